@@ -50,8 +50,13 @@
 //
 // ##################################################################################
 
-// Standard-SPI-Frequenz für Zugriffe auf das Display
-#define SPI_FREQUENCY  27000000   // 27 MHz für ST7796S
+// SPI-Frequenz für Schreibzugriffe auf das Display
+// Der Takt wird beim Start vom Sketch kalibriert und im NVS gespeichert
+// (WindTurbineSpiKalibrierung), daher steht hier eine Variable statt einer Zahl.
+// Startwert und Rückfallwert: 27 MHz (SPI_STANDARD_FREQUENZ in WindTurbineConstants.h)
+#include <stdint.h>
+extern uint32_t tftSpiFrequenz;
+#define SPI_FREQUENCY  tftSpiFrequenz
 
 // Frequenz für Lesezugriffe (normalerweise niedriger)
 #define SPI_READ_FREQUENCY  20000000
@@ -65,12 +70,13 @@
 //
 // ##################################################################################
 
+// Nur GLCD wird verwendet (Rückfall ohne Schriftatlas, siehe WindTurbineSchrift.h)
 #define LOAD_GLCD   // Standard-Adafruit-Schriftart 8x8
-#define LOAD_FONT2  // Small 16 pixel high font
-#define LOAD_FONT4  // Medium 26 pixel high font
-#define LOAD_FONT6  // Large 48 pixel high font
-#define LOAD_FONT7  // 7-segment 48 pixel high font
-#define LOAD_FONT8  // Large 75 pixel high font
+//#define LOAD_FONT2  // Small 16 pixel high font
+//#define LOAD_FONT4  // Medium 26 pixel high font
+//#define LOAD_FONT6  // Large 48 pixel high font
+//#define LOAD_FONT7  // 7-segment 48 pixel high font
+//#define LOAD_FONT8  // Large 75 pixel high font
 //#define LOAD_GFXFF  // FreeFonts (benötigen mehr Speicher)
 
 // ##################################################################################
@@ -0,0 +1,210 @@
+/**
+ * WindTurbineAliasStruktur.cpp
+ * Definierende Relation aus Bitmasken der Planspalten, Aliasketten per XOR
+ */
+
+#include "WindTurbineAliasStruktur.h"
+
+WindTurbineAliasStruktur::WindTurbineAliasStruktur() :
+  faktoren(0),
+  woerterAnzahl(0)
+{
+  for (int i = 0; i < ALIAS_MAX_WOERTER; i++) {
+    woerter[i] = 0;
+    negativ[i] = false;
+  }
+}
+
+/**
+ * Alle Wörter mit konstanter Produktspalte suchen (Gray-Code: ein XOR je Wort)
+ */
+bool WindTurbineAliasStruktur::ausTabelle(const int* stufen, int versuche, int faktoren) {
+  if (versuche < 1 || versuche > 64 || faktoren < 1 || faktoren > EFFEKT_MAX_FAKTOREN) {
+    Serial.println("Aliasstruktur: Plan zu gross");
+    return false;
+  }
+
+  // Spalte als Bitmaske über die Versuche, Bit gesetzt = Stufe -1
+  uint64_t spalten[EFFEKT_MAX_FAKTOREN];
+  for (int f = 0; f < faktoren; f++) {
+    spalten[f] = 0;
+    for (int v = 0; v < versuche; v++) {
+      int stufe = stufen[v * faktoren + f];
+      if (stufe != 1 && stufe != -1) {
+        Serial.println("Aliasstruktur: nur zweistufige Plaene (-1 / 1)");
+        return false;
+      }
+      if (stufe < 0) spalten[f] |= (uint64_t)1 << v;
+    }
+  }
+  uint64_t alle = (versuche == 64) ? ~(uint64_t)0 : (((uint64_t)1 << versuche) - 1);
+
+  this->faktoren = faktoren;
+  woerterAnzahl = 0;
+  uint64_t produkt = 0;
+  for (unsigned i = 1; i < (1u << faktoren); i++) {
+    // Im Gray-Code wechselt das niedrigste gesetzte Bit von i
+    int bit = 0;
+    while (!((i >> bit) & 1)) bit++;
+    produkt ^= spalten[bit];
+
+    if (produkt != 0 && produkt != alle) continue;
+    if (woerterAnzahl >= ALIAS_MAX_WOERTER) {
+      Serial.println("Aliasstruktur: zu viele Woerter");
+      woerterAnzahl = 0;
+      return false;
+    }
+    woerter[woerterAnzahl] = i ^ (i >> 1);
+    negativ[woerterAnzahl] = (produkt == alle);
+    woerterAnzahl++;
+  }
+
+  sortiere();
+  return true;
+}
+
+bool WindTurbineAliasStruktur::setzeRelation(int faktoren, const unsigned* woerter, const bool* negativ, int anzahl) {
+  if (faktoren < 1 || faktoren > EFFEKT_MAX_FAKTOREN || anzahl < 0 || anzahl > ALIAS_MAX_WOERTER) {
+    Serial.println("Aliasstruktur: Relation zu gross");
+    return false;
+  }
+  this->faktoren = faktoren;
+  woerterAnzahl = anzahl;
+  for (int i = 0; i < anzahl; i++) {
+    this->woerter[i] = woerter[i];
+    this->negativ[i] = (negativ != nullptr) && negativ[i];
+  }
+  sortiere();
+  return true;
+}
+
+int WindTurbineAliasStruktur::wortLaenge(unsigned wort) {
+  int laenge = 0;
+  for (; wort != 0; wort >>= 1) laenge += wort & 1;
+  return laenge;
+}
+
+bool WindTurbineAliasStruktur::kuerzer(unsigned a, unsigned b) {
+  int la = wortLaenge(a);
+  int lb = wortLaenge(b);
+  return la < lb || (la == lb && a < b);
+}
+
+// Relation nach Länge, dann nach Wort (Einfügesortierung)
+void WindTurbineAliasStruktur::sortiere() {
+  for (int i = 1; i < woerterAnzahl; i++) {
+    unsigned wort = woerter[i];
+    bool minus = negativ[i];
+    int pos = i;
+    while (pos > 0 && kuerzer(wort, woerter[pos - 1])) {
+      woerter[pos] = woerter[pos - 1];
+      negativ[pos] = negativ[pos - 1];
+      pos--;
+    }
+    woerter[pos] = wort;
+    negativ[pos] = minus;
+  }
+}
+
+int WindTurbineAliasStruktur::anzahlFaktoren() const {
+  return faktoren;
+}
+
+int WindTurbineAliasStruktur::anzahlWoerter() const {
+  return woerterAnzahl;
+}
+
+unsigned WindTurbineAliasStruktur::definierendesWort(int index) const {
+  return (index >= 0 && index < woerterAnzahl) ? woerter[index] : 0;
+}
+
+bool WindTurbineAliasStruktur::istNegativ(int index) const {
+  return index >= 0 && index < woerterAnzahl && negativ[index];
+}
+
+int WindTurbineAliasStruktur::aufloesung() const {
+  // Relation ist sortiert, das erste Wort ist das kürzeste
+  return woerterAnzahl > 0 ? wortLaenge(woerter[0]) : 0;
+}
+
+int WindTurbineAliasStruktur::aliasKette(unsigned effekt, unsigned* kette, bool* minus, int maxAnzahl) const {
+  int anzahl = 0;
+  for (int i = -1; i < woerterAnzahl; i++) {
+    unsigned wort = (i < 0) ? effekt : (effekt ^ woerter[i]);
+    bool vorzeichen = (i >= 0) && negativ[i];
+
+    // Nach Länge einfügen; bei gleicher Länge bleibt die bisherige Reihenfolge
+    int pos = anzahl;
+    while (pos > 0 && wortLaenge(wort) < wortLaenge(kette[pos - 1])) {
+      if (pos < maxAnzahl) {
+        kette[pos] = kette[pos - 1];
+        minus[pos] = minus[pos - 1];
+      }
+      pos--;
+    }
+    if (pos < maxAnzahl) {
+      kette[pos] = wort;
+      minus[pos] = vorzeichen;
+      if (anzahl < maxAnzahl) anzahl++;
+    }
+  }
+  return anzahl;
+}
+
+void WindTurbineAliasStruktur::formatiereKette(unsigned effekt, char* puffer, int groesse, int maxOrdnung) const {
+  if (groesse < 1) return;
+  unsigned kette[ALIAS_MAX_WOERTER + 1];
+  bool minus[ALIAS_MAX_WOERTER + 1];
+  int anzahl = aliasKette(effekt, kette, minus, ALIAS_MAX_WOERTER + 1);
+
+  int n = 0;
+  puffer[0] = '\0';
+  for (int i = 0; i < anzahl; i++) {
+    if (i > 0 && maxOrdnung > 0 && wortLaenge(kette[i]) > maxOrdnung) continue;
+
+    char name[EFFEKT_MAX_FAKTOREN + 1];
+    wortName(kette[i], name, sizeof(name));
+    int laenge = snprintf(puffer + n, groesse - n, "%s%s%s", n > 0 ? "=" : "", minus[i] ? "-" : "", name);
+    if (laenge < 0 || n + laenge >= groesse) {
+      puffer[n] = '\0';
+      return;
+    }
+    n += laenge;
+  }
+}
+
+void WindTurbineAliasStruktur::formatiereRelation(char* puffer, int groesse) const {
+  if (groesse < 2) return;
+  int n = snprintf(puffer, groesse, "I");
+  for (int i = 0; i < woerterAnzahl && n < groesse; i++) {
+    char name[EFFEKT_MAX_FAKTOREN + 1];
+    wortName(woerter[i], name, sizeof(name));
+    int laenge = snprintf(puffer + n, groesse - n, "=%s%s", negativ[i] ? "-" : "", name);
+    if (laenge < 0 || n + laenge >= groesse) {
+      puffer[n] = '\0';
+      return;
+    }
+    n += laenge;
+  }
+}
+
+void WindTurbineAliasStruktur::wortName(unsigned wort, char* puffer, int groesse) {
+  if (groesse < 1) return;
+  if (wort == 0 && groesse > 1) {
+    // Mit dem Gesamtmittelwert vermengt
+    puffer[0] = 'I';
+    puffer[1] = '\0';
+    return;
+  }
+  int n = 0;
+  for (int f = 0; wort != 0 && n < groesse - 1; f++, wort >>= 1) {
+    if (wort & 1) puffer[n++] = 'A' + f;
+  }
+  puffer[n] = '\0';
+}
+
+const char* WindTurbineAliasStruktur::aufloesungText(int aufloesung) {
+  static const char* roemisch[] = {"voll", "I", "II", "III", "IV", "V", "VI", "VII", "VIII"};
+  if (aufloesung < 0 || aufloesung > 8) return "?";
+  return roemisch[aufloesung];
+}
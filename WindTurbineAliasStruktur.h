@@ -0,0 +1,88 @@
+/**
+ * WindTurbineAliasStruktur.h
+ * Vermengungsstruktur (Aliasketten) zweistufiger Teilpläne
+ *
+ * Ein Wort ist eine Bitmaske über die Faktoren (0x1 = A, 0x2 = B, ...) und steht
+ * für das Produkt ihrer Spalten. Die definierende Relation enthält alle Wörter,
+ * deren Produktspalte in jedem Versuch denselben Wert hat (I = W bzw. I = -W).
+ * Der Effekt E ist dann mit E*W = E XOR W vermengt; die Aliaskette von E ist
+ * E zusammen mit allen E XOR W. Die Auflösung ist die Länge des kürzesten Worts.
+ *
+ * ausTabelle() leitet die Relation aus einer beliebigen Plantabelle ab: Jede Spalte
+ * wird zu einer Bitmaske über die Versuche (Bit gesetzt = niedrige Stufe), die
+ * Produktspalte eines Worts ist das XOR seiner Spalten. Alle 2^K Wörter werden in
+ * Gray-Code-Reihenfolge durchlaufen, so dass jedes Wort nur ein XOR kostet.
+ * Für die eingebauten Pläne steht die Relation schon zur Übersetzungszeit fest
+ * (Versuchsplan2kp::definierendesWort) und wird mit setzePlan() übernommen.
+ *
+ * Nur reguläre Pläne (Spalten vollständig vermengt oder orthogonal) werden
+ * richtig beschrieben; teilweise Vermengung wie bei Plackett-Burman nicht.
+ */
+
+#ifndef WIND_TURBINE_ALIAS_STRUKTUR_H
+#define WIND_TURBINE_ALIAS_STRUKTUR_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+
+class WindTurbineAliasStruktur {
+public:
+  // Konstruktor
+  WindTurbineAliasStruktur();
+
+  // Relation aus einer Plantabelle ableiten
+  // @param stufen -1 / 1 je [Versuch * faktoren + Faktor]
+  bool ausTabelle(const int* stufen, int versuche, int faktoren);
+
+  // Relation eines eingebauten Plans (zur Übersetzungszeit berechnet)
+  template <class Plan>
+  bool setzePlan() {
+    unsigned woerter[Plan::RELATIONSWOERTER > 0 ? Plan::RELATIONSWOERTER : 1];
+    for (int i = 0; i < Plan::RELATIONSWOERTER; i++) {
+      woerter[i] = Plan::definierendesWort(i);
+    }
+    return setzeRelation(Plan::FAKTOREN, woerter, nullptr, Plan::RELATIONSWOERTER);
+  }
+
+  // Relation direkt setzen
+  // @param negativ Vorzeichen je Wort (I = -W), nullptr = alle positiv
+  bool setzeRelation(int faktoren, const unsigned* woerter, const bool* negativ, int anzahl);
+
+  int anzahlFaktoren() const;
+  int anzahlWoerter() const;
+  unsigned definierendesWort(int index) const;
+  bool istNegativ(int index) const;
+
+  // Auflösung (3 = III, ...), 0 = keine Vermengung
+  int aufloesung() const;
+
+  // Aliaskette eines Effekts, nach Wortlänge sortiert (der Effekt selbst zuerst bei gleicher Länge)
+  // @return Anzahl der Wörter (höchstens maxAnzahl)
+  int aliasKette(unsigned effekt, unsigned* woerter, bool* negativ, int maxAnzahl) const;
+
+  // Aliaskette als Text, z.B. "A=BD=CE"
+  // @param maxOrdnung nur Wörter bis zu dieser Länge (0 = alle), das erste Wort immer
+  void formatiereKette(unsigned effekt, char* puffer, int groesse, int maxOrdnung = 0) const;
+
+  // Relation als Text, z.B. "I=ABD=ACE=BCDE"
+  void formatiereRelation(char* puffer, int groesse) const;
+
+  // Faktoren eines Worts als Buchstaben, z.B. 0x5 -> "AC"
+  static void wortName(unsigned wort, char* puffer, int groesse);
+
+  // Auflösung als römische Zahl ("III", "IV", ...), "voll" ohne Vermengung
+  static const char* aufloesungText(int aufloesung);
+
+  static int wortLaenge(unsigned wort);
+
+private:
+  int faktoren;
+  int woerterAnzahl;
+  unsigned woerter[ALIAS_MAX_WOERTER];
+  bool negativ[ALIAS_MAX_WOERTER];
+
+  void sortiere();
+  static bool kuerzer(unsigned a, unsigned b);
+};
+
+#endif // WIND_TURBINE_ALIAS_STRUKTUR_H
@@ -0,0 +1,262 @@
+/**
+ * WindTurbineAnova.cpp
+ * Quadratsummen, F-Tests und p-Werte über die unvollständige Betafunktion
+ */
+
+#include "WindTurbineAnova.h"
+
+// Kettenbruch der unvollständigen Betafunktion
+#define ANOVA_KETTENBRUCH_MAX 200
+#define ANOVA_KETTENBRUCH_GENAUIGKEIT 1e-10
+#define ANOVA_KETTENBRUCH_MINIMUM 1e-30
+
+// Quantilsuche der t-Verteilung
+#define ANOVA_QUANTIL_MAXIMUM 1000.0
+#define ANOVA_QUANTIL_SCHRITTE 60
+
+/**
+ * ln Gamma(x) für x > 0 nach Lanczos (6 Koeffizienten, Fehler < 2e-10)
+ */
+static double lnGamma(double x) {
+  static const double koeffizienten[6] = {
+    76.18009172947146, -86.50532032941677, 24.01409824083091,
+    -1.231739572450155, 0.1208650973866179e-2, -0.5395239384953e-5
+  };
+  double y = x;
+  double tmp = x + 5.5;
+  tmp -= (x + 0.5) * log(tmp);
+  double reihe = 1.000000000190015;
+  for (int j = 0; j < 6; j++) {
+    reihe += koeffizienten[j] / ++y;
+  }
+  return -tmp + log(2.5066282746310005 * reihe / x);
+}
+
+/**
+ * Kettenbruch der unvollständigen Betafunktion (modifizierter Lentz-Algorithmus)
+ */
+static double betaKettenbruch(double a, double b, double x) {
+  double qab = a + b;
+  double qap = a + 1.0;
+  double qam = a - 1.0;
+  double c = 1.0;
+  double d = 1.0 - qab * x / qap;
+  if (fabs(d) < ANOVA_KETTENBRUCH_MINIMUM) d = ANOVA_KETTENBRUCH_MINIMUM;
+  d = 1.0 / d;
+  double h = d;
+
+  for (int m = 1; m <= ANOVA_KETTENBRUCH_MAX; m++) {
+    int m2 = 2 * m;
+
+    // Gerades Glied
+    double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+    d = 1.0 + aa * d;
+    if (fabs(d) < ANOVA_KETTENBRUCH_MINIMUM) d = ANOVA_KETTENBRUCH_MINIMUM;
+    c = 1.0 + aa / c;
+    if (fabs(c) < ANOVA_KETTENBRUCH_MINIMUM) c = ANOVA_KETTENBRUCH_MINIMUM;
+    d = 1.0 / d;
+    h *= d * c;
+
+    // Ungerades Glied
+    aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+    d = 1.0 + aa * d;
+    if (fabs(d) < ANOVA_KETTENBRUCH_MINIMUM) d = ANOVA_KETTENBRUCH_MINIMUM;
+    c = 1.0 + aa / c;
+    if (fabs(c) < ANOVA_KETTENBRUCH_MINIMUM) c = ANOVA_KETTENBRUCH_MINIMUM;
+    d = 1.0 / d;
+    double delta = d * c;
+    h *= delta;
+
+    if (fabs(delta - 1.0) < ANOVA_KETTENBRUCH_GENAUIGKEIT) break;
+  }
+  return h;
+}
+
+/**
+ * Regularisierte unvollständige Betafunktion I_x(a, b)
+ * Der Kettenbruch konvergiert für x < (a+1)/(a+b+2) schnell, sonst über die Symmetrie.
+ */
+static double unvollstaendigeBeta(double a, double b, double x) {
+  if (x <= 0.0) return 0.0;
+  if (x >= 1.0) return 1.0;
+
+  double vorfaktor = exp(lnGamma(a + b) - lnGamma(a) - lnGamma(b) + a * log(x) + b * log(1.0 - x));
+  if (x < (a + 1.0) / (a + b + 2.0)) {
+    return vorfaktor * betaKettenbruch(a, b, x) / a;
+  }
+  return 1.0 - vorfaktor * betaKettenbruch(b, a, 1.0 - x) / b;
+}
+
+float WindTurbineAnova::pWertF(float f, int fg1, int fg2) {
+  if (fg1 < 1 || fg2 < 1) return 1;
+  if (f <= 0) return 1;
+  // P(F > f) = I_{fg2/(fg2 + fg1 f)}(fg2/2, fg1/2)
+  return unvollstaendigeBeta(fg2 / 2.0, fg1 / 2.0, fg2 / (fg2 + fg1 * (double)f));
+}
+
+float WindTurbineAnova::pWertT(float t, float fg) {
+  if (fg <= 0) return 1;
+  // P(|T| > |t|) = I_{fg/(fg + t²)}(fg/2, 1/2)
+  return unvollstaendigeBeta(fg / 2.0, 0.5, fg / (fg + (double)t * t));
+}
+
+/**
+ * pWertT fällt in t monoton: Intervall [0, ANOVA_QUANTIL_MAXIMUM] halbieren
+ */
+float WindTurbineAnova::quantilT(float pZweiseitig, float fg) {
+  if (fg <= 0 || pZweiseitig <= 0 || pZweiseitig >= 1) return 0;
+  double unten = 0.0;
+  double oben = ANOVA_QUANTIL_MAXIMUM;
+  for (int i = 0; i < ANOVA_QUANTIL_SCHRITTE; i++) {
+    double mitte = 0.5 * (unten + oben);
+    if (pWertT(mitte, fg) > pZweiseitig) {
+      unten = mitte;
+    } else {
+      oben = mitte;
+    }
+  }
+  return 0.5 * (unten + oben);
+}
+
+static void leereZeile(AnovaZeile& zeile) {
+  zeile.wort = 0;
+  zeile.faktor = -1;
+  zeile.effekt = 0;
+  zeile.quadratsumme = 0;
+  zeile.freiheitsgrade = 0;
+  zeile.mittleresQuadrat = 0;
+  zeile.t = 0;
+  zeile.f = 0;
+  zeile.p = 1;
+}
+
+WindTurbineAnova::WindTurbineAnova() :
+  gueltig(false),
+  pruefung(false),
+  effekte(0)
+{
+  for (int i = 0; i < EFFEKT_MAX_VERSUCHE - 1; i++) leereZeile(zeilen[i]);
+  leereZeile(modell);
+  leereZeile(rest);
+  leereZeile(gesamt);
+}
+
+/**
+ * Quadratsummen je Wort, Modell, Rest und Gesamt; F-Tests gegen den reinen Fehler
+ */
+bool WindTurbineAnova::berechne(const WindTurbineEffektAnalyse& analyse) {
+  gueltig = false;
+  if (!analyse.istGueltig()) return false;
+
+  effekte = analyse.anzahlVersuche() - 1;
+  leereZeile(modell);
+  leereZeile(rest);
+  leereZeile(gesamt);
+
+  rest.freiheitsgrade = analyse.freiheitsgrade();
+  rest.mittleresQuadrat = analyse.reststreuung();
+  rest.quadratsumme = rest.mittleresQuadrat * rest.freiheitsgrade;
+  pruefung = rest.freiheitsgrade > 0 && rest.mittleresQuadrat > 0;
+  float fehler = analyse.standardfehler();
+
+  for (int i = 0; i < effekte; i++) {
+    AnovaZeile& zeile = zeilen[i];
+    leereZeile(zeile);
+    zeile.wort = i + 1;
+    for (int f = 0; f < analyse.anzahlFaktoren(); f++) {
+      if (analyse.wort(f) == zeile.wort) zeile.faktor = f;
+    }
+    zeile.effekt = analyse.effekt(zeile.wort);
+    zeile.quadratsumme = analyse.quadratsumme(zeile.wort);
+    zeile.freiheitsgrade = 1;
+    zeile.mittleresQuadrat = zeile.quadratsumme;
+    if (pruefung) {
+      // Ein Freiheitsgrad: F = t², p aus der t-Verteilung
+      zeile.t = zeile.effekt / fehler;
+      zeile.f = zeile.mittleresQuadrat / rest.mittleresQuadrat;
+      zeile.p = pWertT(zeile.t, rest.freiheitsgrade);
+    }
+    modell.quadratsumme += zeile.quadratsumme;
+  }
+
+  modell.freiheitsgrade = effekte;
+  modell.mittleresQuadrat = effekte > 0 ? modell.quadratsumme / effekte : 0;
+  if (pruefung) {
+    modell.f = modell.mittleresQuadrat / rest.mittleresQuadrat;
+    modell.p = pWertF(modell.f, modell.freiheitsgrade, rest.freiheitsgrade);
+  }
+
+  gesamt.quadratsumme = modell.quadratsumme + rest.quadratsumme;
+  gesamt.freiheitsgrade = modell.freiheitsgrade + rest.freiheitsgrade;
+
+  gueltig = true;
+  return true;
+}
+
+bool WindTurbineAnova::istGueltig() const {
+  return gueltig;
+}
+
+bool WindTurbineAnova::hatPruefung() const {
+  return gueltig && pruefung;
+}
+
+int WindTurbineAnova::anzahlEffekte() const {
+  return gueltig ? effekte : 0;
+}
+
+const AnovaZeile& WindTurbineAnova::effektZeile(int index) const {
+  if (index < 0 || index >= effekte) return gesamt;
+  return zeilen[index];
+}
+
+const AnovaZeile& WindTurbineAnova::modellZeile() const {
+  return modell;
+}
+
+const AnovaZeile& WindTurbineAnova::restZeile() const {
+  return rest;
+}
+
+const AnovaZeile& WindTurbineAnova::gesamtZeile() const {
+  return gesamt;
+}
+
+float WindTurbineAnova::pWertFaktor(int faktor) const {
+  if (!hatPruefung()) return 1;
+  for (int i = 0; i < effekte; i++) {
+    if (zeilen[i].faktor == faktor) return zeilen[i].p;
+  }
+  return 1;
+}
+
+bool WindTurbineAnova::istSignifikant(int faktor, float alpha) const {
+  return hatPruefung() && pWertFaktor(faktor) < alpha;
+}
+
+void WindTurbineAnova::sortiereFaktoren(int* reihenfolge, int anzahl) const {
+  float betrag[EFFEKT_MAX_FAKTOREN];
+  float p[EFFEKT_MAX_FAKTOREN];
+  for (int i = 0; i < anzahl && i < EFFEKT_MAX_FAKTOREN; i++) {
+    reihenfolge[i] = i;
+    betrag[i] = 0;
+    p[i] = pWertFaktor(i);
+    for (int j = 0; j < effekte; j++) {
+      if (zeilen[j].faktor == i) betrag[i] = fabs(zeilen[j].effekt);
+    }
+  }
+
+  // Einfügesortierung (wenige Faktoren)
+  for (int i = 1; i < anzahl && i < EFFEKT_MAX_FAKTOREN; i++) {
+    int faktor = reihenfolge[i];
+    int pos = i;
+    while (pos > 0) {
+      int vorher = reihenfolge[pos - 1];
+      bool davor = p[faktor] < p[vorher] || (p[faktor] == p[vorher] && betrag[faktor] > betrag[vorher]);
+      if (!davor) break;
+      reihenfolge[pos] = vorher;
+      pos--;
+    }
+    reihenfolge[pos] = faktor;
+  }
+}
@@ -0,0 +1,83 @@
+/**
+ * WindTurbineAnova.h
+ * Varianzanalyse eines zweistufigen Plans mit F-Tests und p-Werten
+ *
+ * Grundlage sind die Effekte aus WindTurbineEffektAnalyse. Jedes Wort (Haupteffekt
+ * bzw. Wechselwirkung, im Teilplan samt Vermengungen) hat einen Freiheitsgrad und
+ * die Quadratsumme N * r * Effekt² / 4. Geprüft wird gegen die Streuung der
+ * Wiederholungen innerhalb der Versuche (reiner Fehler): F = MQ / MQ_Rest.
+ * Die Modellzeile fasst alle Wörter zusammen (N-1 Freiheitsgrade).
+ *
+ * Die p-Werte kommen aus der regularisierten unvollständigen Betafunktion
+ * (Kettenbruch nach Lentz, ln Gamma nach Lanczos); Tabellen werden keine benötigt.
+ * Für ein Wort mit einem Freiheitsgrad ist der F-Test gleichwertig zum
+ * zweiseitigen t-Test mit t = Effekt / Standardfehler.
+ *
+ * Ohne verwertbare Wiederholungen (z.B. Mittelwerte manuell eingegeben) gibt es
+ * keine Prüfung: Quadratsummen werden trotzdem berechnet, F = 0 und p = 1.
+ */
+
+#ifndef WIND_TURBINE_ANOVA_H
+#define WIND_TURBINE_ANOVA_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineEffektAnalyse.h"
+
+// Eine Zeile der ANOVA-Tabelle
+struct AnovaZeile {
+  unsigned wort;          // Effektwort, 0 für Modell, Rest und Gesamt
+  int faktor;             // Faktor mit diesem Spaltenwort, sonst -1
+  float effekt;
+  float quadratsumme;
+  int freiheitsgrade;
+  float mittleresQuadrat;
+  float t;                // Effekt / Standardfehler (nur Effektzeilen)
+  float f;
+  float p;
+};
+
+class WindTurbineAnova {
+public:
+  // Konstruktor
+  WindTurbineAnova();
+
+  // Tabelle aus einer berechneten Effektanalyse aufstellen
+  bool berechne(const WindTurbineEffektAnalyse& analyse);
+
+  bool istGueltig() const;
+  // Reststreuung mit Freiheitsgraden vorhanden, F-Tests möglich
+  bool hatPruefung() const;
+
+  // Effektzeilen nach Wort geordnet (Wort = index + 1)
+  int anzahlEffekte() const;
+  const AnovaZeile& effektZeile(int index) const;
+  const AnovaZeile& modellZeile() const;
+  const AnovaZeile& restZeile() const;
+  const AnovaZeile& gesamtZeile() const;
+
+  // p-Wert des Haupteffekts eines Faktors (1 ohne Prüfung)
+  float pWertFaktor(int faktor) const;
+  bool istSignifikant(int faktor, float alpha = ANOVA_ALPHA) const;
+
+  // Faktoren nach p-Wert aufsteigend, bei gleichem p (oder ohne Prüfung) nach Betrag des Effekts
+  void sortiereFaktoren(int* reihenfolge, int anzahl) const;
+
+  // Überschreitungswahrscheinlichkeit P(F > f) bei (fg1, fg2) Freiheitsgraden
+  static float pWertF(float f, int fg1, int fg2);
+  // Zweiseitiger p-Wert P(|T| > |t|) bei fg Freiheitsgraden (auch nicht ganzzahlig)
+  static float pWertT(float t, float fg);
+  // Quantil t mit P(|T| > t) = pZweiseitig (Bisektion über pWertT)
+  static float quantilT(float pZweiseitig, float fg);
+
+private:
+  bool gueltig;
+  bool pruefung;
+  int effekte;
+  AnovaZeile zeilen[EFFEKT_MAX_VERSUCHE - 1];
+  AnovaZeile modell;
+  AnovaZeile rest;
+  AnovaZeile gesamt;
+};
+
+#endif // WIND_TURBINE_ANOVA_H
@@ -0,0 +1,269 @@
+/**
+ * WindTurbineBenchmark.cpp
+ * Render-Benchmark: Zeit, Zeichenaufrufe und SPI-Bytes pro Bildschirm
+ *
+ * Jeder Bildschirm wird mit festen Testdaten zweimal gezeichnet (kalt und
+ * warm, z.B. mit bereits gespeichertem Hintergrund). Die Ergebnisse gehen als
+ * Tabelle über Serial und als CSV nach SPIFFS, damit sich Änderungen am
+ * Zeichnen vorher/nachher vergleichen lassen.
+ */
+
+#include "WindTurbineExperiment.h"
+#include "WindTurbineRenderZaehler.h"
+
+// Ein Eintrag der Benchmark-Tabelle
+struct RenderMessung {
+  const char* name;
+  unsigned long kaltUs = 0;
+  unsigned long warmUs = 0;
+  RenderStatistik statistik = {}; // Zählung des warmen Durchlaufs
+};
+
+/**
+ * Füllt alle Messdaten mit reproduzierbaren Werten
+ * Die Leistung hängt von den Faktorstufen ab, damit die Diagramme
+ * unterschiedlich große Effekte zeigen.
+ */
+static void fuelleTestdaten(float messungen[8][5], float mittelwerte[8], float standardabweichungen[8], float versatz) {
+  for (int i = 0; i < 8; i++) {
+    float basis = 120.0 + versatz + 35.0 * (i & 1) + 18.0 * ((i >> 1) & 1) - 9.0 * ((i >> 2) & 1);
+    float summe = 0;
+    for (int j = 0; j < 5; j++) {
+      messungen[i][j] = basis + ((i * 7 + j * 3) % 5 - 2) * 1.5;
+      summe += messungen[i][j];
+    }
+    mittelwerte[i] = summe / 5;
+
+    float quadratsumme = 0;
+    for (int j = 0; j < 5; j++) {
+      float abweichung = messungen[i][j] - mittelwerte[i];
+      quadratsumme += abweichung * abweichung;
+    }
+    standardabweichungen[i] = sqrt(quadratsumme / 4);
+  }
+}
+
+/**
+ * Misst alle nicht blockierenden Bildschirme und Diagramme
+ * Die aktuellen Versuchsdaten werden vorher gesichert und danach
+ * wiederhergestellt.
+ * @param nachBildschirm optional, z.B. für Bildschirmfotos im Host-Build
+ */
+void WindTurbineExperiment::fuehreRenderBenchmarkDurch(BildschirmGezeichnet nachBildschirm, void* kontext) {
+  Serial.println("Render-Benchmark startet...");
+
+  // Aktuellen Zustand sichern
+  float sicherungTeil[8][5], sicherungTeilMittel[8], sicherungTeilStd[8];
+  float sicherungVoll[8][5], sicherungVollMittel[8], sicherungVollStd[8];
+  float sicherungZzp[ZZP_MAX_ERGAENZUNG][5], sicherungZzpMittel[ZZP_MAX_ERGAENZUNG], sicherungZzpStd[ZZP_MAX_ERGAENZUNG];
+  float sicherungFalt[8][5], sicherungFaltMittel[8], sicherungFaltStd[8];
+  float sicherungEffekte[5];
+  int sicherungVollfaktoren[3], sicherungFixiert[5];
+  memcpy(sicherungTeil, teilfaktoriellMessungen, sizeof(sicherungTeil));
+  memcpy(sicherungTeilMittel, teilfaktoriellMittelwerte, sizeof(sicherungTeilMittel));
+  memcpy(sicherungTeilStd, teilfaktoriellStandardabweichungen, sizeof(sicherungTeilStd));
+  memcpy(sicherungVoll, vollfaktoriellMessungen, sizeof(sicherungVoll));
+  memcpy(sicherungVollMittel, vollfaktoriellMittelwerte, sizeof(sicherungVollMittel));
+  memcpy(sicherungVollStd, vollfaktoriellStandardabweichungen, sizeof(sicherungVollStd));
+  memcpy(sicherungZzp, zzpMessungen, sizeof(sicherungZzp));
+  memcpy(sicherungZzpMittel, zzpMittelwerte, sizeof(sicherungZzpMittel));
+  memcpy(sicherungZzpStd, zzpStandardabweichungen, sizeof(sicherungZzpStd));
+  WindTurbineWirkungsflaeche sicherungFlaeche = wirkungsflaeche;
+  memcpy(sicherungFalt, faltMessungen, sizeof(sicherungFalt));
+  memcpy(sicherungFaltMittel, faltMittelwerte, sizeof(sicherungFaltMittel));
+  memcpy(sicherungFaltStd, faltStandardabweichungen, sizeof(sicherungFaltStd));
+  WindTurbineFaltung sicherungFaltung = faltung;
+  memcpy(sicherungEffekte, effekte, sizeof(sicherungEffekte));
+  memcpy(sicherungVollfaktoren, ausgewaehlteVollfaktoren, sizeof(sicherungVollfaktoren));
+  memcpy(sicherungFixiert, fixierteFaktorwerte, sizeof(sicherungFixiert));
+  ProgrammModus sicherungModus = aktuellerModus;
+  ProgrammModus sicherungVorheriger = vorherigerModus;
+  int sicherungVersuch = aktuellerVersuch;
+  int sicherungMessung = aktuelleMessung;
+  int sicherungCursor = cursorPosition;
+  bool sicherungZwischenstand = zwischenstandAnsicht;
+
+  // Ab hier keine Animationspausen und kein automatisches Speichern
+  renderBenchmarkAktiv = true;
+
+  // Testdaten: alle Versuche vollständig gemessen
+  fuelleTestdaten(teilfaktoriellMessungen, teilfaktoriellMittelwerte, teilfaktoriellStandardabweichungen, 0);
+  fuelleTestdaten(vollfaktoriellMessungen, vollfaktoriellMittelwerte, vollfaktoriellStandardabweichungen, 12);
+  aktuellerVersuch = 7;
+  aktuelleMessung = 5;
+  cursorPosition = 0;
+  berechneEffekte();
+
+  // Die drei wichtigsten Faktoren wie in bestimmeWichtigsteFaktoren() wählen,
+  // ohne deren Anzeige und das Warten auf den Drehknopf
+  int reihenfolge[5];
+  waehleVollfaktoren(reihenfolge);
+  
+  // Ergänzung zum Würfel: Kuppe in den stetigen Faktoren, an den Würfelecken 0
+  bereiteZzpVor();
+  const float kuppe[3] = {30.0, 12.0, 12.0};
+  for (int v = 0; v < wirkungsflaeche.anzahlErgaenzung(); v++) {
+    float basis = 132.0 + 17.5 * (wirkungsflaeche.stufe(v, 0) + 1) + 9.0 * (wirkungsflaeche.stufe(v, 1) + 1) - 4.5 * (wirkungsflaeche.stufe(v, 2) + 1);
+    for (int k = 0; k < 3; k++) {
+      float x = wirkungsflaeche.stufe(v, k);
+      if (wirkungsflaeche.istStetig(k)) basis += kuppe[k] * (1 - x * x);
+    }
+    float summe = 0;
+    for (int j = 0; j < 5; j++) {
+      zzpMessungen[v][j] = basis + ((v * 5 + j * 3) % 5 - 2) * 1.5;
+      summe += zzpMessungen[v][j];
+    }
+    zzpMittelwerte[v] = summe / 5;
+    float quadratsumme = 0;
+    for (int j = 0; j < 5; j++) {
+      quadratsumme += (zzpMessungen[v][j] - zzpMittelwerte[v]) * (zzpMessungen[v][j] - zzpMittelwerte[v]);
+    }
+    zzpStandardabweichungen[v] = sqrt(quadratsumme / 4);
+  }
+
+  // Spiegelung des Teilplans: gleiches Modell wie die Testdaten, Block um 2 uW versetzt
+  bereiteFaltungVor(FALTUNG_SPIEGELUNG);
+  for (int v = 0; v < faltung.anzahlVersuche(); v++) {
+    float basis = 118.0 + 17.5 * (faltung.stufe(v, 0) + 1) + 9.0 * (faltung.stufe(v, 1) + 1) - 4.5 * (faltung.stufe(v, 2) + 1);
+    float summe = 0;
+    for (int j = 0; j < 5; j++) {
+      faltMessungen[v][j] = basis + ((v * 7 + j * 3 + 1) % 5 - 2) * 1.5;
+      summe += faltMessungen[v][j];
+    }
+    faltMittelwerte[v] = summe / 5;
+    float quadratsumme = 0;
+    for (int j = 0; j < 5; j++) {
+      quadratsumme += (faltMessungen[v][j] - faltMittelwerte[v]) * (faltMessungen[v][j] - faltMittelwerte[v]);
+    }
+    faltStandardabweichungen[v] = sqrt(quadratsumme / 4);
+  }
+
+  RenderMessung messungen[] = {
+    {"Intro"}, {"Teilfaktoriell_Plan"}, {"Teilfaktoriell_Messung"}, {"Teilfaktoriell_Auswertung"},
+    {"Vollfaktoriell_Plan"}, {"Vollfaktoriell_Messung"}, {"Vollfaktoriell_Auswertung"},
+    {"Regression"}, {"Zusammenfassung"},
+    {"Diagramm_Haupteffekte"}, {"Diagramm_Interaktion"}, {"Diagramm_Effekte"},
+    {"Diagramm_Vollfaktoriell"}, {"Diagramm_Pareto"},
+    {"Zwischenstand"}, {"Zwischenstand_Versuch"}, {"Anova_Tabelle"},
+    {"ZZP_Plan"}, {"ZZP_Messung"}, {"ZZP_Auswertung"}, {"Diagramm_Halbnormal"},
+    {"Faltung_Plan"}, {"Faltung_Messung"}, {"Faltung_Auswertung"}
+  };
+  const int anzahl = sizeof(messungen) / sizeof(messungen[0]);
+
+  for (int m = 0; m < anzahl; m++) {
+    for (int durchlauf = 0; durchlauf < 2; durchlauf++) {
+      // Zwischenstand mit 7 Versuchen anzeigen, gemessen wird nur das Nachtragen des 8.
+      zwischenstandAnsicht = (m == 14 || m == 15);
+      if (m == 14 || m == 15) {
+        aktuellerVersuch = 7;
+        aktuelleMessung = 5;
+      }
+      if (m == 15) {
+        zeigeZwischenstand();
+      }
+
+      WindTurbineRenderZaehler::starte();
+      unsigned long start = micros();
+
+      switch (m) {
+        case 0: zeigeIntro(); break;
+        case 1: zeigeTeilfaktoriellPlan(); break;
+        case 2: zeigeTeilfaktoriellMessung(); break;
+        case 3: zeigeTeilfaktoriellAuswertung(); break;
+        case 4: zeigeVollfaktoriellPlan(); break;
+        case 5: zeigeVollfaktoriellMessung(); break;
+        case 6: zeigeVollfaktoriellAuswertung(); break;
+        case 7: zeigeRegressionModell(); break;
+        case 8: zeigeZusammenfassung(); break;
+        case 9: tft.fillScreen(TFT_BACKGROUND); zeigeHaupteffekteDiagramm(); break;
+        case 10: tft.fillScreen(TFT_BACKGROUND); zeigeInteraktionsDiagramm(); break;
+        case 11: tft.fillScreen(TFT_BACKGROUND); zeigeEffekteDiagramm(340, 170); break;
+        case 12: tft.fillScreen(TFT_BACKGROUND); zeigeVollfaktoriellDiagramm(340, 230); break;
+        case 13: tft.fillScreen(TFT_BACKGROUND); zeigeParetoEffekteDiagramm(340, 230); break;
+        case 14: zeigeZwischenstand(); break;
+        case 15:
+          zwischenstand.setzeVersuch(7, teilfaktoriellPlan[7], teilfaktoriellMittelwerte[7]);
+          aktualisiereZwischenstand();
+          break;
+        case 16: zeigeAnovaTabelle(); break;
+        case 17: zeigeZzpPlan(); break;
+        case 18: aktuellerVersuch = 2; aktuelleMessung = 5; zeigeZzpMessung(); break;
+        case 19: zeigeZzpAuswertung(); break;
+        case 20: tft.fillScreen(TFT_BACKGROUND); zeigeHalbnormalDiagramm(340, 230); break;
+        case 21: zeigeFaltungPlan(); break;
+        case 22: aktuellerVersuch = 3; aktuelleMessung = 5; zeigeFaltungMessung(); break;
+        case 23: zeigeFaltungAuswertung(); break;
+      }
+
+      unsigned long dauer = micros() - start;
+      RenderStatistik statistik = WindTurbineRenderZaehler::beende();
+      if (durchlauf == 0) {
+        messungen[m].kaltUs = dauer;
+      } else {
+        messungen[m].warmUs = dauer;
+        messungen[m].statistik = statistik;
+      }
+
+      if (nachBildschirm != nullptr) {
+        nachBildschirm(messungen[m].name, durchlauf == 1, kontext);
+      }
+    }
+  }
+
+  renderBenchmarkAktiv = false;
+  zwischenstandAnsicht = sicherungZwischenstand;
+
+  // Tabelle über Serial und als CSV ausgeben
+  File datei = SPIFFS.open("/render_benchmark.csv", FILE_WRITE);
+  if (!datei) {
+    Serial.println("Render-Benchmark: CSV konnte nicht angelegt werden");
+  }
+
+  const char* kopf = "Bildschirm;Zeit_kalt_ms;Zeit_ms;Aufrufe;Pixel;Bytes";
+  Serial.println(kopf);
+  if (datei) datei.println(kopf);
+
+  char zeile[96];
+  for (int m = 0; m < anzahl; m++) {
+    snprintf(zeile, sizeof(zeile), "%s;%.2f;%.2f;%lu;%lu;%lu",
+             messungen[m].name,
+             messungen[m].kaltUs / 1000.0,
+             messungen[m].warmUs / 1000.0,
+             (unsigned long)messungen[m].statistik.aufrufe,
+             (unsigned long)messungen[m].statistik.pixel,
+             (unsigned long)messungen[m].statistik.bytes);
+    Serial.println(zeile);
+    if (datei) datei.println(zeile);
+  }
+
+  if (datei) {
+    datei.close();
+    Serial.println("Render-Benchmark gespeichert: /render_benchmark.csv");
+  }
+
+  // Zustand wiederherstellen
+  memcpy(teilfaktoriellMessungen, sicherungTeil, sizeof(sicherungTeil));
+  memcpy(teilfaktoriellMittelwerte, sicherungTeilMittel, sizeof(sicherungTeilMittel));
+  memcpy(teilfaktoriellStandardabweichungen, sicherungTeilStd, sizeof(sicherungTeilStd));
+  memcpy(vollfaktoriellMessungen, sicherungVoll, sizeof(sicherungVoll));
+  memcpy(vollfaktoriellMittelwerte, sicherungVollMittel, sizeof(sicherungVollMittel));
+  memcpy(vollfaktoriellStandardabweichungen, sicherungVollStd, sizeof(sicherungVollStd));
+  memcpy(zzpMessungen, sicherungZzp, sizeof(sicherungZzp));
+  memcpy(zzpMittelwerte, sicherungZzpMittel, sizeof(sicherungZzpMittel));
+  memcpy(zzpStandardabweichungen, sicherungZzpStd, sizeof(sicherungZzpStd));
+  wirkungsflaeche = sicherungFlaeche;
+  memcpy(faltMessungen, sicherungFalt, sizeof(sicherungFalt));
+  memcpy(faltMittelwerte, sicherungFaltMittel, sizeof(sicherungFaltMittel));
+  memcpy(faltStandardabweichungen, sicherungFaltStd, sizeof(sicherungFaltStd));
+  faltung = sicherungFaltung;
+  memcpy(effekte, sicherungEffekte, sizeof(sicherungEffekte));
+  memcpy(ausgewaehlteVollfaktoren, sicherungVollfaktoren, sizeof(sicherungVollfaktoren));
+  memcpy(fixierteFaktorwerte, sicherungFixiert, sizeof(sicherungFixiert));
+  aktuellerModus = sicherungModus;
+  vorherigerModus = sicherungVorheriger;
+  aktuellerVersuch = sicherungVersuch;
+  aktuelleMessung = sicherungMessung;
+  cursorPosition = sicherungCursor;
+
+  Serial.println("Render-Benchmark abgeschlossen");
+}
@@ -0,0 +1,67 @@
+/**
+ * WindTurbineBildPlaner.cpp
+ * Zusammenfassen von Zeichenaufträgen mit begrenzter Bildrate
+ */
+
+#include "WindTurbineBildPlaner.h"
+
+WindTurbineBildPlaner::WindTurbineBildPlaner() :
+  ausstehend(0),
+  eingaben(0),
+  letztesBildUs(0),
+  letzteEingabeUs(0),
+  bilder(0),
+  zusammengefasst(0),
+  verschoben(0)
+{
+}
+
+void WindTurbineBildPlaner::invalidiere(uint8_t bereiche) {
+  if (ausstehend & bereiche) zusammengefasst++;
+  ausstehend |= bereiche;
+}
+
+/**
+ * Vormerkung durch eine Eingabe (z.B. Drehknopf-Rastung)
+ */
+void WindTurbineBildPlaner::invalidiereEingabe(uint8_t bereiche) {
+  invalidiere(bereiche);
+  eingaben |= bereiche;
+  letzteEingabeUs = micros();
+}
+
+bool WindTurbineBildPlaner::bildFaellig(unsigned long jetztUs) {
+  if (ausstehend == 0) return false;
+  if (jetztUs - letztesBildUs < 1000000UL / UI_MAX_BILDER_PRO_SEKUNDE) return false;
+
+  // Während der Drehknopf bewegt wird, nur Bilder mit Eingaben
+  if (eingaben == 0 && jetztUs - letzteEingabeUs < UI_EINGABE_VORRANG_MS * 1000UL) return false;
+  return true;
+}
+
+uint8_t WindTurbineBildPlaner::beginneBild(unsigned long jetztUs) {
+  uint8_t bereiche = ausstehend;
+  ausstehend = 0;
+  eingaben = 0;
+  letztesBildUs = jetztUs;
+  bilder++;
+  return bereiche;
+}
+
+bool WindTurbineBildPlaner::budgetErschoepft(unsigned long bildStartUs) {
+  return micros() - bildStartUs > UI_BILD_BUDGET_US;
+}
+
+void WindTurbineBildPlaner::verschiebe(uint8_t bereiche) {
+  ausstehend |= bereiche;
+  verschoben++;
+}
+
+void WindTurbineBildPlaner::gibStatistikAus() {
+  Serial.print("Bilder: ");
+  Serial.print(bilder);
+  Serial.print(", zusammengefasst: ");
+  Serial.print(zusammengefasst);
+  Serial.print(", verschoben: ");
+  Serial.println(verschoben);
+}
@@ -0,0 +1,61 @@
+/**
+ * WindTurbineBildPlaner.h
+ * Sammelt Zeichenaufträge und begrenzt die Bildrate
+ *
+ * Drehknopf, Live-Werte und Motor-/Akku-Status merken ihre Bereiche nur vor,
+ * statt sofort zu zeichnen. loop() zeichnet höchstens UI_MAX_BILDER_PRO_SEKUNDE
+ * Bilder pro Sekunde; mehrere Vormerkungen eines Bereichs bis dahin ergeben
+ * ein einziges Neuzeichnen mit dem neuesten Zustand.
+ *
+ * Eingaben haben Vorrang: Sie werden in jedem Bild zuerst gezeichnet, die
+ * übrigen Bereiche werden bei verbrauchtem Zeitbudget ins nächste Bild
+ * verschoben. Solange der Drehknopf bewegt wird (UI_EINGABE_VORRANG_MS nach
+ * der letzten Rastung), gibt es keine Bilder nur für Hintergrundbereiche.
+ */
+
+#ifndef WIND_TURBINE_BILD_PLANER_H
+#define WIND_TURBINE_BILD_PLANER_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+
+// Bereiche, die unabhängig vom Bildschirmwechsel neu gezeichnet werden
+#define UI_BEREICH_CURSOR 0x01  // Auswahl per Drehknopf (Eingabe)
+#define UI_BEREICH_STATUS 0x02  // Motor-/Akku-Status im Titelbalken
+#define UI_BEREICH_LIVE   0x04  // Live-Leistung und Leistungsdiagramm
+
+class WindTurbineBildPlaner {
+public:
+  // Konstruktor
+  WindTurbineBildPlaner();
+
+  // Bereiche für das nächste Bild vormerken
+  void invalidiere(uint8_t bereiche);
+  void invalidiereEingabe(uint8_t bereiche);
+
+  // true wenn etwas vorgemerkt ist und der Mindestabstand seit dem letzten Bild erreicht ist
+  bool bildFaellig(unsigned long jetztUs);
+
+  // Bild beginnen: liefert die vorgemerkten Bereiche und leert die Vormerkung
+  uint8_t beginneBild(unsigned long jetztUs);
+
+  // Zeitbudget des Bildes verbraucht (danach nur noch Eingaben zeichnen)
+  bool budgetErschoepft(unsigned long bildStartUs);
+
+  // Bereich ins nächste Bild verschieben
+  void verschiebe(uint8_t bereiche);
+
+  // Gezeichnete Bilder, zusammengefasste und verschobene Vormerkungen über Serial
+  void gibStatistikAus();
+
+private:
+  uint8_t ausstehend;
+  uint8_t eingaben;
+  unsigned long letztesBildUs;
+  unsigned long letzteEingabeUs;
+  uint32_t bilder;
+  uint32_t zusammengefasst; // Vormerkungen, die in ein bereits vorgemerktes Bild fielen
+  uint32_t verschoben;
+};
+
+#endif // WIND_TURBINE_BILD_PLANER_H
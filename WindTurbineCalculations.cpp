@@ -36,6 +36,71 @@
    return sqrt(summeQuadraticheAbweichungen / (anzahl - 1));
  }
  
+/**
+ * Berechnet Effekte beider Pläne, die Varianzanalyse und das Regressionsmodell neu,
+ * wenn sich die Messdaten geändert haben; nach vollständiger Faltung auch den
+ * kombinierten Plan aus Teilplan und Faltung. Haupteffekte, Wechselwirkungen, p-Werte,
+ * Koeffizienten und Modellgüte lesen danach aus demselben Ergebnis.
+ */
+ void WindTurbineExperiment::aktualisiereAuswertung() {
+   uint32_t stand = WindTurbineDiagrammModell::pruefsumme(teilfaktoriellMittelwerte, sizeof(teilfaktoriellMittelwerte));
+   stand = WindTurbineDiagrammModell::pruefsumme(teilfaktoriellMessungen, sizeof(teilfaktoriellMessungen), stand);
+   stand = WindTurbineDiagrammModell::pruefsumme(vollfaktoriellMittelwerte, sizeof(vollfaktoriellMittelwerte), stand);
+   stand = WindTurbineDiagrammModell::pruefsumme(vollfaktoriellMessungen, sizeof(vollfaktoriellMessungen), stand);
+   int faltArt = faltung.istErzeugt() ? faltung.faltFaktor() : -2;
+   stand = WindTurbineDiagrammModell::pruefsumme(&faltArt, sizeof(faltArt), stand);
+   stand = WindTurbineDiagrammModell::pruefsumme(faltMittelwerte, sizeof(faltMittelwerte), stand);
+   stand = WindTurbineDiagrammModell::pruefsumme(faltMessungen, sizeof(faltMessungen), stand);
+   if (stand == analyseStand && teilAnalyse.istGueltig() && vollAnalyse.istGueltig()) return;
+   
+   teilAnalyse.berechne(teilfaktoriellMittelwerte, &teilfaktoriellMessungen[0][0], 5);
+   teilAnova.berechne(teilAnalyse);
+   teilLenth.berechne(teilAnalyse);
+   if (faltungVollstaendig() &&
+       faltung.berechne(faltAnalyse, teilfaktoriellMittelwerte, &teilfaktoriellMessungen[0][0],
+                        faltMittelwerte, &faltMessungen[0][0], 5)) {
+     faltAnova.berechne(faltAnalyse);
+   }
+   vollAnalyse.berechne(vollfaktoriellMittelwerte, &vollfaktoriellMessungen[0][0], 5);
+   passeRegressionAn();
+   analyseStand = stand;
+ }
+ 
+/**
+ * Passt das lineare Modell (Konstante und die drei ausgewählten Faktoren) und das
+ * Prognosemodell (zusätzlich Zweifach-Wechselwirkungen) an
+ * Verwendet die Einzelmessungen, sofern jeder Versuch zu seinem Mittelwert passt,
+ * sonst (Mittelwerte manuell eingegeben) die Versuchsmittelwerte.
+ */
+ void WindTurbineExperiment::passeRegressionAn() {
+   const int faktoren = VollfaktoriellPlan::FAKTOREN;
+   float stufen[VollfaktoriellPlan::VERSUCHE * 5 * faktoren];
+   float werte[VollfaktoriellPlan::VERSUCHE * 5];
+   
+   bool einzelmessungen = true;
+   WindTurbineKonfidenz reihe;
+   for (int v = 0; v < VollfaktoriellPlan::VERSUCHE && einzelmessungen; v++) {
+     einzelmessungen = reihe.ausMessreihe(vollfaktoriellMessungen[v], 5) > 0 &&
+                       fabs(reihe.mittelwert() - vollfaktoriellMittelwerte[v]) <= 0.001 * max(1.0f, (float)fabs(vollfaktoriellMittelwerte[v]));
+   }
+   
+   int anzahl = 0;
+   for (int v = 0; v < VollfaktoriellPlan::VERSUCHE; v++) {
+     // Vorzeitig abgeschlossene Versuche gehen mit ihren vorhandenen Messungen ein
+     int wiederholungen = einzelmessungen ? WindTurbineKonfidenz::zaehleMessungen(vollfaktoriellMessungen[v], 5) : 1;
+     for (int w = 0; w < wiederholungen; w++) {
+       for (int f = 0; f < faktoren; f++) {
+         stufen[anzahl * faktoren + f] = vollfaktoriellPlan[v][f];
+       }
+       werte[anzahl] = einzelmessungen ? vollfaktoriellMessungen[v][w] : vollfaktoriellMittelwerte[v];
+       anzahl++;
+     }
+   }
+   
+   regression.passeAn(stufen, faktoren, werte, anzahl);
+   prognoseModell.passeAn(stufen, faktoren, werte, anzahl);
+ }
+ 
 /**
  * Berechnet die Haupteffekte der Faktoren aus dem teilfaktoriellen Versuch
  * Zeigt eine Fortschrittsanzeige während der Berechnung
@@ -55,13 +120,11 @@
    // Bereich für aktuellen Faktor - feste Position
    tft.fillRoundRect(20, 150, 440, 30, 5, TFT_OUTLINE);
    
+   // Alle Effekte in einem Durchlauf
+   aktualisiereAuswertung();
+   
    // Für jeden Faktor
    for (int i = 0; i < 5; i++) {
-     float summeNiedrig = 0;
-     float summeHoch = 0;
-     int anzahlNiedrig = 0;
-     int anzahlHoch = 0;
-     
      // Fortschrittsbalken aktualisieren
      int progress = (i * 440) / 5;
      tft.fillRect(21, 101, progress, 38, TFT_HIGHLIGHT);
@@ -74,24 +137,11 @@
      tft.setTextColor(TFT_TEXT);
      tft.print(faktorNamen[i]);
      
-     // Für jeden Versuch im teilfaktoriellen Plan
-     for (int j = 0; j < 8; j++) {
-       if (teilfaktoriellPlan[j][i] == -1) {
-         summeNiedrig += teilfaktoriellMittelwerte[j];
-         anzahlNiedrig++;
-       } else if (teilfaktoriellPlan[j][i] == 1) {
-         summeHoch += teilfaktoriellMittelwerte[j];
-         anzahlHoch++;
-       }
-     }
-     
-     // Berechnung des Effekts
-     float mittelwertNiedrig = summeNiedrig / anzahlNiedrig;
-     float mittelwertHoch = summeHoch / anzahlHoch;
-     effekte[i] = mittelwertHoch - mittelwertNiedrig;
+     // Effekt = Mittelwert hoch - Mittelwert niedrig
+     effekte[i] = teilAnalyse.haupteffekt(i);
      
      // Längere Pause für bessere Sichtbarkeit
-     delay(800);
+     pausiereAnimation(800);
    }
    
    // Abschluss der Berechnung visuell darstellen
@@ -103,12 +153,61 @@
    tft.setCursor(180, 160);
    tft.print("Abgeschlossen!");
    
-   delay(1000);
+   pausiereAnimation(1000);
+ }
+ 
+/**
+ * Varianzanalyse für die Faktorauswahl: nach vollständig gemessener Faltung die
+ * des kombinierten Plans (Haupteffekte entflochten), sonst die des Teilplans
+ */
+ const WindTurbineAnova& WindTurbineExperiment::auswahlAnova() {
+   return (faltungVollstaendig() && faltAnova.istGueltig()) ? faltAnova : teilAnova;
+ }
+ 
+/**
+ * Haupteffekt für die Faktorauswahl (kombinierter Plan bzw. Teilplan, siehe auswahlAnova())
+ */
+ float WindTurbineExperiment::auswahlEffekt(int faktor) {
+   if (faltungVollstaendig() && faltAnalyse.istGueltig()) return faltAnalyse.haupteffekt(faktor);
+   return effekte[faktor];
+ }
+ 
+/**
+ * Ordnet die Faktoren nach dem p-Wert ihres Haupteffekts (ANOVA), wählt die drei
+ * ersten für den vollfaktoriellen Versuch und fixiert die übrigen.
+ * Fixiert wird nur ein signifikanter Effekt nach seiner Richtung, sonst auf der
+ * niedrigen (wirtschaftlicheren) Stufe. Ohne Wiederholungen für den F-Test gilt
+ * wie bisher die Effektstärke mit dem Schwellwert 0.05.
+ * Ist die Faltung gemessen, gelten Effekte und p-Werte des kombinierten Plans.
+ * @param reihenfolge erhält die Faktorindizes in Rangfolge
+ */
+ void WindTurbineExperiment::waehleVollfaktoren(int reihenfolge[5]) {
+   aktualisiereAuswertung();
+   const WindTurbineAnova& anova = auswahlAnova();
+   anova.sortiereFaktoren(reihenfolge, 5);
+   bool signifikanzTest = anova.hatPruefung();
+   
+   for (int i = 0; i < 5; i++) {
+     fixierteFaktorwerte[i] = 99; // 99 = nicht fixiert
+   }
+   for (int i = 0; i < 3; i++) {
+     ausgewaehlteVollfaktoren[i] = reihenfolge[i];
+   }
+   
+   for (int i = 3; i < 5; i++) {
+     int faktor = reihenfolge[i];
+     if (signifikanzTest) {
+       bool signifikant = anova.istSignifikant(faktor);
+       fixierteFaktorwerte[faktor] = (signifikant && auswahlEffekt(faktor) > 0) ? 1 : -1;
+     } else {
+       fixierteFaktorwerte[faktor] = (auswahlEffekt(faktor) > 0.05) ? 1 : -1;
+     }
+   }
  }
  
 /**
  * Bestimmt die drei wichtigsten Faktoren basierend auf den berechneten Effekten
- * Sortiert die Faktoren nach Effektstärke und wählt die drei stärksten für den vollfaktoriellen Versuch aus
+ * Sortiert die Faktoren nach Signifikanz (ANOVA) und wählt die drei ersten für den vollfaktoriellen Versuch aus
  */
  void WindTurbineExperiment::bestimmeWichtigsteFaktoren() {
    // Statusanzeige für komplexe Berechnungen
@@ -122,37 +221,30 @@
    tft.setCursor(30, 75);
    tft.print("Bestimme die drei wichtigsten Faktoren...");
    
-   // Kopie der Effekte und Indizes erstellen
-   float absEffekte[5];
+   // Rangfolge nach Signifikanz, Auswahl und Fixierung
    int faktorIndizes[5];
+   waehleVollfaktoren(faktorIndizes);
+   const WindTurbineAnova& anova = auswahlAnova();
+   bool signifikanzTest = anova.hatPruefung();
+   float effekt[5];
+   for (int i = 0; i < 5; i++) effekt[i] = auswahlEffekt(i);
    
+   float absEffekte[5];
+   float maxEffekt = 0;
    for (int i = 0; i < 5; i++) {
-     absEffekte[i] = abs(effekte[i]);
-     faktorIndizes[i] = i;
-   }
-   
-   // Sortieren (Bubble-Sort) nach absoluten Effekten
-   for (int i = 0; i < 4; i++) {
-     for (int j = 0; j < 4 - i; j++) {
-       if (absEffekte[j] < absEffekte[j + 1]) {
-         // Effekte tauschen
-         float tempEffekt = absEffekte[j];
-         absEffekte[j] = absEffekte[j + 1];
-         absEffekte[j + 1] = tempEffekt;
-         
-         // Indizes tauschen
-         int tempIndex = faktorIndizes[j];
-         faktorIndizes[j] = faktorIndizes[j + 1];
-         faktorIndizes[j + 1] = tempIndex;
-       }
-     }
+     absEffekte[i] = abs(effekt[faktorIndizes[i]]);
+     if (absEffekte[i] > maxEffekt) maxEffekt = absEffekte[i];
    }
    
    // Visualisierung der sortierten Faktoren
    tft.fillRoundRect(20, 110, 440, 160, 5, TFT_OUTLINE);
    tft.setTextColor(TFT_HIGHLIGHT);
    tft.setCursor(30, 120);
-   tft.println("Faktoren nach Effektstaerke sortiert:");
+   if (faltungVollstaendig()) {
+     tft.println(signifikanzTest ? "Faktoren nach Signifikanz sortiert (ANOVA, mit Faltung):" : "Faktoren nach Effektstaerke sortiert (mit Faltung):");
+   } else {
+     tft.println(signifikanzTest ? "Faktoren nach Signifikanz sortiert (ANOVA):" : "Faktoren nach Effektstaerke sortiert:");
+   }
    
    // Faktoren mit Balken für relative Effektstärke anzeigen
    tft.setTextColor(TFT_TEXT);
@@ -175,23 +267,37 @@
      
      // Effektwert
      tft.setCursor(180, y);
-     if (effekte[faktorIndizes[i]] >= 0) {
+     if (effekt[faktorIndizes[i]] >= 0) {
        tft.setTextColor(TFT_SUCCESS);
        tft.print("+");
      } else {
        tft.setTextColor(TFT_WARNING);
      }
-     tft.print(effekte[faktorIndizes[i]], 2);
+     tft.print(effekt[faktorIndizes[i]], 2);
      tft.print(" uW");
      tft.setTextColor(TFT_TEXT);
      
+     // p-Wert des F-Tests
+     if (signifikanzTest) {
+       float p = anova.pWertFaktor(faktorIndizes[i]);
+       tft.setCursor(236, y);
+       tft.setTextColor(p < ANOVA_ALPHA ? TFT_HIGHLIGHT : TFT_LIGHT_TEXT);
+       if (p < 0.001) {
+         tft.print("p<0.001");
+       } else {
+         tft.print("p=");
+         tft.print(p, 3);
+       }
+       tft.setTextColor(TFT_TEXT);
+     }
+     
      // Balken für relative Stärke
-     int balkenBreite = (absEffekte[i] / absEffekte[0]) * 150;
+     int balkenBreite = maxEffekt > 0 ? (absEffekte[i] / maxEffekt) * 150 : 0;
      if (balkenBreite < 5 && absEffekte[i] > 0) balkenBreite = 5; // Mindestbreite
      
-     if (effekte[faktorIndizes[i]] > 0) {
+     if (effekt[faktorIndizes[i]] > 0) {
        tft.fillRect(280, y-7, balkenBreite, 14, TFT_SUCCESS);
-     } else if (effekte[faktorIndizes[i]] < 0) {
+     } else if (effekt[faktorIndizes[i]] < 0) {
        tft.fillRect(280, y-7, balkenBreite, 14, TFT_WARNING);
      }
      
@@ -201,42 +307,7 @@
      }
      
      // Animation verzögern
-     delay(300);
-   }
-   
-   // Die drei wichtigsten Faktoren auswählen
-   for (int i = 0; i < 3; i++) {
-     ausgewaehlteVollfaktoren[i] = faktorIndizes[i];
-   }
-   
-   // NEUE FUNKTIONALITÄT: Fixierung der nicht ausgewählten Faktoren
-   // Alle Faktoren zunächst als "nicht fixiert" markieren
-   for (int i = 0; i < 5; i++) {
-     fixierteFaktorwerte[i] = 99; // 99 = nicht fixiert
-   }
-   
-   // Nicht ausgewählte Faktoren auf optimale Werte fixieren
-   for (int i = 0; i < 5; i++) {
-     bool istAusgewaehlt = false;
-     
-     // Prüfen ob dieser Faktor ausgewählt wurde
-     for (int j = 0; j < 3; j++) {
-       if (ausgewaehlteVollfaktoren[j] == i) {
-         istAusgewaehlt = true;
-         break;
-       }
-     }
-     
-     // Wenn nicht ausgewählt, auf optimale Stufe fixieren
-     if (!istAusgewaehlt) {
-       if (effekte[i] > 0.05) { // Schwellwert für positive Effekte
-         fixierteFaktorwerte[i] = 1;  // Hohe Stufe (+) ist besser
-       } else if (effekte[i] < -0.05) { // Schwellwert für negative Effekte
-         fixierteFaktorwerte[i] = -1; // Niedrige Stufe (-) ist besser
-       } else {
-         fixierteFaktorwerte[i] = -1; // Bei geringem Effekt: niedrige Stufe (wirtschaftlicher)
-       }
-     }
+     pausiereAnimation(300);
    }
    
    // Auswahl bestätigen
@@ -250,7 +321,7 @@
      tft.print(faktorNamen[ausgewaehlteVollfaktoren[i]][0]);
    }
    
-   delay(1500);
+   pausiereAnimation(1500);
    
   // Fixierung dem Benutzer anzeigen
   tft.fillScreen(TFT_BACKGROUND);
@@ -320,7 +391,13 @@
   tft.setTextSize(1); // Kleine Schrift für Fußnote
   tft.setTextColor(TFT_TEXT);
   tft.setCursor(30, 277);
-  tft.print("Fixierung basiert auf Effektrichtung: positiv=hoch, negativ=niedrig");
+  if (signifikanzTest) {
+    tft.print("Signifikant (p<");
+    tft.print(ANOVA_ALPHA, 2);
+    tft.print("): nach Effektrichtung, sonst niedrige Stufe");
+  } else {
+    tft.print("Fixierung basiert auf Effektrichtung: positiv=hoch, negativ=niedrig");
+  }
   
   // Warten auf Benutzer-Eingabe
   zeichneStatusleiste("Druecken Sie den Drehknopf zum Fortfahren");
@@ -349,118 +426,157 @@
 }
  
 /**
- * Berechnet einen Regressionskoeffizienten für das lineare Modell
- * @param koeffIndex Index des Koeffizienten (0=Konstante, 1-3=Faktoren)
- * @return Berechneter Regressionskoeffizient
+ * Stufe eines Faktors im vollfaktoriellen Versuch
+ * Ausgewählte Faktoren laufen nach dem 2^3-Plan, fixierte bleiben auf ihrem Wert.
+ * @return -1 / 1, 0 wenn der Faktor weder ausgewählt noch fixiert ist
  */
- float WindTurbineExperiment::berechneRegressionsKoeffizient(int koeffIndex) {
-   // Erstellen des vollfaktoriellen Plans
-   int vollfaktoriellPlan[8][5];
-   for (int i = 0; i < 8; i++) {
-     for (int j = 0; j < 5; j++) {
-       if (fixierteFaktorwerte[j] != 99) {
-         // Fixierte Faktoren auf ihren festen Wert setzen
-         vollfaktoriellPlan[i][j] = fixierteFaktorwerte[j];
-       } else {
-         vollfaktoriellPlan[i][j] = 0; // Wird gleich überschrieben
-       }
+ int WindTurbineExperiment::vollfaktoriellStufe(int versuch, int faktor) {
+   for (int k = 0; k < VollfaktoriellPlan::FAKTOREN; k++) {
+     if (ausgewaehlteVollfaktoren[k] == faktor) {
+       return vollfaktoriellPlan[versuch][k];
      }
    }
+   return (fixierteFaktorwerte[faktor] != 99) ? fixierteFaktorwerte[faktor] : 0;
+ }
+ 
+/**
+ * Ergänzt den vollfaktoriellen Würfel der drei ausgewählten Faktoren um Stern-
+ * und Zentrumspunkte. Faktoren ohne Zwischenstufen bleiben in der Ergänzung auf
+ * der Stufe, die das lineare Modell bevorzugt. Messungen der Ergänzung bleiben
+ * erhalten, solange sich der Plan nicht ändert.
+ */
+ void WindTurbineExperiment::bereiteZzpVor() {
+   const int faktoren = VollfaktoriellPlan::FAKTOREN;
+   aktualisiereAuswertung();
    
-   for (int i = 0; i < 8; i++) {
-     vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[0]] = (i & 1) ? 1 : -1;
-     vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[1]] = (i & 2) ? 1 : -1;
-     vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[2]] = (i & 4) ? 1 : -1;
+   float bisher[ZZP_MAX_ERGAENZUNG][ZZP_MAX_FAKTOREN];
+   int bisherAnzahl = wirkungsflaeche.anzahlErgaenzung();
+   for (int v = 0; v < bisherAnzahl; v++) {
+     for (int k = 0; k < faktoren; k++) bisher[v][k] = wirkungsflaeche.stufe(v, k);
    }
    
-   // Einfaches Beispiel für Regressionskoeffizienten
-   // In einem realen Programm würde dies mit tatsächlichen Daten berechnet werden
+   bool stetig[VollfaktoriellPlan::FAKTOREN];
+   int ersatzStufe[VollfaktoriellPlan::FAKTOREN];
+   for (int k = 0; k < faktoren; k++) {
+     stetig[k] = faktorStetig[ausgewaehlteVollfaktoren[k]];
+     ersatzStufe[k] = (regression.koeffizient(k + 1) >= 0) ? 1 : -1;
+   }
+   int anzahl = wirkungsflaeche.erzeugeErgaenzung(stetig, ersatzStufe, faktoren);
    
-   if (koeffIndex == 0) {
-     // Konstanter Term (Mittelwert aller Versuchsergebnisse)
-     float summe = 0;
-     for (int i = 0; i < 8; i++) {
-       summe += vollfaktoriellMittelwerte[i];
-     }
-     return summe / 8.0;
-   } else {
-     // Faktor-Koeffizienten
-     int faktorIndex = ausgewaehlteVollfaktoren[koeffIndex - 1];
-     
-     float summeNiedrig = 0;
-     float summeHoch = 0;
-     int anzahlNiedrig = 0;
-     int anzahlHoch = 0;
-     
-     for (int i = 0; i < 8; i++) {
-       if (vollfaktoriellPlan[i][faktorIndex] == -1) {
-         summeNiedrig += vollfaktoriellMittelwerte[i];
-         anzahlNiedrig++;
-       } else if (vollfaktoriellPlan[i][faktorIndex] == 1) {
-         summeHoch += vollfaktoriellMittelwerte[i];
-         anzahlHoch++;
-       }
-     }
-     
-     float mittelwertNiedrig = summeNiedrig / anzahlNiedrig;
-     float mittelwertHoch = summeHoch / anzahlHoch;
-     
-     // Regressions-Koeffizient (Hälfte des Effekts)
-     return (mittelwertHoch - mittelwertNiedrig) / 2.0;
+   bool gleich = (anzahl == bisherAnzahl);
+   for (int v = 0; v < anzahl && gleich; v++) {
+     for (int k = 0; k < faktoren; k++) gleich = gleich && wirkungsflaeche.stufe(v, k) == bisher[v][k];
+   }
+   if (gleich) return;
+   
+   Serial.print("Zentraler zusammengesetzter Plan: ");
+   Serial.print(anzahl);
+   Serial.println(" Ergaenzungsversuche");
+   for (int v = 0; v < ZZP_MAX_ERGAENZUNG; v++) {
+     zzpMittelwerte[v] = 0;
+     zzpStandardabweichungen[v] = 0;
+     for (int j = 0; j < 5; j++) zzpMessungen[v][j] = 0;
    }
  }
  
 /**
- * Berechnet das Bestimmtheitsmaß R² für das Regressionsmodell
- * @return R²-Wert zwischen 0 und 1
+ * Kodierte Stufe eines Faktors in einem Ergänzungsversuch der Wirkungsfläche
+ * @return -1 / 0 / 1 (±ZZP_ALPHA bei Sternpunkten), fixierte Faktoren auf ihrem Wert
  */
- float WindTurbineExperiment::berechneR2() {
-   // Regressionskoeffizienten berechnen
-   float koeffizienten[4];
-   for (int i = 0; i < 4; i++) {
-     koeffizienten[i] = berechneRegressionsKoeffizient(i);
+ float WindTurbineExperiment::zzpStufe(int versuch, int faktor) {
+   for (int k = 0; k < VollfaktoriellPlan::FAKTOREN; k++) {
+     if (ausgewaehlteVollfaktoren[k] == faktor) {
+       return wirkungsflaeche.stufe(versuch, k);
+     }
    }
+   return (fixierteFaktorwerte[faktor] != 99) ? fixierteFaktorwerte[faktor] : 0;
+ }
+ 
+/**
+ * Passt das quadratische Modell an Würfel und vollständig gemessene Ergänzungsversuche an
+ * Wie in passeRegressionAn() Einzelmessungen, außer die Mittelwerte des Würfels
+ * wurden manuell eingegeben; dann gehen alle Versuche mit ihrem Mittelwert ein.
+ */
+ void WindTurbineExperiment::passeWirkungsflaecheAn() {
+   const int faktoren = VollfaktoriellPlan::FAKTOREN;
+   const int maxVersuche = VollfaktoriellPlan::VERSUCHE + ZZP_MAX_ERGAENZUNG;
+   float stufen[maxVersuche * 5 * faktoren];
+   float werte[maxVersuche * 5];
    
-   // Gesamtmittelwert berechnen
-   float mittelwert = koeffizienten[0];
-   
-   // Summe der Quadrate der Abweichungen vom Mittelwert (SST)
-   float sst = 0;
-   for (int i = 0; i < 8; i++) {
-     float abweichung = vollfaktoriellMittelwerte[i] - mittelwert;
-     sst += abweichung * abweichung;
+   bool einzelmessungen = true;
+   WindTurbineKonfidenz reihe;
+   for (int v = 0; v < VollfaktoriellPlan::VERSUCHE && einzelmessungen; v++) {
+     einzelmessungen = reihe.ausMessreihe(vollfaktoriellMessungen[v], 5) > 0 &&
+                       fabs(reihe.mittelwert() - vollfaktoriellMittelwerte[v]) <= 0.001 * max(1.0f, (float)fabs(vollfaktoriellMittelwerte[v]));
    }
    
-   // Summe der Quadrate der Residuen (SSE)
-   float sse = 0;
-   for (int i = 0; i < 8; i++) {
-     // Vorhersage für diesen Versuch berechnen
-     float vorhersage = koeffizienten[0]; // Konstante
-     
-     for (int j = 0; j < 3; j++) {
-       int faktorIndex = ausgewaehlteVollfaktoren[j];
-       int faktorWert = (i & (1 << j)) ? 1 : -1;
-       vorhersage += koeffizienten[j+1] * faktorWert;
+   int anzahl = 0;
+   for (int v = 0; v < VollfaktoriellPlan::VERSUCHE; v++) {
+     int wiederholungen = einzelmessungen ? WindTurbineKonfidenz::zaehleMessungen(vollfaktoriellMessungen[v], 5) : 1;
+     for (int w = 0; w < wiederholungen; w++) {
+       for (int f = 0; f < faktoren; f++) {
+         stufen[anzahl * faktoren + f] = vollfaktoriellPlan[v][f];
+       }
+       werte[anzahl] = einzelmessungen ? vollfaktoriellMessungen[v][w] : vollfaktoriellMittelwerte[v];
+       anzahl++;
+     }
+   }
+   for (int v = 0; v < wirkungsflaeche.anzahlErgaenzung(); v++) {
+     if (zzpMittelwerte[v] == 0) continue; // noch nicht vollständig gemessen
+     int wiederholungen = einzelmessungen ? WindTurbineKonfidenz::zaehleMessungen(zzpMessungen[v], 5) : 1;
+     for (int w = 0; w < wiederholungen; w++) {
+       for (int f = 0; f < faktoren; f++) {
+         stufen[anzahl * faktoren + f] = wirkungsflaeche.stufe(v, f);
+       }
+       werte[anzahl] = einzelmessungen ? zzpMessungen[v][w] : zzpMittelwerte[v];
+       anzahl++;
      }
-     
-     // Residuum
-     float residuum = vollfaktoriellMittelwerte[i] - vorhersage;
-     sse += residuum * residuum;
    }
    
-   // R² berechnen: 1 - (SSE / SST)
-   float r2 = 1.0 - (sse / sst);
-   
-   // Begrenzung auf sinnvolle Werte (0 bis 1)
-   if (r2 < 0) r2 = 0;
-   if (r2 > 1) r2 = 1;
+   wirkungsflaeche.passeAn(stufen, werte, anzahl);
+ }
+ 
+/**
+ * Erzeugt die Faltungsversuche des teilfaktoriellen Plans. Messungen der Faltung
+ * bleiben erhalten, solange dieselbe Art der Faltung gewählt ist.
+ * @param faktor umzukehrender Faktor, FALTUNG_SPIEGELUNG = alle Faktoren
+ */
+ void WindTurbineExperiment::bereiteFaltungVor(int faktor) {
+   bool gleich = faltung.istErzeugt() && faltung.faltFaktor() == faktor;
+   if (gleich) return;
    
-   return r2;
+   if (!faltung.erzeuge(faktor)) return;
+   Serial.print("Faltung des Teilplans: ");
+   if (faltung.istSpiegelung()) {
+     Serial.println("Spiegelung aller Faktoren");
+   } else {
+     Serial.println(faktorNamen[faktor]);
+   }
+   for (int v = 0; v < 8; v++) {
+     faltMittelwerte[v] = 0;
+     faltStandardabweichungen[v] = 0;
+     for (int j = 0; j < 5; j++) faltMessungen[v][j] = 0;
+   }
+ }
+ 
+/**
+ * Alle Faltungsversuche gemessen (Mittelwert 0 = noch nicht gemessen)
+ */
+ bool WindTurbineExperiment::faltungVollstaendig() {
+   if (!faltung.istErzeugt()) return false;
+   for (int v = 0; v < faltung.anzahlVersuche(); v++) {
+     if (faltMittelwerte[v] == 0) return false;
+   }
+   return true;
  }
  
 /**
- * Berechnet die prognostizierte maximale Leistung bei optimalen Einstellungen
- * @return Prognostizierte maximale Leistung in µW
+ * Sucht die optimalen Einstellungen über dem angepassten Modell und zeigt sie an
+ * Nach gemessener Wirkungsfläche gilt das quadratische Modell (stetige Faktoren auch
+ * zwischen den Stufen), sonst Haupteffekte und Zweifach-Wechselwirkungen des
+ * vollfaktoriellen Versuchs. Fixierte Faktoren bleiben auf ihrer Stufe, verbotene
+ * Kombinationen (verboteneKombinationen und eingegebeneVerbote) scheiden aus.
+ * @return Prognostizierte maximale Leistung in µW (Prognoseintervall: optimierung.halbbreite())
  */
 float WindTurbineExperiment::berechnePrognose() {
   // Statusanzeige für komplexe Berechnungen
@@ -478,74 +594,118 @@ float WindTurbineExperiment::berechnePrognose() {
   tft.fillRect(30, 90, 420, 20, TFT_BACKGROUND);
   for (int i = 0; i < 20; i++) {
     tft.fillRect(30 + i*21, 90, 20, 20, TFT_HIGHLIGHT);
-    delay(50);
+    pausiereAnimation(50);
   }
   
-  // Vorhersage für optimale Einstellungen
-  // Konstanter Term
-  float vorhersage = berechneRegressionsKoeffizient(0);
+  // Modell wählen: Wirkungsfläche nur mit allen Stern- und Zentrumspunkten
+  aktualisiereAuswertung();
+  bool zzpGemessen = wirkungsflaeche.anzahlErgaenzung() > 0;
+  for (int v = 0; v < wirkungsflaeche.anzahlErgaenzung(); v++) {
+    if (zzpMittelwerte[v] == 0) zzpGemessen = false;
+  }
+  if (zzpGemessen) passeWirkungsflaecheAn();
+  bool quadratisch = zzpGemessen && wirkungsflaeche.istAngepasst();
+  const WindTurbineRegression& modell = quadratisch ? wirkungsflaeche.modell() : prognoseModell;
+  
+  // Nebenbedingungen: fixierte Faktoren und verbotene Kombinationen
+  optimierung.setzeFaktoren(5, ausgewaehlteVollfaktoren, VollfaktoriellPlan::FAKTOREN);
+  for (int k = 0; k < VollfaktoriellPlan::FAKTOREN; k++) {
+    optimierung.setzeStetig(ausgewaehlteVollfaktoren[k], quadratisch && wirkungsflaeche.istStetig(k));
+  }
+  for (int i = 0; i < 5; i++) {
+    if (fixierteFaktorwerte[i] != 99) optimierung.fixiere(i, fixierteFaktorwerte[i]);
+  }
+  for (int v = 0; verboteneKombinationen[v][0] != 0; v++) {
+    optimierung.verbiete(verboteneKombinationen[v][0], verboteneKombinationen[v][1]);
+  }
+  for (int v = 0; v < anzahlEingegebeneVerbote; v++) {
+    optimierung.verbiete(eingegebeneVerbote[v][0], eingegebeneVerbote[v][1]);
+  }
+  bool gefunden = optimierung.suche(modell);
   
   // Optimale Einstellungen anzeigen
   tft.setTextColor(TFT_SUBTITLE);
   tft.setCursor(30, 120);
-  tft.print("Optimale Faktorstufen:");
+  tft.print(quadratisch ? "Optimale Faktorstufen (Wirkungsflaeche):" : "Optimale Faktorstufen (mit Wechselwirkungen):");
+  tft.setCursor(330, 120);
+  tft.print(optimierung.anzahlZulaessig());
+  tft.print("/");
+  tft.print(optimierung.anzahlEcken());
+  tft.print(" Ecken zulaessig");
   
-  // Für jeden ausgewählten Faktor
-  for (int i = 0; i < 3; i++) {
-    int faktorIndex = ausgewaehlteVollfaktoren[i];
-    float koeffizient = berechneRegressionsKoeffizient(i + 1);
-    int stufe = (koeffizient > 0) ? 1 : -1;
-    
-    // Je nach Vorzeichen des Koeffizienten die niedrige oder hohe Stufe wählen
-    tft.setCursor(30, 140 + i*20);
-    tft.print(faktorNamen[faktorIndex]);
-    tft.print(": ");
-    
-    if (stufe > 0) {
-      tft.setTextColor(TFT_HIGHLIGHT);
-      tft.print(faktorEinheitenHoch[faktorIndex]);
-      tft.print(" (+)");
-      
-      // Beitrag zur Vorhersage
-      tft.setCursor(280, 140 + i*20);
-      tft.print("+");
-      tft.print(koeffizient, 2);
-      tft.print(" uW");
-      
-      vorhersage += koeffizient * 1.0; // Hohe Stufe
-    } else {
+  if (!gefunden) {
+    tft.setTextColor(TFT_WARNING);
+    tft.setCursor(30, 140);
+    tft.print("Keine zulaessige Einstellung - Verbote pruefen");
+  }
+  for (int i = 0; i < 5 && gefunden; i++) {
+    int y = 140 + i * 15;
+    tft.setTextColor(TFT_SUBTITLE);
+    tft.setCursor(30, y);
+    tft.print(faktorNamen[i]);
+    tft.print(":");
+    zeichneZzpStufe(130, y + 3, i, optimierung.stufe(i));
+    if (optimierung.istFixiert(i)) {
       tft.setTextColor(TFT_LIGHT_TEXT);
-      tft.print(faktorEinheitenNiedrig[faktorIndex]);
-      tft.print(" (-)");
-      
-      // Beitrag zur Vorhersage
-      tft.setCursor(280, 140 + i*20);
-      tft.print("-");
-      tft.print(abs(koeffizient), 2);
-      tft.print(" uW");
-      
-      vorhersage += koeffizient * (-1.0); // Niedrige Stufe
+      tft.setCursor(330, y);
+      tft.print("fixiert");
     }
-    tft.setTextColor(TFT_SUBTITLE);
-    
-    // Berechnungsanimation
-    tft.fillRect(200 + i*60, 200, 20, 10, TFT_SUCCESS);
-    delay(300);
   }
   
+  float vorhersage = optimierung.optimum();
+  Serial.print("Prognose: ");
+  Serial.print(vorhersage, 2);
+  Serial.print(" +/- ");
+  Serial.print(optimierung.halbbreite(), 2);
+  Serial.println(optimierung.istInnen() ? " uW (zwischen den Stufen)" : " uW (Ecke)");
+  
   // Berechnetes Ergebnis anzeigen - NUR EINMAL!
   tft.fillRoundRect(20, 230, 440, 50, 5, TFT_SUCCESS);
   tft.setTextSize(1);
   tft.setTextColor(TFT_TEXT);
   tft.setCursor(30, 230);
-  tft.print("Prognostizierte maximale Leistung:");
-  
-
+  tft.print("Prognostizierte maximale Leistung (");
+  tft.print(KONFIDENZ_NIVEAU);
+  tft.print(" % Prognoseintervall):");
   
   // Statusleiste mit korrektem Zurück-Button verwenden
   zeichneStatusleiste("Optimierung abgeschlossen - Druecken zum Fortfahren");
   
-  delay(1000);
+  pausiereAnimation(1000);
   
   return vorhersage;
 }
+
+/**
+ * Gefundenes Optimum als verbotene Kombination merken (Versuchsstand kann es nicht einstellen)
+ * Maske: alle nicht fixierten Faktoren außerhalb der Mitte, verbotene Seite wie im Optimum.
+ * Gilt bis zum Neustart oder Taste 3 in der Zusammenfassung.
+ * @return false ohne gültiges Optimum, ohne freien Faktor oder bei voller Liste
+ */
+bool WindTurbineExperiment::verbieteOptimum() {
+  if (!optimierung.istGueltig()) return false;
+  int feste = 0;
+  while (verboteneKombinationen[feste][0] != 0) feste++;
+  if (feste + anzahlEingegebeneVerbote >= OPTIMIERUNG_MAX_VERBOTE) {
+    Serial.println("Optimierung: keine weiteren Ausschluesse moeglich");
+    return false;
+  }
+
+  uint8_t maske = 0;
+  uint8_t hohe = 0;
+  for (int f = 0; f < 5; f++) {
+    if (optimierung.istFixiert(f) || optimierung.stufe(f) == 0) continue;
+    maske |= 1 << f;
+    if (optimierung.stufe(f) > 0) hohe |= 1 << f;
+  }
+  if (maske == 0) return false;
+
+  eingegebeneVerbote[anzahlEingegebeneVerbote][0] = maske;
+  eingegebeneVerbote[anzahlEingegebeneVerbote][1] = hohe;
+  anzahlEingegebeneVerbote++;
+  Serial.print("Optimierung: Einstellung ausgeschlossen, Maske 0x");
+  Serial.print(maske, HEX);
+  Serial.print(" hoch 0x");
+  Serial.println(hohe, HEX);
+  return true;
+}
@@ -0,0 +1,234 @@
+/**
+ * WindTurbineCompositor.cpp
+ * Overlay- und Schadensverwaltung für das TFT-Display
+ */
+
+#include "WindTurbineCompositor.h"
+#include "WindTurbineRenderZaehler.h"
+#include "WindTurbineSpiegel.h"
+
+WindTurbineCompositor::WindTurbineCompositor() :
+  tft(nullptr),
+  anzahlSchaeden(0),
+  reparaturAktiv(false),
+  reparaturKennungGesehen(false),
+  reparaturGueltig(false)
+{
+  for (int i = 0; i < OVERLAY_ANZAHL; i++) {
+    overlays[i].aktiv = false;
+    overlays[i].unterlage = nullptr;
+  }
+  unterlageKennung[0] = '\0';
+}
+
+WindTurbineCompositor::~WindTurbineCompositor() {
+  for (int i = 0; i < OVERLAY_ANZAHL; i++) {
+    gibUnterlageFrei(overlays[i]);
+  }
+}
+
+void WindTurbineCompositor::begin(TFT_eSPI* display) {
+  tft = display;
+}
+
+/**
+ * Ein neuer Bildschirm wurde gezeichnet
+ * Außerhalb einer Reparatur sind alle Overlays und Schäden damit überdeckt.
+ * Während einer Reparatur wird nur geprüft, ob derselbe Bildschirm neu gezeichnet wird.
+ * @param kennung Titel des Bildschirms
+ */
+void WindTurbineCompositor::neuerBildschirm(const char* kennung) {
+  if (reparaturAktiv) {
+    reparaturKennungGesehen = true;
+    if (strncmp(kennung, unterlageKennung, sizeof(unterlageKennung) - 1) != 0) {
+      reparaturGueltig = false;
+    }
+    return;
+  }
+
+  strncpy(unterlageKennung, kennung, sizeof(unterlageKennung) - 1);
+  unterlageKennung[sizeof(unterlageKennung) - 1] = '\0';
+
+  for (int i = 0; i < OVERLAY_ANZAHL; i++) {
+    overlays[i].aktiv = false;
+    gibUnterlageFrei(overlays[i]);
+  }
+  anzahlSchaeden = 0;
+}
+
+/**
+ * Meldet ein Overlay an, bevor es gezeichnet wird
+ * Mit Rücklesen werden die Pixel darunter gesichert.
+ */
+void WindTurbineCompositor::zeigeOverlay(OverlayKennung id, int16_t x, int16_t y, int16_t w, int16_t h) {
+  // Beim geclippten Neuzeichnen bleibt das bestehende Overlay unverändert
+  if (reparaturAktiv) return;
+
+  OverlayEintrag& eintrag = overlays[id];
+  gibUnterlageFrei(eintrag);
+
+  eintrag.aktiv = true;
+  eintrag.bereich.x = x;
+  eintrag.bereich.y = y;
+  eintrag.bereich.w = w;
+  eintrag.bereich.h = h;
+
+  sichereUnterlage(eintrag);
+}
+
+/**
+ * Entfernt ein Overlay
+ * @return true wenn der Bereich aus gesicherten Pixeln wiederhergestellt wurde,
+ *         false wenn er als beschädigt markiert wurde (oder das Overlay nicht aktiv war)
+ */
+bool WindTurbineCompositor::entferneOverlay(OverlayKennung id) {
+  OverlayEintrag& eintrag = overlays[id];
+  if (!eintrag.aktiv) return false;
+
+  eintrag.aktiv = false;
+  DisplayBereich& b = eintrag.bereich;
+
+  if (eintrag.unterlage != nullptr && tft != nullptr) {
+    tft->pushRect(b.x, b.y, b.w, b.h, eintrag.unterlage);
+    WindTurbineRenderZaehler::erfasseBlock((uint32_t)b.w * b.h);
+    WindTurbineSpiegel::uebernimmBild(b.x, b.y, b.w, b.h, eintrag.unterlage);
+    gibUnterlageFrei(eintrag);
+    return true;
+  }
+
+  markiereBeschaedigt(b.x, b.y, b.w, b.h);
+  return false;
+}
+
+bool WindTurbineCompositor::istOverlayAktiv(OverlayKennung id) {
+  return overlays[id].aktiv;
+}
+
+/**
+ * Markiert einen Bereich als beschädigt
+ * Sich berührende Bereiche werden zusammengefasst, bei voller Liste
+ * wird der neue Bereich mit dem letzten vereinigt.
+ */
+void WindTurbineCompositor::markiereBeschaedigt(int16_t x, int16_t y, int16_t w, int16_t h) {
+  // Auf den Bildschirm begrenzen
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > 480) w = 480 - x;
+  if (y + h > 320) h = 320 - y;
+  if (w <= 0 || h <= 0) return;
+
+  DisplayBereich neu = {x, y, w, h};
+
+  // Mit bestehenden Bereichen zusammenfassen, solange sich etwas ändert
+  bool zusammengefasst = true;
+  while (zusammengefasst) {
+    zusammengefasst = false;
+    for (int i = 0; i < anzahlSchaeden; i++) {
+      if (beruehrenSich(schaeden[i], neu)) {
+        neu = vereinige(schaeden[i], neu);
+        schaeden[i] = schaeden[anzahlSchaeden - 1];
+        anzahlSchaeden--;
+        zusammengefasst = true;
+        break;
+      }
+    }
+  }
+
+  if (anzahlSchaeden < COMPOSITOR_MAX_BEREICHE) {
+    schaeden[anzahlSchaeden++] = neu;
+  } else {
+    schaeden[anzahlSchaeden - 1] = vereinige(schaeden[anzahlSchaeden - 1], neu);
+  }
+}
+
+int WindTurbineCompositor::anzahlBeschaedigteBereiche() {
+  return anzahlSchaeden;
+}
+
+DisplayBereich WindTurbineCompositor::beschaedigterBereich(int index) {
+  return schaeden[index];
+}
+
+void WindTurbineCompositor::verwerfeBeschaedigteBereiche() {
+  anzahlSchaeden = 0;
+}
+
+/**
+ * Beginnt das Neuzeichnen eines beschädigten Bereichs
+ * Alle Zeichenbefehle werden bis beendeReparatur() auf den Bereich geclippt.
+ */
+void WindTurbineCompositor::beginneReparatur(int index) {
+  DisplayBereich& b = schaeden[index];
+  reparaturAktiv = true;
+  reparaturKennungGesehen = false;
+  reparaturGueltig = true;
+  // vpDatum = false: absolute Koordinaten beibehalten, nur clippen
+  tft->setViewport(b.x, b.y, b.w, b.h, false);
+  WindTurbineSpiegel::setzeClip(b.x, b.y, b.w, b.h);
+}
+
+/**
+ * Beendet das Neuzeichnen eines Bereichs
+ * @return true wenn derselbe Bildschirm wie unter dem Overlay gezeichnet wurde
+ */
+bool WindTurbineCompositor::beendeReparatur() {
+  tft->resetViewport();
+  WindTurbineSpiegel::hebeClipAuf();
+  reparaturAktiv = false;
+  return reparaturKennungGesehen && reparaturGueltig;
+}
+
+bool WindTurbineCompositor::istReparaturAktiv() {
+  return reparaturAktiv;
+}
+
+void WindTurbineCompositor::gibUnterlageFrei(OverlayEintrag& eintrag) {
+  if (eintrag.unterlage != nullptr) {
+    free(eintrag.unterlage);
+    eintrag.unterlage = nullptr;
+  }
+}
+
+/**
+ * Sichert die Pixel unter einem Overlay (nur mit COMPOSITOR_RUECKLESEN)
+ * Der Puffer liegt bevorzugt im PSRAM, ohne PSRAM im internen Heap.
+ */
+bool WindTurbineCompositor::sichereUnterlage(OverlayEintrag& eintrag) {
+#if COMPOSITOR_RUECKLESEN
+  if (tft == nullptr) return false;
+
+  DisplayBereich& b = eintrag.bereich;
+  size_t groesse = (size_t)b.w * b.h * sizeof(uint16_t);
+
+  if (psramFound()) {
+    eintrag.unterlage = (uint16_t*)ps_malloc(groesse);
+  } else {
+    eintrag.unterlage = (uint16_t*)malloc(groesse);
+  }
+
+  if (eintrag.unterlage == nullptr) {
+    Serial.println("Compositor: Kein Speicher fuer Overlay-Unterlage, zeichne spaeter neu");
+    return false;
+  }
+
+  tft->readRect(b.x, b.y, b.w, b.h, eintrag.unterlage);
+  return true;
+#else
+  (void)eintrag;
+  return false;
+#endif
+}
+
+bool WindTurbineCompositor::beruehrenSich(const DisplayBereich& a, const DisplayBereich& b) {
+  return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+         a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+DisplayBereich WindTurbineCompositor::vereinige(const DisplayBereich& a, const DisplayBereich& b) {
+  DisplayBereich ergebnis;
+  ergebnis.x = min(a.x, b.x);
+  ergebnis.y = min(a.y, b.y);
+  ergebnis.w = max(a.x + a.w, b.x + b.w) - ergebnis.x;
+  ergebnis.h = max(a.y + a.h, b.y + b.h) - ergebnis.y;
+  return ergebnis;
+}
@@ -0,0 +1,88 @@
+/**
+ * WindTurbineCompositor.h
+ * Verwaltung von Overlays und beschädigten Bildschirmbereichen
+ *
+ * Overlays (Motor-Warnung, Bestätigungsdialog) werden über den aktuellen
+ * Bildschirm gelegt. Beim Entfernen wird nur der darunterliegende Bereich
+ * wiederhergestellt statt den kompletten Bildschirm (480x320) neu zu zeichnen:
+ * - mit Rücklesen: gesicherte Pixel werden per pushRect zurückgeschrieben
+ * - ohne Rücklesen: der Bildschirm wird mit Clipping auf den Bereich neu gezeichnet,
+ *   über SPI gehen dann nur die Pixel innerhalb des beschädigten Bereichs
+ */
+
+#ifndef WIND_TURBINE_COMPOSITOR_H
+#define WIND_TURBINE_COMPOSITOR_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+
+// Rechteckiger Bildschirmbereich
+struct DisplayBereich {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+// Bekannte Overlays
+enum OverlayKennung {
+  OVERLAY_MOTOR_WARNUNG = 0,
+  OVERLAY_DIALOG,
+  OVERLAY_DIALOG_STATUS,
+  OVERLAY_ANZAHL
+};
+
+class WindTurbineCompositor {
+public:
+  // Konstruktor und Destruktor
+  WindTurbineCompositor();
+  ~WindTurbineCompositor();
+
+  // Initialisierung
+  void begin(TFT_eSPI* display);
+
+  // Neuer Bildschirm wurde gezeichnet (Kennung = Titel des Bildschirms)
+  void neuerBildschirm(const char* kennung);
+
+  // Overlay-Verwaltung
+  void zeigeOverlay(OverlayKennung id, int16_t x, int16_t y, int16_t w, int16_t h);
+  bool entferneOverlay(OverlayKennung id);
+  bool istOverlayAktiv(OverlayKennung id);
+
+  // Beschädigte Bereiche
+  void markiereBeschaedigt(int16_t x, int16_t y, int16_t w, int16_t h);
+  int anzahlBeschaedigteBereiche();
+  DisplayBereich beschaedigterBereich(int index);
+  void verwerfeBeschaedigteBereiche();
+
+  // Reparatur eines beschädigten Bereichs durch geclipptes Neuzeichnen
+  void beginneReparatur(int index);
+  bool beendeReparatur();
+  bool istReparaturAktiv();
+
+private:
+  struct OverlayEintrag {
+    bool aktiv;
+    DisplayBereich bereich;
+    uint16_t* unterlage; // Gesicherte Pixel (nur mit Rücklesen, sonst nullptr)
+  };
+
+  TFT_eSPI* tft;
+  OverlayEintrag overlays[OVERLAY_ANZAHL];
+  DisplayBereich schaeden[COMPOSITOR_MAX_BEREICHE];
+  int anzahlSchaeden;
+
+  char unterlageKennung[50]; // Titel des Bildschirms unter den Overlays
+  bool reparaturAktiv;
+  bool reparaturKennungGesehen;
+  bool reparaturGueltig;
+
+  // Hilfsfunktionen
+  void gibUnterlageFrei(OverlayEintrag& eintrag);
+  bool sichereUnterlage(OverlayEintrag& eintrag);
+  static bool beruehrenSich(const DisplayBereich& a, const DisplayBereich& b);
+  static DisplayBereich vereinige(const DisplayBereich& a, const DisplayBereich& b);
+};
+
+#endif // WIND_TURBINE_COMPOSITOR_H
@@ -5,9 +5,12 @@
 
  #ifndef WIND_TURBINE_CONSTANTS_H
  #define WIND_TURBINE_CONSTANTS_H
+
+ #include "WindTurbineVersuchsplan.h"
  
  // Datenverwaltungskonstanten
  #define MAX_SAVED_EXPERIMENTS 20  // Maximale Anzahl gespeicherter Experimente
+ #define VERSUCH_JSON_GROESSE 12288 // JSON-Dokument einer vollständigen Versuchsdatei (mit ZZP-Ergänzung)
  
  // Pin-Definitionen für den Encoder
  #define ENCODER_PIN_A 34  // CLK-Pin des KY-040 Encoders
@@ -50,22 +53,144 @@
  #define TFT_TITLE_BG 0x0861       // Titelbalken-Hintergrund
  #define TFT_SUBTITLE 0xAD75       // Untertitel-Farbe
  #define TFT_STATUS_BAR 0x0882     // Statusleisten-Hintergrund
+ #define TFT_CHART_BAND 0x1A6B     // ±1σ-Band im Leistungsdiagramm
+ #define TFT_SELECTION 0x2B0C      // Hintergrund der mit dem Drehknopf ausgewählten Zeile
  
  // Layoutkonstanten
  #define STATUS_BAR_HEIGHT 20      // Höhe der Statusleiste
  #define HEADER_HEIGHT 30          // Höhe des Titelbalkens
+ #define TITEL_MAX_BREITE 220      // Titeltext ab x = 25, endet vor der Motor-Status-Box (x = 248)
  #define CONTENT_MARGIN 5          // Standardrand für Inhalte
  #define CHART_MARGIN 8            // Rand für Diagramme
+
+ // Compositor-Konstanten (Overlays und beschädigte Bereiche)
+ #define COMPOSITOR_MAX_BEREICHE 8 // Maximale Anzahl getrennt verwalteter beschädigter Bereiche
+ // Rücklesen des Displays (readRect) zum Sichern der Pixel unter Overlays.
+ // Standardmäßig aus: GPIO 19 wird als TFT_MISO und als Keypad-Spalte genutzt,
+ // daher ist das Rücklesen nicht zuverlässig. Ohne Rücklesen wird geclippt neu gezeichnet.
+ #define COMPOSITOR_RUECKLESEN 0
+ 
+ // Live-Anzeige auf den Messbildschirmen
+ #define LIVE_ANZEIGE_INTERVALL_MS 66 // Aktualisierungsrate begrenzen (ca. 15 Hz)
+ #define LIVE_DIAGRAMM_BREITE 450     // Laufendes Leistungsdiagramm (eine Spalte pro Bild)
+ #define LIVE_DIAGRAMM_HOEHE 26
+ #define LIVE_DIAGRAMM_FENSTER 30     // Gleitender Mittelwert/σ über 30 Werte (ca. 2 s)
+ #define LIVE_DIAGRAMM_BUDGET_US 12000 // Zeitbudget pro Bild, danach wird das Diagramm verschoben
+
+ // Bildplaner (Zusammenfassen von Zeichenaufträgen)
+ #define UI_MAX_BILDER_PRO_SEKUNDE 30 // Obergrenze der Bildrate
+ #define UI_BILD_BUDGET_US 20000      // Danach werden Status und Live-Werte ins nächste Bild verschoben
+ #define UI_EINGABE_VORRANG_MS 150    // So lange nach einer Rastung nur Bilder mit Eingaben
+ #define UI_BILD_STATISTIK 0          // 1 = Bildstatistik alle 30 Sekunden über Serial
+
+ // Spiegelung des Displays im Browser (Schattenbild im PSRAM)
+ #define SPIEGEL_AKTIV 1                     // 0 = kein Schattenbild, keine Spiegelung
+ #define SPIEGEL_RUECKLESEN 0                // 1 = ohne PSRAM vom Display zurücklesen (unzuverlässig wie COMPOSITOR_RUECKLESEN)
+ #define SPIEGEL_MAX_BEREICHE 8              // Getrennt verwaltete geänderte Bereiche
+ #define SPIEGEL_PUFFER_BYTES 2920           // Sendepuffer (zwei TCP-Segmente, mind. eine Zeile mit 480 Läufen)
+ #define SPIEGEL_INTERVALL_MS 100            // Höchstens 10 Sendungen pro Sekunde
+ #define SPIEGEL_MAX_BYTES_PRO_SEKUNDE 48000 // Bandbreite der Spiegelung begrenzen
+ #define SPIEGEL_BUDGET_US 3000              // Rechenzeit pro Sendung für die Kodierung
+
+ // Screenshot (/screenshot.png)
+ #define PNG_IDAT_BYTES 1024 // Größe der IDAT-Chunks, zugleich Ausgabepuffer
  
+ // DMA-Kachelpuffer (2 Puffer im internen RAM)
+ #define DMA_KACHEL_BREITE 480     // Pufferbreite (breitere Bereiche: weniger Zeilen je Kachel)
+ #define DMA_KACHEL_HOEHE 16       // Zeilen pro Kachel
+ #define DMA_BENCHMARK_BEIM_START 0 // 1 = Vergleich blockierend/DMA beim Start über Serial ausgeben
+ #define RENDER_BENCHMARK_BEIM_START 0 // 1 = Render-Benchmark aller Bildschirme beim Start (Serial + /render_benchmark.csv)
+ 
+ // SPI-Takt des Displays (Kalibrierung beim Start, Ergebnis im NVS)
+ #define SPI_STANDARD_FREQUENZ 27000000 // Ohne Kalibrierung bzw. wenn Rücklesen nicht möglich ist
+ #define SPI_KALIBRIERUNG_AKTIV 1        // 0 = immer SPI_STANDARD_FREQUENZ verwenden
+ #define SPI_KALIBRIERUNG_ERZWINGEN 0    // 1 = gespeicherten Takt verwerfen und neu messen
+ #define SPI_KALIBRIERUNG_DURCHLAEUFE 4  // Durchläufe aller Testmuster pro Frequenz
+ #define SPI_KALIBRIERUNG_DAUERTEST 32   // Durchläufe bei der höchsten fehlerfreien Frequenz
+ #define SPI_KALIBRIERUNG_MAX_FREQUENZ 40000000 // Obergrenze, auch wenn schnellere Stufen bestehen
+ 
+ // Widget-Schicht
+ #define WIDGET_MAX_ANZAHL 48      // Widgets pro Bildschirm
+ #define WIDGET_MAX_TEXT 72        // Zeichen pro Widget-Text (inkl. Spaltentrennern)
+ #define WIDGET_MAX_SPALTEN 8      // Spalten einer Tabellenzeile
+ 
+ // Zwischenspeicher für statische Hintergründe
+ #define HINTERGRUND_STREIFEN_HOEHE 20   // Zeilen pro Aufnahme-Streifen (480x20 Sprite)
+ #define HINTERGRUND_MAX_BYTES 49152     // Obergrenze pro Bildschirm (RLE-kodiert)
+ #define HINTERGRUND_MAX_BYTES_INTERN 28672 // Ohne PSRAM: alle Hintergründe zusammen im internen Heap (reicht für beide Messbildschirme)
+ 
+ // Geometrie-Zwischenspeicher der Diagramme
+ #define DIAGRAMM_MAX_PRIMITIVE 512      // Zeichenbefehle pro Diagramm (12 Bytes je Befehl)
+ #define DIAGRAMM_MAX_TEXT 2048          // Bytes für Beschriftungen pro Diagramm
+
+ // Kantengeglättete Schriften (Atlanten im SPIFFS, vorgemischte Glyphen im RAM)
+ #define SCHRIFT_AKTIV 1                       // 0 = nur GLCD-Schrift
+ #define SCHRIFT_DATEI_KLEIN "/schrift_klein"  // Ersetzt Textgröße 1 (.wsa, sonst aus .vlw erzeugt)
+ #define SCHRIFT_DATEI_GROSS "/schrift_gross"  // Ersetzt Textgröße 2
+ #define SCHRIFT_CACHE_EINTRAEGE 96            // Vorgemischte Glyphen (LRU)
+ #define SCHRIFT_CACHE_MAX_BYTES 32768         // Obergrenze für den Glyphen-Cache
+
+ // Effektberechnung (Yates-Algorithmus)
+ #define EFFEKT_MAX_VERSUCHE 64   // 2^6 Versuche (z.B. 2^(7-1))
+ #define EFFEKT_MAX_FAKTOREN 8
+ #define ALIAS_MAX_WOERTER 127    // Definierende Relation: höchstens 2^(K-1) - 1 Wörter
+
+ // Regression (kleinste Quadrate, feste Matrixgröße)
+ #define REGRESSION_MAX_TERME 16            // Konstante + Terme (X'X in double: 2 KB Stack)
+ #define REGRESSION_MAX_BEOBACHTUNGEN 128   // Einzelmessungen pro Anpassung
+
+ // Varianzanalyse (F-Test gegen die Streuung der Wiederholungen)
+ #define ANOVA_ALPHA 0.05                   // Signifikanzniveau für Auswahl und Fixierung
+
+ // Effektprüfung ohne Wiederholungen (Lenth: Pseudo-Standardfehler aus den Effekten)
+ #define LENTH_FAKTOR 1.5                   // s0 = 1.5 * Median |Effekt|
+ #define LENTH_GRENZE 2.5                   // Effekte über 2.5 * s0 bleiben beim PSE außen vor
+ #define LENTH_MIN_EFFEKTE 3                // Weniger Kontraste: kein sinnvoller Median
+
+ // Faltung des teilfaktoriellen Plans (zweiter Block mit umgekehrten Stufen)
+ #define FALTUNG_SPIEGELUNG -1              // Alle Faktoren umkehren statt eines einzelnen
+ #define FALTUNG_MAX_WIEDERHOLUNGEN 5       // Messungen je Versuch im kombinierten Plan
+
+ // Konfidenzintervalle (95 %, Student-t) und vorzeitiger Abschluss eines Versuchs
+ #define KONFIDENZ_NIVEAU 95                // Prozent (Quantiltabelle in WindTurbineKonfidenz.h)
+ #define KONFIDENZ_MIN_WIEDERHOLUNGEN 3     // Frühestens nach so vielen Messungen abschließen
+ #define KONFIDENZ_ZIEL_ANTEIL 0.05         // Halbbreite höchstens 5 % des Mittelwerts
+
+ // Zentraler zusammengesetzter Plan (quadratisches Wirkungsflächenmodell)
+ #define ZZP_ALPHA 1.0                      // Sternpunkte auf den Würfelflächen (Stufen physikalisch begrenzt)
+ #define ZZP_ZENTRUMSPUNKTE 3               // Wiederholte Zentrumspunkte
+ #define ZZP_MAX_FAKTOREN 3                 // Faktoren des vollfaktoriellen Würfels
+ #define ZZP_MAX_ERGAENZUNG (2 * ZZP_MAX_FAKTOREN + ZZP_ZENTRUMSPUNKTE) // Stern- und Zentrumspunkte
+
+ // Optimumsuche über dem angepassten Modell (Ecken, stetige Faktoren, Nebenbedingungen)
+ #define OPTIMIERUNG_MAX_FAKTOREN 5         // 2^5 Ecken im Walsh-Feld
+ #define OPTIMIERUNG_MAX_VERBOTE 8          // Verbotene Stufenkombinationen
+ #define OPTIMIERUNG_MITTELUNG 1            // Prognoseintervall für eine Einzelmessung
+
+ // Suche nach dem größten Modellwert (Wirkungsfläche und Optimierung, WindTurbineModellSuche.h)
+ #define SUCHE_MAX_FAKTOREN OPTIMIERUNG_MAX_FAKTOREN
+ #define SUCHE_RASTER 10                    // Rasterschritte je stetigem Faktor
+ #define SUCHE_VERFEINERUNG_RUNDEN 20       // Koordinatenweise Parabelschritte
+
  // Faktornamen und Stufen
  extern const char* faktorNamen[];
  extern const char* faktorEinheitenNiedrig[];
  extern const char* faktorEinheitenHoch[];
+ extern const char* faktorEinheitenMitte[];
+ extern const bool faktorStetig[];          // Zwischenstufen einstellbar (Stern- und Zentrumspunkte)
+ extern const float faktorMitte[];          // Realwert der Mitte (kodiert 0)
+ extern const float faktorHalbeSpanne[];    // Realwert je kodierter Einheit
+ extern const char* faktorFormat[];         // Realwert als Text, z.B. "%.0f cm"
+ extern const uint8_t verboteneKombinationen[][2]; // {Faktormaske, hohe Stufen}, Ende mit {0, 0}
  
  // Versuchspläne
- // Teil- und vollfaktorieller Versuchsplan werden als 2D-Arrays kodiert
- // -1 = niedrige Stufe, 1 = hohe Stufe, 0 = nicht verwendet
+ // Teil- und vollfaktorieller Versuchsplan werden zur Übersetzungszeit erzeugt
+ // (WindTurbineVersuchsplan.h), -1 = niedrige Stufe, 1 = hohe Stufe
  // Teilfaktorieller Plan (2^(5-2) = 8 Versuche)
- extern const int teilfaktoriellPlan[8][5];
+ static constexpr const int (&teilfaktoriellPlan)[TeilfaktoriellPlan::VERSUCHE][TeilfaktoriellPlan::FAKTOREN] =
+   TeilfaktoriellPlan::tabelle.stufen;
+ // Vollfaktorieller Plan der drei ausgewählten Faktoren (2^3 = 8 Versuche)
+ static constexpr const int (&vollfaktoriellPlan)[VollfaktoriellPlan::VERSUCHE][VollfaktoriellPlan::FAKTOREN] =
+   VollfaktoriellPlan::tabelle.stufen;
  
  #endif // WIND_TURBINE_CONSTANTS_H
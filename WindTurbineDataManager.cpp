@@ -11,12 +11,21 @@
  */
 
 #include "WindTurbineDataManager.h"
+#include "WindTurbineSpiegel.h"
+#include "WindTurbinePngStrom.h"
+#include "WindTurbineAnova.h"
+#include "WindTurbineAliasStruktur.h"
+#include "WindTurbineLenth.h"
+#include "WindTurbineWirkungsflaeche.h"
 #include <time.h>
 
 // Konstruktor mit erweiterten Konfigurationen
 WindTurbineDataManager::WindTurbineDataManager() : 
   server(nullptr),
-  wifiExportActive(false) {
+  wifiExportActive(false),
+  accessPointAktiv(false),
+  spiegelungAktiv(false),
+  spiegelNeu(false) {
   
   // Standard-Export-Konfiguration
   defaultConfig.width = 800;
@@ -66,37 +75,20 @@ bool WindTurbineDataManager::startWiFiExport(const char* filename) {
   
   Serial.println("Starte WiFi-Export...");
   
-  WiFi.mode(WIFI_AP);
-  WiFi.setTxPower(WIFI_POWER_11dBm);
-  
-  int randomNum = random(1000, 9999);
-  String ssid = "WindTurbine_" + String(randomNum);
-  currentSSID = ssid;
-  
-  if (!WiFi.softAP(ssid.c_str(), "windturbine", 1, 0, 1)) {
-    Serial.println("Fehler beim Starten des WiFi-AP");
+  // Läuft die Spiegelung bereits, bleibt der AP bestehen
+  if (!starteAccessPoint()) {
     return false;
   }
-  
-  Serial.print("AP gestartet mit SSID: ");
-  Serial.println(ssid);
-  Serial.print("IP-Adresse: ");
-  Serial.println(WiFi.softAPIP());
-  
-  if (!MDNS.begin("windturbine")) {
-    Serial.println("Fehler beim Starten von mDNS");
-  }
+  beendeServer();
   
   try {
     server = new WebServer(80);
     if (!server) {
-      WiFi.disconnect(true);
-      WiFi.mode(WIFI_OFF);
+      beendeAccessPoint();
       return false;
     }
   } catch (...) {
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_OFF);
+    beendeAccessPoint();
     return false;
   }
   
@@ -148,6 +140,10 @@ bool WindTurbineDataManager::startWiFiExport(const char* filename) {
     this->serveCorrectedSVG("pareto", filename);
   });
   
+  server->on("/svg/half-normal", HTTP_GET, [this, filename]() {
+    this->serveCorrectedSVG("half-normal", filename);
+  });
+  
   server->on("/svg/interaction", HTTP_GET, [this, filename]() {
     this->serveCorrectedSVG("interaction", filename);
   });
@@ -160,6 +156,9 @@ bool WindTurbineDataManager::startWiFiExport(const char* filename) {
     this->serveCorrectedSVG("factorial", filename);
   });
   
+  // Spiegelung des Displays und Screenshot
+  registriereSpiegelRouten();
+  
   server->begin();
   
   currentExportFilename = filename;
@@ -170,23 +169,311 @@ bool WindTurbineDataManager::startWiFiExport(const char* filename) {
 }
 
 void WindTurbineDataManager::stopWiFiExport() {
+  beendeServer();
+  wifiExportActive = false;
+  
+  // Die Spiegelung läuft mit eigenem Server weiter
+  if (spiegelungAktiv && starteSpiegelServer()) {
+    Serial.println("WiFi-Export gestoppt, Spiegelung aktiv");
+    return;
+  }
+  
+  beendeAccessPoint();
+  spiegelungAktiv = false;
+  
+  Serial.println("WiFi-Export gestoppt");
+}
+
+void WindTurbineDataManager::handleWiFiExport() {
+  if (server && (wifiExportActive || spiegelungAktiv)) {
+    server->handleClient();
+  }
+}
+
+/**
+ * Startet den Access Point, falls er nicht schon läuft
+ */
+bool WindTurbineDataManager::starteAccessPoint() {
+  if (accessPointAktiv) {
+    return true;
+  }
+  
+  WiFi.mode(WIFI_AP);
+  WiFi.setTxPower(WIFI_POWER_11dBm);
+  
+  int randomNum = random(1000, 9999);
+  String ssid = "WindTurbine_" + String(randomNum);
+  currentSSID = ssid;
+  
+  if (!WiFi.softAP(ssid.c_str(), "windturbine", 1, 0, 1)) {
+    Serial.println("Fehler beim Starten des WiFi-AP");
+    WiFi.mode(WIFI_OFF);
+    return false;
+  }
+  
+  Serial.print("AP gestartet mit SSID: ");
+  Serial.println(ssid);
+  Serial.print("IP-Adresse: ");
+  Serial.println(WiFi.softAPIP());
+  
+  if (!MDNS.begin("windturbine")) {
+    Serial.println("Fehler beim Starten von mDNS");
+  }
+  
+  accessPointAktiv = true;
+  return true;
+}
+
+void WindTurbineDataManager::beendeAccessPoint() {
+  beendeServer();
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+  accessPointAktiv = false;
+}
+
+void WindTurbineDataManager::beendeServer() {
+  if (spiegelClient) {
+    spiegelClient.stop();
+  }
   if (server) {
     server->stop();
     delete server;
     server = nullptr;
   }
+}
+
+/**
+ * Startet die Spiegelung des Displays unter http://<IP>/spiegel
+ * Während eines WiFi-Exports läuft sie auf dessen Server mit.
+ */
+bool WindTurbineDataManager::startSpiegelung() {
+  if (spiegelungAktiv) {
+    return true;
+  }
+  if (!starteAccessPoint()) {
+    return false;
+  }
   
-  WiFi.disconnect(true);
-  WiFi.mode(WIFI_OFF);
-  wifiExportActive = false;
+  spiegelungAktiv = true;
+  if (!wifiExportActive && !starteSpiegelServer()) {
+    spiegelungAktiv = false;
+    beendeAccessPoint();
+    return false;
+  }
   
-  Serial.println("WiFi-Export gestoppt");
+  Serial.println("Spiegelung gestartet: http://" + WiFi.softAPIP().toString() + "/spiegel");
+  return true;
 }
 
-void WindTurbineDataManager::handleWiFiExport() {
-  if (server && wifiExportActive) {
-    server->handleClient();
+void WindTurbineDataManager::stopSpiegelung() {
+  if (!spiegelungAktiv) {
+    return;
+  }
+  spiegelungAktiv = false;
+  
+  if (spiegelClient) {
+    spiegelClient.stop();
+  }
+  if (!wifiExportActive) {
+    beendeAccessPoint();
+  }
+  Serial.println("Spiegelung gestoppt");
+}
+
+bool WindTurbineDataManager::isSpiegelungAktiv() {
+  return spiegelungAktiv;
+}
+
+bool WindTurbineDataManager::istSpiegelVerbunden() {
+  return spiegelungAktiv && spiegelClient && spiegelClient.connected();
+}
+
+/**
+ * true einmalig nach einer neuen Verbindung (dann das ganze Bild senden)
+ */
+bool WindTurbineDataManager::pruefeNeueSpiegelVerbindung() {
+  bool neu = spiegelNeu;
+  spiegelNeu = false;
+  return neu;
+}
+
+/**
+ * Schickt kodierte Bereiche an den Browser
+ * Kann der Browser nicht schnell genug lesen, wird die Verbindung getrennt,
+ * statt zu warten; er verbindet sich neu und erhält das ganze Bild.
+ */
+bool WindTurbineDataManager::sendeSpiegelDaten(const uint8_t* daten, size_t laenge) {
+  if (!istSpiegelVerbunden()) {
+    return false;
+  }
+  if (spiegelClient.write(daten, laenge) != laenge) {
+    Serial.println("Spiegelung: Browser zu langsam, Verbindung getrennt");
+    spiegelClient.stop();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Server nur für die Spiegelung (ohne WiFi-Export)
+ */
+bool WindTurbineDataManager::starteSpiegelServer() {
+  beendeServer();
+  server = new WebServer(80);
+  if (!server) {
+    return false;
+  }
+  
+  server->on("/", HTTP_GET, [this]() {
+    this->serveSpiegelSeite();
+  });
+  registriereSpiegelRouten();
+  server->begin();
+  return true;
+}
+
+void WindTurbineDataManager::registriereSpiegelRouten() {
+  server->on("/spiegel", HTTP_GET, [this]() {
+    this->serveSpiegelSeite();
+  });
+  
+  server->on("/spiegel/strom", HTTP_GET, [this]() {
+    this->oeffneSpiegelStrom();
+  });
+  
+  server->on("/screenshot.png", HTTP_GET, [this]() {
+    this->serveScreenshot();
+  });
+}
+
+// Gibt PNG-Daten als Chunk der HTTP-Antwort weiter
+static bool sendePngDaten(const uint8_t* daten, size_t laenge, void* kontext) {
+  WebServer* server = (WebServer*)kontext;
+  server->sendContent((const char*)daten, laenge);
+  return server->client().connected();
+}
+
+/**
+ * Aktueller Bildschirminhalt als PNG
+ * Zeile für Zeile aus dem Schattenbild gelesen und kodiert, das Bild wird
+ * nie vollständig im Speicher gehalten. Ohne PSRAM nur mit SPIEGEL_RUECKLESEN
+ * (siehe WindTurbineSpiegel.h).
+ */
+void WindTurbineDataManager::serveScreenshot() {
+  if (!WindTurbineSpiegel::kannLesen()) {
+    server->send(503, "text/plain", "Bildschirm kann nicht gelesen werden (kein PSRAM)");
+    return;
   }
+  
+  unsigned long start = millis();
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->sendHeader("Cache-Control", "no-cache");
+  server->sendHeader("Content-Disposition", "inline; filename=\"screenshot.png\"");
+  server->send(200, "image/png", "");
+  
+  uint16_t zeile[480];
+  WindTurbinePngStrom png;
+  bool ok = png.beginne(480, 320, sendePngDaten, server);
+  for (int16_t y = 0; ok && y < 320; y++) {
+    ok = WindTurbineSpiegel::leseZeile(y, zeile) && png.schreibeZeile(zeile);
+  }
+  ok = png.beende() && ok;
+  server->sendContent("");
+  
+  Serial.print("Screenshot: ");
+  Serial.print(png.geschriebeneBytes());
+  Serial.print(" Bytes in ");
+  Serial.print(millis() - start);
+  Serial.println(ok ? " ms" : " ms (abgebrochen)");
+}
+
+/**
+ * Seite mit Canvas, die den Datenstrom dekodiert
+ * Format der Streifen siehe WindTurbineSpiegel.h
+ */
+void WindTurbineDataManager::serveSpiegelSeite() {
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(200, "text/html", "");
+  
+  server->sendContent("<!DOCTYPE html><html lang='de'><head>");
+  server->sendContent("<meta charset='UTF-8'>");
+  server->sendContent("<meta name='viewport' content='width=device-width, initial-scale=1.0'>");
+  server->sendContent("<title>🌪️ Windkraft-Experiment Spiegelung</title>");
+  server->sendContent("<style>");
+  server->sendContent("body { margin: 0; background: #111; color: #ccc; font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif; text-align: center; }");
+  server->sendContent("canvas { width: 100%; max-width: 1440px; image-rendering: pixelated; background: #000; }");
+  server->sendContent("#status { padding: 6px; font-size: 0.9rem; }");
+  server->sendContent("</style>");
+  server->sendContent("</head><body>");
+  server->sendContent("<canvas id='bild' width='480' height='320'></canvas>");
+  server->sendContent("<div id='status'>Verbinde...</div>");
+  server->sendContent("<a href='/screenshot.png' download='screenshot.png' style='color: #8cf;'>Screenshot (PNG)</a>");
+  
+  server->sendContent("<script>");
+  server->sendContent("const c = document.getElementById('bild'), ctx = c.getContext('2d');");
+  server->sendContent("const bild = ctx.createImageData(480, 320), d = bild.data, status = document.getElementById('status');");
+  server->sendContent("for (let i = 3; i < d.length; i += 4) d[i] = 255;");
+  // Ein Streifen: 'R', x, y, w, h, Anzahl Läufe, danach je Lauf Länge und RGB565
+  server->sendContent("function streifen(b, v, p) {");
+  server->sendContent("  const x = v.getUint16(p + 1, true), y = v.getUint16(p + 3, true), w = v.getUint16(p + 5, true);");
+  server->sendContent("  const h = v.getUint16(p + 7, true), n = v.getUint16(p + 9, true);");
+  server->sendContent("  if (b.length - p < 11 + n * 4) return -1;");
+  server->sendContent("  let q = p + 11, i = 0;");
+  server->sendContent("  for (let k = 0; k < n; k++, q += 4) {");
+  server->sendContent("    let anzahl = v.getUint16(q, true); const f = v.getUint16(q + 2, true);");
+  server->sendContent("    const r = ((f >> 11) * 527 + 23) >> 6, g = (((f >> 5) & 63) * 259 + 33) >> 6, bl = ((f & 31) * 527 + 23) >> 6;");
+  server->sendContent("    while (anzahl-- > 0) { const o = ((y + Math.floor(i / w)) * 480 + x + i % w) * 4; d[o] = r; d[o + 1] = g; d[o + 2] = bl; i++; }");
+  server->sendContent("  }");
+  server->sendContent("  ctx.putImageData(bild, 0, 0, x, y, w, h);");
+  server->sendContent("  return q;");
+  server->sendContent("}");
+  server->sendContent("async function verbinde() {");
+  server->sendContent("  try {");
+  server->sendContent("    const antwort = await fetch('/spiegel/strom', { cache: 'no-store' });");
+  server->sendContent("    const leser = antwort.body.getReader();");
+  server->sendContent("    let rest = new Uint8Array(0);");
+  server->sendContent("    status.textContent = 'Verbunden';");
+  server->sendContent("    for (;;) {");
+  server->sendContent("      const { value, done } = await leser.read();");
+  server->sendContent("      if (done) break;");
+  server->sendContent("      const b = new Uint8Array(rest.length + value.length); b.set(rest); b.set(value, rest.length);");
+  server->sendContent("      const v = new DataView(b.buffer); let p = 0;");
+  server->sendContent("      while (b.length - p >= 11) {");
+  server->sendContent("        if (b[p] !== 82) throw new Error('Datenstrom gestoert');");
+  server->sendContent("        const naechster = streifen(b, v, p);");
+  server->sendContent("        if (naechster < 0) break;");
+  server->sendContent("        p = naechster;");
+  server->sendContent("      }");
+  server->sendContent("      rest = b.slice(p);");
+  server->sendContent("    }");
+  server->sendContent("  } catch (e) {}");
+  server->sendContent("  status.textContent = 'Verbindung getrennt - verbinde neu...';");
+  server->sendContent("  setTimeout(verbinde, 1000);");
+  server->sendContent("}");
+  server->sendContent("verbinde();");
+  server->sendContent("</script>");
+  server->sendContent("</body></html>");
+  server->sendContent("");
+}
+
+/**
+ * Übernimmt die Verbindung als dauerhaften Datenstrom
+ * Die Antwort hat keine Länge; gesendet wird danach aus loop() über
+ * sendeSpiegelDaten(). Es gibt nur einen Betrachter, eine neue Verbindung
+ * ersetzt die alte.
+ */
+void WindTurbineDataManager::oeffneSpiegelStrom() {
+  if (spiegelClient) {
+    spiegelClient.stop();
+  }
+  spiegelClient = server->client();
+  spiegelClient.setNoDelay(true);
+  spiegelClient.print("HTTP/1.1 200 OK\r\n"
+                      "Content-Type: application/octet-stream\r\n"
+                      "Cache-Control: no-cache\r\n"
+                      "Connection: close\r\n\r\n");
+  spiegelNeu = true;
+  Serial.println("Spiegelung: Browser verbunden");
 }
 
 /**
@@ -238,6 +525,8 @@ void WindTurbineDataManager::serveEnhancedIndex() {
   server->sendContent("<p>Grundlegende Datenformate für weitere Analyse</p>");
   server->sendContent("<a href='/data.json' class='btn btn-primary'>📄 JSON Daten</a>");
   server->sendContent("<a href='/data.csv' class='btn btn-primary'>📈 CSV Export</a>");
+  server->sendContent("<a href='/spiegel' class='btn btn-secondary'>🖥️ Display-Spiegelung</a>");
+  server->sendContent("<a href='/screenshot.png' class='btn btn-secondary'>📷 Screenshot</a>");
   server->sendContent("</div>");
   
   // Korrigierte PNG-Exports
@@ -257,6 +546,7 @@ void WindTurbineDataManager::serveEnhancedIndex() {
   server->sendContent("<p>Verlustfrei skalierbare Vektorgrafiken für professionelle Verwendung</p>");
   server->sendContent("<a href='/svg/main-effects' class='btn btn-warning'>📐 SVG Main Effects</a>");
   server->sendContent("<a href='/svg/pareto' class='btn btn-warning'>📐 SVG Pareto</a>");
+  server->sendContent("<a href='/svg/half-normal' class='btn btn-warning'>📐 SVG Halbnormal (Lenth)</a>");
   server->sendContent("<a href='/svg/interaction' class='btn btn-warning'>📐 SVG Interaction</a>");
   server->sendContent("<a href='/svg/effects' class='btn btn-warning'>📐 SVG Effekte</a>");
   server->sendContent("<a href='/svg/factorial' class='btn btn-warning'>📐 SVG Faktoriell</a>");
@@ -285,7 +575,7 @@ void WindTurbineDataManager::serveCorrectedPNG(const String& chartType, const ch
     return;
   }
   
-  DynamicJsonDocument doc(4096);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -415,6 +705,8 @@ void WindTurbineDataManager::serveCorrectedSVG(const String& chartType, const ch
     generateMainEffectsSVG(filename);
   } else if (chartType == "pareto") {
     generateParetoSVG(filename);
+  } else if (chartType == "half-normal") {
+    generateHalfNormalSVG(filename);
   } else if (chartType == "interaction") {
     generateInteractionSVG(filename);
   } else if (chartType == "effects") {
@@ -962,7 +1254,7 @@ void WindTurbineDataManager::generateEffectsChartJS(const char* filename) {
   float realEffects[5] = {0, 0, 0, 0, 0};
   
   if (file) {
-    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -1082,7 +1374,7 @@ void WindTurbineDataManager::generateFactorialChartJS(const char* filename) {
   float realData[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   
   if (file) {
-    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -1192,6 +1484,35 @@ void WindTurbineDataManager::generateFactorialChartJS(const char* filename) {
   server->sendContent("drawChart();");
 }
 
+/**
+ * Effektanalyse aus den gespeicherten Einzelmessungen und Mittelwerten eines Plans
+ * Auch ältere Dateien ohne gespeicherte Konfidenzintervalle liefern so Intervalle.
+ */
+template <class Plan>
+static bool analysiereGespeichertenPlan(JsonArray messungenArray, JsonArray mittelwerteArray, WindTurbineEffektAnalyse& analyse) {
+  float messungen[Plan::VERSUCHE][5];
+  float mittelwerte[Plan::VERSUCHE];
+  for (int i = 0; i < Plan::VERSUCHE; i++) {
+    JsonArray reihe = messungenArray[i];
+    for (int j = 0; j < 5; j++) {
+      messungen[i][j] = reihe[j].as<float>();
+    }
+    mittelwerte[i] = mittelwerteArray[i].as<float>();
+  }
+  analyse.setzePlan<Plan>();
+  return analyse.berechne(mittelwerte, &messungen[0][0], 5);
+}
+
+/**
+ * Fehlerbalken (Konfidenzintervall) als SVG-Linien mit Endstrichen
+ */
+static String svgFehlerbalken(int x, int yHoch, int yTief) {
+  String linie = "<line x1='" + String(x) + "' y1='" + String(yHoch) + "' x2='" + String(x) + "' y2='" + String(yTief) + "' stroke='#2c3e50' stroke-width='1.5'/>";
+  linie += "<line x1='" + String(x - 6) + "' y1='" + String(yHoch) + "' x2='" + String(x + 6) + "' y2='" + String(yHoch) + "' stroke='#2c3e50' stroke-width='1.5'/>";
+  linie += "<line x1='" + String(x - 6) + "' y1='" + String(yTief) + "' x2='" + String(x + 6) + "' y2='" + String(yTief) + "' stroke='#2c3e50' stroke-width='1.5'/>";
+  return linie;
+}
+
 /**
  * SVG-Generierungsfunktionen
  */
@@ -1315,6 +1636,91 @@ void WindTurbineDataManager::generateParetoSVG(const char* filename) {
   }
 }
 
+/**
+ * Halbnormal-Diagramm aller Kontraste des Teilplans mit Lenths ME und SME
+ * Wird aus den gespeicherten Mittelwerten neu berechnet, Wiederholungen sind nicht nötig.
+ */
+void WindTurbineDataManager::generateHalfNormalSVG(const char* filename) {
+  server->sendContent("<text x='400' y='25' class='title' text-anchor='middle'>Halbnormal-Diagramm nach Lenth (SVG)</text>");
+  
+  // Lade Daten
+  WindTurbineEffektAnalyse analyse;
+  WindTurbineLenth lenth;
+  File file = SPIFFS.open("/" + String(filename), FILE_READ);
+  if (file) {
+    DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    
+    if (!error && doc.containsKey("teilfaktoriellMessungen") &&
+        analysiereGespeichertenPlan<TeilfaktoriellPlan>(doc["teilfaktoriellMessungen"], doc["teilfaktoriellMittelwerte"], analyse)) {
+      lenth.berechne(analyse);
+    }
+  }
+  
+  if (!lenth.istGueltig()) {
+    server->sendContent("<text x='400' y='300' class='text' text-anchor='middle'>Keine Effektdaten vorhanden</text>");
+    return;
+  }
+  
+  WindTurbineAliasStruktur alias;
+  alias.setzePlan<TeilfaktoriellPlan>();
+  
+  int chartX = 100, chartY = 80, chartWidth = 560, chartHeight = 380;
+  int anzahl = lenth.anzahlEffekte();
+  float maxBetrag = max((float)fabs(lenth.effekt(anzahl - 1)), lenth.sme()) * 1.1;
+  float maxQuantil = lenth.quantil(anzahl - 1) * 1.1;
+  
+  // Achsen
+  server->sendContent("<line x1='" + String(chartX) + "' y1='" + String(chartY) + "' x2='" + String(chartX) + "' y2='" + String(chartY + chartHeight) + "' class='axis'/>");
+  server->sendContent("<line x1='" + String(chartX) + "' y1='" + String(chartY + chartHeight) + "' x2='" + String(chartX + chartWidth) + "' y2='" + String(chartY + chartHeight) + "' class='axis'/>");
+  
+  // Raster und Beschriftung der Quantile
+  for (int q = 0; q <= (int)maxQuantil; q++) {
+    int y = chartY + chartHeight - q / maxQuantil * chartHeight;
+    if (q > 0) server->sendContent("<line x1='" + String(chartX) + "' y1='" + String(y) + "' x2='" + String(chartX + chartWidth) + "' y2='" + String(y) + "' class='grid'/>");
+    server->sendContent("<text x='" + String(chartX - 5) + "' y='" + String(y + 3) + "' class='text' text-anchor='end'>" + String(q) + "</text>");
+  }
+  for (int i = 0; i <= 4; i++) {
+    int x = chartX + i * chartWidth / 4;
+    server->sendContent("<text x='" + String(x) + "' y='" + String(chartY + chartHeight + 18) + "' class='text' text-anchor='middle'>" + String(maxBetrag * i / 4, 2) + "</text>");
+  }
+  server->sendContent("<text x='" + String(chartX + chartWidth / 2) + "' y='" + String(chartY + chartHeight + 40) + "' class='factor-text' text-anchor='middle'>|Effekt| (uW)</text>");
+  server->sendContent("<text x='" + String(chartX - 45) + "' y='" + String(chartY + chartHeight / 2) + "' class='factor-text' text-anchor='middle' transform='rotate(-90 " + String(chartX - 45) + " " + String(chartY + chartHeight / 2) + ")'>Halbnormal-Quantil</text>");
+  
+  // Gerade der inaktiven Effekte: |c| = PSE * q
+  float endQuantil = maxQuantil;
+  if (lenth.pse() * endQuantil > maxBetrag) endQuantil = maxBetrag / lenth.pse();
+  int endeX = chartX + lenth.pse() * endQuantil / maxBetrag * chartWidth;
+  int endeY = chartY + chartHeight - endQuantil / maxQuantil * chartHeight;
+  server->sendContent("<line x1='" + String(chartX) + "' y1='" + String(chartY + chartHeight) + "' x2='" + String(endeX) + "' y2='" + String(endeY) + "' stroke='#adb5bd' stroke-width='1.5'/>");
+  
+  // Fehlergrenzen
+  const float grenzen[2] = {lenth.me(), lenth.sme()};
+  const char* namen[2] = {"ME", "SME"};
+  const char* farben[2] = {"#e67e22", "#c0392b"};
+  for (int g = 0; g < 2; g++) {
+    int x = chartX + grenzen[g] / maxBetrag * chartWidth;
+    server->sendContent("<line x1='" + String(x) + "' y1='" + String(chartY) + "' x2='" + String(x) + "' y2='" + String(chartY + chartHeight) + "' stroke='" + String(farben[g]) + "' stroke-width='2' stroke-dasharray='6,4'/>");
+    server->sendContent("<text x='" + String(x) + "' y='" + String(chartY - 6) + "' class='text' text-anchor='middle' fill='" + String(farben[g]) + "'>" + String(namen[g]) + " = " + String(grenzen[g], 2) + "</text>");
+  }
+  
+  // Punkte mit Aliasnamen
+  for (int rang = 0; rang < anzahl; rang++) {
+    int x = chartX + fabs(lenth.effekt(rang)) / maxBetrag * chartWidth;
+    int y = chartY + chartHeight - lenth.quantil(rang) / maxQuantil * chartHeight;
+    String farbe = lenth.istAktiv(rang) ? "#c0392b" : (lenth.istAuffaellig(rang) ? "#e67e22" : "#3498db");
+    server->sendContent("<circle cx='" + String(x) + "' cy='" + String(y) + "' r='5' fill='" + farbe + "' stroke='#2c3e50'/>");
+    
+    char kette[32];
+    alias.formatiereKette(lenth.wort(rang), kette, sizeof(kette), 2);
+    server->sendContent("<text x='" + String(x - 8) + "' y='" + String(y + 4) + "' class='text' text-anchor='end'>" + String(kette) + " (" + String(lenth.effekt(rang), 2) + ")</text>");
+  }
+  
+  // Kennwerte
+  server->sendContent("<text x='" + String(chartX) + "' y='" + String(chartY + chartHeight + 70) + "' class='text'>PSE = " + String(lenth.pse(), 3) + " uW, FG = " + String(lenth.freiheitsgrade(), 1) + ", alpha = " + String(ANOVA_ALPHA, 2) + "</text>");
+}
+
 void WindTurbineDataManager::generateInteractionSVG(const char* filename) {
   server->sendContent("<text x='400' y='25' class='title' text-anchor='middle'>Interaction Plot (SVG)</text>");
   
@@ -1383,10 +1789,11 @@ void WindTurbineDataManager::generateEffectsSVG(const char* filename) {
   // Lade Daten
   File file = SPIFFS.open("/" + String(filename), FILE_READ);
   float effects[5] = {0.5, -0.3, 0.2, -0.7, 0.4}; // Fallback
+  float halbbreite = 0;
   bool hasRealData = false;
   
   if (file) {
-    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -1396,6 +1803,13 @@ void WindTurbineDataManager::generateEffectsSVG(const char* filename) {
       for (int i = 0; i < 5 && i < effekteArray.size(); i++) {
         effects[i] = effekteArray[i].as<float>();
       }
+      
+      // Konfidenzintervall der Effekte aus den Wiederholungen
+      WindTurbineEffektAnalyse analyse;
+      if (doc.containsKey("teilfaktoriellMessungen") &&
+          analysiereGespeichertenPlan<TeilfaktoriellPlan>(doc["teilfaktoriellMessungen"], doc["teilfaktoriellMittelwerte"], analyse)) {
+        halbbreite = analyse.konfidenzHalbbreite();
+      }
     }
   }
   
@@ -1431,10 +1845,21 @@ void WindTurbineDataManager::generateEffectsSVG(const char* filename) {
     int textY = effects[i] > 0 ? y - 5 : y + barHeight + 15;
     server->sendContent("<text x='" + String(x + barWidth * 0.4) + "' y='" + String(textY) + "' class='text' text-anchor='middle'>" + String(effects[i], 2) + "</text>");
     
+    // Konfidenzintervall (auf den Diagrammrahmen begrenzt)
+    if (halbbreite > 0) {
+      int yHoch = constrain((int)(zeroY - (effects[i] + halbbreite) * scale), chartY, chartY + chartHeight);
+      int yTief = constrain((int)(zeroY - (effects[i] - halbbreite) * scale), chartY, chartY + chartHeight);
+      server->sendContent(svgFehlerbalken(x + barWidth * 0.4, yHoch, yTief));
+    }
+    
     // Faktorname
     server->sendContent("<text x='" + String(x + barWidth * 0.4) + "' y='" + String(chartY + chartHeight + 20) + "' class='text' text-anchor='middle'>" + String(faktorNamen[i]) + "</text>");
   }
   
+  if (halbbreite > 0) {
+    server->sendContent("<text x='" + String(chartX + chartWidth) + "' y='" + String(chartY - 8) + "' class='text' text-anchor='end'>Fehlerbalken: " + String(KONFIDENZ_NIVEAU) + "%-Konfidenzintervall (&#177;" + String(halbbreite, 2) + ")</text>");
+  }
+  
   // Y-Achse Beschriftung
   server->sendContent("<text x='" + String(chartX - 5) + "' y='" + String(zeroY + 3) + "' class='text' text-anchor='end'>0</text>");
   if (maxEffect > 0) {
@@ -1449,10 +1874,11 @@ void WindTurbineDataManager::generateFactorialSVG(const char* filename) {
   // Lade Daten
   File file = SPIFFS.open("/" + String(filename), FILE_READ);
   float data[8] = {0.8, 1.2, 0.7, 1.5, 0.9, 1.4, 1.1, 1.8}; // Fallback
+  float halbbreiten[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   bool hasRealData = false;
   
   if (file) {
-    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -1462,6 +1888,15 @@ void WindTurbineDataManager::generateFactorialSVG(const char* filename) {
       for (int i = 0; i < 8 && i < vfMittelwerte.size(); i++) {
         data[i] = vfMittelwerte[i].as<float>();
       }
+      
+      // Konfidenzintervall je Versuchsmittelwert
+      WindTurbineEffektAnalyse analyse;
+      if (doc.containsKey("vollfaktoriellMessungen") &&
+          analysiereGespeichertenPlan<VollfaktoriellPlan>(doc["vollfaktoriellMessungen"], vfMittelwerte, analyse)) {
+        for (int i = 0; i < 8; i++) {
+          halbbreiten[i] = analyse.versuchsHalbbreite(i);
+        }
+      }
     }
   }
   
@@ -1501,6 +1936,13 @@ void WindTurbineDataManager::generateFactorialSVG(const char* filename) {
     // Wert
     server->sendContent("<text x='" + String(x + barWidth * 0.4) + "' y='" + String(y - 5) + "' class='text' text-anchor='middle'>" + String(data[i], 2) + "</text>");
     
+    // Konfidenzintervall des Mittelwerts
+    if (halbbreiten[i] > 0) {
+      int yHoch = constrain((int)(y - halbbreiten[i] * scale), chartY, chartY + chartHeight);
+      int yTief = constrain((int)(y + halbbreiten[i] * scale), chartY, chartY + chartHeight);
+      server->sendContent(svgFehlerbalken(x + barWidth * 0.4, yHoch, yTief));
+    }
+    
     // Versuchsnummer
     server->sendContent("<text x='" + String(x + barWidth * 0.4) + "' y='" + String(chartY + chartHeight + 15) + "' class='text' text-anchor='middle'>" + String(i + 1) + "</text>");
   }
@@ -1548,7 +1990,7 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
     return;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -1587,23 +2029,15 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
   // ===========================================
   server->sendContent("=== TEILFAKTORIELLE VERSUCHE (2^(5-2)) ===\n");
   server->sendContent(";;;;;\n");
-  server->sendContent("Versuch_Nr;Messung_1_uW;Messung_2_uW;Messung_3_uW;Messung_4_uW;Messung_5_uW;Mittelwert_uW;Standardabweichung;Steigung;Groesse;Abstand;Luftstaerke;Blattanzahl\n");
+  server->sendContent("Versuch_Nr;Messung_1_uW;Messung_2_uW;Messung_3_uW;Messung_4_uW;Messung_5_uW;Mittelwert_uW;Standardabweichung;Steigung;Groesse;Abstand;Luftstaerke;Blattanzahl;Anzahl_Messungen;KI" + String(KONFIDENZ_NIVEAU) + "_Halbbreite_uW\n");
   
   JsonArray tfMessungen = doc["teilfaktoriellMessungen"];
   JsonArray tfMittelwerte = doc["teilfaktoriellMittelwerte"];
   JsonArray tfStdDev = doc["teilfaktoriellStandardabweichungen"];
   
-  // Teilfaktorieller Plan (aus dem Code)
-  const int teilfaktoriellPlan[8][5] = {
-    {-1, -1, -1,  1,  1},
-    { 1, -1, -1, -1, -1},
-    {-1,  1, -1, -1,  1},
-    { 1,  1, -1,  1, -1},
-    {-1, -1,  1,  1, -1},
-    { 1, -1,  1, -1,  1},
-    {-1,  1,  1, -1, -1},
-    { 1,  1,  1,  1,  1}
-  };
+  // Konfidenzintervalle aus den gespeicherten Einzelmessungen (auch für ältere Dateien)
+  WindTurbineEffektAnalyse tfAnalyse;
+  analysiereGespeichertenPlan<TeilfaktoriellPlan>(tfMessungen, tfMittelwerte, tfAnalyse);
   
   for (int i = 0; i < 8; i++) {
     String zeile = String(i+1) + ";";
@@ -1623,6 +2057,9 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
       zeile += String(teilfaktoriellPlan[i][j]) + ";";
     }
     
+    // Vorzeitig abgeschlossene Versuche haben weniger als 5 Messungen
+    zeile += String(tfAnalyse.anzahlMessungen(i)) + ";";
+    zeile += formatGerman(tfAnalyse.versuchsHalbbreite(i));
     zeile += "\n";
     server->sendContent(zeile);
   }
@@ -1644,12 +2081,14 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
     int faktorIndex = ausgewaehlteVollfaktoren[i].as<int>();
     vfHeader += String(faktorNamen[faktorIndex]) + ";";
   }
-  vfHeader += "\n";
+  vfHeader += "Anzahl_Messungen;KI" + String(KONFIDENZ_NIVEAU) + "_Halbbreite_uW\n";
   server->sendContent(vfHeader);
   
   JsonArray vfMessungen = doc["vollfaktoriellMessungen"];
   JsonArray vfMittelwerte = doc["vollfaktoriellMittelwerte"];
   JsonArray vfStdDev = doc["vollfaktoriellStandardabweichungen"];
+  WindTurbineEffektAnalyse vfAnalyse;
+  analysiereGespeichertenPlan<VollfaktoriellPlan>(vfMessungen, vfMittelwerte, vfAnalyse);
   
   for (int i = 0; i < 8; i++) {
     String zeile = String(i+1) + ";";
@@ -1666,22 +2105,71 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
     
     // Vollfaktorielle Faktoreinstellungen (2^3 Plan)
     for (int j = 0; j < 3; j++) {
-      int stufe = (i & (1 << j)) ? 1 : -1;
-      zeile += String(stufe) + ";";
+      zeile += String(vollfaktoriellPlan[i][j]) + ";";
     }
     
+    zeile += String(vfAnalyse.anzahlMessungen(i)) + ";";
+    zeile += formatGerman(vfAnalyse.versuchsHalbbreite(i));
     zeile += "\n";
     server->sendContent(zeile);
   }
   
   server->sendContent(";;;;;\n");
   
+  // ===========================================
+  // 3b. STERN- UND ZENTRUMSPUNKTE (ZZP)
+  // ===========================================
+  // Nur in Dateien mit gemessener oder geplanter Ergänzung des Würfels
+  if (doc.containsKey("zzpMessungen")) {
+    server->sendContent("=== STERN- UND ZENTRUMSPUNKTE (ZENTRALER ZUSAMMENGESETZTER PLAN) ===\n");
+    server->sendContent(";;;;;\n");
+    
+    String zzpHeader = "Versuch_Nr;Punkt;Messung_1_uW;Messung_2_uW;Messung_3_uW;Messung_4_uW;Messung_5_uW;Mittelwert_uW;Standardabweichung";
+    for (int i = 0; i < 3 && i < ausgewaehlteVollfaktoren.size(); i++) {
+      int faktorIndex = ausgewaehlteVollfaktoren[i].as<int>();
+      zzpHeader += ";" + String(faktorNamen[faktorIndex]);
+    }
+    server->sendContent(zzpHeader + "\n");
+    
+    JsonArray zzpMessungen = doc["zzpMessungen"];
+    JsonArray zzpMittelwerte = doc["zzpMittelwerte"];
+    JsonArray zzpStdDev = doc["zzpStandardabweichungen"];
+    JsonArray zzpStufen = doc["zzpStufen"];
+    int zzpAnzahl = doc["zzpAnzahl"] | (int)zzpMessungen.size();
+    
+    for (int i = 0; i < zzpAnzahl; i++) {
+      String zeile = String(i+1) + ";";
+      zeile += (i >= zzpAnzahl - ZZP_ZENTRUMSPUNKTE) ? "Zentrum;" : "Stern;";
+      
+      // Messungen
+      JsonArray messungen = zzpMessungen[i];
+      for (int j = 0; j < 5; j++) {
+        zeile += formatGerman(messungen[j].as<float>()) + ";";
+      }
+      
+      // Mittelwert und Standardabweichung
+      zeile += formatGerman(zzpMittelwerte[i].as<float>()) + ";";
+      zeile += formatGerman(zzpStdDev[i].as<float>());
+      
+      // Kodierte Stufen der ausgewählten Faktoren
+      JsonArray stufen = zzpStufen[i];
+      for (int j = 0; j < (int)stufen.size(); j++) {
+        zeile += ";" + formatGerman(stufen[j].as<float>(), 2);
+      }
+      zeile += "\n";
+      server->sendContent(zeile);
+    }
+    
+    server->sendContent(";;;;;\n");
+  }
+  
   // ===========================================
   // 4. HAUPTEFFEKTE-ANALYSE
   // ===========================================
   server->sendContent("=== HAUPTEFFEKTE-ANALYSE ===\n");
   server->sendContent(";;;;;\n");
-  server->sendContent("Faktor;Effekt_uW;Mittelwert_niedrig_uW;Mittelwert_hoch_uW;Absoluter_Effekt;Rang\n");
+  server->sendContent("Faktor;Effekt_uW;Mittelwert_niedrig_uW;Mittelwert_hoch_uW;Absoluter_Effekt;Rang;KI" + String(KONFIDENZ_NIVEAU) + "_Untergrenze_uW;KI" + String(KONFIDENZ_NIVEAU) + "_Obergrenze_uW\n");
+  float effektHalbbreite = tfAnalyse.konfidenzHalbbreite();
   
   JsonArray effekte = doc["effekte"];
   
@@ -1728,7 +2216,10 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
     zeile += formatGerman(mittelwertNiedrig) + ";";
     zeile += formatGerman(mittelwertHoch) + ";";
     zeile += formatGerman(abs(effektWert)) + ";";
-    zeile += String(i + 1) + "\n";
+    zeile += String(i + 1) + ";";
+    // Ohne Wiederholungen kein Intervall
+    zeile += (effektHalbbreite > 0 ? formatGerman(effektWert - effektHalbbreite) : String("")) + ";";
+    zeile += (effektHalbbreite > 0 ? formatGerman(effektWert + effektHalbbreite) : String("")) + "\n";
     
     server->sendContent(zeile);
   }
@@ -1736,7 +2227,101 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
   server->sendContent(";;;;;\n");
   
   // ===========================================
-  // 5. PARETO-ANALYSE
+  // 5. VARIANZANALYSE (ANOVA)
+  // ===========================================
+  server->sendContent("=== VARIANZANALYSE (ANOVA) ===\n");
+  server->sendContent(";;;;;\n");
+  server->sendContent("Quelle;Effekt_uW;Quadratsumme;FG;Mittleres_Quadrat;F;p_Wert;Signifikant\n");
+  
+  // Aus den gespeicherten Einzelmessungen neu berechnet (auch für ältere Dateien)
+  WindTurbineAnova anova;
+  anova.berechne(tfAnalyse);
+  bool anovaPruefung = anova.hatPruefung();
+  WindTurbineAliasStruktur anovaAlias;
+  anovaAlias.setzePlan<TeilfaktoriellPlan>();
+  
+  for (int i = 0; i < anova.anzahlEffekte() + 3; i++) {
+    int effekteAnzahl = anova.anzahlEffekte();
+    const AnovaZeile& z = i < effekteAnzahl ? anova.effektZeile(i)
+                        : i == effekteAnzahl ? anova.modellZeile()
+                        : i == effekteAnzahl + 1 ? anova.restZeile()
+                        : anova.gesamtZeile();
+    String zeile;
+    if (i < effekteAnzahl) {
+      if (z.faktor >= 0) {
+        zeile = String(faktorNamen[z.faktor]) + ";";
+      } else {
+        char kette[16];
+        anovaAlias.formatiereKette(z.wort, kette, sizeof(kette), 2);
+        zeile = String(kette) + ";";
+      }
+      zeile += formatGerman(z.effekt) + ";";
+    } else {
+      zeile = String(i == effekteAnzahl ? "Modell" : (i == effekteAnzahl + 1 ? "Rest" : "Gesamt")) + ";;";
+    }
+    zeile += formatGerman(z.quadratsumme) + ";";
+    zeile += String(z.freiheitsgrade) + ";";
+    
+    bool mitTest = anovaPruefung && i <= effekteAnzahl;
+    zeile += (i <= effekteAnzahl + 1 ? formatGerman(z.mittleresQuadrat) : String("")) + ";";
+    zeile += (mitTest ? formatGerman(z.f) : String("")) + ";";
+    zeile += (mitTest ? formatGerman(z.p, 5) : String("")) + ";";
+    zeile += (mitTest ? String(z.p < ANOVA_ALPHA ? "ja" : "nein") : String("")) + "\n";
+    
+    server->sendContent(zeile);
+  }
+  
+  if (!anovaPruefung) {
+    server->sendContent("Hinweis;Keine verwertbaren Wiederholungen - kein F-Test;;;;\n");
+  }
+  
+  server->sendContent(";;;;;\n");
+  
+  // Effektprüfung ohne Wiederholungen (Lenth)
+  server->sendContent("=== EFFEKTPRUEFUNG NACH LENTH ===\n");
+  server->sendContent(";;;;;\n");
+  WindTurbineLenth lenth;
+  if (lenth.berechne(tfAnalyse)) {
+    server->sendContent("PSE_uW;" + formatGerman(lenth.pse()) + ";;;;\n");
+    server->sendContent("ME_uW;" + formatGerman(lenth.me()) + ";;;;\n");
+    server->sendContent("SME_uW;" + formatGerman(lenth.sme()) + ";;;;\n");
+    server->sendContent("Freiheitsgrade;" + formatGerman(lenth.freiheitsgrade()) + ";;;;\n");
+    server->sendContent("Effekt;Betrag_uW;Halbnormal_Quantil;Ueber_ME;Ueber_SME;\n");
+    for (int rang = lenth.anzahlEffekte() - 1; rang >= 0; rang--) {
+      char kette[16];
+      anovaAlias.formatiereKette(lenth.wort(rang), kette, sizeof(kette), 2);
+      String zeile = String(kette) + ";" + formatGerman(fabs(lenth.effekt(rang))) + ";";
+      zeile += formatGerman(lenth.quantil(rang)) + ";";
+      zeile += String(lenth.istAuffaellig(rang) ? "ja" : "nein") + ";";
+      zeile += String(lenth.istAktiv(rang) ? "ja" : "nein") + ";\n";
+      server->sendContent(zeile);
+    }
+  } else {
+    server->sendContent("Hinweis;Keine Effekte berechnet;;;;\n");
+  }
+  
+  server->sendContent(";;;;;\n");
+  
+  // Vermengungsstruktur des Plans
+  server->sendContent("=== ALIASSTRUKTUR (2^(5-2)) ===\n");
+  server->sendContent(";;;;;\n");
+  char aliasText[128];
+  anovaAlias.formatiereRelation(aliasText, sizeof(aliasText));
+  server->sendContent("Definierende_Relation;" + String(aliasText) + ";;;;\n");
+  server->sendContent("Aufloesung;" + String(WindTurbineAliasStruktur::aufloesungText(anovaAlias.aufloesung())) + ";;;;\n");
+  server->sendContent("Effekt;Aliaskette;;;;\n");
+  for (unsigned wort = 1; wort < (unsigned)TeilfaktoriellPlan::VERSUCHE; wort++) {
+    // Erstes (kürzestes) Wort der Kette benennt die Spalte
+    anovaAlias.formatiereKette(wort, aliasText, sizeof(aliasText));
+    String kette = String(aliasText);
+    int trenner = kette.indexOf('=');
+    server->sendContent((trenner > 0 ? kette.substring(0, trenner) : kette) + ";" + kette + ";;;;\n");
+  }
+  
+  server->sendContent(";;;;;\n");
+  
+  // ===========================================
+  // 6. PARETO-ANALYSE
   // ===========================================
   server->sendContent("=== PARETO-ANALYSE ===\n");
   server->sendContent(";;;;;\n");
@@ -1766,7 +2351,7 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
   server->sendContent(";;;;;\n");
   
   // ===========================================
-  // 6. REGRESSIONSANALYSE
+  // 7. REGRESSIONSANALYSE
   // ===========================================
   server->sendContent("=== REGRESSIONSANALYSE ===\n");
   server->sendContent(";;;;;\n");
@@ -1800,7 +2385,7 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
   server->sendContent(";;;;;\n");
   
   // ===========================================
-  // 7. OPTIMIERUNG UND PROGNOSE
+  // 8. OPTIMIERUNG UND PROGNOSE
   // ===========================================
   server->sendContent("=== OPTIMIERUNG UND PROGNOSE ===\n");
   server->sendContent(";;;;;\n");
@@ -1839,7 +2424,7 @@ void WindTurbineDataManager::serveCompleteCSV(const char* filename) {
   server->sendContent(";;;;;\n");
   
   // ===========================================
-  // 8. ZUSÄTZLICHE INFORMATIONEN
+  // 9. ZUSÄTZLICHE INFORMATIONEN
   // ===========================================
   server->sendContent("=== ZUSÄTZLICHE INFORMATIONEN ===\n");
   server->sendContent(";;;;;\n");
@@ -1889,6 +2474,15 @@ void WindTurbineDataManager::serveFileChunked(const char* filename) {
   file.close();
 }
 
+// Eine Zeile der ANOVA-Tabelle als JSON-Objekt
+static void schreibeAnovaZeile(JsonObject ziel, const AnovaZeile& zeile) {
+  ziel["sq"] = zeile.quadratsumme;
+  ziel["fg"] = zeile.freiheitsgrade;
+  ziel["mq"] = zeile.mittleresQuadrat;
+  ziel["f"] = zeile.f;
+  ziel["p"] = zeile.p;
+}
+
 /**
  * Basis-Datenverwaltungsfunktionen
  */
@@ -1896,12 +2490,14 @@ bool WindTurbineDataManager::saveExperiment(const char* description, float teilf
                                            float teilfaktoriellMittelwerte[], float teilfaktoriellStandardabweichungen[],
                                            float vollfaktoriellMessungen[][5], float vollfaktoriellMittelwerte[], 
                                            float vollfaktoriellStandardabweichungen[], float effekte[], 
-                                           int ausgewaehlteVollfaktoren[]) {
+                                           int ausgewaehlteVollfaktoren[],
+                                           float zzpMessungen[][5], float zzpMittelwerte[], float zzpStandardabweichungen[],
+                                           const WindTurbineWirkungsflaeche& wirkungsflaeche) {
   
   // Eindeutigen Dateinamen generieren
   String filename = generateFilename();
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   
   // Metadaten
   doc["timestamp"] = millis();
@@ -1940,6 +2536,29 @@ bool WindTurbineDataManager::saveExperiment(const char* description, float teilf
     vfStdDevArray.add(vollfaktoriellStandardabweichungen[i]);
   }
   
+  // Zentraler zusammengesetzter Plan: Stern- und Zentrumspunkte mit ihren kodierten Stufen
+  // (Reihenfolge wie ausgewaehlteVollfaktoren, die Zentrumspunkte zuletzt)
+  int zzpAnzahl = wirkungsflaeche.anzahlErgaenzung();
+  if (zzpAnzahl > 0) {
+    doc["zzpAnzahl"] = zzpAnzahl;
+    JsonArray zzpMessungenArray = doc.createNestedArray("zzpMessungen");
+    JsonArray zzpMittelwerteArray = doc.createNestedArray("zzpMittelwerte");
+    JsonArray zzpStdDevArray = doc.createNestedArray("zzpStandardabweichungen");
+    JsonArray zzpStufenArray = doc.createNestedArray("zzpStufen");
+    for (int i = 0; i < zzpAnzahl; i++) {
+      JsonArray versuch = zzpMessungenArray.createNestedArray();
+      for (int j = 0; j < 5; j++) {
+        versuch.add(zzpMessungen[i][j]);
+      }
+      zzpMittelwerteArray.add(zzpMittelwerte[i]);
+      zzpStdDevArray.add(zzpStandardabweichungen[i]);
+      JsonArray stufen = zzpStufenArray.createNestedArray();
+      for (int k = 0; k < wirkungsflaeche.anzahlFaktoren(); k++) {
+        stufen.add(wirkungsflaeche.stufe(i, k));
+      }
+    }
+  }
+  
   // Effekte
   JsonArray effekteArray = doc.createNestedArray("effekte");
   for (int i = 0; i < 5; i++) {
@@ -1952,6 +2571,82 @@ bool WindTurbineDataManager::saveExperiment(const char* description, float teilf
     faktoren.add(ausgewaehlteVollfaktoren[i]);
   }
   
+  // Varianzanalyse des teilfaktoriellen Plans (F-Tests gegen die Wiederholungen)
+  WindTurbineEffektAnalyse analyse;
+  analyse.setzePlan<TeilfaktoriellPlan>();
+  analyse.berechne(teilfaktoriellMittelwerte, &teilfaktoriellMessungen[0][0], 5);
+  WindTurbineAnova anova;
+  if (anova.berechne(analyse)) {
+    JsonObject anovaObjekt = doc.createNestedObject("anova");
+    anovaObjekt["pruefung"] = anova.hatPruefung();
+    anovaObjekt["alpha"] = ANOVA_ALPHA;
+    JsonArray zeilen = anovaObjekt.createNestedArray("effekte");
+    for (int i = 0; i < anova.anzahlEffekte(); i++) {
+      const AnovaZeile& zeile = anova.effektZeile(i);
+      JsonObject eintrag = zeilen.createNestedObject();
+      eintrag["wort"] = zeile.wort;
+      eintrag["faktor"] = zeile.faktor;
+      eintrag["effekt"] = zeile.effekt;
+      eintrag["t"] = zeile.t;
+      schreibeAnovaZeile(eintrag, zeile);
+    }
+    schreibeAnovaZeile(anovaObjekt.createNestedObject("modell"), anova.modellZeile());
+    schreibeAnovaZeile(anovaObjekt.createNestedObject("rest"), anova.restZeile());
+    schreibeAnovaZeile(anovaObjekt.createNestedObject("gesamt"), anova.gesamtZeile());
+  }
+  
+  // Lenth-Prüfung (auch ohne Wiederholungen): Kennwerte und Wörter über den Grenzen
+  WindTurbineLenth lenth;
+  if (lenth.berechne(analyse)) {
+    JsonObject lenthObjekt = doc.createNestedObject("lenth");
+    lenthObjekt["pse"] = lenth.pse();
+    lenthObjekt["me"] = lenth.me();
+    lenthObjekt["sme"] = lenth.sme();
+    lenthObjekt["freiheitsgrade"] = lenth.freiheitsgrade();
+    JsonArray auffaellig = lenthObjekt.createNestedArray("ueberME");
+    JsonArray aktiv = lenthObjekt.createNestedArray("ueberSME");
+    for (int rang = lenth.anzahlEffekte() - 1; rang >= 0 && lenth.istAuffaellig(rang); rang--) {
+      auffaellig.add(lenth.wort(rang));
+      if (lenth.istAktiv(rang)) aktiv.add(lenth.wort(rang));
+    }
+  }
+  
+  // Konfidenzintervalle: je Versuchsmittelwert und für die Effekte des Teilplans
+  WindTurbineEffektAnalyse vollAnalyse;
+  vollAnalyse.setzePlan<VollfaktoriellPlan>();
+  vollAnalyse.berechne(vollfaktoriellMittelwerte, &vollfaktoriellMessungen[0][0], 5);
+  if (analyse.istGueltig() && vollAnalyse.istGueltig()) {
+    JsonObject konfidenz = doc.createNestedObject("konfidenz");
+    konfidenz["niveau"] = KONFIDENZ_NIVEAU;
+    konfidenz["effektHalbbreite"] = analyse.konfidenzHalbbreite();
+    konfidenz["freiheitsgrade"] = analyse.freiheitsgrade();
+    JsonArray tfHalbbreiten = konfidenz.createNestedArray("teilfaktoriellHalbbreiten");
+    JsonArray vfHalbbreiten = konfidenz.createNestedArray("vollfaktoriellHalbbreiten");
+    JsonArray tfAnzahlen = konfidenz.createNestedArray("teilfaktoriellAnzahlMessungen");
+    JsonArray vfAnzahlen = konfidenz.createNestedArray("vollfaktoriellAnzahlMessungen");
+    for (int i = 0; i < 8; i++) {
+      tfHalbbreiten.add(analyse.versuchsHalbbreite(i));
+      vfHalbbreiten.add(vollAnalyse.versuchsHalbbreite(i));
+      tfAnzahlen.add(analyse.anzahlMessungen(i));
+      vfAnzahlen.add(vollAnalyse.anzahlMessungen(i));
+    }
+  }
+  
+  // Vermengungsstruktur des eingebauten Plans (zur Übersetzungszeit berechnet)
+  WindTurbineAliasStruktur alias;
+  if (alias.setzePlan<TeilfaktoriellPlan>()) {
+    JsonObject aliasObjekt = doc.createNestedObject("alias");
+    char text[128];
+    alias.formatiereRelation(text, sizeof(text));
+    aliasObjekt["relation"] = text;
+    aliasObjekt["aufloesung"] = alias.aufloesung();
+    JsonArray ketten = aliasObjekt.createNestedArray("ketten");
+    for (unsigned wort = 1; wort < (unsigned)TeilfaktoriellPlan::VERSUCHE; wort++) {
+      alias.formatiereKette(wort, text, sizeof(text));
+      ketten.add(text);
+    }
+  }
+  
   // Datei speichern
   File file = SPIFFS.open("/" + filename, FILE_WRITE);
   if (!file) {
@@ -1974,7 +2669,9 @@ bool WindTurbineDataManager::loadExperiment(const char* filename, float teilfakt
                                           float teilfaktoriellMittelwerte[], float teilfaktoriellStandardabweichungen[],
                                           float vollfaktoriellMessungen[][5], float vollfaktoriellMittelwerte[], 
                                           float vollfaktoriellStandardabweichungen[], float effekte[], 
-                                          int ausgewaehlteVollfaktoren[]) {
+                                          int ausgewaehlteVollfaktoren[],
+                                          float zzpMessungen[][5], float zzpMittelwerte[],
+                                          float zzpStandardabweichungen[]) {
   
   File file = SPIFFS.open("/" + String(filename), FILE_READ);
   if (!file) {
@@ -1982,7 +2679,7 @@ bool WindTurbineDataManager::loadExperiment(const char* filename, float teilfakt
     return false;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -2023,6 +2720,21 @@ bool WindTurbineDataManager::loadExperiment(const char* filename, float teilfakt
     vollfaktoriellStandardabweichungen[i] = vfStdDevArray[i];
   }
   
+  // Stern- und Zentrumspunkte laden (ältere Dateien ohne ZZP: alles 0 = nicht gemessen)
+  if (zzpMessungen != nullptr && zzpMittelwerte != nullptr && zzpStandardabweichungen != nullptr) {
+    JsonArray zzpMessungenArray = doc["zzpMessungen"];
+    JsonArray zzpMittelwerteArray = doc["zzpMittelwerte"];
+    JsonArray zzpStdDevArray = doc["zzpStandardabweichungen"];
+    for (int i = 0; i < ZZP_MAX_ERGAENZUNG; i++) {
+      JsonArray versuch = zzpMessungenArray[i];
+      for (int j = 0; j < 5; j++) {
+        zzpMessungen[i][j] = versuch[j] | 0.0f;
+      }
+      zzpMittelwerte[i] = zzpMittelwerteArray[i] | 0.0f;
+      zzpStandardabweichungen[i] = zzpStdDevArray[i] | 0.0f;
+    }
+  }
+  
   // Effekte laden
   JsonArray effekteArray = doc["effekte"];
   for (int i = 0; i < 5; i++) {
@@ -2156,7 +2868,7 @@ bool WindTurbineDataManager::isWiFiExportActive() {
 }
 
 String WindTurbineDataManager::getCurrentIP() {
-  if (wifiExportActive) {
+  if (accessPointAktiv) {
     return WiFi.softAPIP().toString();
   }
   return "0.0.0.0";
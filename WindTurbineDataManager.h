@@ -22,6 +22,8 @@
 #include <ArduinoJson.h>
 #include "WindTurbineConstants.h"
 
+class WindTurbineWirkungsflaeche;
+
 // Struktur für Metadaten gespeicherter Experimente
 struct ExperimentMetadata {
   char filename[50];
@@ -63,13 +65,18 @@ public:
                      float teilfaktoriellMittelwerte[], float teilfaktoriellStandardabweichungen[],
                      float vollfaktoriellMessungen[][5], float vollfaktoriellMittelwerte[], 
                      float vollfaktoriellStandardabweichungen[], float effekte[], 
-                     int ausgewaehlteVollfaktoren[]);
+                     int ausgewaehlteVollfaktoren[],
+                     float zzpMessungen[][5], float zzpMittelwerte[], float zzpStandardabweichungen[],
+                     const WindTurbineWirkungsflaeche& wirkungsflaeche);
   
+  // Stern- und Zentrumspunkte nur, wenn ihre Felder übergeben werden
   bool loadExperiment(const char* filename, float teilfaktoriellMessungen[][5], 
                      float teilfaktoriellMittelwerte[], float teilfaktoriellStandardabweichungen[],
                      float vollfaktoriellMessungen[][5], float vollfaktoriellMittelwerte[], 
                      float vollfaktoriellStandardabweichungen[], float effekte[], 
-                     int ausgewaehlteVollfaktoren[]);
+                     int ausgewaehlteVollfaktoren[],
+                     float zzpMessungen[][5] = nullptr, float zzpMittelwerte[] = nullptr,
+                     float zzpStandardabweichungen[] = nullptr);
   
   int listExperiments(ExperimentMetadata* metadata, int maxCount);
   bool deleteExperiment(const char* filename);
@@ -80,6 +87,14 @@ public:
   void stopWiFiExport();
   void handleWiFiExport();
   
+  // Spiegelung des Displays im Browser (läuft auch ohne WiFi-Export)
+  bool startSpiegelung();
+  void stopSpiegelung();
+  bool isSpiegelungAktiv();
+  bool istSpiegelVerbunden();
+  bool pruefeNeueSpiegelVerbindung();
+  bool sendeSpiegelDaten(const uint8_t* daten, size_t laenge);
+  
   // Hilfsfunktionen (bestehend)
   String getExportURL();
   bool isExportActive();
@@ -141,6 +156,20 @@ private:
   String currentExportFilename;
   String currentSSID;
   
+  // Access Point und Spiegelung
+  bool accessPointAktiv;
+  bool spiegelungAktiv;
+  bool spiegelNeu;
+  WiFiClient spiegelClient;
+  bool starteAccessPoint();
+  void beendeAccessPoint();
+  void beendeServer();
+  bool starteSpiegelServer();
+  void registriereSpiegelRouten();
+  void serveSpiegelSeite();
+  void oeffneSpiegelStrom();
+  void serveScreenshot();
+  
   // === NEUE PRIVATE FUNKTIONEN FÜR ERWEITERTE EXPORTS ===
   
   // Basis-Funktionen (bestehend, teilweise erweitert)
@@ -161,6 +190,7 @@ private:
   // SVG-Generierung
   void generateMainEffectsSVG(const char* filename);
   void generateParetoSVG(const char* filename);
+  void generateHalfNormalSVG(const char* filename);
   void generateInteractionSVG(const char* filename);
   void generateFactorialSVG(const char* filename);
   void generateEffectsSVG(const char* filename);
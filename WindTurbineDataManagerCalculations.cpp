@@ -8,6 +8,7 @@
 
 #include "WindTurbineDataManager.h"
 #include "WindTurbineConstants.h"
+#include "WindTurbineEffektAnalyse.h"
 #include <ArduinoJson.h>
 
 /**
@@ -45,7 +46,7 @@ void WindTurbineDataManager::calculateMainEffectsData(const char* filename, floa
     return;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -89,23 +90,12 @@ void WindTurbineDataManager::calculateMainEffectsData(const char* filename, floa
         }
       }
     } else {
-      // Fallback: Standardplan verwenden
-      const int standardPlan[8][5] = {
-        {-1, -1, -1, -1, 1},
-        {1, -1, -1, 1, -1},
-        {-1, 1, -1, 1, 1},
-        {1, 1, -1, -1, -1},
-        {-1, -1, 1, 1, -1},
-        {1, -1, 1, -1, 1},
-        {-1, 1, 1, -1, -1},
-        {1, 1, 1, 1, 1}
-      };
-      
-      for (int j = 0; j < 8 && j < tfMittelwerteArray.size(); j++) {
-        if (standardPlan[j][i] == -1) {
+      // Fallback: Plan des Versuchsstands verwenden
+      for (int j = 0; j < TeilfaktoriellPlan::VERSUCHE && j < tfMittelwerteArray.size(); j++) {
+        if (teilfaktoriellPlan[j][i] == -1) {
           summeNiedrig += tfMittelwerteArray[j].as<float>();
           anzahlNiedrig++;
-        } else if (standardPlan[j][i] == 1) {
+        } else if (teilfaktoriellPlan[j][i] == 1) {
           summeHoch += tfMittelwerteArray[j].as<float>();
           anzahlHoch++;
         }
@@ -145,7 +135,7 @@ void WindTurbineDataManager::calculateParetoData(const char* filename, float* ef
     return;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -156,7 +146,21 @@ void WindTurbineDataManager::calculateParetoData(const char* filename, float* ef
   
   // Effekte laden
   JsonArray effekteArray = doc["effekte"];
-  if (effekteArray.isNull() || effekteArray.size() == 0) {
+  JsonArray tfMittelwerteArray = doc["teilfaktoriellMittelwerte"];
+  if ((effekteArray.isNull() || effekteArray.size() == 0) &&
+      !tfMittelwerteArray.isNull() && tfMittelwerteArray.size() >= TeilfaktoriellPlan::VERSUCHE) {
+    // Keine gespeicherten Effekte: aus den Versuchsmittelwerten berechnen
+    float mittelwerte[TeilfaktoriellPlan::VERSUCHE];
+    for (int i = 0; i < TeilfaktoriellPlan::VERSUCHE; i++) {
+      mittelwerte[i] = tfMittelwerteArray[i].as<float>();
+    }
+    WindTurbineEffektAnalyse analyse;
+    analyse.setzePlan<TeilfaktoriellPlan>();
+    analyse.berechne(mittelwerte);
+    for (int i = 0; i < 5; i++) {
+      effects[i] = analyse.haupteffekt(i);
+    }
+  } else if (effekteArray.isNull() || effekteArray.size() == 0) {
     // Fallback: Beispieleffekte
     effects[0] = 0.5;
     effects[1] = -0.3;
@@ -224,7 +228,7 @@ void WindTurbineDataManager::calculateInteractionData(const char* filename, int
     return;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -274,43 +278,45 @@ void WindTurbineDataManager::calculateInteractionData(const char* filename, int
     dataAvailable[i] = false;
   }
   
-  // Lade Daten aus vollfaktoriellen Messungen
+  // Zellen aus dem vollfaktoriellen Plan, wenn beide Faktoren darin variiert wurden,
+  // sonst aus dem teilfaktoriellen Plan (dort ist jede Kombination besetzt)
   JsonArray vfMittelwerteArray = doc["vollfaktoriellMittelwerte"];
+  JsonArray tfMittelwerteArray = doc["teilfaktoriellMittelwerte"];
   JsonArray ausgewaehlteVollfaktorenArray = doc["ausgewaehlteVollfaktoren"];
   
-  if (!vfMittelwerteArray.isNull() && !ausgewaehlteVollfaktorenArray.isNull()) {
-    // Prüfe, ob die gewählten Faktoren im vollfaktoriellen Plan sind
-    bool factor1InPlan = false;
-    bool factor2InPlan = false;
-    int factor1Index = -1;
-    int factor2Index = -1;
-    
-    for (int i = 0; i < ausgewaehlteVollfaktorenArray.size(); i++) {
+  WindTurbineEffektAnalyse analyse;
+  float mittelwerte[8];
+  int spalte1 = -1;
+  int spalte2 = -1;
+  
+  if (!vfMittelwerteArray.isNull() && vfMittelwerteArray.size() >= VollfaktoriellPlan::VERSUCHE &&
+      !ausgewaehlteVollfaktorenArray.isNull()) {
+    for (int i = 0; i < ausgewaehlteVollfaktorenArray.size() && i < VollfaktoriellPlan::FAKTOREN; i++) {
       int faktor = ausgewaehlteVollfaktorenArray[i].as<int>();
-      if (faktor == factor1) {
-        factor1InPlan = true;
-        factor1Index = i;
-      }
-      if (faktor == factor2) {
-        factor2InPlan = true;
-        factor2Index = i;
-      }
+      if (faktor == factor1) spalte1 = i;
+      if (faktor == factor2) spalte2 = i;
     }
-    
-    if (factor1InPlan && factor2InPlan) {
-      // Beide Faktoren sind im Plan, wir können alle Datenpunkte extrahieren
-      for (int i = 0; i < 8 && i < vfMittelwerteArray.size(); i++) {
-        // Bestimme die Faktorstufen für diesen Versuch
-        bool f1High = (i & (1 << factor1Index)) != 0;
-        bool f2High = (i & (1 << factor2Index)) != 0;
-        
-        // Bestimme den Index im data-Array
-        int dataIndex = (f1High ? 1 : 0) + (f2High ? 2 : 0);
-        
-        // Speichere den Wert
-        data[dataIndex] = vfMittelwerteArray[i].as<float>();
-        dataAvailable[dataIndex] = true;
-      }
+  }
+  
+  if (spalte1 >= 0 && spalte2 >= 0) {
+    for (int i = 0; i < VollfaktoriellPlan::VERSUCHE; i++) {
+      mittelwerte[i] = vfMittelwerteArray[i].as<float>();
+    }
+    analyse.setzePlan<VollfaktoriellPlan>();
+  } else if (!tfMittelwerteArray.isNull() && tfMittelwerteArray.size() >= TeilfaktoriellPlan::VERSUCHE) {
+    for (int i = 0; i < TeilfaktoriellPlan::VERSUCHE; i++) {
+      mittelwerte[i] = tfMittelwerteArray[i].as<float>();
+    }
+    analyse.setzePlan<TeilfaktoriellPlan>();
+    spalte1 = factor1;
+    spalte2 = factor2;
+  }
+  
+  if (spalte1 >= 0 && spalte2 >= 0 && analyse.berechne(mittelwerte)) {
+    for (int i = 0; i < 4; i++) {
+      // Index im data-Array: Bit 0 = Faktor 1 hoch, Bit 1 = Faktor 2 hoch
+      data[i] = analyse.zellenMittel(spalte1, (i & 1) ? 1 : -1, spalte2, (i & 2) ? 1 : -1);
+      dataAvailable[i] = true;
     }
   }
   
@@ -446,7 +452,7 @@ bool WindTurbineDataManager::hasCompleteFactorialData(const char* filename, int
     return false;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -487,7 +493,7 @@ void WindTurbineDataManager::validateChartData(const String& chartType, const ch
     return;
   }
   
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(VERSUCH_JSON_GROESSE);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
   
@@ -68,7 +68,8 @@ void WindTurbineExperiment::zeigeBeschreibungEingabe() {
                                       teilfaktoriellMittelwerte, teilfaktoriellStandardabweichungen,
                                       vollfaktoriellMessungen, vollfaktoriellMittelwerte, 
                                       vollfaktoriellStandardabweichungen, effekte, 
-                                      ausgewaehlteVollfaktoren)) {
+                                      ausgewaehlteVollfaktoren,
+                                      zzpMessungen, zzpMittelwerte, zzpStandardabweichungen, wirkungsflaeche)) {
           // Erfolgsmeldung anzeigen
           tft.fillScreen(TFT_BACKGROUND);
           tft.fillRoundRect(90, 120, 300, 80, 8, TFT_SUCCESS);
@@ -263,7 +264,8 @@ void WindTurbineExperiment::zeigeBeschreibungEingabe() {
                                       teilfaktoriellMittelwerte, teilfaktoriellStandardabweichungen,
                                       vollfaktoriellMessungen, vollfaktoriellMittelwerte, 
                                       vollfaktoriellStandardabweichungen, effekte, 
-                                      ausgewaehlteVollfaktoren)) {
+                                      ausgewaehlteVollfaktoren,
+                                      zzpMessungen, zzpMittelwerte, zzpStandardabweichungen, wirkungsflaeche)) {
           // Erfolgsmeldung anzeigen
           tft.fillScreen(TFT_BACKGROUND);
           tft.fillRoundRect(90, 120, 300, 80, 8, TFT_SUCCESS);
@@ -309,15 +311,15 @@ void WindTurbineExperiment::zeigeBeschreibungEingabe() {
  * Ermöglicht die Auswahl eines Versuchs zur detaillierten Ansicht
  */
 void WindTurbineExperiment::zeigeGespeicherteVersuche() {
-  tft.fillScreen(TFT_BACKGROUND);
-  
-  // Titelbereich
-  zeichneTitelbalken("Gespeicherte Versuche");
-  
   // Versuche auflisten
   anzahlGespeicherteVersuche = dataManager.listExperiments(gespeicherteVersuche, MAX_SAVED_EXPERIMENTS);
   
   if (anzahlGespeicherteVersuche == 0) {
+    tft.fillScreen(TFT_BACKGROUND);
+    
+    // Titelbereich
+    zeichneTitelbalken("Gespeicherte Versuche");
+    
     // Keine gespeicherten Versuche
     tft.fillRoundRect(90, 120, 300, 80, 8, TFT_OUTLINE);
     tft.setTextColor(TFT_TEXT);
@@ -353,63 +355,62 @@ void WindTurbineExperiment::zeigeGespeicherteVersuche() {
   }
   
   // Versuche anzeigen
-  tft.fillRoundRect(20, 50, 440, 220, 5, TFT_OUTLINE);
+  beginneWidgetBildschirm("Gespeicherte Versuche", "1-8=Versuch, Drehen+#=Auswahl oeffnen, D/Druecken=Zurueck");
+  
+  int liste = widgets.fuegeHinzu(WIDGET_BOX, 20, 50, 440, 220);
+  widgets.setzeFarben(liste, TFT_TEXT, TFT_OUTLINE);
+  widgets.setzeRadius(liste, 5);
   
   // Überschriften
-  tft.fillRect(21, 51, 438, 20, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setTextSize(1);
-  tft.setCursor(30, 56);
-  tft.print("Nr.");
-  tft.setCursor(60, 56);
-  tft.print("Beschreibung");
-  tft.setCursor(280, 56);
-  tft.print("Datum");
-  tft.setCursor(400, 56);
-  tft.print("Max. P");
+  int kopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 21, 51, 438, 20, liste);
+  widgets.setzeFarben(kopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+  widgets.setzeText(kopf, "Nr.|Beschreibung|Datum|Max. P");
+  widgets.setzeSpalte(kopf, 0, 9);
+  widgets.setzeSpalte(kopf, 1, 39);
+  widgets.setzeSpalte(kopf, 2, 259);
+  widgets.setzeSpalte(kopf, 3, 379);
   
   // Versuche auflisten
-  for (int i = 0; i < anzahlGespeicherteVersuche && i < 8; i++) {
-    int y = 80 + i * 20;
-    
-    // Zeilenhintergrund
-    if (i % 2 == 0) {
-      tft.fillRect(21, y-9, 438, 19, 0x1082);
+  int anzahlZeilen = min(anzahlGespeicherteVersuche, 8);
+  if (cursorPosition >= anzahlZeilen) {
+    cursorPosition = 0;
+  }
+  
+  for (int i = 0; i < anzahlZeilen; i++) {
+    int id = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 21, 71 + i * 20, 438, 19, liste);
+    // Zeilenhintergrund abwechselnd
+    widgets.setzeFarben(id, TFT_TEXT, (i % 2 == 0) ? 0x1082 : TFT_OUTLINE);
+    widgets.setzeAkzent(id, TFT_SELECTION);
+    if (i == 0) {
+      ersteCursorZeile = id;
     }
     
-    // Nummer
-    tft.setTextColor(TFT_TEXT);
-    tft.setCursor(30, y);
-    tft.print(i + 1);
-    
-    // Beschreibung (gekürzt)
-    tft.setCursor(60, y);
-    char kurzeBeschreibung[25];
-    strncpy(kurzeBeschreibung, gespeicherteVersuche[i].description, 24);
-    kurzeBeschreibung[24] = '\0';
-    tft.print(kurzeBeschreibung);
-    
-    // Datum (gekürzt)
-    tft.setCursor(280, y);
-    char kurzesDatum[15];
-    strncpy(kurzesDatum, gespeicherteVersuche[i].timestamp, 14);
-    kurzesDatum[14] = '\0';
-    tft.print(kurzesDatum);
-    
-    // Maximale Leistung
-    tft.setCursor(400, y);
-    tft.print(gespeicherteVersuche[i].maxPower, 1);
+    // Beschreibung und Datum gekürzt
+    char zeile[WIDGET_MAX_TEXT];
+    snprintf(zeile, sizeof(zeile), "%d|%.24s|%.14s|%.1f",
+             i + 1,
+             gespeicherteVersuche[i].description,
+             gespeicherteVersuche[i].timestamp,
+             gespeicherteVersuche[i].maxPower);
+    widgets.setzeText(id, zeile);
+    widgets.setzeSpalte(id, 0, 9);
+    widgets.setzeSpalte(id, 1, 39);
+    widgets.setzeSpalte(id, 2, 259);
+    widgets.setzeSpalte(id, 3, 379);
+    widgets.setzeAusgewaehlt(id, i == cursorPosition);
   }
   
   // Anleitung
-  tft.fillRoundRect(20, 280, 440, 20, 5, TFT_SUBTITLE);
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(30, 285);
-  tft.print("Waehlen Sie einen Versuch (1-");
-  tft.print(anzahlGespeicherteVersuche);
-  tft.print(") oder druecken Sie D zum Zurueckkehren");
+  char anleitung[WIDGET_MAX_TEXT];
+  snprintf(anleitung, sizeof(anleitung), "Versuch waehlen (1-%d oder Drehen und #), D = Zurueck", anzahlZeilen);
+  int hinweis = widgets.fuegeHinzu(WIDGET_BOX, 20, 280, 440, 20);
+  widgets.setzeFarben(hinweis, TFT_TEXT, TFT_SUBTITLE);
+  widgets.setzeRadius(hinweis, 5);
+  widgets.setzeText(hinweis, anleitung);
   
-  zeichneStatusleiste("1-9=Versuch auswaehlen, D=Zurueck");
+  zeichneWidgetBildschirm();
+  
+  maxCursorPosition = anzahlZeilen - 1;
   
   // Auf Auswahl warten
   bool fertig = false;
@@ -429,9 +430,23 @@ void WindTurbineExperiment::zeigeGespeicherteVersuche() {
           strcpy(aktuellerVersuchsFilename, gespeicherteVersuche[index].filename);
           zeigeVersuchDetails(aktuellerVersuchsFilename);
         }
+      } else if (key == '#') {
+        // Mit dem Drehknopf markierten Versuch öffnen
+        fertig = true;
+        strcpy(aktuellerVersuchsFilename, gespeicherteVersuche[cursorPosition].filename);
+        zeigeVersuchDetails(aktuellerVersuchsFilename);
       }
     }
     
+    // Drehknopf bewegt die Auswahl (nur zwei Zeilen werden neu gezeichnet, max. UI_MAX_BILDER_PRO_SEKUNDE)
+    if (pruefeEncoderDrehung()) {
+      bildPlaner.invalidiereEingabe(UI_BEREICH_CURSOR);
+    }
+    if (bildPlaner.bildFaellig(micros())) {
+      bildPlaner.beginneBild(micros());
+      zeigeCursorAuswahl();
+    }
+    
     // Auf Encoder-Button prüfen
     if (digitalRead(ENCODER_BUTTON) == LOW) {
       if (!buttonPressed && (millis() - lastDebounceTime > debounceDelay)) {
@@ -727,6 +742,8 @@ void WindTurbineExperiment::zeigeVersuchDetails(const char* filename) {
  * Zeigt Verbindungsinformationen und URL für den Datenzugriff an
  */
 void WindTurbineExperiment::zeigeWiFiExport() {
+  // Schattenbild für /screenshot.png vor dem Zeichnen einschalten
+  WindTurbineSpiegel::setzeAktiv(true);
   tft.fillScreen(TFT_BACKGROUND);
   
   // Titelbereich
@@ -785,8 +802,9 @@ void WindTurbineExperiment::zeigeWiFiExport() {
     // Auf Auswahl warten
     bool fertig = false;
     while (!fertig) {
-      // WiFi-Export-Handler aufrufen
+      // WiFi-Export-Handler aufrufen (und ggf. die Spiegelung bedienen)
       dataManager.handleWiFiExport();
+      handleSpiegelung();
       
       char key = keypad.getKey();
       
@@ -795,6 +813,7 @@ void WindTurbineExperiment::zeigeWiFiExport() {
           // Export beenden
           fertig = true;
           dataManager.stopWiFiExport();
+          WindTurbineSpiegel::setzeAktiv(dataManager.isSpiegelungAktiv());
           
           // Zurück zu den Versuchsdetails
           zeigeVersuchDetails(aktuellerVersuchsFilename);
@@ -810,6 +829,7 @@ void WindTurbineExperiment::zeigeWiFiExport() {
           // Export beenden
           fertig = true;
           dataManager.stopWiFiExport();
+          WindTurbineSpiegel::setzeAktiv(dataManager.isSpiegelungAktiv());
           
           // Zurück zu den Versuchsdetails
           zeigeVersuchDetails(aktuellerVersuchsFilename);
@@ -819,6 +839,8 @@ void WindTurbineExperiment::zeigeWiFiExport() {
       }
     }
   } else {
+    WindTurbineSpiegel::setzeAktiv(dataManager.isSpiegelungAktiv());
+    
     // Fehler beim Starten des Exports
     tft.fillRoundRect(90, 120, 300, 80, 8, TFT_WARNING);
     tft.setTextColor(TFT_TEXT);
@@ -852,3 +874,67 @@ void WindTurbineExperiment::zeigeWiFiExport() {
     zeigeVersuchDetails(aktuellerVersuchsFilename);
   }
 }
+
+/**
+ * Schaltet die Spiegelung des Displays im Browser ein oder aus
+ * WLAN und Adresse stehen danach in der Statusleiste.
+ */
+void WindTurbineExperiment::schalteSpiegelung() {
+  if (dataManager.isSpiegelungAktiv()) {
+    dataManager.stopSpiegelung();
+    WindTurbineSpiegel::setzeAktiv(false);
+    zeichneStatusleiste("Spiegelung beendet");
+    return;
+  }
+
+  if (!WindTurbineSpiegel::istBereit()) {
+    zeichneStatusleiste("Spiegelung nicht verfuegbar (kein PSRAM)");
+    return;
+  }
+
+  if (dataManager.startSpiegelung()) {
+    // Schattenbild wurde bisher nicht nachgeführt: Bildschirm neu zeichnen
+    WindTurbineSpiegel::setzeAktiv(true);
+    zeichneAktuellenBildschirm();
+    
+    char status[80];
+    snprintf(status, sizeof(status), "Spiegelung: WLAN %s, http://%s/spiegel",
+             dataManager.getCurrentSSID().c_str(), dataManager.getCurrentIP().c_str());
+    zeichneStatusleiste(status);
+  } else {
+    zeichneStatusleiste("Spiegelung konnte nicht gestartet werden");
+  }
+}
+
+/**
+ * Sendet die geänderten Bereiche des Displays an den Browser (aus loop())
+ * Höchstens alle SPIEGEL_INTERVALL_MS, mit SPIEGEL_BUDGET_US Rechenzeit und
+ * höchstens SPIEGEL_MAX_BYTES_PRO_SEKUNDE. Während einer Messung läuft
+ * loop() nicht, die Spiegelung holt danach das aktuelle Bild nach.
+ */
+void WindTurbineExperiment::handleSpiegelung() {
+  if (!dataManager.isSpiegelungAktiv()) return;
+
+  // Neuer Browser: das ganze Bild senden
+  if (dataManager.pruefeNeueSpiegelVerbindung()) {
+    WindTurbineSpiegel::markiereAlles();
+  }
+  if (!dataManager.istSpiegelVerbunden() || !WindTurbineSpiegel::hatAenderungen()) return;
+
+  unsigned long jetzt = millis();
+  unsigned long vergangen = jetzt - letzteSpiegelSendung;
+  if (vergangen < SPIEGEL_INTERVALL_MS) return;
+  letzteSpiegelSendung = jetzt;
+
+  // Guthaben für die vergangene Zeit, höchstens eine Sekunde ansparen
+  uint32_t zuwachs = min(vergangen, 1000UL) * SPIEGEL_MAX_BYTES_PRO_SEKUNDE / 1000;
+  spiegelGuthaben = min(spiegelGuthaben + zuwachs, (uint32_t)SPIEGEL_MAX_BYTES_PRO_SEKUNDE);
+
+  static uint8_t puffer[SPIEGEL_PUFFER_BYTES];
+  unsigned long start = micros();
+  while (spiegelGuthaben >= sizeof(puffer) && micros() - start < SPIEGEL_BUDGET_US) {
+    size_t laenge = WindTurbineSpiegel::kodiere(puffer, sizeof(puffer), SPIEGEL_BUDGET_US - (micros() - start));
+    if (laenge == 0 || !dataManager.sendeSpiegelDaten(puffer, laenge)) break;
+    spiegelGuthaben -= laenge;
+  }
+}
@@ -0,0 +1,313 @@
+/**
+ * WindTurbineDiagrammModell.cpp
+ * Zwischenspeicher für die Geometrie der Auswertungsdiagramme
+ */
+
+#include "WindTurbineDiagrammModell.h"
+
+WindTurbineDiagrammModell::WindTurbineDiagrammModell() :
+  tft(nullptr),
+  aufnahme(nullptr),
+  direkt(false)
+{
+  for (int i = 0; i < DIAGRAMM_ANZAHL; i++) {
+    eintraege[i].primitive = nullptr;
+    eintraege[i].anzahl = 0;
+    eintraege[i].kapazitaet = 0;
+    eintraege[i].texte = nullptr;
+    eintraege[i].textLaenge = 0;
+    eintraege[i].textKapazitaet = 0;
+    eintraege[i].datenstand = 0;
+    eintraege[i].x = 0;
+    eintraege[i].y = 0;
+    eintraege[i].gueltig = false;
+  }
+}
+
+WindTurbineDiagrammModell::~WindTurbineDiagrammModell() {
+  for (int i = 0; i < DIAGRAMM_ANZAHL; i++) {
+    gibFrei(eintraege[i]);
+  }
+}
+
+void WindTurbineDiagrammModell::begin(TFT_eSPI* display) {
+  tft = display;
+}
+
+uint32_t WindTurbineDiagrammModell::pruefsumme(const void* daten, size_t laenge, uint32_t start) {
+  const uint8_t* bytes = (const uint8_t*)daten;
+  uint32_t summe = start;
+  for (size_t i = 0; i < laenge; i++) {
+    summe ^= bytes[i];
+    summe *= 16777619UL;
+  }
+  return summe;
+}
+
+/**
+ * Startet die Aufnahme eines Diagramms
+ * Stimmen Datenstand und Position mit der gespeicherten Liste überein, muss
+ * nichts berechnet werden und zeichne() genügt.
+ */
+bool WindTurbineDiagrammModell::beginneAufnahme(DiagrammKennung id, int16_t x, int16_t y, uint32_t datenstand) {
+  Eintrag& eintrag = eintraege[id];
+  if (eintrag.gueltig && eintrag.datenstand == datenstand && eintrag.x == x && eintrag.y == y) {
+    return false;
+  }
+
+  eintrag.anzahl = 0;
+  eintrag.textLaenge = 0;
+  eintrag.datenstand = datenstand;
+  eintrag.x = x;
+  eintrag.y = y;
+  eintrag.gueltig = false;
+
+  aufnahme = &eintrag;
+  direkt = false;
+  return true;
+}
+
+void WindTurbineDiagrammModell::beendeAufnahme() {
+  if (aufnahme == nullptr) return;
+
+  // Nach einem Speicherfehler wurde bereits direkt gezeichnet
+  if (!direkt) {
+    aufnahme->gueltig = true;
+  }
+  aufnahme = nullptr;
+}
+
+/**
+ * Spielt die Zeichenbefehle eines gültigen Diagramms ab
+ */
+void WindTurbineDiagrammModell::zeichne(DiagrammKennung id) {
+  if (tft == nullptr) return;
+
+  // Ungültig heißt: bei der Aufnahme wurde bereits direkt gezeichnet
+  Eintrag& eintrag = eintraege[id];
+  if (!eintrag.gueltig) return;
+
+  for (uint16_t i = 0; i < eintrag.anzahl; i++) {
+    zeichnePrimitiv(eintrag.primitive[i], eintrag.texte);
+  }
+}
+
+void WindTurbineDiagrammModell::verwerfen() {
+  for (int i = 0; i < DIAGRAMM_ANZAHL; i++) {
+    eintraege[i].gueltig = false;
+  }
+}
+
+size_t WindTurbineDiagrammModell::belegterSpeicher() {
+  size_t summe = 0;
+  for (int i = 0; i < DIAGRAMM_ANZAHL; i++) {
+    summe += eintraege[i].kapazitaet * sizeof(Primitiv) + eintraege[i].textKapazitaet;
+  }
+  return summe;
+}
+
+void WindTurbineDiagrammModell::linie(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_LINIE, 0, farbe, x0, y0, x1, y1);
+}
+
+void WindTurbineDiagrammModell::hLinie(int16_t x, int16_t y, int16_t w, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_HLINIE, 0, farbe, x, y, w, 0);
+}
+
+void WindTurbineDiagrammModell::vLinie(int16_t x, int16_t y, int16_t h, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_VLINIE, 0, farbe, x, y, 0, h);
+}
+
+void WindTurbineDiagrammModell::strichLinie(int16_t x, int16_t y, int16_t bisX, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_STRICHLINIE, 0, farbe, x, y, bisX, 0);
+}
+
+void WindTurbineDiagrammModell::rechteck(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_RECHTECK, 0, farbe, x, y, w, h);
+}
+
+void WindTurbineDiagrammModell::flaeche(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_FLAECHE, 0, farbe, x, y, w, h);
+}
+
+void WindTurbineDiagrammModell::rundRechteck(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_RUNDRECHTECK, radius, farbe, x, y, w, h);
+}
+
+void WindTurbineDiagrammModell::rundFlaeche(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_RUNDFLAECHE, radius, farbe, x, y, w, h);
+}
+
+void WindTurbineDiagrammModell::kreis(int16_t x, int16_t y, uint8_t radius, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_KREIS, radius, farbe, x, y, 0, 0);
+}
+
+void WindTurbineDiagrammModell::kreisFlaeche(int16_t x, int16_t y, uint8_t radius, uint16_t farbe) {
+  fuegeHinzu(PRIMITIV_KREISFLAECHE, radius, farbe, x, y, 0, 0);
+}
+
+void WindTurbineDiagrammModell::verlauf(int16_t x, int16_t y, int16_t w, int16_t h, VerlaufArt art) {
+  if (h <= 0) return;
+  fuegeHinzu(PRIMITIV_VERLAUF, art, 0, x, y, w, h);
+}
+
+void WindTurbineDiagrammModell::text(int16_t x, int16_t y, uint16_t farbe, const char* text, uint8_t textGroesse) {
+  fuegeHinzu(PRIMITIV_TEXT, textGroesse, farbe, x, y, 0, 0, text);
+}
+
+/**
+ * Zahl mit fester Anzahl Nachkommastellen (wie print(wert, stellen)) und optionaler Einheit
+ */
+void WindTurbineDiagrammModell::zahl(int16_t x, int16_t y, uint16_t farbe, float wert, uint8_t stellen, const char* einheit, uint8_t textGroesse) {
+  char puffer[24];
+  snprintf(puffer, sizeof(puffer), "%.*f%s", stellen, wert, einheit);
+  text(x, y, farbe, puffer, textGroesse);
+}
+
+/**
+ * Hängt einen Zeichenbefehl an die laufende Aufnahme an
+ * Ist kein Speicher mehr frei, wird das Bisherige gezeichnet und der Rest
+ * des Diagramms ohne Aufnahme direkt ausgegeben.
+ */
+void WindTurbineDiagrammModell::fuegeHinzu(uint8_t typ, uint8_t parameter, uint16_t farbe, int16_t x, int16_t y, int16_t a, int16_t b, const char* text) {
+  Primitiv p = {typ, parameter, farbe, x, y, a, b};
+
+  if (aufnahme == nullptr || direkt) {
+    zeichnePrimitiv(p, text);
+    return;
+  }
+
+  size_t textBytes = (text != nullptr) ? strlen(text) + 1 : 0;
+  if (!reserviere(*aufnahme, textBytes)) {
+    Serial.println("Diagramm-Modell: Speichergrenze erreicht, zeichne direkt");
+    for (uint16_t i = 0; i < aufnahme->anzahl; i++) {
+      zeichnePrimitiv(aufnahme->primitive[i], aufnahme->texte);
+    }
+    direkt = true;
+    zeichnePrimitiv(p, text);
+    return;
+  }
+
+  if (text != nullptr) {
+    p.a = aufnahme->textLaenge;
+    memcpy(aufnahme->texte + aufnahme->textLaenge, text, textBytes);
+    aufnahme->textLaenge += textBytes;
+  }
+  aufnahme->primitive[aufnahme->anzahl++] = p;
+}
+
+/**
+ * Vergrößert die Puffer eines Eintrags bis DIAGRAMM_MAX_PRIMITIVE bzw. DIAGRAMM_MAX_TEXT
+ */
+bool WindTurbineDiagrammModell::reserviere(Eintrag& eintrag, size_t textBytes) {
+  if (eintrag.anzahl + 1 > eintrag.kapazitaet) {
+    size_t neueKapazitaet = (eintrag.kapazitaet == 0) ? 64 : eintrag.kapazitaet * 2;
+    if (neueKapazitaet > DIAGRAMM_MAX_PRIMITIVE) neueKapazitaet = DIAGRAMM_MAX_PRIMITIVE;
+    if (neueKapazitaet < (size_t)eintrag.anzahl + 1) return false;
+
+    Primitiv* neu = (Primitiv*)realloc(eintrag.primitive, neueKapazitaet * sizeof(Primitiv));
+    if (neu == nullptr) return false;
+    eintrag.primitive = neu;
+    eintrag.kapazitaet = neueKapazitaet;
+  }
+
+  if (eintrag.textLaenge + textBytes > eintrag.textKapazitaet) {
+    size_t neueKapazitaet = (eintrag.textKapazitaet == 0) ? 256 : eintrag.textKapazitaet * 2;
+    while (neueKapazitaet < eintrag.textLaenge + textBytes) neueKapazitaet *= 2;
+    if (neueKapazitaet > DIAGRAMM_MAX_TEXT) neueKapazitaet = DIAGRAMM_MAX_TEXT;
+    if (neueKapazitaet < eintrag.textLaenge + textBytes) return false;
+
+    char* neu = (char*)realloc(eintrag.texte, neueKapazitaet);
+    if (neu == nullptr) return false;
+    eintrag.texte = neu;
+    eintrag.textKapazitaet = neueKapazitaet;
+  }
+  return true;
+}
+
+void WindTurbineDiagrammModell::zeichnePrimitiv(const Primitiv& p, const char* texte) {
+  switch (p.typ) {
+    case PRIMITIV_LINIE:
+      tft->drawLine(p.x, p.y, p.a, p.b, p.farbe);
+      break;
+    case PRIMITIV_HLINIE:
+      tft->drawFastHLine(p.x, p.y, p.a, p.farbe);
+      break;
+    case PRIMITIV_VLINIE:
+      tft->drawFastVLine(p.x, p.y, p.b, p.farbe);
+      break;
+    case PRIMITIV_STRICHLINIE:
+      for (int16_t x = p.x; x < p.a; x += 10) {
+        tft->drawFastHLine(x, p.y, 5, p.farbe);
+      }
+      break;
+    case PRIMITIV_RECHTECK:
+      tft->drawRect(p.x, p.y, p.a, p.b, p.farbe);
+      break;
+    case PRIMITIV_FLAECHE:
+      tft->fillRect(p.x, p.y, p.a, p.b, p.farbe);
+      break;
+    case PRIMITIV_RUNDRECHTECK:
+      tft->drawRoundRect(p.x, p.y, p.a, p.b, p.parameter, p.farbe);
+      break;
+    case PRIMITIV_RUNDFLAECHE:
+      tft->fillRoundRect(p.x, p.y, p.a, p.b, p.parameter, p.farbe);
+      break;
+    case PRIMITIV_KREIS:
+      tft->drawCircle(p.x, p.y, p.parameter, p.farbe);
+      break;
+    case PRIMITIV_KREISFLAECHE:
+      tft->fillCircle(p.x, p.y, p.parameter, p.farbe);
+      break;
+    case PRIMITIV_VERLAUF:
+      for (int16_t zeile = 0; zeile < p.b; zeile++) {
+        tft->drawFastHLine(p.x, p.y + zeile, p.a, verlaufFarbe(p.parameter, zeile, p.b));
+      }
+      break;
+    case PRIMITIV_TEXT:
+      if (p.parameter != 0) tft->setTextSize(p.parameter);
+      tft->setTextColor(p.farbe);
+      tft->setCursor(p.x, p.y);
+      tft->print(texte + p.a);
+      break;
+  }
+}
+
+/**
+ * Farbe einer Verlaufszeile (Zeile 0 = oben), Kanäle wie bei color565() als uint8_t
+ */
+uint16_t WindTurbineDiagrammModell::verlaufFarbe(uint8_t art, int16_t zeile, int16_t hoehe) {
+  switch (art) {
+    case VERLAUF_PARETO:
+      return tft->color565(0, (uint8_t)(100 - zeile/3), (uint8_t)(150 + zeile/2));
+    case VERLAUF_GRUEN:
+      return tft->color565(0, (uint8_t)(120 - zeile/2), 0);
+    case VERLAUF_ROT:
+      return tft->color565((uint8_t)(120 - zeile/2), 0, 0);
+    case VERLAUF_GRUEN_STARK:
+      return tft->color565(0, (uint8_t)(120 - zeile), 0);
+    case VERLAUF_ROT_STARK:
+      return tft->color565((uint8_t)(120 - zeile), 0, 0);
+    case VERLAUF_VOLLFAKTORIELL: {
+      int16_t h = hoehe - 1 - zeile;  // Von unten gezählt
+      return tft->color565(0, (uint8_t)(80 + h/3), (uint8_t)(120 + h/2));
+    }
+  }
+  return TFT_BLACK;
+}
+
+void WindTurbineDiagrammModell::gibFrei(Eintrag& eintrag) {
+  if (eintrag.primitive != nullptr) {
+    free(eintrag.primitive);
+    eintrag.primitive = nullptr;
+  }
+  if (eintrag.texte != nullptr) {
+    free(eintrag.texte);
+    eintrag.texte = nullptr;
+  }
+  eintrag.anzahl = 0;
+  eintrag.kapazitaet = 0;
+  eintrag.textLaenge = 0;
+  eintrag.textKapazitaet = 0;
+  eintrag.gueltig = false;
+}
@@ -0,0 +1,129 @@
+/**
+ * WindTurbineDiagrammModell.h
+ * Zwischenspeicher für die Geometrie der Auswertungsdiagramme
+ *
+ * Ein Diagramm wird einmal pro Datenstand aufgebaut: Mittelwerte, Skalen und
+ * Pixelkoordinaten werden berechnet und als kompakte Liste von Zeichenbefehlen
+ * (Linien, Flächen, Kreise, Verläufe, Beschriftungen) abgelegt. Jeder weitere
+ * Aufruf mit gleichem Datenstand und gleicher Position spielt nur die Liste ab.
+ */
+
+#ifndef WIND_TURBINE_DIAGRAMM_MODELL_H
+#define WIND_TURBINE_DIAGRAMM_MODELL_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+
+// Diagramme mit zwischengespeicherter Geometrie
+enum DiagrammKennung {
+  DIAGRAMM_HAUPTEFFEKTE = 0,
+  DIAGRAMM_INTERAKTION,
+  DIAGRAMM_PARETO,
+  DIAGRAMM_EFFEKTE,
+  DIAGRAMM_VOLLFAKTORIELL,
+  DIAGRAMM_HALBNORMAL,
+  DIAGRAMM_ANZAHL
+};
+
+// Farbverläufe der Balken (Farbe pro Zeile)
+enum VerlaufArt {
+  VERLAUF_PARETO = 0,     // Blau, nach unten heller
+  VERLAUF_GRUEN,          // Positive Effekte
+  VERLAUF_ROT,            // Negative Effekte
+  VERLAUF_GRUEN_STARK,    // Positive Effekte (Beispieldaten)
+  VERLAUF_ROT_STARK,      // Negative Effekte (Beispieldaten)
+  VERLAUF_VOLLFAKTORIELL  // Blau, nach oben heller
+};
+
+class WindTurbineDiagrammModell {
+public:
+  // Konstruktor und Destruktor
+  WindTurbineDiagrammModell();
+  ~WindTurbineDiagrammModell();
+
+  // Initialisierung
+  void begin(TFT_eSPI* display);
+
+  // Prüfsumme über die Eingangsdaten eines Diagramms (FNV-1a, fortsetzbar)
+  static uint32_t pruefsumme(const void* daten, size_t laenge, uint32_t start = 2166136261UL);
+
+  // Aufnahme starten, falls sich Datenstand oder Position geändert haben
+  // @return true wenn das Diagramm neu aufgebaut werden muss (danach beendeAufnahme())
+  bool beginneAufnahme(DiagrammKennung id, int16_t x, int16_t y, uint32_t datenstand);
+  void beendeAufnahme();
+
+  // Gespeicherte Zeichenbefehle abspielen
+  void zeichne(DiagrammKennung id);
+
+  // Alle Diagramme verwerfen (z.B. bei neuen Daten)
+  void verwerfen();
+
+  size_t belegterSpeicher();
+
+  // Zeichenbefehle während der Aufnahme (Parameter wie TFT_eSPI)
+  void linie(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t farbe);
+  void hLinie(int16_t x, int16_t y, int16_t w, uint16_t farbe);
+  void vLinie(int16_t x, int16_t y, int16_t h, uint16_t farbe);
+  void strichLinie(int16_t x, int16_t y, int16_t bisX, uint16_t farbe);  // 5 Pixel Strich, 5 Pixel Lücke
+  void rechteck(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t farbe);
+  void flaeche(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t farbe);
+  void rundRechteck(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius, uint16_t farbe);
+  void rundFlaeche(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t radius, uint16_t farbe);
+  void kreis(int16_t x, int16_t y, uint8_t radius, uint16_t farbe);
+  void kreisFlaeche(int16_t x, int16_t y, uint8_t radius, uint16_t farbe);
+  void verlauf(int16_t x, int16_t y, int16_t w, int16_t h, VerlaufArt art);
+  // Text mit transparentem Hintergrund, textGroesse 0 = aktuelle Größe beibehalten
+  void text(int16_t x, int16_t y, uint16_t farbe, const char* text, uint8_t textGroesse = 1);
+  void zahl(int16_t x, int16_t y, uint16_t farbe, float wert, uint8_t stellen, const char* einheit = "", uint8_t textGroesse = 1);
+
+private:
+  enum PrimitivTyp : uint8_t {
+    PRIMITIV_LINIE,
+    PRIMITIV_HLINIE,
+    PRIMITIV_VLINIE,
+    PRIMITIV_STRICHLINIE,
+    PRIMITIV_RECHTECK,
+    PRIMITIV_FLAECHE,
+    PRIMITIV_RUNDRECHTECK,
+    PRIMITIV_RUNDFLAECHE,
+    PRIMITIV_KREIS,
+    PRIMITIV_KREISFLAECHE,
+    PRIMITIV_VERLAUF,
+    PRIMITIV_TEXT
+  };
+
+  // Ein Zeichenbefehl (12 Bytes)
+  struct Primitiv {
+    uint8_t typ;
+    uint8_t parameter;  // Radius, Verlaufsart oder Textgröße
+    uint16_t farbe;
+    int16_t x, y;
+    int16_t a, b;       // Endpunkt, Breite/Höhe oder Textposition im Puffer
+  };
+
+  struct Eintrag {
+    Primitiv* primitive;
+    uint16_t anzahl;
+    uint16_t kapazitaet;
+    char* texte;
+    uint16_t textLaenge;
+    uint16_t textKapazitaet;
+    uint32_t datenstand;
+    int16_t x, y;
+    bool gueltig;
+  };
+
+  TFT_eSPI* tft;
+  Eintrag eintraege[DIAGRAMM_ANZAHL];
+  Eintrag* aufnahme;   // Eintrag der laufenden Aufnahme
+  bool direkt;         // Speicher voll: Befehle sofort zeichnen statt aufnehmen
+
+  void fuegeHinzu(uint8_t typ, uint8_t parameter, uint16_t farbe, int16_t x, int16_t y, int16_t a, int16_t b, const char* text = nullptr);
+  bool reserviere(Eintrag& eintrag, size_t textBytes);
+  void zeichnePrimitiv(const Primitiv& p, const char* texte);
+  uint16_t verlaufFarbe(uint8_t art, int16_t zeile, int16_t hoehe);
+  void gibFrei(Eintrag& eintrag);
+};
+
+#endif // WIND_TURBINE_DIAGRAMM_MODELL_H
@@ -0,0 +1,238 @@
+/**
+ * WindTurbineDmaRenderer.cpp
+ * Kachelweises Zeichnen mit DMA-Übertragung und Doppelpuffer
+ */
+
+#include "WindTurbineDmaRenderer.h"
+#include "WindTurbineRenderZaehler.h"
+#include "WindTurbineSpiegel.h"
+
+// Kontext für einfarbige Flächen: jeder Puffer muss nur einmal gefüllt werden
+struct FlaechenKontext {
+  uint16_t farbe;
+  int gefuelltePuffer;
+};
+
+// Kontext für zeilenweise Verläufe
+struct ZeilenKontext {
+  ZeilenFarbe farbe;
+  void* kontext;
+};
+
+static void zeichneFlaechenKachel(uint16_t* puffer, int16_t, int16_t, int16_t, void* kontext) {
+  FlaechenKontext* k = (FlaechenKontext*)kontext;
+  if (k->gefuelltePuffer >= 2) return; // Beide Puffer enthalten bereits die Farbe
+
+  // Ganzen Puffer füllen, damit jede Kachelgröße abgedeckt ist
+  for (int32_t i = 0; i < (int32_t)DMA_KACHEL_BREITE * DMA_KACHEL_HOEHE; i++) {
+    puffer[i] = k->farbe;
+  }
+  k->gefuelltePuffer++;
+}
+
+static void zeichneZeilenKachel(uint16_t* puffer, int16_t breite, int16_t zeileStart, int16_t zeilen, void* kontext) {
+  ZeilenKontext* k = (ZeilenKontext*)kontext;
+
+  for (int16_t z = 0; z < zeilen; z++) {
+    uint16_t farbe = k->farbe(zeileStart + z, k->kontext);
+    farbe = (farbe >> 8) | (farbe << 8);
+    uint16_t* zeile = puffer + (int32_t)z * breite;
+    for (int16_t s = 0; s < breite; s++) {
+      zeile[s] = farbe;
+    }
+  }
+}
+
+// Verlauf wie bei den Diagrammhintergründen, über den ganzen Bildschirm
+static uint16_t benchmarkVerlauf(int16_t zeile, void* kontext) {
+  return ((TFT_eSPI*)kontext)->color565(4, 10 + zeile / 10, 20 + zeile / 5);
+}
+
+WindTurbineDmaRenderer::WindTurbineDmaRenderer() :
+  tft(nullptr),
+  bereit(false),
+  gesamtzeitUs(0),
+  wartezeitUs(0)
+{
+  puffer[0] = nullptr;
+  puffer[1] = nullptr;
+}
+
+WindTurbineDmaRenderer::~WindTurbineDmaRenderer() {
+  for (int i = 0; i < 2; i++) {
+    if (puffer[i] != nullptr) {
+      heap_caps_free(puffer[i]);
+      puffer[i] = nullptr;
+    }
+  }
+}
+
+/**
+ * Aktiviert DMA und legt zwei Kachelpuffer an
+ * Die Puffer müssen im internen, DMA-fähigen RAM liegen (nicht im PSRAM).
+ * @return true wenn DMA-Zeichnen verfügbar ist
+ */
+bool WindTurbineDmaRenderer::begin(TFT_eSPI* display) {
+  tft = display;
+
+  size_t groesse = DMA_KACHEL_BREITE * DMA_KACHEL_HOEHE * sizeof(uint16_t);
+  for (int i = 0; i < 2; i++) {
+    puffer[i] = (uint16_t*)heap_caps_malloc(groesse, MALLOC_CAP_DMA);
+    if (puffer[i] == nullptr) {
+      Serial.println("DMA-Renderer: Kein DMA-fähiger Speicher frei");
+      return false;
+    }
+  }
+
+  if (!tft->initDMA()) {
+    Serial.println("DMA-Renderer: initDMA fehlgeschlagen");
+    return false;
+  }
+
+  bereit = true;
+  Serial.println("DMA-Renderer bereit");
+  return true;
+}
+
+bool WindTurbineDmaRenderer::istBereit() {
+  return bereit;
+}
+
+/**
+ * Zeichnet einen Bereich kachelweise
+ * Der Zeichner füllt Kachel n+1, während Kachel n per DMA übertragen wird.
+ * Bereiche breiter als DMA_KACHEL_BREITE erhalten entsprechend weniger Zeilen
+ * pro Kachel, damit eine Kachel weiter in den Puffer passt.
+ */
+void WindTurbineDmaRenderer::zeichneBereich(int16_t x, int16_t y, int16_t w, int16_t h, KachelZeichner zeichner, void* kontext) {
+  if (!bereit || w <= 0 || h <= 0) return;
+
+  int16_t kachelZeilen = min((int32_t)DMA_KACHEL_HOEHE, (int32_t)DMA_KACHEL_BREITE * DMA_KACHEL_HOEHE / w);
+  if (kachelZeilen < 1) {
+    Serial.println("DMA-Renderer: Bereich breiter als der Kachelpuffer");
+    return;
+  }
+
+  unsigned long start = micros();
+  wartezeitUs = 0;
+  int index = 0;
+
+  tft->startWrite();
+
+  for (int16_t zeile = 0; zeile < h; zeile += kachelZeilen) {
+    int16_t zeilen = min((int)kachelZeilen, (int)(h - zeile));
+
+    // Kachel aufbauen - die vorige Kachel ist währenddessen noch auf dem Bus
+    zeichner(puffer[index], w, zeile, zeilen, kontext);
+
+    // Erst jetzt auf das Ende der vorigen Übertragung warten
+    unsigned long warteStart = micros();
+    tft->dmaWait();
+    wartezeitUs += micros() - warteStart;
+
+    tft->pushImageDMA(x, y + zeile, w, zeilen, puffer[index]);
+    WindTurbineRenderZaehler::erfasseBlock((uint32_t)w * zeilen);
+    WindTurbineSpiegel::uebernimmBild(x, y + zeile, w, zeilen, puffer[index]);
+    index ^= 1;
+  }
+
+  unsigned long warteStart = micros();
+  tft->dmaWait();
+  wartezeitUs += micros() - warteStart;
+
+  tft->endWrite();
+  gesamtzeitUs = micros() - start;
+}
+
+/**
+ * Füllt einen Bereich einfarbig (Ersatz für fillRect)
+ */
+void WindTurbineDmaRenderer::fuelleBereich(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t farbe) {
+  if (!bereit) {
+    tft->fillRect(x, y, w, h, farbe);
+    return;
+  }
+
+  FlaechenKontext k = {tauscheBytes(farbe), 0};
+  zeichneBereich(x, y, w, h, zeichneFlaechenKachel, &k);
+}
+
+/**
+ * Füllt einen Bereich mit einer Farbe pro Zeile (Ersatz für drawFastHLine-Schleifen)
+ */
+void WindTurbineDmaRenderer::fuelleZeilenweise(int16_t x, int16_t y, int16_t w, int16_t h, ZeilenFarbe farbe, void* kontext) {
+  if (!bereit) {
+    for (int16_t i = 0; i < h; i++) {
+      tft->drawFastHLine(x, y + i, w, farbe(i, kontext));
+    }
+    return;
+  }
+
+  ZeilenKontext k = {farbe, kontext};
+  zeichneBereich(x, y, w, h, zeichneZeilenKachel, &k);
+}
+
+unsigned long WindTurbineDmaRenderer::letzteGesamtzeitUs() {
+  return gesamtzeitUs;
+}
+
+/**
+ * CPU-Zeit des letzten Aufrufs: Gesamtzeit abzüglich der Wartezeit auf DMA
+ */
+unsigned long WindTurbineDmaRenderer::letzteCpuZeitUs() {
+  return gesamtzeitUs > wartezeitUs ? gesamtzeitUs - wartezeitUs : 0;
+}
+
+/**
+ * Vergleicht blockierendes Zeichnen mit dem DMA-Pfad für einen ganzen Bildschirm
+ * Beim blockierenden Zeichnen ist die CPU die ganze Zeit belegt.
+ */
+void WindTurbineDmaRenderer::fuehreBenchmarkDurch() {
+  if (!bereit) {
+    Serial.println("DMA-Benchmark: DMA nicht verfügbar");
+    return;
+  }
+
+  Serial.println("=== DMA-Benchmark (480x320, Zeiten in us) ===");
+  Serial.println("Test;Blockierend;DMA_Gesamt;DMA_CPU;CPU_gespart;CPU_gespart_Prozent");
+
+  for (int test = 0; test < 2; test++) {
+    unsigned long start = micros();
+    if (test == 0) {
+      tft->fillScreen(TFT_BACKGROUND);
+    } else {
+      for (int16_t i = 0; i < 320; i++) {
+        tft->drawFastHLine(0, i, 480, benchmarkVerlauf(i, tft));
+      }
+    }
+    unsigned long blockierend = micros() - start;
+
+    if (test == 0) {
+      fuelleBereich(0, 0, 480, 320, TFT_BACKGROUND);
+    } else {
+      fuelleZeilenweise(0, 0, 480, 320, benchmarkVerlauf, tft);
+    }
+
+    unsigned long cpu = letzteCpuZeitUs();
+    long gespart = (long)blockierend - (long)cpu;
+
+    Serial.print(test == 0 ? "Flaeche" : "Verlauf");
+    Serial.print(";");
+    Serial.print(blockierend);
+    Serial.print(";");
+    Serial.print(gesamtzeitUs);
+    Serial.print(";");
+    Serial.print(cpu);
+    Serial.print(";");
+    Serial.print(gespart);
+    Serial.print(";");
+    Serial.println(blockierend > 0 ? (gespart * 100.0) / blockierend : 0.0, 1);
+  }
+
+  tft->fillScreen(TFT_BACKGROUND);
+  Serial.println("=============================================");
+}
+
+uint16_t WindTurbineDmaRenderer::tauscheBytes(uint16_t farbe) {
+  return (farbe >> 8) | (farbe << 8);
+}
@@ -0,0 +1,59 @@
+/**
+ * WindTurbineDmaRenderer.h
+ * Kachelweises Zeichnen mit DMA-Übertragung und Doppelpuffer
+ *
+ * Ein Bereich wird in Streifen (Kacheln) von DMA_KACHEL_HOEHE Zeilen aufgeteilt
+ * (bei Bereichen breiter als DMA_KACHEL_BREITE entsprechend weniger Zeilen).
+ * Während eine Kachel per DMA über SPI übertragen wird, berechnet die CPU
+ * bereits den Inhalt der nächsten Kachel im zweiten Puffer.
+ */
+
+#ifndef WIND_TURBINE_DMA_RENDERER_H
+#define WIND_TURBINE_DMA_RENDERER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <esp_heap_caps.h>
+#include "WindTurbineConstants.h"
+
+// Füllt eine Kachel: puffer hat breite x zeilen Pixel (RGB565, bereits byte-getauscht),
+// zeileStart ist die erste Zeile der Kachel relativ zum Bereich
+typedef void (*KachelZeichner)(uint16_t* puffer, int16_t breite, int16_t zeileStart, int16_t zeilen, void* kontext);
+
+// Liefert die Farbe einer Zeile relativ zum Bereich (für Verläufe)
+typedef uint16_t (*ZeilenFarbe)(int16_t zeile, void* kontext);
+
+class WindTurbineDmaRenderer {
+public:
+  // Konstruktor und Destruktor
+  WindTurbineDmaRenderer();
+  ~WindTurbineDmaRenderer();
+
+  // Initialisierung (DMA aktivieren, Puffer im DMA-fähigen RAM anlegen)
+  bool begin(TFT_eSPI* display);
+  bool istBereit();
+
+  // Zeichenfunktionen
+  void zeichneBereich(int16_t x, int16_t y, int16_t w, int16_t h, KachelZeichner zeichner, void* kontext);
+  void fuelleBereich(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t farbe);
+  void fuelleZeilenweise(int16_t x, int16_t y, int16_t w, int16_t h, ZeilenFarbe farbe, void* kontext);
+
+  // Zeitmessung des letzten Aufrufs
+  unsigned long letzteGesamtzeitUs();
+  unsigned long letzteCpuZeitUs();
+
+  // Vergleich blockierend vs. DMA für einen vollständigen Bildschirm (Ausgabe über Serial)
+  void fuehreBenchmarkDurch();
+
+private:
+  TFT_eSPI* tft;
+  uint16_t* puffer[2];
+  bool bereit;
+
+  unsigned long gesamtzeitUs;
+  unsigned long wartezeitUs;
+
+  static uint16_t tauscheBytes(uint16_t farbe);
+};
+
+#endif // WIND_TURBINE_DMA_RENDERER_H
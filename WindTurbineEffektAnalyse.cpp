@@ -0,0 +1,191 @@
+/**
+ * WindTurbineEffektAnalyse.cpp
+ * Yates-Algorithmus (schnelle Walsh-Hadamard-Transformation) für zweistufige Pläne
+ */
+
+#include "WindTurbineEffektAnalyse.h"
+
+WindTurbineEffektAnalyse::WindTurbineEffektAnalyse() :
+  basis(0),
+  versuche(0),
+  faktoren(0),
+  wiederholungen(1),
+  gueltig(false),
+  varianz(0),
+  fg(0),
+  fehler(0)
+{
+  for (int i = 0; i < EFFEKT_MAX_FAKTOREN; i++) spalten[i] = 0;
+  for (int i = 0; i < EFFEKT_MAX_VERSUCHE; i++) {
+    werte[i] = 0;
+    anzahlen[i] = 0;
+    halbbreiten[i] = 0;
+  }
+}
+
+bool WindTurbineEffektAnalyse::setzePlan(int basis, int faktoren, const unsigned* spaltenWoerter) {
+  if (basis < 1 || (1 << basis) > EFFEKT_MAX_VERSUCHE || faktoren < 1 || faktoren > EFFEKT_MAX_FAKTOREN) {
+    Serial.println("Effektanalyse: Plan zu gross");
+    return false;
+  }
+
+  this->basis = basis;
+  this->versuche = 1 << basis;
+  this->faktoren = faktoren;
+  for (int f = 0; f < faktoren; f++) {
+    spalten[f] = spaltenWoerter[f];
+  }
+  gueltig = false;
+  return true;
+}
+
+/**
+ * Mittelwerte je Versuch bilden, transformieren und Reststreuung bestimmen
+ */
+bool WindTurbineEffektAnalyse::berechne(const float* mittelwerte, const float* messungen, int wiederholungen) {
+  gueltig = false;
+  if (versuche == 0 || (mittelwerte == nullptr && (messungen == nullptr || wiederholungen < 1))) return false;
+
+  float quadratsumme = 0;
+  float summeKehrwerte = 0;
+  fg = 0;
+
+  for (int v = 0; v < versuche; v++) {
+    float mittel = 0;
+    anzahlen[v] = 0;
+    halbbreiten[v] = 0;
+    if (messungen != nullptr && wiederholungen > 0) {
+      WindTurbineKonfidenz reihe;
+      int n = reihe.ausMessreihe(messungen + v * wiederholungen, wiederholungen);
+      mittel = reihe.mittelwert();
+
+      // Streuung nur aus Messungen, die zum verwendeten Mittelwert passen
+      bool passend = n > 0 && (mittelwerte == nullptr ||
+                     fabs(mittel - mittelwerte[v]) <= 0.001 * max(1.0f, (float)fabs(mittelwerte[v])));
+      if (passend && n > 1) {
+        quadratsumme += reihe.varianz() * (n - 1);
+        fg += n - 1;
+        halbbreiten[v] = reihe.halbbreite();
+      }
+      anzahlen[v] = n;
+    }
+    summeKehrwerte += 1.0 / max(1, anzahlen[v]);
+    werte[v] = (mittelwerte != nullptr) ? mittelwerte[v] : mittel;
+  }
+
+  // Yates: je Stufe Summe und Differenz (hoch - niedrig) der Paare im Abstand h
+  for (int h = 1; h < versuche; h <<= 1) {
+    for (int i = 0; i < versuche; i += h << 1) {
+      for (int j = i; j < i + h; j++) {
+        float niedrig = werte[j];
+        float hoch = werte[j + h];
+        werte[j] = niedrig + hoch;
+        werte[j + h] = hoch - niedrig;
+      }
+    }
+  }
+
+  werte[0] /= versuche;
+  for (int w = 1; w < versuche; w++) {
+    werte[w] /= versuche / 2;
+  }
+
+  // Var(Effekt) = 4/N² * Σ s²/n_v, bei gleichen Anzahlen r: 4 s² / (N r)
+  this->wiederholungen = versuche / summeKehrwerte;
+  varianz = (fg > 0) ? quadratsumme / fg : 0;
+  fehler = (fg > 0) ? 2.0 * sqrt(varianz / (versuche * this->wiederholungen)) : 0;
+
+  gueltig = true;
+  return true;
+}
+
+bool WindTurbineEffektAnalyse::istGueltig() const {
+  return gueltig;
+}
+
+int WindTurbineEffektAnalyse::anzahlVersuche() const {
+  return versuche;
+}
+
+int WindTurbineEffektAnalyse::anzahlFaktoren() const {
+  return faktoren;
+}
+
+float WindTurbineEffektAnalyse::mittelwert() const {
+  return gueltig ? werte[0] : 0;
+}
+
+float WindTurbineEffektAnalyse::effekt(unsigned wort) const {
+  if (!gueltig || wort == 0 || wort >= (unsigned)versuche) return 0;
+  return werte[wort];
+}
+
+unsigned WindTurbineEffektAnalyse::wort(int faktor) const {
+  if (faktor < 0 || faktor >= faktoren) return 0;
+  return spalten[faktor];
+}
+
+float WindTurbineEffektAnalyse::haupteffekt(int faktor) const {
+  return effekt(wort(faktor));
+}
+
+float WindTurbineEffektAnalyse::wechselwirkung(int faktorA, int faktorB) const {
+  return effekt(wort(faktorA) ^ wort(faktorB));
+}
+
+float WindTurbineEffektAnalyse::zellenMittel(int faktorA, int stufeA, int faktorB, int stufeB) const {
+  return mittelwert() + (stufeA * haupteffekt(faktorA) + stufeB * haupteffekt(faktorB) +
+                         stufeA * stufeB * wechselwirkung(faktorA, faktorB)) / 2.0;
+}
+
+float WindTurbineEffektAnalyse::reststreuung() const {
+  return varianz;
+}
+
+int WindTurbineEffektAnalyse::freiheitsgrade() const {
+  return fg;
+}
+
+float WindTurbineEffektAnalyse::standardfehler() const {
+  return fehler;
+}
+
+float WindTurbineEffektAnalyse::anzahlWiederholungen() const {
+  return wiederholungen;
+}
+
+int WindTurbineEffektAnalyse::anzahlMessungen(int versuch) const {
+  if (versuch < 0 || versuch >= versuche) return 0;
+  return anzahlen[versuch];
+}
+
+float WindTurbineEffektAnalyse::konfidenzHalbbreite() const {
+  return tQuantil(fg) * fehler;
+}
+
+float WindTurbineEffektAnalyse::versuchsHalbbreite(int versuch) const {
+  if (!gueltig || versuch < 0 || versuch >= versuche) return 0;
+  return halbbreiten[versuch];
+}
+
+float WindTurbineEffektAnalyse::quadratsumme(unsigned wort) const {
+  float e = effekt(wort);
+  return versuche * wiederholungen * e * e / 4.0;
+}
+
+int WindTurbineEffektAnalyse::sortiereNachBetrag(unsigned* woerter, int maxAnzahl) const {
+  int anzahl = 0;
+  for (unsigned w = 1; w < (unsigned)versuche; w++) {
+    // Einfügen an der passenden Stelle, was hinter maxAnzahl fällt, entfällt
+    int pos = anzahl;
+    while (pos > 0 && fabs(effekt(woerter[pos - 1])) < fabs(effekt(w))) {
+      if (pos < maxAnzahl) woerter[pos] = woerter[pos - 1];
+      pos--;
+    }
+    if (pos < maxAnzahl) {
+      woerter[pos] = w;
+      if (anzahl < maxAnzahl) anzahl++;
+    }
+  }
+  return anzahl;
+}
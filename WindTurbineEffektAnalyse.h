@@ -0,0 +1,110 @@
+/**
+ * WindTurbineEffektAnalyse.h
+ * Alle Effekte eines 2^k- bzw. 2^(k-p)-Plans in einem Durchlauf (Yates-Algorithmus)
+ *
+ * Die Versuche müssen in Standardreihenfolge der Basisfaktoren vorliegen, wie
+ * sie Versuchsplan2kp erzeugt. Die schnelle Walsh-Hadamard-Transformation
+ * (log2(N) Stufen aus Summen und Differenzen benachbarter Paare) liefert dann
+ * für jedes Wort w der Basisfaktoren den Kontrast; Effekt = Kontrast / (N/2).
+ * Ein Wort steht für einen Haupteffekt oder eine Wechselwirkung, im Teilplan
+ * zusammen mit allen dazu vermengten Effekten (z.B. D = AB im 2^(5-2)-Plan).
+ *
+ * Eingabe sind die Mittelwerte der Versuche und/oder die Einzelmessungen. Aus
+ * den Einzelmessungen wird die Reststreuung innerhalb der Versuche und daraus
+ * der Standardfehler eines Effekts bestimmt. Messungen eines Versuchs, die nicht
+ * zu seinem Mittelwert passen (Mittelwert manuell korrigiert), zählen dafür nicht.
+ * Ein Versuch kann vorzeitig abgeschlossen sein: gezählt werden nur die Messungen
+ * vor der ersten 0, der Standardfehler berücksichtigt die ungleichen Anzahlen.
+ *
+ * Konfidenzintervalle: je Versuchsmittelwert aus seiner eigenen Streuung
+ * (t mit n-1 Freiheitsgraden, wie bei der Messung angezeigt), für die Effekte
+ * aus der gepoolten Reststreuung (t mit allen Freiheitsgraden des reinen Fehlers).
+ */
+
+#ifndef WIND_TURBINE_EFFEKT_ANALYSE_H
+#define WIND_TURBINE_EFFEKT_ANALYSE_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineKonfidenz.h"
+
+class WindTurbineEffektAnalyse {
+public:
+  // Konstruktor
+  WindTurbineEffektAnalyse();
+
+  // Plan mit 2^basis Versuchen, Spaltenwort je Faktor
+  bool setzePlan(int basis, int faktoren, const unsigned* spaltenWoerter);
+
+  template <class Plan>
+  bool setzePlan() {
+    unsigned woerter[Plan::FAKTOREN];
+    for (int f = 0; f < Plan::FAKTOREN; f++) {
+      woerter[f] = Plan::spaltenWort(f);
+    }
+    return setzePlan(Plan::BASIS, Plan::FAKTOREN, woerter);
+  }
+
+  // Effekte berechnen
+  // @param mittelwerte Mittelwert je Versuch (nullptr = aus den Messungen)
+  // @param messungen Einzelmessungen [Versuch * wiederholungen + w] oder nullptr
+  bool berechne(const float* mittelwerte, const float* messungen = nullptr, int wiederholungen = 0);
+
+  bool istGueltig() const;
+  int anzahlVersuche() const;
+  int anzahlFaktoren() const;
+
+  // Gesamtmittelwert und Effekt eines Worts (1..N-1)
+  float mittelwert() const;
+  float effekt(unsigned wort) const;
+
+  // Wort eines Faktors bzw. einer Zweifach-Wechselwirkung
+  unsigned wort(int faktor) const;
+  float haupteffekt(int faktor) const;
+  float wechselwirkung(int faktorA, int faktorB) const;
+
+  // Modellwert der Zelle (stufeA, stufeB) aus Mittelwert, beiden Haupteffekten und Wechselwirkung
+  float zellenMittel(int faktorA, int stufeA, int faktorB, int stufeB) const;
+
+  // Reststreuung (Varianz innerhalb der Versuche), ihre Freiheitsgrade und Standardfehler eines Effekts
+  // Ohne verwertbare Einzelmessungen: 0
+  float reststreuung() const;
+  int freiheitsgrade() const;
+  float standardfehler() const;
+
+  // Wiederholungen je Versuch der letzten Berechnung (1 = nur Mittelwerte)
+  // Bei ungleichen Anzahlen das harmonische Mittel
+  float anzahlWiederholungen() const;
+  // Verwertete Messungen eines Versuchs
+  int anzahlMessungen(int versuch) const;
+
+  // Halbbreite des Konfidenzintervalls eines Effekts (0 ohne Reststreuung)
+  float konfidenzHalbbreite() const;
+  // Halbbreite des Konfidenzintervalls eines Versuchsmittelwerts (0 ohne Wiederholungen)
+  float versuchsHalbbreite(int versuch) const;
+
+  // Quadratsumme eines Worts (1 Freiheitsgrad): N * r * Effekt² / 4
+  float quadratsumme(unsigned wort) const;
+
+  // Wörter 1..N-1 nach Betrag des Effekts absteigend
+  // @return Anzahl eingetragener Wörter (höchstens maxAnzahl)
+  int sortiereNachBetrag(unsigned* woerter, int maxAnzahl) const;
+
+private:
+  int basis;
+  int versuche;
+  int faktoren;
+  float wiederholungen;
+  unsigned spalten[EFFEKT_MAX_FAKTOREN];
+  bool gueltig;
+
+  // [0] = Gesamtmittelwert, [w] = Effekt des Worts w
+  float werte[EFFEKT_MAX_VERSUCHE];
+  int anzahlen[EFFEKT_MAX_VERSUCHE];       // Verwertete Messungen je Versuch
+  float halbbreiten[EFFEKT_MAX_VERSUCHE];
+  float varianz;
+  int fg;
+  float fehler;
+};
+
+#endif // WIND_TURBINE_EFFEKT_ANALYSE_H
@@ -9,18 +9,15 @@
 const char* faktorNamen[] = {"Steigung", "Groesse", "Abstand", "Luftstaerke", "Blattanzahl"};
 const char* faktorEinheitenNiedrig[] = {"4", "7 Zoll", "30 cm", "Stufe 1", "2 Stueck"};
 const char* faktorEinheitenHoch[] = {"6", "8 Zoll", "60 cm", "Stufe 3", "3 Stueck"};
- 
- // Teilfaktorieller Plan (2^(5-2) = 8 Versuche)
- const int teilfaktoriellPlan[8][5] = {
-   {-1, -1, -1,  1,  1},  // Versuch 1: A-, B-, C-, D+, E+
-   { 1, -1, -1, -1, -1},  // Versuch 2: A+, B-, C-, D-, E-
-   {-1,  1, -1, -1,  1},  // Versuch 3: A-, B+, C-, D-, E+
-   { 1,  1, -1,  1, -1},  // Versuch 4: A+, B+, C-, D+, E-
-   {-1, -1,  1,  1, -1},  // Versuch 5: A-, B-, C+, D+, E-
-   { 1, -1,  1, -1,  1},  // Versuch 6: A+, B-, C+, D-, E+
-   {-1,  1,  1, -1, -1},  // Versuch 7: A-, B+, C+, D-, E-
-   { 1,  1,  1,  1,  1}   // Versuch 8: A+, B+, C+, D+, E+
- };
+const char* faktorEinheitenMitte[] = {"5", "-", "45 cm", "Stufe 2", "-"};
+const bool faktorStetig[] = {true, false, true, true, false};
+const float faktorMitte[] = {5.0, 7.5, 45.0, 2.0, 2.5};
+const float faktorHalbeSpanne[] = {1.0, 0.5, 15.0, 1.0, 0.5};
+const char* faktorFormat[] = {"%.1f", "%.1f Zoll", "%.0f cm", "Stufe %.1f", "%.0f Stueck"};
+// Nicht einstellbare Kombinationen für die Optimumsuche, z.B. {0x05, 0x05}:
+// Steigung und Abstand nicht gleichzeitig auf der hohen Stufe.
+// Während des Betriebs kommen weitere per Taste 2 in der Zusammenfassung hinzu (verbieteOptimum).
+const uint8_t verboteneKombinationen[][2] = {{0, 0}};
  
  // Keypad-Layout
  char keys[KEYPAD_ROWS][KEYPAD_COLS] = {
@@ -39,19 +36,31 @@ WindTurbineExperiment::WindTurbineExperiment() :
   tft(),
   encoder(),
   dataManager(),
+  compositor(),
+  dmaRenderer(),
+  widgets(),
+  hintergrundCache(),
+  spriteTabelle(&tft),
+  spriteFortschritt(&tft),
+  spriteMittelwert(&tft),
+  spriteLiveWert(&tft),
+  spriteStatus(&tft),
+  leistungsDiagramm(&tft),
   aktuellerModus(INTRO),
   vorherigerModus(INTRO),
   naechsterModus(INTRO),
+  dialogNachricht(""),
   aktuellerVersuch(0),
   aktuelleMessung(0),
+  anzahlGespeicherteVersuche(0),
   encoderPosition(0),
   previousEncoderPosition(0),
   cursorPosition(0),
   maxCursorPosition(0),
+  ersteCursorZeile(-1),
   buttonPressed(false),
   lastDebounceTime(0),
   debounceDelay(250),
-  anzahlGespeicherteVersuche(0),
   letzterMotorCheck(0),
   motorFehlerZaehler(0),
   motorWarnungAktiv(false),
@@ -60,7 +69,16 @@ WindTurbineExperiment::WindTurbineExperiment() :
   motorStatusAktuell(true),
   letzteAkkuPruefung(0),        // NEU
   akkuSpannung(0),              // NEU
-  akkuProzent(0)                // NEU
+  akkuProzent(0),               // NEU
+  letzteLiveAktualisierung(0),
+  letzteLiveLeistung(0),
+  angezeigterMotorStatus(true),
+  angezeigterAkkuProzent(0),
+  renderBenchmarkAktiv(false),
+  zwischenstandAnsicht(false),
+  versuchAbschliessen(false),
+  letzteSpiegelSendung(0),
+  spiegelGuthaben(0)
 {
   // Initialisiere Standardwerte für ausgewählte Vollfaktoren
   ausgewaehlteVollfaktoren[0] = 0; // Steigung
@@ -71,6 +89,7 @@ WindTurbineExperiment::WindTurbineExperiment() :
   for(int i = 0; i < 5; i++) {
     fixierteFaktorwerte[i] = 99; // 99 = nicht fixiert (Standardwert)
   }
+  anzahlEingegebeneVerbote = 0;
   
   // Arrays mit 0 initialisieren
   for(int i = 0; i < 8; i++) {
@@ -85,9 +104,33 @@ WindTurbineExperiment::WindTurbineExperiment() :
     }
   }
   
+  for(int i = 0; i < ZZP_MAX_ERGAENZUNG; i++) {
+    zzpMittelwerte[i] = 0;
+    zzpStandardabweichungen[i] = 0;
+    for(int j = 0; j < 5; j++) {
+      zzpMessungen[i][j] = 0;
+    }
+  }
+  
+  for(int i = 0; i < 8; i++) {
+    faltMittelwerte[i] = 0;
+    faltStandardabweichungen[i] = 0;
+    for(int j = 0; j < 5; j++) {
+      faltMessungen[i][j] = 0;
+    }
+  }
+  
   for(int i = 0; i < 5; i++) {
     effekte[i] = 0;
   }
+  
+  teilAnalyse.setzePlan<TeilfaktoriellPlan>();
+  vollAnalyse.setzePlan<VollfaktoriellPlan>();
+  teilAlias.setzePlan<TeilfaktoriellPlan>();
+  regression.fuegeHaupteffekteHinzu(VollfaktoriellPlan::FAKTOREN);
+  prognoseModell.fuegeHaupteffekteHinzu(VollfaktoriellPlan::FAKTOREN);
+  prognoseModell.fuegeWechselwirkungenHinzu(VollfaktoriellPlan::FAKTOREN);
+  analyseStand = 0;
 }
  
 void WindTurbineExperiment::setup() {
@@ -97,7 +140,27 @@ void WindTurbineExperiment::setup() {
   // Display initialisieren mit den definierten Pins
   tft.init();
   tft.setRotation(1); // Landscape-Modus
+#if SPIEGEL_AKTIV
+  // Schattenbild anlegen, nachgeführt wird es erst während Spiegelung/WiFi-Export
+  WindTurbineSpiegel::begin(&tft);
+#endif
   tft.fillScreen(TFT_BACKGROUND);
+
+  // SPI-Takt vor initDMA() festlegen, der DMA-Kanal übernimmt ihn
+#if SPI_KALIBRIERUNG_AKTIV
+  spiKalibrierung.begin(&tft);
+  spiKalibrierung.stelleTaktEin(SPI_KALIBRIERUNG_ERZWINGEN);
+#endif
+
+  compositor.begin(&tft);
+  dmaRenderer.begin(&tft);
+  schrift.begin(&tft);
+  widgets.begin(&tft, &schrift);
+  hintergrundCache.begin(&tft, &dmaRenderer);
+  diagrammModell.begin(&tft);
+  zwischenstand.begin(&tft);
+  initialisiereLiveSprites();
+  leistungsDiagramm.begin();
   tft.setTextColor(TFT_TEXT, TFT_BACKGROUND);
   
   // Hintergrundbeleuchtung einschalten (falls Pin definiert)
@@ -137,6 +200,11 @@ void WindTurbineExperiment::setup() {
     delay(3000);
   } else {
     Serial.println("Dateisystem erfolgreich initialisiert");
+#if SCHRIFT_AKTIV
+    // Ohne Atlas bleibt es bei der GLCD-Schrift
+    schrift.ladeAtlas(1, SCHRIFT_DATEI_KLEIN);
+    schrift.ladeAtlas(2, SCHRIFT_DATEI_GROSS);
+#endif
     Serial.println("AUTOMATISCHER RESET DEAKTIVIERT - Verwenden Sie die geheime Sequenz 9999 im Intro-Bildschirm");
   }
 
@@ -151,6 +219,16 @@ void WindTurbineExperiment::setup() {
   // Startup Motor-Check durchführen
   startMotorStartupCheck();
   
+#if DMA_BENCHMARK_BEIM_START
+  // CPU-Zeitersparnis des DMA-Pfads messen und über Serial ausgeben
+  dmaRenderer.fuehreBenchmarkDurch();
+#endif
+
+#if RENDER_BENCHMARK_BEIM_START
+  // Zeit, Zeichenaufrufe und SPI-Bytes pro Bildschirm messen
+  fuehreRenderBenchmarkDurch();
+#endif
+  
   Serial.println("Setup abgeschlossen - zeige Intro");
   
   // Startbildschirm anzeigen
@@ -163,21 +241,19 @@ void WindTurbineExperiment::setup() {
    handleAkkuMonitoring();
    // Motor-Background-Monitoring
    handleMotorBackgroundMonitoring();
-   
-   // Encoder-Position abfragen
-   encoderPosition = encoder.getCount() / 2;
+   // Live-Werte messen und Status prüfen (max. 15 Hz), gezeichnet wird in zeichneBild()
+   aktualisiereLiveAnzeige();
    
    // Prüfen auf Encoder-Drehung
-   if (encoderPosition != previousEncoderPosition) {
-     if (encoderPosition > previousEncoderPosition) {
-       cursorPosition = min(cursorPosition + 1, maxCursorPosition);
-     } else {
-       cursorPosition = max(cursorPosition - 1, 0);
-     }
-     
-     // UI aktualisieren basierend auf aktuellem Modus
-     aktualisiereUI();
-     previousEncoderPosition = encoderPosition;
+   if (pruefeEncoderDrehung() && ersteCursorZeile >= 0) {
+     // Nur vormerken: mehrere Rastungen ergeben ein Bild mit der neuesten Position.
+     // Bildschirme ohne Cursor-Zeilen lösen kein Bild aus und bremsen die Live-Werte nicht.
+     bildPlaner.invalidiereEingabe(UI_BEREICH_CURSOR);
+   }
+   
+   // Vorgemerkte Bereiche zeichnen (max. UI_MAX_BILDER_PRO_SEKUNDE)
+   if (bildPlaner.bildFaellig(micros())) {
+     zeichneBild();
    }
    
    // Prüfen auf Encoder-Button-Druck
@@ -196,6 +272,10 @@ void WindTurbineExperiment::setup() {
    if (key) {
      verarbeiteKeypadEingabe(key);
    }
+   
+   // Spiegelung im Browser (nur wenn gestartet)
+   dataManager.handleWiFiExport();
+   handleSpiegelung();
  }
  
  void WindTurbineExperiment::aktualisiereUI() {
@@ -227,6 +307,14 @@ void WindTurbineExperiment::setup() {
      case ZUSAMMENFASSUNG:
        // Keine UI-Aktualisierung nötig
        break;
+     case ZZP_PLAN:
+     case ZZP_MESSUNG:
+     case ZZP_AUSWERTUNG:
+     case FALTUNG_PLAN:
+     case FALTUNG_MESSUNG:
+     case FALTUNG_AUSWERTUNG:
+       // Keine UI-Aktualisierung nötig
+       break;
      case BESTAETIGUNG_DIALOG:
        // Keine UI-Aktualisierung nötig
        break;
@@ -245,6 +333,78 @@ void WindTurbineExperiment::setup() {
    }
  }
  
+/**
+ * Zeichnet die im Bildplaner vorgemerkten Bereiche
+ * Die Cursor-Auswahl (Eingabe) kommt zuerst; Status und Live-Werte werden
+ * bei verbrauchtem Zeitbudget ins nächste Bild verschoben.
+ */
+void WindTurbineExperiment::zeichneBild() {
+  unsigned long bildStart = micros();
+  uint8_t bereiche = bildPlaner.beginneBild(bildStart);
+
+  if (bereiche & UI_BEREICH_CURSOR) {
+    zeigeCursorAuswahl();
+  }
+
+  if (bereiche & UI_BEREICH_STATUS) {
+    if (bildPlaner.budgetErschoepft(bildStart)) {
+      bildPlaner.verschiebe(UI_BEREICH_STATUS);
+    } else if (aktuellerModus != INTRO) {
+      zeichneMotorStatusBox();
+    }
+  }
+
+  if (bereiche & UI_BEREICH_LIVE) {
+    // Bildschirm kann inzwischen gewechselt haben
+    bool messbildschirm = (aktuellerModus == TEILFAKTORIELL_MESSUNG && !zwischenstandAnsicht) ||
+                          aktuellerModus == VOLLFAKTORIELL_MESSUNG || aktuellerModus == ZZP_MESSUNG ||
+                          aktuellerModus == FALTUNG_MESSUNG;
+    if (messbildschirm) {
+      if (bildPlaner.budgetErschoepft(bildStart)) {
+        bildPlaner.verschiebe(UI_BEREICH_LIVE);
+      } else {
+        bool istTeilfaktoriell = (aktuellerModus == TEILFAKTORIELL_MESSUNG);
+        zeichneLiveLeistung(istTeilfaktoriell, letzteLiveLeistung);
+        // Reicht das Budget nicht für alle neuen Spalten, wird im nächsten Bild nachgezogen
+        if (!leistungsDiagramm.zeichne(15, leistungsDiagrammY(istTeilfaktoriell), bildStart, LIVE_DIAGRAMM_BUDGET_US)) {
+          bildPlaner.verschiebe(UI_BEREICH_LIVE);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Liest den Encoder und bewegt den Cursor innerhalb von 0..maxCursorPosition
+ * Der Cursor folgt der ganzen Drehung seit der letzten Abfrage, damit bei
+ * schnellem Drehen zwischen zwei Bildern keine Rastungen verloren gehen.
+ * @return true wenn der Encoder gedreht wurde
+ */
+bool WindTurbineExperiment::pruefeEncoderDrehung() {
+  encoderPosition = encoder.getCount() / 2;
+  if (encoderPosition == previousEncoderPosition) {
+    return false;
+  }
+  
+  cursorPosition = constrain(cursorPosition + (encoderPosition - previousEncoderPosition), 0, maxCursorPosition);
+  previousEncoderPosition = encoderPosition;
+  return true;
+}
+
+/**
+ * Markiert die Tabellenzeile an der Cursor-Position
+ * Durch den Vergleich der Widget-Eigenschaften werden nur die bisher
+ * und die neu ausgewählte Zeile gezeichnet.
+ */
+void WindTurbineExperiment::zeigeCursorAuswahl() {
+  if (ersteCursorZeile < 0) return;
+  
+  for (int i = 0; i <= maxCursorPosition; i++) {
+    widgets.setzeAusgewaehlt(ersteCursorZeile + i, i == cursorPosition);
+  }
+  widgets.zeichne();
+}
+ 
 void WindTurbineExperiment::verarbeiteButtonDruck() {
   // Vorherigen Modus speichern für Zurück-Funktion
   vorherigerModus = aktuellerModus;
@@ -263,15 +423,22 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
       break;
     case TEILFAKTORIELL_MESSUNG:
       // Messung durchführen
-      if (aktuelleMessung < 5) {
+      if (aktuelleMessung < 5 && !versuchAbschliessen) {
         // Messung mit INA226 durchführen
         teilfaktoriellMessungen[aktuellerVersuch][aktuelleMessung] = messeLeistung();
         aktuelleMessung++;
-        zeigeTeilfaktoriellMessung();
+        // Nur veränderte Bereiche aktualisieren
+        if (zwischenstandAnsicht) {
+          zeichneZwischenstandKopf();
+          zeichneMessStatusleiste(true);
+        } else {
+          aktualisiereMessbildschirm(true);
+        }
       } else {
-        // Alle 5 Messungen abgeschlossen - Mittelwerte und Standardabweichungen berechnen
-        teilfaktoriellMittelwerte[aktuellerVersuch] = berechneMittelwert(teilfaktoriellMessungen[aktuellerVersuch], 5);
-        teilfaktoriellStandardabweichungen[aktuellerVersuch] = berechneStandardabweichung(teilfaktoriellMessungen[aktuellerVersuch], 5, teilfaktoriellMittelwerte[aktuellerVersuch]);
+        // Alle Messungen abgeschlossen (5 oder vorzeitig) - Mittelwerte und Standardabweichungen berechnen
+        versuchAbschliessen = false;
+        teilfaktoriellMittelwerte[aktuellerVersuch] = berechneMittelwert(teilfaktoriellMessungen[aktuellerVersuch], aktuelleMessung);
+        teilfaktoriellStandardabweichungen[aktuellerVersuch] = berechneStandardabweichung(teilfaktoriellMessungen[aktuellerVersuch], aktuelleMessung, teilfaktoriellMittelwerte[aktuellerVersuch]);
 
             // MOTOR-CHECK NACH JEDER 5. MESSUNG
         if (!testMotorVerbindung()) {
@@ -321,6 +488,9 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
         // Motor ist OK - Status aktualisieren
         motorStatusAktuell = true;
         
+        // Zwischenstand der Effekte um diesen Versuch fortschreiben
+        zwischenstand.setzeVersuch(aktuellerVersuch, teilfaktoriellPlan[aktuellerVersuch], teilfaktoriellMittelwerte[aktuellerVersuch]);
+        
         // Bei bestimmten Versuchen manuelle Berechnungen vom Studenten fordern
         if (aktuellerVersuch == 1 || aktuellerVersuch == 4 || aktuellerVersuch == 6) {
           if (random(2) == 0) { // Zufällige Auswahl der Berechnungsart
@@ -334,7 +504,12 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
           aktuellerVersuch++;
           if (aktuellerVersuch < 8) {
             aktuelleMessung = 0;
-            zeigeTeilfaktoriellMessung();
+            if (zwischenstandAnsicht) {
+              // Diagramme bleiben stehen, nur geänderte Punkte und Balken zeichnen
+              aktualisiereZwischenstand();
+            } else {
+              zeigeTeilfaktoriellMessung();
+            }
           } else {
             // Bestätigung vor Abschluss der teilfaktoriellen Versuche
             berechneEffekte();
@@ -357,16 +532,18 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
       break;
     case VOLLFAKTORIELL_MESSUNG:
       // Messung durchführen
-      if (aktuelleMessung < 5) {
+      if (aktuelleMessung < 5 && !versuchAbschliessen) {
         // Messung mit INA226 durchführen
         vollfaktoriellMessungen[aktuellerVersuch][aktuelleMessung] = messeLeistung();
         aktuelleMessung++;
-        zeigeVollfaktoriellMessung();
+        // Nur veränderte Bereiche aktualisieren
+        aktualisiereMessbildschirm(false);
       } else {
 
-        // Alle 5 Messungen abgeschlossen - Mittelwerte und Standardabweichungen berechnen
-        vollfaktoriellMittelwerte[aktuellerVersuch] = berechneMittelwert(vollfaktoriellMessungen[aktuellerVersuch], 5);
-        vollfaktoriellStandardabweichungen[aktuellerVersuch] = berechneStandardabweichung(vollfaktoriellMessungen[aktuellerVersuch], 5, vollfaktoriellMittelwerte[aktuellerVersuch]);
+        // Alle Messungen abgeschlossen (5 oder vorzeitig) - Mittelwerte und Standardabweichungen berechnen
+        versuchAbschliessen = false;
+        vollfaktoriellMittelwerte[aktuellerVersuch] = berechneMittelwert(vollfaktoriellMessungen[aktuellerVersuch], aktuelleMessung);
+        vollfaktoriellStandardabweichungen[aktuellerVersuch] = berechneStandardabweichung(vollfaktoriellMessungen[aktuellerVersuch], aktuelleMessung, vollfaktoriellMittelwerte[aktuellerVersuch]);
         // MOTOR-CHECK NACH JEDER 5. MESSUNG
         if (!testMotorVerbindung()) {
           motorStatusAktuell = false;
@@ -461,6 +638,91 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
       // Bestätigung vor Wechsel zur Zusammenfassung
       zeigeBestaetigung("Zur Zusammenfassung wechseln?", ZUSAMMENFASSUNG);
       break;
+    case ZZP_PLAN:
+      // Ohne stetige Faktoren gibt es nichts zu messen
+      if (wirkungsflaeche.anzahlErgaenzung() > 0) {
+        zeigeBestaetigung("Moechten Sie mit den Messungen beginnen?", ZZP_MESSUNG);
+      }
+      break;
+    case ZZP_MESSUNG:
+      if (aktuelleMessung < 5 && !versuchAbschliessen) {
+        zzpMessungen[aktuellerVersuch][aktuelleMessung] = messeLeistung();
+        aktuelleMessung++;
+        aktualisiereMessbildschirm(false);
+      } else {
+        versuchAbschliessen = false;
+        zzpMittelwerte[aktuellerVersuch] = berechneMittelwert(zzpMessungen[aktuellerVersuch], aktuelleMessung);
+        zzpStandardabweichungen[aktuellerVersuch] = berechneStandardabweichung(zzpMessungen[aktuellerVersuch], aktuelleMessung, zzpMittelwerte[aktuellerVersuch]);
+        
+        // Motor-Check nach jeder 5. Messung: ohne Motor den Versuch neu messen
+        if (!testMotorVerbindung()) {
+          motorStatusAktuell = false;
+          for (int i = 0; i < 5; i++) {
+            zzpMessungen[aktuellerVersuch][i] = 0;
+          }
+          zzpMittelwerte[aktuellerVersuch] = 0;
+          aktuelleMessung = 0;
+          zeigeZzpMessung();
+          zeichneStatusleiste("Motor abgezogen! Anschliessen und Versuch neu messen");
+          return;
+        }
+        motorStatusAktuell = true;
+        
+        // Nächster Versuch oder zur Auswertung
+        aktuellerVersuch++;
+        if (aktuellerVersuch < wirkungsflaeche.anzahlErgaenzung()) {
+          aktuelleMessung = 0;
+          zeigeZzpMessung();
+        } else {
+          zeigeBestaetigung("Alle Messungen abgeschlossen. Zur Auswertung?", ZZP_AUSWERTUNG);
+        }
+      }
+      break;
+    case ZZP_AUSWERTUNG:
+      zeigeBestaetigung("Zur Zusammenfassung wechseln?", ZUSAMMENFASSUNG);
+      break;
+    case FALTUNG_PLAN:
+      if (faltung.istErzeugt()) {
+        zeigeBestaetigung("Moechten Sie mit den Messungen beginnen?", FALTUNG_MESSUNG);
+      }
+      break;
+    case FALTUNG_MESSUNG:
+      if (aktuelleMessung < 5 && !versuchAbschliessen) {
+        faltMessungen[aktuellerVersuch][aktuelleMessung] = messeLeistung();
+        aktuelleMessung++;
+        aktualisiereMessbildschirm(false);
+      } else {
+        versuchAbschliessen = false;
+        faltMittelwerte[aktuellerVersuch] = berechneMittelwert(faltMessungen[aktuellerVersuch], aktuelleMessung);
+        faltStandardabweichungen[aktuellerVersuch] = berechneStandardabweichung(faltMessungen[aktuellerVersuch], aktuelleMessung, faltMittelwerte[aktuellerVersuch]);
+        
+        // Motor-Check nach jeder 5. Messung: ohne Motor den Versuch neu messen
+        if (!testMotorVerbindung()) {
+          motorStatusAktuell = false;
+          for (int i = 0; i < 5; i++) {
+            faltMessungen[aktuellerVersuch][i] = 0;
+          }
+          faltMittelwerte[aktuellerVersuch] = 0;
+          aktuelleMessung = 0;
+          zeigeFaltungMessung();
+          zeichneStatusleiste("Motor abgezogen! Anschliessen und Versuch neu messen");
+          return;
+        }
+        motorStatusAktuell = true;
+        
+        // Nächster Versuch oder zur Auswertung
+        aktuellerVersuch++;
+        if (aktuellerVersuch < faltung.anzahlVersuche()) {
+          aktuelleMessung = 0;
+          zeigeFaltungMessung();
+        } else {
+          zeigeBestaetigung("Alle Messungen abgeschlossen. Zur Auswertung?", FALTUNG_AUSWERTUNG);
+        }
+      }
+      break;
+    case FALTUNG_AUSWERTUNG:
+      zeigeBestaetigung("Zurueck zur teilfaktoriellen Auswertung?", TEILFAKTORIELL_AUSWERTUNG);
+      break;
     case ZUSAMMENFASSUNG:
       // Direkt zum Startbildschirm zurückkehren
       // Zuerst die Liste der gespeicherten Versuche aktualisieren
@@ -481,6 +743,8 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
       // Wird in der Funktion selbst behandelt
       zeigeWiFiExport();
       break;
+    default:
+      break;
   }
 }
  
@@ -490,11 +754,14 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
    vorherigerModus = aktuellerModus;
    // Zielmodus speichern
    naechsterModus = zielModus;
+   dialogNachricht = nachricht;
    // Modus auf Bestätigungsdialog setzen
    aktuellerModus = BESTAETIGUNG_DIALOG;
    
-   // Hintergrund abdunkeln
-   tft.fillScreen(TFT_BACKGROUND);
+   // NEU: Dialog als Overlay über den aktuellen Bildschirm legen,
+   // damit beim Abbrechen nur Dialog und Statusleiste ersetzt werden müssen
+   compositor.zeigeOverlay(OVERLAY_DIALOG, 90, 120, 300, 100);
+   compositor.zeigeOverlay(OVERLAY_DIALOG_STATUS, 0, 320-STATUS_BAR_HEIGHT, 480, STATUS_BAR_HEIGHT);
    
    // Dialog-Box zentriert
    tft.fillRoundRect(90, 120, 300, 100, 8, TFT_OUTLINE);
@@ -531,6 +798,13 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
    // von dem aus der Dialog aufgerufen wurde
    if (aktuellerModus == BESTAETIGUNG_DIALOG) {
      aktuellerModus = vorherigerModus;
+     
+     // NEU: Nur Dialog und Statusleiste entfernen, wenn der Bildschirm darunter noch stimmt
+     bool dialogWiederhergestellt = compositor.entferneOverlay(OVERLAY_DIALOG);
+     dialogWiederhergestellt = compositor.entferneOverlay(OVERLAY_DIALOG_STATUS) && dialogWiederhergestellt;
+     if (dialogWiederhergestellt || repariereBeschaedigteBereiche()) {
+       return;
+     }
    } else if (aktuellerModus == ZUSAMMENFASSUNG) {
      // Von der Zusammenfassung direkt zum Startbildschirm zurückkehren
      aktuellerModus = INTRO;
@@ -570,6 +844,26 @@ void WindTurbineExperiment::verarbeiteButtonDruck() {
      case ZUSAMMENFASSUNG:
        zeigeZusammenfassung();
        break;
+     case ZZP_PLAN:
+       zeigeZzpPlan();
+       break;
+     case ZZP_MESSUNG:
+       zeigeZzpMessung();
+       break;
+     case ZZP_AUSWERTUNG:
+       zeigeZzpAuswertung();
+       break;
+     case FALTUNG_PLAN:
+       zeigeFaltungPlan();
+       break;
+     case FALTUNG_MESSUNG:
+       zeigeFaltungMessung();
+       break;
+     case FALTUNG_AUSWERTUNG:
+       zeigeFaltungAuswertung();
+       break;
+     default:
+       break;
    }
  }
  
@@ -668,6 +962,42 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
         zeigeVollfaktoriellPlan();
       }
       return;
+    } else if (aktuellerModus == ZZP_MESSUNG) {
+      if (aktuellerVersuch > 0) {
+        // Zum vorherigen Versuch zurückgehen, vorhandene Messungen bleiben
+        aktuellerVersuch--;
+        int vorhandeneMessungen = 0;
+        while (vorhandeneMessungen < 5 && zzpMessungen[aktuellerVersuch][vorhandeneMessungen] != 0) {
+          vorhandeneMessungen++;
+        }
+        aktuelleMessung = vorhandeneMessungen;
+        zeigeZzpMessung();
+      } else {
+        zeigeZzpPlan();
+      }
+      return;
+    } else if (aktuellerModus == ZZP_PLAN) {
+      // Zurück zum Regressionsmodell, von dem aus der Plan geöffnet wurde
+      zeigeRegressionModell();
+      return;
+    } else if (aktuellerModus == FALTUNG_MESSUNG) {
+      if (aktuellerVersuch > 0) {
+        // Zum vorherigen Versuch zurückgehen, vorhandene Messungen bleiben
+        aktuellerVersuch--;
+        int vorhandeneMessungen = 0;
+        while (vorhandeneMessungen < 5 && faltMessungen[aktuellerVersuch][vorhandeneMessungen] != 0) {
+          vorhandeneMessungen++;
+        }
+        aktuelleMessung = vorhandeneMessungen;
+        zeigeFaltungMessung();
+      } else {
+        zeigeFaltungPlan();
+      }
+      return;
+    } else if (aktuellerModus == FALTUNG_PLAN) {
+      // Zurück zur teilfaktoriellen Auswertung, von der aus die Faltung geöffnet wurde
+      zeigeTeilfaktoriellAuswertung();
+      return;
     }
     
     // Standard-Zurückfunktion für alle anderen Modi
@@ -692,6 +1022,7 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
         case TEILFAKTORIELL_MESSUNG:
           aktuellerVersuch = 0;
           aktuelleMessung = 0;
+          zwischenstandAnsicht = false;
           zeigeTeilfaktoriellMessung();
           break;
         case TEILFAKTORIELL_AUSWERTUNG:
@@ -716,6 +1047,28 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
         case ZUSAMMENFASSUNG:
           zeigeZusammenfassung();
           break;
+        case ZZP_PLAN:
+          zeigeZzpPlan();
+          break;
+        case ZZP_MESSUNG:
+          aktuellerVersuch = 0;
+          aktuelleMessung = 0;
+          zeigeZzpMessung();
+          break;
+        case ZZP_AUSWERTUNG:
+          zeigeZzpAuswertung();
+          break;
+        case FALTUNG_PLAN:
+          zeigeFaltungPlan();
+          break;
+        case FALTUNG_MESSUNG:
+          aktuellerVersuch = 0;
+          aktuelleMessung = 0;
+          zeigeFaltungMessung();
+          break;
+        case FALTUNG_AUSWERTUNG:
+          zeigeFaltungAuswertung();
+          break;
         case BESCHREIBUNG_EINGABE:
           zeigeBeschreibungEingabe();
           break;
@@ -728,6 +1081,8 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
         case WIFI_EXPORT:
           zeigeWiFiExport();
           break;
+        default:
+          break;
       }
     } else if (key == '*') {
       // Abbrechen - zum vorherigen Modus zurückkehren
@@ -754,7 +1109,7 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
       
       // Debug-Ausgabe (nur für Entwicklung - kann entfernt werden)
       Serial.print("Reset-Sequenz Progress: ");
-      for (int i = 0; i < resetSequenz.length(); i++) {
+      for (int i = 0; i < (int)resetSequenz.length(); i++) {
         Serial.print("*"); // Versteckte Anzeige für Sicherheit
       }
       Serial.println();
@@ -821,6 +1176,10 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
             // Zurück zum Startbildschirm
             zeigeIntro();
           }
+        } else if (key == '3') {
+          // Spiegelung im Browser ein-/ausschalten
+          resetSequenz = ""; // Reset-Sequenz zurücksetzen
+          schalteSpiegelung();
         }
       }
     }
@@ -830,6 +1189,19 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
       aktuelleMessung--;
       // Messwert auf 0 setzen
       teilfaktoriellMessungen[aktuellerVersuch][aktuelleMessung] = 0;
+      if (zwischenstandAnsicht) {
+        zeichneZwischenstandKopf();
+        zeichneMessStatusleiste(true);
+      } else {
+        aktualisiereMessbildschirm(true);
+      }
+    } else if (key == '#' && aktuelleMessung < 5 && messreiheKonfidenz(true).istAusreichend()) {
+      // Konfidenzintervall eng genug: Versuch mit den vorhandenen Messungen abschließen
+      versuchAbschliessen = true;
+      verarbeiteButtonDruck();
+    } else if (key == 'C') {
+      // Zwischen Messbildschirm und Zwischenstand der Effekte wechseln
+      zwischenstandAnsicht = !zwischenstandAnsicht;
       zeigeTeilfaktoriellMessung();
     }
   } else if (aktuellerModus == VOLLFAKTORIELL_MESSUNG) {
@@ -838,7 +1210,47 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
       aktuelleMessung--;
       // Messwert auf 0 setzen
       vollfaktoriellMessungen[aktuellerVersuch][aktuelleMessung] = 0;
-      zeigeVollfaktoriellMessung();
+      aktualisiereMessbildschirm(false);
+    } else if (key == '#' && aktuelleMessung < 5 && messreiheKonfidenz(false).istAusreichend()) {
+      // Konfidenzintervall eng genug: Versuch mit den vorhandenen Messungen abschließen
+      versuchAbschliessen = true;
+      verarbeiteButtonDruck();
+    }
+  } else if (aktuellerModus == ZZP_MESSUNG) {
+    if (key == '*' && aktuelleMessung > 0) {
+      // Letzte Messung löschen
+      aktuelleMessung--;
+      zzpMessungen[aktuellerVersuch][aktuelleMessung] = 0;
+      aktualisiereMessbildschirm(false);
+    } else if (key == '#' && aktuelleMessung < 5 && messreiheKonfidenz(false).istAusreichend()) {
+      versuchAbschliessen = true;
+      verarbeiteButtonDruck();
+    }
+  } else if (aktuellerModus == FALTUNG_MESSUNG) {
+    if (key == '*' && aktuelleMessung > 0) {
+      // Letzte Messung löschen
+      aktuelleMessung--;
+      faltMessungen[aktuellerVersuch][aktuelleMessung] = 0;
+      aktualisiereMessbildschirm(false);
+    } else if (key == '#' && aktuelleMessung < 5 && messreiheKonfidenz(false).istAusreichend()) {
+      versuchAbschliessen = true;
+      verarbeiteButtonDruck();
+    }
+  } else if (aktuellerModus == FALTUNG_PLAN) {
+    if (key >= '0' && key <= '5') {
+      // 0 = Spiegelung aller Faktoren, 1-5 = nur diesen Faktor umkehren
+      bereiteFaltungVor(key == '0' ? FALTUNG_SPIEGELUNG : key - '1');
+      zeigeFaltungPlan();
+    } else if (key == '#' && faltungVollstaendig()) {
+      // Bereits gemessene Faltung direkt auswerten
+      zeigeFaltungAuswertung();
+    }
+  } else if (aktuellerModus == REGRESSION) {
+    if (key == '1') {
+      // Vollfaktoriellen Würfel zum zentralen zusammengesetzten Plan ergänzen
+      bereiteZzpVor();
+      vorherigerModus = REGRESSION;
+      zeigeZzpPlan();
     }
   } else if (aktuellerModus == TEILFAKTORIELL_AUSWERTUNG) {
     if (key == '*') {
@@ -862,6 +1274,17 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
     } else if (key == '4') {
       // Pareto-Diagramm anzeigen
       zeigeParetoEffekteDiagrammAnsicht();
+    } else if (key == '5') {
+      // ANOVA-Tabelle mit F-Tests anzeigen
+      zeigeAnovaTabelleAnsicht();
+    } else if (key == '6') {
+      // Halbnormal-Diagramm mit Lenths Fehlergrenzen anzeigen
+      zeigeHalbnormalDiagrammAnsicht();
+    } else if (key == '7') {
+      // Faltung: zweiter Block zur Entflechtung der Vermengungen (zuletzt gewählte Art)
+      bereiteFaltungVor(faltung.istErzeugt() ? faltung.faltFaktor() : FALTUNG_SPIEGELUNG);
+      vorherigerModus = TEILFAKTORIELL_AUSWERTUNG;
+      zeigeFaltungPlan();
     }
   } else if (aktuellerModus == VOLLFAKTORIELL_AUSWERTUNG) {
     if (key == '*') {
@@ -878,6 +1301,17 @@ void WindTurbineExperiment::verarbeiteKeypadEingabe(char key) {
     if (key == '1') {
       // Gespeicherte Versuche anzeigen
       zeigeGespeicherteVersuche();
+    } else if (key == '2') {
+      // Vorgeschlagene Einstellung ist am Versuchsstand nicht möglich: ausschließen und neu suchen
+      if (verbieteOptimum()) {
+        berechnePrognose();
+        zeichneZusammenfassung();
+      }
+    } else if (key == '3' && anzahlEingegebeneVerbote > 0) {
+      // Eingegebene Ausschlüsse aufheben
+      anzahlEingegebeneVerbote = 0;
+      berechnePrognose();
+      zeichneZusammenfassung();
     }
   } else if (aktuellerModus == GESPEICHERTE_VERSUCHE) {
     // Verarbeitung für gespeicherte Versuche
@@ -1083,7 +1517,7 @@ void WindTurbineExperiment::manuelleDatenLoeschung() {
         tft.setTextColor(TFT_TEXT);
         tft.setCursor(80, 250);
         tft.print("Eingabe: ");
-        for (int i = 0; i < eingabe.length(); i++) {
+        for (int i = 0; i < (int)eingabe.length(); i++) {
           tft.print("*");
         }
         
@@ -1425,6 +1859,9 @@ void WindTurbineExperiment::handleMotorBackgroundMonitoring() {
 void WindTurbineExperiment::zeigeMotorWarnung() {
   motorWarnungAktiv = true;
   
+  // Bereich inklusive Schatten beim Compositor anmelden
+  compositor.zeigeOverlay(OVERLAY_MOTOR_WARNUNG, 50, 50, 378, 110);
+  
   // Warnung als Overlay über aktuellen Bildschirm
   // Schatten-Effekt
   tft.fillRoundRect(52, 52, 376, 108, 8, 0x2104);
@@ -1469,7 +1906,31 @@ void WindTurbineExperiment::versteckeMotorWarnung() {
   
   motorWarnungAktiv = false;
   
-  // Warnung-Bereich übermalen - einfach aktuellen Bildschirm neu zeichnen
+  unsigned long startZeit = millis();
+  
+  // Nur den Bereich unter der Warnung wiederherstellen
+  if (!compositor.entferneOverlay(OVERLAY_MOTOR_WARNUNG) && !repariereBeschaedigteBereiche()) {
+    // Bildschirm darunter ist unbekannt - komplett neu zeichnen
+    compositor.verwerfeBeschaedigteBereiche();
+    if (!zeichneAktuellenBildschirm()) {
+      // Fallback: schwarzer Bereich
+      tft.fillRect(50, 50, 378, 110, TFT_BACKGROUND);
+    }
+  }
+  
+  Serial.print("Overlay entfernt in ");
+  Serial.print(millis() - startZeit);
+  Serial.println(" ms");
+  Serial.println("Motor-Warnung versteckt");
+}
+
+/**
+ * Zeichnet den Bildschirm des aktuellen Modus vollständig neu
+ * Wird auch für das geclippte Neuzeichnen beschädigter Bereiche verwendet,
+ * daher nur Zeichenfunktionen ohne Berechnung oder Speichern (Zusammenfassung).
+ * @return false wenn für den Modus keine Zeichenfunktion existiert
+ */
+bool WindTurbineExperiment::zeichneAktuellenBildschirm() {
   switch (aktuellerModus) {
     case INTRO:
       zeigeIntro();
@@ -1496,15 +1957,60 @@ void WindTurbineExperiment::versteckeMotorWarnung() {
       zeigeRegressionModell();
       break;
     case ZUSAMMENFASSUNG:
-      zeigeZusammenfassung();
+      zeichneZusammenfassung();
       break;
-    default:
-      // Fallback: schwarzer Bereich
-      tft.fillRect(50, 50, 376, 108, TFT_BACKGROUND);
+    case ZZP_PLAN:
+      zeigeZzpPlan();
       break;
+    case ZZP_MESSUNG:
+      zeigeZzpMessung();
+      break;
+    case ZZP_AUSWERTUNG:
+      zeigeZzpAuswertung();
+      break;
+    case FALTUNG_PLAN:
+      zeigeFaltungPlan();
+      break;
+    case FALTUNG_MESSUNG:
+      zeigeFaltungMessung();
+      break;
+    case FALTUNG_AUSWERTUNG:
+      zeigeFaltungAuswertung();
+      break;
+    case BESTAETIGUNG_DIALOG: {
+      // Bildschirm unter dem Dialog und anschließend den Dialog selbst zeichnen
+      ProgrammModus dialogZiel = naechsterModus;
+      aktuellerModus = vorherigerModus;
+      if (aktuellerModus == BESTAETIGUNG_DIALOG || !zeichneAktuellenBildschirm()) {
+        aktuellerModus = BESTAETIGUNG_DIALOG;
+        return false;
+      }
+      zeigeBestaetigung(dialogNachricht, dialogZiel);
+      break;
+    }
+    default:
+      return false;
   }
+  return true;
+}
+
+/**
+ * Zeichnet alle beschädigten Bereiche geclippt neu
+ * Die Zeichenbefehle des Bildschirms laufen vollständig durch, über SPI
+ * werden aber nur die Pixel innerhalb der Bereiche übertragen.
+ * @return true wenn alle Bereiche mit dem richtigen Bildschirm repariert wurden
+ */
+bool WindTurbineExperiment::repariereBeschaedigteBereiche() {
+  bool erfolgreich = true;
   
-  Serial.println("Motor-Warnung versteckt");
+  for (int i = 0; i < compositor.anzahlBeschaedigteBereiche() && erfolgreich; i++) {
+    compositor.beginneReparatur(i);
+    bool gezeichnet = zeichneAktuellenBildschirm();
+    erfolgreich = compositor.beendeReparatur() && gezeichnet;
+  }
+  
+  compositor.verwerfeBeschaedigteBereiche();
+  return erfolgreich;
 }
 
 
@@ -1521,6 +2027,10 @@ void WindTurbineExperiment::handleAkkuMonitoring() {
     if (akkuProzent < 20) {
       Serial.println("⚠️ WARNUNG: Niedriger Akkustand!");
     }
+
+#if UI_BILD_STATISTIK
+    bildPlaner.gibStatistikAus();
+#endif
   }
 }
 
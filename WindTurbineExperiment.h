@@ -24,6 +24,27 @@
 #include <esp_system.h>        // Für esp_reset_reason() (moderne ESP32 API)
 #include "WindTurbineConstants.h"
 #include "WindTurbineDataManager.h"
+#include "WindTurbineCompositor.h"
+#include "WindTurbineDmaRenderer.h"
+#include "WindTurbineWidgets.h"
+#include "WindTurbineHintergrundCache.h"
+#include "WindTurbineStreifenDiagramm.h"
+#include "WindTurbineDiagrammModell.h"
+#include "WindTurbineSpiKalibrierung.h"
+#include "WindTurbineSchrift.h"
+#include "WindTurbineZwischenstand.h"
+#include "WindTurbineRenderZaehler.h"
+#include "WindTurbineBildPlaner.h"
+#include "WindTurbineSpiegel.h"
+#include "WindTurbineEffektAnalyse.h"
+#include "WindTurbineKonfidenz.h"
+#include "WindTurbineRegression.h"
+#include "WindTurbineAnova.h"
+#include "WindTurbineLenth.h"
+#include "WindTurbineAliasStruktur.h"
+#include "WindTurbineWirkungsflaeche.h"
+#include "WindTurbineFaltung.h"
+#include "WindTurbineOptimierung.h"
 
 // Motor-Verbindungstest Pins
 #define MOTOR_TEST_PIN_A 12
@@ -42,6 +63,9 @@ public:
   void setup();
   void loop();
 
+  // Render-Benchmark aller Bildschirme (auch vom Host-Build aufgerufen)
+  void fuehreRenderBenchmarkDurch(BildschirmGezeichnet nachBildschirm = nullptr, void* kontext = nullptr);
+
 private:
   // Status-Enum
   enum ProgrammModus {
@@ -54,6 +78,12 @@ private:
     VOLLFAKTORIELL_AUSWERTUNG,
     REGRESSION,
     ZUSAMMENFASSUNG,
+    ZZP_PLAN,        // Zentraler zusammengesetzter Plan (Stern- und Zentrumspunkte)
+    ZZP_MESSUNG,
+    ZZP_AUSWERTUNG,  // Quadratisches Modell und stationärer Punkt
+    FALTUNG_PLAN,    // Faltung des teilfaktoriellen Plans (zweiter Block)
+    FALTUNG_MESSUNG,
+    FALTUNG_AUSWERTUNG, // Kombinierter Plan aus Teilplan und Faltung
     BESTAETIGUNG_DIALOG, // Neuer Modus für Bestätigungsdialoge
     GESPEICHERTE_VERSUCHE, // Modus für die Anzeige gespeicherter Versuche
     VERSUCH_DETAILS, // Modus für die Detailansicht eines gespeicherten Versuchs
@@ -63,15 +93,46 @@ private:
 
   // Objektreferenzen
   Keypad keypad;
-  TFT_eSPI tft;
+  WindTurbineDisplay tft;       // TFT_eSPI mit Zählung für den Render-Benchmark
   INA226 ina226 = INA226(0x40); // Standard I2C-Adresse für INA226
   ESP32Encoder encoder;
   WindTurbineDataManager dataManager;
+  WindTurbineCompositor compositor; // Overlays und beschädigte Bereiche
+  WindTurbineDmaRenderer dmaRenderer; // Kachelweises Zeichnen per DMA
+  WindTurbineWidgetBaum widgets; // Widgets des aktuellen Bildschirms
+  WindTurbineHintergrundCache hintergrundCache; // Statische Hintergründe (RLE)
+  WindTurbineDiagrammModell diagrammModell; // Geometrie der Auswertungsdiagramme
+  WindTurbineSpiKalibrierung spiKalibrierung; // SPI-Takt des Displays (NVS)
+  WindTurbineSchrift schrift; // Kantengeglättete Schriftatlanten
+  WindTurbineBildPlaner bildPlaner; // Zusammenfassen von Zeichenaufträgen
+  
+  // Sprites für flimmerfreie Live-Bereiche
+  TFT_eSprite spriteTabelle;     // Messwerte des aktuellen Versuchs
+  TFT_eSprite spriteFortschritt; // Messfortschritt n/5
+  TFT_eSprite spriteMittelwert;  // Aktueller Mittelwert
+  TFT_eSprite spriteLiveWert;    // Aktuell anliegende Leistung
+  TFT_eSprite spriteStatus;      // Motor- und Akku-Status im Titelbalken
+  WindTurbineStreifenDiagramm leistungsDiagramm; // Laufendes Leistungsdiagramm
+  WindTurbineZwischenstand zwischenstand; // Effekte während der teilfaktoriellen Messungen
+  WindTurbineEffektAnalyse teilAnalyse;   // Alle Effekte des teilfaktoriellen Plans
+  WindTurbineEffektAnalyse vollAnalyse;   // Alle Effekte des vollfaktoriellen Plans
+  WindTurbineRegression regression;       // Lineares Modell des vollfaktoriellen Versuchs
+  WindTurbineAnova teilAnova;             // Varianzanalyse des teilfaktoriellen Plans
+  WindTurbineLenth teilLenth;             // Effektprüfung ohne Wiederholungen (Lenth)
+  WindTurbineAliasStruktur teilAlias;     // Vermengung im teilfaktoriellen Plan
+  WindTurbineWirkungsflaeche wirkungsflaeche; // Ergänzung und quadratisches Modell des vollfaktoriellen Würfels
+  WindTurbineFaltung faltung;             // Faltungsversuche und kombinierter Plan
+  WindTurbineEffektAnalyse faltAnalyse;   // Alle Effekte aus Teilplan und Faltung
+  WindTurbineAnova faltAnova;             // Varianzanalyse des kombinierten Plans
+  WindTurbineRegression prognoseModell;   // Haupteffekte und Zweifach-Wechselwirkungen für die Prognose
+  WindTurbineOptimierung optimierung;     // Optimumsuche über dem Prognosemodell
+  uint32_t analyseStand;                  // Prüfsumme der Messdaten bei der letzten Auswertung
 
   // Statusvariablen
   ProgrammModus aktuellerModus;
   ProgrammModus vorherigerModus; // Für Zurück-Funktion
   ProgrammModus naechsterModus;  // Für Bestätigungsdialoge
+  const char* dialogNachricht;   // Text des offenen Bestätigungsdialogs
   int aktuellerVersuch;
   float teilfaktoriellMessungen[8][5]; // 8 Versuche × 5 Messwerte
   float teilfaktoriellMittelwerte[8];
@@ -79,12 +140,21 @@ private:
   float vollfaktoriellMessungen[8][5]; // 8 Versuche × 5 Messwerte
   float vollfaktoriellMittelwerte[8];
   float vollfaktoriellStandardabweichungen[8];
+  float zzpMessungen[ZZP_MAX_ERGAENZUNG][5]; // Stern- und Zentrumspunkte × 5 Messwerte
+  float zzpMittelwerte[ZZP_MAX_ERGAENZUNG];
+  float zzpStandardabweichungen[ZZP_MAX_ERGAENZUNG];
+  float faltMessungen[8][5]; // 8 Faltungsversuche × 5 Messwerte
+  float faltMittelwerte[8];
+  float faltStandardabweichungen[8];
   float effekte[5]; // Haupteffekte für 5 Faktoren
   int aktuelleMessung;
   int ausgewaehlteVollfaktoren[3]; // Beispiel: Steigung, Abstand, Blattanzahl
   
   // NEUE VARIABLE: Fixierte Faktorwerte für nicht ausgewählte Faktoren
   int fixierteFaktorwerte[5]; // 99 = nicht fixiert, -1 = niedrige Stufe, 1 = hohe Stufe
+  // Am Versuchsstand nicht einstellbare Optima (Taste 2 in der Zusammenfassung), wie verboteneKombinationen
+  uint8_t eingegebeneVerbote[OPTIMIERUNG_MAX_VERBOTE][2];
+  int anzahlEingegebeneVerbote;
   
   // Datenverwaltungs-Variablen
   char versuchsBeschreibung[100]; // Beschreibung für gespeicherte Versuche
@@ -98,6 +168,7 @@ private:
   int previousEncoderPosition;
   int cursorPosition;
   int maxCursorPosition;
+  int ersteCursorZeile; // Widget der ersten auswählbaren Tabellenzeile (-1 = keine)
   bool buttonPressed;
   unsigned long lastDebounceTime;
   unsigned long debounceDelay;
@@ -113,11 +184,33 @@ private:
   unsigned long letzteAkkuPruefung;
   float akkuSpannung;
   int akkuProzent;
+  // Live-Anzeige
+  unsigned long letzteLiveAktualisierung;
+  float letzteLiveLeistung;
+  bool angezeigterMotorStatus;
+  int angezeigterAkkuProzent;
+  // Render-Benchmark (kein automatisches Speichern, keine Wartezeiten)
+  bool renderBenchmarkAktiv;
+  // Zwischenstand statt Messbildschirm (Taste C während der teilfaktoriellen Messungen)
+  bool zwischenstandAnsicht;
+  // Taste # bei engem Konfidenzintervall: Versuch vor der 5. Messung abschließen
+  bool versuchAbschliessen;
+  // Spiegelung im Browser (Taste 3 im Startbildschirm)
+  unsigned long letzteSpiegelSendung;
+  uint32_t spiegelGuthaben; // Bytes, die noch gesendet werden dürfen
 
   // UI-Hilfsfunktionen
   void zeichneTitelbalken(const char* titel);
   void zeichneStatusleiste(const char* status);
+  void zeichneStatusleiste(TFT_eSPI& ziel, const char* status);
   void zeichneMotorStatusBox();
+  void pausiereAnimation(unsigned long ms);
+  void beginneWidgetBildschirm(const char* titel, const char* status);
+  void zeichneWidgetBildschirm();
+  void zeigeStatischenHintergrund(HintergrundKennung id, EbenenZeichner zeichner);
+  void zeichneIntroHintergrund(TFT_eSPI& ziel);
+  void zeichneTeilMessungHintergrund(TFT_eSPI& ziel);
+  void zeichneVollMessungHintergrund(TFT_eSPI& ziel);
   void zeigeBestaetigung(const char* nachricht, ProgrammModus zielModus);
   void zurueckZumVorherigenModus();
   void zeigeFeedback(bool korrekt, float eingabe, float korrekterWert, const char* einheit, const char* kategorie);
@@ -132,15 +225,28 @@ private:
   void zeigeVollfaktoriellAuswertung();
   void zeigeRegressionModell();
   void zeigeZusammenfassung();
+  void zeichneZusammenfassung();
+  void zeigeZzpPlan();
+  void zeigeZzpMessung();
+  void zeigeZzpAuswertung();
+  void zeichneZzpStufe(int x, int y, int faktor, float kodiert);
+  void zeigeFaltungPlan();
+  void zeigeFaltungMessung();
+  void zeigeFaltungAuswertung();
   
   // Datenverwaltungs-UI-Funktionen
   void zeigeGespeicherteVersuche();
   void zeigeVersuchDetails(const char* filename);
   void zeigeBeschreibungEingabe();
   void zeigeWiFiExport();
+  void schalteSpiegelung();
+  void handleSpiegelung();
   
   // Event-Handler
   void aktualisiereUI();
+  void zeichneBild();
+  bool pruefeEncoderDrehung();
+  void zeigeCursorAuswahl();
   void verarbeiteButtonDruck();
   void verarbeiteKeypadEingabe(char key);
   
@@ -155,9 +261,19 @@ private:
   float berechneStandardabweichung(float* messungen, int anzahl, float mittelwert);
   void berechneEffekte();
   void bestimmeWichtigsteFaktoren();
-  float berechneRegressionsKoeffizient(int koeffIndex);
-  float berechneR2();
+  void waehleVollfaktoren(int reihenfolge[5]);
+  void aktualisiereAuswertung();
+  int vollfaktoriellStufe(int versuch, int faktor);
+  void passeRegressionAn();
   float berechnePrognose();
+  bool verbieteOptimum();
+  void bereiteZzpVor();
+  float zzpStufe(int versuch, int faktor);
+  void passeWirkungsflaecheAn();
+  void bereiteFaltungVor(int faktor);
+  bool faltungVollstaendig();
+  const WindTurbineAnova& auswahlAnova();
+  float auswahlEffekt(int faktor);
   
   // Visualisierungsfunktionen
   void zeigeHaupteffekteDiagrammAnsicht();
@@ -165,11 +281,23 @@ private:
   void zeigeTeilfaktoriellDiagrammAnsicht();
   void zeigeVollfaktoriellDiagrammAnsicht();
   void zeigeParetoEffekteDiagrammAnsicht();
+  void zeigeHalbnormalDiagrammAnsicht();
+  void zeigeAnovaTabelleAnsicht();
+  void zeigeAnovaTabelle();
   void zeigeHaupteffekteDiagramm();
   void zeigeInteraktionsDiagramm();
   void zeigeEffekteDiagramm(int x, int y);
   void zeigeVollfaktoriellDiagramm(int x, int y);
   void zeigeParetoEffekteDiagramm(int x, int y);
+  void zeigeHalbnormalDiagramm(int x, int y);
+  void zeichneDiagrammHintergrund(int x, int y, int breite, int hoehe);
+  uint32_t diagrammDatenstand();
+  void baueHaupteffekteDiagramm();
+  void baueInteraktionsDiagramm();
+  void baueEffekteDiagramm(int x, int y);
+  void baueVollfaktoriellDiagramm(int x, int y);
+  void baueParetoEffekteDiagramm(int x, int y);
+  void baueHalbnormalDiagramm(int x, int y);
   
   // Reset-Funktionalität
   void manuelleDatenLoeschung();
@@ -180,10 +308,30 @@ private:
   void handleMotorBackgroundMonitoring();
   void zeigeMotorWarnung();
   void versteckeMotorWarnung();
+  // Overlay-Reparatur
+  bool zeichneAktuellenBildschirm();
+  bool repariereBeschaedigteBereiche();
   // Battery monitoring functions
   void handleAkkuMonitoring();
   float messeAkkuSpannung();
   int berechneAkkuProzent(float spannung);
+  // Live-Anzeige (Sprites)
+  void initialisiereLiveSprites();
+  float* aktuelleMessreihe(bool istTeilfaktoriell);
+  WindTurbineKonfidenz messreiheKonfidenz(bool istTeilfaktoriell);
+  void zeichneMesswertTabelle(bool istTeilfaktoriell);
+  void zeichneMessfortschritt(bool istTeilfaktoriell);
+  void zeichneMittelwertAnzeige(bool istTeilfaktoriell);
+  void zeichneLiveLeistung(bool istTeilfaktoriell, float leistung);
+  int leistungsDiagrammY(bool istTeilfaktoriell);
+  void zeichneMessStatusleiste(bool istTeilfaktoriell);
+  void aktualisiereMessbildschirm(bool istTeilfaktoriell);
+  void aktualisiereLiveAnzeige();
+  float messeLeistungLive();
+  // Zwischenstand der Effekte
+  void zeigeZwischenstand();
+  void zeichneZwischenstandKopf();
+  void aktualisiereZwischenstand();
 };
 
 #endif // WIND_TURBINE_EXPERIMENT_H
@@ -0,0 +1,157 @@
+/**
+ * WindTurbineFaltung.cpp
+ * Faltungsversuche, Spaltenwörter des kombinierten Plans und Umsortierung der Messungen
+ */
+
+#include "WindTurbineFaltung.h"
+
+WindTurbineFaltung::WindTurbineFaltung() :
+  erzeugt(false),
+  faktor(FALTUNG_SPIEGELUNG),
+  umkehrMaske(0),
+  blockFaktoren(0)
+{
+  for (int f = 0; f < TeilfaktoriellPlan::FAKTOREN; f++) {
+    vorzeichen[f] = 1;
+    woerter[f] = TeilfaktoriellPlan::spaltenWort(f);
+  }
+}
+
+/**
+ * Vorzeichen je Faktor, Spaltenwörter mit Block und Vermengung des kombinierten Plans
+ */
+bool WindTurbineFaltung::erzeuge(int faktor) {
+  const int faktoren = TeilfaktoriellPlan::FAKTOREN;
+  const int basis = TeilfaktoriellPlan::BASIS;
+  erzeugt = false;
+  if (faktor != FALTUNG_SPIEGELUNG && (faktor < 0 || faktor >= faktoren)) {
+    Serial.println("Faltung: ungueltiger Faktor");
+    return false;
+  }
+  this->faktor = faktor;
+
+  umkehrMaske = 0;
+  for (int f = 0; f < faktoren; f++) {
+    vorzeichen[f] = (faktor == FALTUNG_SPIEGELUNG || faktor == f) ? -1 : 1;
+    if (f < basis && vorzeichen[f] < 0) umkehrMaske |= 1u << f;
+  }
+
+  // Vorzeichen der Spalte im Faltungsblock, bezogen auf die neuen Basisstufen
+  blockFaktoren = 0;
+  for (int f = 0; f < faktoren; f++) {
+    unsigned generator = TeilfaktoriellPlan::spaltenWort(f);
+    woerter[f] = generator;
+    if (f < basis) continue;
+    int sigma = vorzeichen[f];
+    for (int j = 0; j < basis; j++) {
+      if ((generator >> j) & 1) sigma *= vorzeichen[j];
+    }
+    if (sigma < 0) {
+      woerter[f] |= blockWort();
+      if (blockFaktoren == 0) blockFaktoren = (1u << f) ^ generator;
+    }
+  }
+  if (blockFaktoren == 0) {
+    // Keine Spalte wechselt das Vorzeichen: Faltung wiederholt nur den Teilplan
+    Serial.println("Faltung: keine Entflechtung moeglich");
+    return false;
+  }
+
+  int tabelle[2 * TeilfaktoriellPlan::VERSUCHE * TeilfaktoriellPlan::FAKTOREN];
+  for (int v = 0; v < TeilfaktoriellPlan::VERSUCHE; v++) {
+    for (int f = 0; f < faktoren; f++) {
+      tabelle[kombiIndex(v, false) * faktoren + f] = teilfaktoriellPlan[v][f];
+      tabelle[kombiIndex(v, true) * faktoren + f] = stufe(v, f);
+    }
+  }
+  if (!kombiAlias.ausTabelle(tabelle, anzahlKombiniert(), faktoren)) return false;
+
+  erzeugt = true;
+  return true;
+}
+
+bool WindTurbineFaltung::istErzeugt() const {
+  return erzeugt;
+}
+
+int WindTurbineFaltung::faltFaktor() const {
+  return faktor;
+}
+
+bool WindTurbineFaltung::istSpiegelung() const {
+  return faktor == FALTUNG_SPIEGELUNG;
+}
+
+int WindTurbineFaltung::anzahlVersuche() const {
+  return TeilfaktoriellPlan::VERSUCHE;
+}
+
+int WindTurbineFaltung::stufe(int versuch, int faktor) const {
+  if (versuch < 0 || versuch >= TeilfaktoriellPlan::VERSUCHE || faktor < 0 || faktor >= TeilfaktoriellPlan::FAKTOREN) return 0;
+  return vorzeichen[faktor] * teilfaktoriellPlan[versuch][faktor];
+}
+
+int WindTurbineFaltung::anzahlKombiniert() const {
+  return 2 * TeilfaktoriellPlan::VERSUCHE;
+}
+
+unsigned WindTurbineFaltung::spaltenWort(int faktor) const {
+  if (faktor < 0 || faktor >= TeilfaktoriellPlan::FAKTOREN) return 0;
+  return woerter[faktor];
+}
+
+unsigned WindTurbineFaltung::blockWort() const {
+  return 1u << TeilfaktoriellPlan::BASIS;
+}
+
+unsigned WindTurbineFaltung::faktorMaske(unsigned wort) const {
+  return (wort & (blockWort() - 1)) ^ ((wort & blockWort()) ? blockFaktoren : 0);
+}
+
+unsigned WindTurbineFaltung::blockMaske() const {
+  return blockFaktoren;
+}
+
+const WindTurbineAliasStruktur& WindTurbineFaltung::alias() const {
+  return kombiAlias;
+}
+
+/**
+ * Teilplan mit Block +1, Faltung mit Block -1; die umgekehrten Basisfaktoren
+ * bestimmen die Position eines Faltungsversuchs in der Standardreihenfolge
+ */
+int WindTurbineFaltung::kombiIndex(int versuch, bool faltung) const {
+  return faltung ? (int)(versuch ^ umkehrMaske) : (int)(versuch | blockWort());
+}
+
+/**
+ * Mittelwerte und Einzelmessungen beider Blöcke in Standardreihenfolge des
+ * kombinierten Plans bringen und alle Effekte in einem Durchlauf berechnen
+ */
+bool WindTurbineFaltung::berechne(WindTurbineEffektAnalyse& analyse,
+                                  const float* teilMittelwerte, const float* teilMessungen,
+                                  const float* faltMittelwerte, const float* faltMessungen, int wiederholungen) const {
+  if (!erzeugt) return false;
+  if (wiederholungen > FALTUNG_MAX_WIEDERHOLUNGEN) {
+    Serial.println("Faltung: zu viele Wiederholungen");
+    return false;
+  }
+  const int versuche = TeilfaktoriellPlan::VERSUCHE;
+  bool einzelmessungen = teilMessungen != nullptr && faltMessungen != nullptr && wiederholungen > 0;
+
+  float mittelwerte[2 * TeilfaktoriellPlan::VERSUCHE];
+  float messungen[2 * TeilfaktoriellPlan::VERSUCHE * FALTUNG_MAX_WIEDERHOLUNGEN];
+  for (int v = 0; v < versuche; v++) {
+    int teil = kombiIndex(v, false);
+    int falt = kombiIndex(v, true);
+    mittelwerte[teil] = teilMittelwerte[v];
+    mittelwerte[falt] = faltMittelwerte[v];
+    for (int w = 0; einzelmessungen && w < wiederholungen; w++) {
+      messungen[teil * wiederholungen + w] = teilMessungen[v * wiederholungen + w];
+      messungen[falt * wiederholungen + w] = faltMessungen[v * wiederholungen + w];
+    }
+  }
+
+  analyse.setzePlan(TeilfaktoriellPlan::BASIS + 1, TeilfaktoriellPlan::FAKTOREN, woerter);
+  return analyse.berechne(mittelwerte, einzelmessungen ? messungen : nullptr, einzelmessungen ? wiederholungen : 0);
+}
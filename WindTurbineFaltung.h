@@ -0,0 +1,81 @@
+/**
+ * WindTurbineFaltung.h
+ * Faltung (Foldover) des teilfaktoriellen Plans zur Entflechtung vermengter Effekte
+ *
+ * Die Faltung ist ein zweiter Block aus 8 Versuchen, in dem die Stufen eines
+ * Faktors (einfache Faltung) oder aller Faktoren (Spiegelung) umgekehrt sind.
+ * Gemessen werden nur diese 8 Versuche, ausgewertet wird der kombinierte Plan
+ * aus 16 Versuchen:
+ * - Spiegelung: alle Haupteffekte frei von Zweifach-Wechselwirkungen (Auflösung IV)
+ * - Faltung eines Faktors: dieser Faktor und alle seine Zweifach-Wechselwirkungen
+ *   werden frei von den übrigen Zweifach-Wechselwirkungen
+ *
+ * Der kombinierte Plan ist wieder ein regulärer 2^(5-1)-Plan mit Blockfaktor.
+ * Seine Basis sind die Basisfaktoren des Teilplans und der Block (+1 = Teilplan,
+ * -1 = Faltung). Mit den Vorzeichen s_j der Faltung hat ein erzeugter Faktor f
+ * mit Generatorwort w_f im Faltungsblock die Spalte s_f * Π s_j * Π x_j (j in w_f).
+ * Ist dieses Vorzeichen -1, wechselt seine Spalte mit dem Block das Vorzeichen
+ * und sein Spaltenwort im kombinierten Plan enthält den Block. Der Blockeffekt
+ * (Unterschied beider Messreihen) ist dann mit f * w_f vermengt.
+ *
+ * Die Versuche werden in Standardreihenfolge der neuen Basis umsortiert, so dass
+ * WindTurbineEffektAnalyse alle 15 Effekte in einem Durchlauf liefert. Die
+ * Vermengung des kombinierten Plans leitet WindTurbineAliasStruktur aus der
+ * Tabelle ab.
+ */
+
+#ifndef WIND_TURBINE_FALTUNG_H
+#define WIND_TURBINE_FALTUNG_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineEffektAnalyse.h"
+#include "WindTurbineAliasStruktur.h"
+
+class WindTurbineFaltung {
+public:
+  // Konstruktor
+  WindTurbineFaltung();
+
+  // Faltungsversuche erzeugen
+  // @param faktor umzukehrender Faktor, FALTUNG_SPIEGELUNG = alle Faktoren
+  bool erzeuge(int faktor);
+
+  bool istErzeugt() const;
+  int faltFaktor() const;
+  bool istSpiegelung() const;
+
+  // Faltungsversuche (gleiche Reihenfolge wie der Teilplan)
+  int anzahlVersuche() const;
+  int stufe(int versuch, int faktor) const;
+
+  // Kombinierter Plan: Basis sind die Basisfaktoren und der Block (blockWort())
+  int anzahlKombiniert() const;
+  unsigned spaltenWort(int faktor) const;
+  unsigned blockWort() const;
+  // Faktoren eines Worts des kombinierten Plans (Block durch seine Vermengung ersetzt)
+  unsigned faktorMaske(unsigned wort) const;
+  // Mit dem Blockeffekt vermengtes Wort der Faktoren
+  unsigned blockMaske() const;
+  const WindTurbineAliasStruktur& alias() const;
+
+  // Effekte des kombinierten Plans berechnen
+  // @param teilMessungen, faltMessungen [Versuch * wiederholungen + w] oder nullptr
+  bool berechne(WindTurbineEffektAnalyse& analyse,
+                const float* teilMittelwerte, const float* teilMessungen,
+                const float* faltMittelwerte, const float* faltMessungen, int wiederholungen) const;
+
+private:
+  bool erzeugt;
+  int faktor;
+  int vorzeichen[TeilfaktoriellPlan::FAKTOREN];
+  unsigned woerter[TeilfaktoriellPlan::FAKTOREN];
+  unsigned umkehrMaske;  // Umgekehrte Basisfaktoren
+  unsigned blockFaktoren;
+  WindTurbineAliasStruktur kombiAlias;
+
+  // Index eines Versuchs im kombinierten Plan
+  int kombiIndex(int versuch, bool faltung) const;
+};
+
+#endif // WIND_TURBINE_FALTUNG_H
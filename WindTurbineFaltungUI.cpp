@@ -0,0 +1,370 @@
+/**
+ * WindTurbineFaltungUI.cpp
+ * Plan-, Mess- und Auswertungsbildschirm der Faltung des teilfaktoriellen Plans
+ *
+ * Gemessen werden nur die 8 Faltungsversuche; die ersten 8 Versuche kommen aus
+ * dem teilfaktoriellen Versuch. Der Messbildschirm benutzt Hintergrund und
+ * Live-Bereiche des vollfaktoriellen Versuchs.
+ */
+
+#include "WindTurbineExperiment.h"
+
+// Faktornamen für enge Spalten
+static const char* kurzeFaktorNamen[] = {"Steigung", "Groesse", "Abstand", "Luftst.", "Blattanz."};
+
+/**
+ * Art der Faltung als Text, z.B. "Spiegelung aller Faktoren"
+ */
+static void formatiereFaltArt(const WindTurbineFaltung& faltung, char* puffer, int groesse) {
+  if (faltung.istSpiegelung()) {
+    snprintf(puffer, groesse, "Spiegelung aller Faktoren");
+  } else {
+    snprintf(puffer, groesse, "Faltung von %c (%s)", 'A' + faltung.faltFaktor(), faktorNamen[faltung.faltFaktor()]);
+  }
+}
+
+/**
+ * Zeigt die Faltungsversuche und die Vermengung vor und nach der Faltung
+ * Tasten 0-5 wählen die Art der Faltung.
+ */
+void WindTurbineExperiment::zeigeFaltungPlan() {
+  char text[48];
+
+  tft.fillScreen(TFT_BACKGROUND);
+  zeichneTitelbalken("Faltung des Teilplans (Foldover)");
+
+  // Art der Faltung und Vermengung
+  tft.fillRoundRect(20, 48, 440, 76, 5, TFT_OUTLINE);
+  tft.fillRect(21, 49, 438, 18, TFT_TITLE_BG);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 55);
+  formatiereFaltArt(faltung, text, sizeof(text));
+  tft.print(text);
+
+  int gemessen = 0;
+  for (int v = 0; v < faltung.anzahlVersuche(); v++) {
+    if (faltMittelwerte[v] != 0) gemessen++;
+  }
+  tft.setTextColor(gemessen == faltung.anzahlVersuche() ? TFT_SUCCESS : TFT_LIGHT_TEXT);
+  tft.setCursor(330, 55);
+  tft.print("Gemessen: ");
+  tft.print(gemessen);
+  tft.print(" von ");
+  tft.print(faltung.anzahlVersuche());
+
+  char relation[48];
+  tft.setTextColor(TFT_SUBTITLE);
+  tft.setCursor(30, 74);
+  tft.print("Teilplan (8 Versuche):");
+  teilAlias.formatiereRelation(relation, sizeof(relation));
+  tft.setTextColor(TFT_TEXT);
+  tft.setCursor(200, 74);
+  tft.print(relation);
+  tft.print("  Aufl. ");
+  tft.print(WindTurbineAliasStruktur::aufloesungText(teilAlias.aufloesung()));
+
+  if (faltung.istErzeugt()) {
+    tft.setTextColor(TFT_SUBTITLE);
+    tft.setCursor(30, 89);
+    tft.print("Mit Faltung (16 Versuche):");
+    faltung.alias().formatiereRelation(relation, sizeof(relation));
+    tft.setTextColor(TFT_HIGHLIGHT);
+    tft.setCursor(200, 89);
+    tft.print(relation);
+    tft.print("  Aufl. ");
+    tft.print(WindTurbineAliasStruktur::aufloesungText(faltung.alias().aufloesung()));
+
+    tft.setTextColor(TFT_SUBTITLE);
+    tft.setCursor(30, 104);
+    tft.print("Block vermengt mit:");
+    faltung.alias().formatiereKette(faltung.blockMaske(), relation, sizeof(relation));
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.setCursor(200, 104);
+    tft.print(relation);
+  } else {
+    tft.setTextColor(TFT_WARNING);
+    tft.setCursor(30, 89);
+    tft.print("Keine Faltung erzeugt.");
+  }
+
+  // Tabelle der Faltungsversuche
+  tft.fillRoundRect(20, 130, 440, 160, 5, TFT_OUTLINE);
+  tft.fillRect(21, 131, 438, 20, TFT_TITLE_BG);
+  tft.setCursor(30, 137);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.print("Nr.");
+  for (int j = 0; j < 5; j++) {
+    bool gefaltet = faltung.istErzeugt() && faltung.stufe(0, j) != teilfaktoriellPlan[0][j];
+    tft.setTextColor(gefaltet ? TFT_WARNING : TFT_HIGHLIGHT);
+    tft.setCursor(60 + j * 80, 137);
+    tft.print(kurzeFaktorNamen[j]);
+  }
+
+  for (int i = 0; faltung.istErzeugt() && i < faltung.anzahlVersuche(); i++) {
+    int y = 162 + i * 15;
+
+    if (i % 2 == 0) {
+      tft.fillRect(21, y-7, 438, 15, 0x1082);
+    }
+
+    tft.setTextColor(faltMittelwerte[i] != 0 ? TFT_SUCCESS : TFT_TEXT);
+    tft.setCursor(33, y-3);
+    tft.print(i + 9);
+
+    for (int j = 0; j < 5; j++) {
+      zeichneZzpStufe(60 + j * 80, y, j, faltung.stufe(i, j));
+    }
+  }
+
+  zeichneStatusleiste(gemessen == faltung.anzahlVersuche() ? "Knopf: neu messen | #: Auswertung | 0: Spiegelung | 1-5: Faktor"
+                                                           : "Knopf: Messungen | 0: Spiegelung | 1-5: nur diesen Faktor falten");
+
+  maxCursorPosition = 0;
+  aktuellerModus = FALTUNG_PLAN;
+}
+
+/**
+ * Messbildschirm eines Faltungsversuchs (5 Messungen wie im vollfaktoriellen Versuch)
+ */
+void WindTurbineExperiment::zeigeFaltungMessung() {
+  int anzahl = faltung.anzahlVersuche();
+  if (aktuellerVersuch >= anzahl) {
+    // Zurück aus der Auswertung: letzten Versuch zeigen
+    aktuellerVersuch = anzahl - 1;
+    aktuelleMessung = 5;
+  }
+  // Die Live-Bereiche lesen die Messreihe über den Modus
+  aktuellerModus = FALTUNG_MESSUNG;
+
+  zeigeStatischenHintergrund(HINTERGRUND_VOLL_MESSUNG, [this](TFT_eSPI& ziel) {
+    zeichneVollMessungHintergrund(ziel);
+  });
+
+  char titel[50];
+  sprintf(titel, "Faltung des Teilplans: Versuch %d/%d", aktuellerVersuch + 1, anzahl);
+  zeichneTitelbalken(titel);
+
+  // Fortschrittsanzeige
+  tft.fillRoundRect(380, 15, 90, 20, 5, TFT_TITLE_BG);
+  tft.fillRect(382, 17, (aktuellerVersuch * 86) / anzahl, 16, TFT_HIGHLIGHT);
+
+  // Faktoreinstellungen hinter den Faktornamen, umgekehrte Faktoren markiert
+  tft.setTextSize(1);
+  for (int i = 0; i < 5; i++) {
+    int y = 78 + i * 22;
+    zeichneZzpStufe(95, y, i, faltung.stufe(aktuellerVersuch, i));
+
+    if (faltung.stufe(aktuellerVersuch, i) != teilfaktoriellPlan[aktuellerVersuch][i]) {
+      tft.setTextColor(TFT_WARNING);
+      tft.setCursor(180, y-3);
+      tft.print("(gefaltet)");
+    }
+  }
+  tft.setTextColor(TFT_SUBTITLE);
+  tft.setCursor(180, 60);
+  tft.print("zu Nr. ");
+  tft.print(aktuellerVersuch + 1);
+  tft.setTextColor(TFT_TEXT);
+
+  // Messwerte, Fortschritt, Mittelwert und Live-Leistung (als Sprites)
+  zeichneMesswertTabelle(false);
+  zeichneMessfortschritt(false);
+  zeichneMittelwertAnzeige(false);
+  zeichneLiveLeistung(false, letzteLiveLeistung);
+
+  leistungsDiagramm.zeichneVollstaendig(15, leistungsDiagrammY(false));
+
+  zeichneMessStatusleiste(false);
+
+  maxCursorPosition = 0;
+}
+
+/**
+ * Auswertung des kombinierten Plans: Haupteffekte vor und nach der Faltung mit
+ * Konfidenzintervall und p-Wert, Blockeffekt und die verbleibenden Ketten der
+ * Zweifach-Wechselwirkungen
+ */
+void WindTurbineExperiment::zeigeFaltungAuswertung() {
+  aktualisiereAuswertung();
+  bool vollstaendig = faltungVollstaendig() && faltAnalyse.istGueltig();
+  char text[48];
+
+  tft.fillScreen(TFT_BACKGROUND);
+  zeichneTitelbalken("Teilplan + Faltung (16 Versuche)");
+
+  // Art der Faltung und Vermengung vorher / nachher
+  tft.fillRoundRect(20, 48, 440, 58, 5, TFT_OUTLINE);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 56);
+  formatiereFaltArt(faltung, text, sizeof(text));
+  tft.print(text);
+
+  tft.setTextColor(TFT_SUBTITLE);
+  tft.setCursor(30, 72);
+  tft.print("Aufloesung ");
+  tft.print(WindTurbineAliasStruktur::aufloesungText(teilAlias.aufloesung()));
+  tft.print(" -> ");
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.print(WindTurbineAliasStruktur::aufloesungText(faltung.alias().aufloesung()));
+  tft.setTextColor(TFT_TEXT);
+  tft.print("   ");
+  faltung.alias().formatiereRelation(text, sizeof(text));
+  tft.print(text);
+
+  tft.setTextColor(TFT_SUBTITLE);
+  tft.setCursor(30, 88);
+  tft.print("Block (Teilplan - Faltung): ");
+  if (vollstaendig) {
+    float block = faltAnalyse.effekt(faltung.blockWort());
+    tft.setTextColor(TFT_TEXT);
+    if (block >= 0) tft.print("+");
+    tft.print(block, 2);
+    tft.print(" uW");
+  }
+  tft.setTextColor(TFT_LIGHT_TEXT);
+  tft.print("  = ");
+  faltung.alias().formatiereKette(faltung.blockMaske(), text, sizeof(text), 3);
+  tft.print(text);
+
+  if (!vollstaendig) {
+    int gemessen = 0;
+    for (int v = 0; v < faltung.anzahlVersuche(); v++) {
+      if (faltMittelwerte[v] != 0) gemessen++;
+    }
+    tft.fillRoundRect(20, 112, 440, 60, 5, TFT_OUTLINE);
+    tft.setTextColor(TFT_WARNING);
+    tft.setCursor(30, 124);
+    tft.print("Faltung noch nicht vollstaendig gemessen (");
+    tft.print(gemessen);
+    tft.print(" von ");
+    tft.print(faltung.anzahlVersuche());
+    tft.print(").");
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.setCursor(30, 142);
+    tft.print("Die Faktorauswahl nutzt weiter den Teilplan.");
+    zeichneStatusleiste("Druecken: Zurueck zur teilfaktoriellen Auswertung");
+    maxCursorPosition = 0;
+    aktuellerModus = FALTUNG_AUSWERTUNG;
+    return;
+  }
+
+  // Haupteffekte: Teilplan gegen kombinierten Plan
+  tft.fillRoundRect(20, 112, 440, 112, 5, TFT_OUTLINE);
+  tft.fillRect(21, 113, 438, 18, TFT_TITLE_BG);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 119);
+  tft.print("Faktor");
+  tft.setCursor(100, 119);
+  tft.print("Teilplan");
+  tft.setCursor(170, 119);
+  tft.print("Kombiniert +/-KI");
+  tft.setCursor(290, 119);
+  tft.print("p");
+  tft.setCursor(345, 119);
+  tft.print("Vermengung");
+
+  bool pruefung = faltAnova.hatPruefung();
+  float halbbreite = faltAnalyse.konfidenzHalbbreite();
+  for (int i = 0; i < 5; i++) {
+    int y = 137 + i * 15;
+
+    if (i % 2 == 0) {
+      tft.fillRect(21, y-4, 438, 15, 0x1082);
+    }
+
+    tft.setTextColor(TFT_TEXT);
+    tft.setCursor(30, y);
+    tft.print(kurzeFaktorNamen[i]);
+
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.setCursor(100, y);
+    if (teilAnalyse.haupteffekt(i) >= 0) tft.print("+");
+    tft.print(teilAnalyse.haupteffekt(i), 2);
+
+    float effekt = faltAnalyse.haupteffekt(i);
+    tft.setTextColor(effekt >= 0 ? TFT_SUCCESS : TFT_WARNING);
+    tft.setCursor(170, y);
+    if (effekt >= 0) tft.print("+");
+    tft.print(effekt, 2);
+    if (halbbreite > 0) {
+      tft.setTextColor(TFT_LIGHT_TEXT);
+      tft.print("+/-");
+      tft.print(halbbreite, 2);
+    }
+
+    tft.setCursor(290, y);
+    if (pruefung) {
+      float p = faltAnova.pWertFaktor(i);
+      tft.setTextColor(p < ANOVA_ALPHA ? TFT_HIGHLIGHT : TFT_LIGHT_TEXT);
+      if (p < 0.001) {
+        tft.print("<0.001");
+      } else {
+        tft.print(p, 3);
+      }
+    } else {
+      tft.setTextColor(TFT_LIGHT_TEXT);
+      tft.print("-");
+    }
+
+    // Verbliebene Vermengung mit Zweifach-Wechselwirkungen
+    char kette[24];
+    faltung.alias().formatiereKette(1u << i, kette, sizeof(kette), 2);
+    const char* aliase = strchr(kette, '=');
+    tft.setCursor(345, y);
+    if (aliase != nullptr) {
+      tft.setTextColor(TFT_WARNING);
+      tft.print(aliase);
+    } else {
+      tft.setTextColor(TFT_SUCCESS);
+      tft.print("frei");
+    }
+  }
+
+  tft.setTextColor(TFT_LIGHT_TEXT);
+  tft.setCursor(30, 212);
+  if (halbbreite > 0) {
+    tft.print("KI ");
+    tft.print(KONFIDENZ_NIVEAU);
+    tft.print("% aus ");
+    tft.print(faltAnalyse.freiheitsgrade());
+    tft.print(" FG (beide Bloecke)");
+  } else {
+    tft.print("KI und p: keine Wiederholungen");
+  }
+
+  // Größte übrige Wörter (Ketten der Zweifach-Wechselwirkungen)
+  tft.fillRoundRect(20, 230, 440, 62, 5, TFT_OUTLINE);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 237);
+  tft.print("Wechselwirkungsketten (nach Betrag):");
+
+  unsigned woerter[EFFEKT_MAX_VERSUCHE];
+  int anzahl = faltAnalyse.sortiereNachBetrag(woerter, EFFEKT_MAX_VERSUCHE);
+  int zeile = 0;
+  for (int i = 0; i < anzahl && zeile < 6; i++) {
+    bool spalte = woerter[i] == faltung.blockWort();
+    for (int f = 0; f < 5; f++) spalte = spalte || woerter[i] == faltung.spaltenWort(f);
+    if (spalte) continue;
+
+    int x = 30 + (zeile / 3) * 220;
+    int y = 251 + (zeile % 3) * 13;
+    char kette[24];
+    faltung.alias().formatiereKette(faltung.faktorMaske(woerter[i]), kette, sizeof(kette), 2);
+    float effekt = faltAnalyse.effekt(woerter[i]);
+    tft.setTextColor(TFT_TEXT);
+    tft.setCursor(x, y);
+    tft.print(kette);
+    tft.setCursor(x + 120, y);
+    tft.setTextColor(pruefung && faltAnova.effektZeile(woerter[i] - 1).p < ANOVA_ALPHA ? TFT_WARNING : TFT_LIGHT_TEXT);
+    if (effekt >= 0) tft.print("+");
+    tft.print(effekt, 2);
+    zeile++;
+  }
+
+  zeichneStatusleiste("Druecken: Zurueck | Faktorauswahl nutzt jetzt den kombinierten Plan");
+
+  maxCursorPosition = 0;
+  aktuellerModus = FALTUNG_AUSWERTUNG;
+}
@@ -0,0 +1,237 @@
+/**
+ * WindTurbineHintergrundCache.cpp
+ * RLE-Zwischenspeicher für statische Bildschirmhintergründe
+ */
+
+#include "WindTurbineHintergrundCache.h"
+#include "WindTurbineRenderZaehler.h"
+#include "WindTurbineSpiegel.h"
+
+// Zustand beim Entpacken in die DMA-Kacheln
+struct EntpackKontext {
+  const uint16_t* daten;
+  size_t position;
+  uint16_t rest;   // Verbleibende Pixel des aktuellen Laufs
+  uint16_t farbe;  // Farbe des aktuellen Laufs (bereits byte-getauscht)
+};
+
+static void entpackeKachel(uint16_t* puffer, int16_t breite, int16_t, int16_t zeilen, void* kontext) {
+  EntpackKontext* k = (EntpackKontext*)kontext;
+  int32_t pixel = (int32_t)breite * zeilen;
+
+  while (pixel > 0) {
+    if (k->rest == 0) {
+      k->rest = k->daten[k->position];
+      uint16_t farbe = k->daten[k->position + 1];
+      k->farbe = (farbe >> 8) | (farbe << 8);
+      k->position += 2;
+    }
+    uint16_t anzahl = (k->rest < pixel) ? k->rest : (uint16_t)pixel;
+    for (uint16_t i = 0; i < anzahl; i++) {
+      *puffer++ = k->farbe;
+    }
+    k->rest -= anzahl;
+    pixel -= anzahl;
+  }
+}
+
+WindTurbineHintergrundCache::WindTurbineHintergrundCache() :
+  tft(nullptr),
+  dmaRenderer(nullptr)
+{
+  for (int i = 0; i < HINTERGRUND_ANZAHL; i++) {
+    eintraege[i].daten = nullptr;
+    eintraege[i].laenge = 0;
+    eintraege[i].kapazitaet = 0;
+    eintraege[i].fehlgeschlagen = false;
+  }
+}
+
+WindTurbineHintergrundCache::~WindTurbineHintergrundCache() {
+  leeren();
+}
+
+void WindTurbineHintergrundCache::begin(TFT_eSPI* display, WindTurbineDmaRenderer* dma) {
+  tft = display;
+  dmaRenderer = dma;
+}
+
+/**
+ * Zeigt einen statischen Hintergrund an
+ * Beim ersten Aufruf wird er aufgenommen und gespeichert.
+ * @return true wenn der Hintergrund aus dem Speicher übertragen wurde
+ */
+bool WindTurbineHintergrundCache::zeige(HintergrundKennung id, EbenenZeichner zeichner) {
+  if (tft == nullptr) return false;
+
+  Eintrag& eintrag = eintraege[id];
+  if (eintrag.fehlgeschlagen) return false;
+
+  if (eintrag.daten == nullptr) {
+    unsigned long start = millis();
+    if (!nimmAuf(eintrag, zeichner)) {
+      eintrag.fehlgeschlagen = true;
+      return false;
+    }
+    Serial.print("Hintergrund ");
+    Serial.print(id);
+    Serial.print(" gespeichert: ");
+    Serial.print(eintrag.laenge * sizeof(uint16_t));
+    Serial.print(" Bytes, ");
+    Serial.print(millis() - start);
+    Serial.println(" ms");
+  }
+
+  uebertrage(eintrag);
+  return true;
+}
+
+void WindTurbineHintergrundCache::leeren() {
+  for (int i = 0; i < HINTERGRUND_ANZAHL; i++) {
+    gibFrei(eintraege[i]);
+    eintraege[i].fehlgeschlagen = false;
+  }
+}
+
+size_t WindTurbineHintergrundCache::belegterSpeicher() {
+  size_t summe = 0;
+  for (int i = 0; i < HINTERGRUND_ANZAHL; i++) {
+    summe += eintraege[i].kapazitaet * sizeof(uint16_t);
+  }
+  return summe;
+}
+
+/**
+ * Zeichnet die statische Ebene streifenweise in ein Sprite und kodiert sie
+ * Über den Viewport mit negativem Ursprung verwendet der Zeichner weiterhin
+ * absolute Bildschirmkoordinaten, alles außerhalb des Streifens wird geclippt.
+ */
+bool WindTurbineHintergrundCache::nimmAuf(Eintrag& eintrag, EbenenZeichner& zeichner) {
+  const int16_t breite = 480;
+  const int16_t hoehe = 320;
+
+  TFT_eSprite streifen(tft);
+  streifen.setColorDepth(16);
+  if (streifen.createSprite(breite, HINTERGRUND_STREIFEN_HOEHE) == nullptr) {
+    Serial.println("Hintergrund-Cache: Kein Speicher fuer Streifen");
+    return false;
+  }
+
+  uint16_t laufFarbe = 0;
+  uint16_t laufAnzahl = 0;
+  bool ok = true;
+
+  for (int16_t y0 = 0; y0 < hoehe && ok; y0 += HINTERGRUND_STREIFEN_HOEHE) {
+    streifen.fillSprite(TFT_BACKGROUND);
+    streifen.setViewport(0, -y0, breite, hoehe, true);
+    zeichner(streifen);
+    streifen.resetViewport();
+
+    // Sprite-Puffer enthält byte-getauschtes RGB565
+    const uint16_t* pixel = (const uint16_t*)streifen.getPointer();
+    int16_t zeilen = min((int)HINTERGRUND_STREIFEN_HOEHE, (int)(hoehe - y0));
+    int32_t anzahlPixel = (int32_t)breite * zeilen;
+
+    for (int32_t i = 0; i < anzahlPixel; i++) {
+      uint16_t farbe = (pixel[i] >> 8) | (pixel[i] << 8);
+      if (laufAnzahl > 0 && (farbe != laufFarbe || laufAnzahl == 0xFFFF)) {
+        if (!haengeLaufAn(eintrag, laufAnzahl, laufFarbe)) {
+          ok = false;
+          break;
+        }
+        laufAnzahl = 0;
+      }
+      laufFarbe = farbe;
+      laufAnzahl++;
+    }
+  }
+
+  if (ok && laufAnzahl > 0) {
+    ok = haengeLaufAn(eintrag, laufAnzahl, laufFarbe);
+  }
+
+  streifen.deleteSprite();
+
+  if (!ok) {
+    Serial.println("Hintergrund-Cache: Speichergrenze erreicht, zeichne direkt");
+    gibFrei(eintrag);
+    return false;
+  }
+
+  // Reserve aus dem Verdoppeln zurückgeben
+  size_t groesse = eintrag.laenge * sizeof(uint16_t);
+  uint16_t* passend = psramFound() ? (uint16_t*)ps_realloc(eintrag.daten, groesse)
+                                   : (uint16_t*)realloc(eintrag.daten, groesse);
+  if (passend != nullptr) {
+    eintrag.daten = passend;
+    eintrag.kapazitaet = eintrag.laenge;
+  }
+  return true;
+}
+
+/**
+ * Hängt einen Lauf an, der Puffer wächst bis HINTERGRUND_MAX_BYTES
+ * Bevorzugt im PSRAM. Ohne PSRAM teilen sich alle Hintergründe
+ * HINTERGRUND_MAX_BYTES_INTERN im internen Heap; was nicht mehr passt,
+ * wird weiter direkt gezeichnet.
+ */
+bool WindTurbineHintergrundCache::haengeLaufAn(Eintrag& eintrag, uint16_t anzahl, uint16_t farbe) {
+  if (eintrag.laenge + 2 > eintrag.kapazitaet) {
+    size_t grenze = HINTERGRUND_MAX_BYTES;
+    if (!psramFound()) {
+      size_t andere = belegterSpeicher() - eintrag.kapazitaet * sizeof(uint16_t);
+      grenze = (andere < HINTERGRUND_MAX_BYTES_INTERN) ? min(grenze, (size_t)HINTERGRUND_MAX_BYTES_INTERN - andere) : 0;
+    }
+    size_t neueKapazitaet = (eintrag.kapazitaet == 0) ? 1024 : eintrag.kapazitaet * 2;
+    if (neueKapazitaet * sizeof(uint16_t) > grenze) {
+      neueKapazitaet = grenze / sizeof(uint16_t);
+    }
+    if (neueKapazitaet < eintrag.laenge + 2) {
+      return false;
+    }
+
+    size_t groesse = neueKapazitaet * sizeof(uint16_t);
+    uint16_t* neu = psramFound() ? (uint16_t*)ps_realloc(eintrag.daten, groesse)
+                                 : (uint16_t*)realloc(eintrag.daten, groesse);
+    if (neu == nullptr) {
+      return false;
+    }
+    eintrag.daten = neu;
+    eintrag.kapazitaet = neueKapazitaet;
+  }
+
+  eintrag.daten[eintrag.laenge++] = anzahl;
+  eintrag.daten[eintrag.laenge++] = farbe;
+  return true;
+}
+
+/**
+ * Überträgt einen gespeicherten Hintergrund als einen Block (0,0 - 479,319)
+ * Mit DMA wird die nächste Kachel entpackt, während die vorige übertragen wird.
+ */
+void WindTurbineHintergrundCache::uebertrage(Eintrag& eintrag) {
+  if (dmaRenderer != nullptr && dmaRenderer->istBereit()) {
+    EntpackKontext k = {eintrag.daten, 0, 0, 0};
+    dmaRenderer->zeichneBereich(0, 0, 480, 320, entpackeKachel, &k);
+    return;
+  }
+
+  tft->startWrite();
+  tft->setAddrWindow(0, 0, 480, 320);
+  WindTurbineSpiegel::beginneFenster(0, 0, 480, 320);
+  for (size_t i = 0; i + 1 < eintrag.laenge; i += 2) {
+    tft->pushBlock(eintrag.daten[i + 1], eintrag.daten[i]);
+    WindTurbineSpiegel::uebernimmLauf(eintrag.daten[i + 1], eintrag.daten[i]);
+  }
+  tft->endWrite();
+  WindTurbineRenderZaehler::erfasseBlock(480UL * 320);
+}
+
+void WindTurbineHintergrundCache::gibFrei(Eintrag& eintrag) {
+  if (eintrag.daten != nullptr) {
+    free(eintrag.daten);
+    eintrag.daten = nullptr;
+  }
+  eintrag.laenge = 0;
+  eintrag.kapazitaet = 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * WindTurbineHintergrundCache.h
+ * Zwischenspeicher für statische Bildschirmhintergründe
+ *
+ * Der statische Teil eines Bildschirms (Rahmen, Boxen, feste Beschriftungen)
+ * wird beim ersten Aufruf streifenweise in ein Sprite gezeichnet und
+ * lauflängenkodiert (RLE) im PSRAM bzw. Heap abgelegt (ohne PSRAM höchstens
+ * HINTERGRUND_MAX_BYTES_INTERN für alle Hintergründe zusammen). Bei jedem weiteren
+ * Aufruf wird der Hintergrund in einer einzigen Übertragung auf das Display
+ * geschrieben, danach zeichnet der Bildschirm nur noch die dynamischen Inhalte.
+ */
+
+#ifndef WIND_TURBINE_HINTERGRUND_CACHE_H
+#define WIND_TURBINE_HINTERGRUND_CACHE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <functional>
+#include "WindTurbineConstants.h"
+#include "WindTurbineDmaRenderer.h"
+
+// Bildschirme mit zwischengespeichertem Hintergrund
+enum HintergrundKennung {
+  HINTERGRUND_INTRO = 0,
+  HINTERGRUND_TEIL_MESSUNG,
+  HINTERGRUND_VOLL_MESSUNG,
+  HINTERGRUND_ANZAHL
+};
+
+// Zeichnet die statische Ebene mit absoluten Bildschirmkoordinaten auf das Ziel
+typedef std::function<void(TFT_eSPI& ziel)> EbenenZeichner;
+
+class WindTurbineHintergrundCache {
+public:
+  // Konstruktor und Destruktor
+  WindTurbineHintergrundCache();
+  ~WindTurbineHintergrundCache();
+
+  // Initialisierung (dma darf nullptr sein)
+  void begin(TFT_eSPI* display, WindTurbineDmaRenderer* dma);
+
+  // Hintergrund anzeigen, beim ersten Aufruf aufnehmen
+  // @return false wenn der Hintergrund nicht gespeichert werden kann (dann direkt zeichnen)
+  bool zeige(HintergrundKennung id, EbenenZeichner zeichner);
+
+  // Alle gespeicherten Hintergründe verwerfen
+  void leeren();
+
+  size_t belegterSpeicher();
+
+private:
+  struct Eintrag {
+    uint16_t* daten;    // Paare aus Lauflänge und Farbe
+    size_t laenge;      // Anzahl belegter uint16_t
+    size_t kapazitaet;  // Anzahl reservierter uint16_t
+    bool fehlgeschlagen;
+  };
+
+  TFT_eSPI* tft;
+  WindTurbineDmaRenderer* dmaRenderer;
+  Eintrag eintraege[HINTERGRUND_ANZAHL];
+
+  bool nimmAuf(Eintrag& eintrag, EbenenZeichner& zeichner);
+  bool haengeLaufAn(Eintrag& eintrag, uint16_t anzahl, uint16_t farbe);
+  void uebertrage(Eintrag& eintrag);
+  void gibFrei(Eintrag& eintrag);
+};
+
+#endif // WIND_TURBINE_HINTERGRUND_CACHE_H
@@ -0,0 +1,80 @@
+/**
+ * WindTurbineKonfidenz.cpp
+ * Fortgeschriebener Mittelwert und Varianz (Welford), Intervall-Halbbreiten
+ */
+
+#include "WindTurbineKonfidenz.h"
+
+// Stichprobe der Tabelle (t(0.975; 4) = 2.776)
+static_assert(tQuantil(4) > 2.775f && tQuantil(4) < 2.777f, "t-Tabelle fehlerhaft");
+static_assert(tQuantil(45) == 2.021f, "t-Tabelle: Stufe 40 erwartet");
+
+WindTurbineKonfidenz::WindTurbineKonfidenz() :
+  n(0),
+  mittel(0),
+  quadratsumme(0)
+{
+}
+
+void WindTurbineKonfidenz::zuruecksetzen() {
+  n = 0;
+  mittel = 0;
+  quadratsumme = 0;
+}
+
+/**
+ * Eine Messung aufnehmen: Mittelwert und Quadratsumme der Abweichungen fortschreiben
+ */
+void WindTurbineKonfidenz::fuegeHinzu(float wert) {
+  n++;
+  double abweichung = wert - mittel;
+  mittel += abweichung / n;
+  quadratsumme += abweichung * (wert - mittel);
+}
+
+int WindTurbineKonfidenz::ausMessreihe(const float* messungen, int maxAnzahl) {
+  zuruecksetzen();
+  int anzahl = zaehleMessungen(messungen, maxAnzahl);
+  for (int i = 0; i < anzahl; i++) {
+    fuegeHinzu(messungen[i]);
+  }
+  return anzahl;
+}
+
+int WindTurbineKonfidenz::anzahl() const {
+  return n;
+}
+
+float WindTurbineKonfidenz::mittelwert() const {
+  return mittel;
+}
+
+float WindTurbineKonfidenz::varianz() const {
+  return n > 1 ? quadratsumme / (n - 1) : 0;
+}
+
+float WindTurbineKonfidenz::standardabweichung() const {
+  return sqrt(varianz());
+}
+
+float WindTurbineKonfidenz::halbbreite() const {
+  if (n < 2) return 0;
+  return tQuantil(n - 1) * standardabweichung() / sqrt((float)n);
+}
+
+float WindTurbineKonfidenz::relativeHalbbreite() const {
+  if (n < 2 || mittel == 0) return 0;
+  return halbbreite() / fabs(mittel);
+}
+
+bool WindTurbineKonfidenz::istAusreichend(float zielAnteil) const {
+  return n >= KONFIDENZ_MIN_WIEDERHOLUNGEN && mittel != 0 && relativeHalbbreite() <= zielAnteil;
+}
+
+int WindTurbineKonfidenz::zaehleMessungen(const float* messungen, int maxAnzahl) {
+  int anzahl = 0;
+  while (anzahl < maxAnzahl && messungen[anzahl] != 0) {
+    anzahl++;
+  }
+  return anzahl;
+}
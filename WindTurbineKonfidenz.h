@@ -0,0 +1,76 @@
+/**
+ * WindTurbineKonfidenz.h
+ * Laufende Statistik einer Messreihe und Konfidenzintervalle nach Student
+ *
+ * Mittelwert und Quadratsumme werden mit jeder Messung fortgeschrieben
+ * (Welford), so dass Mittelwert, Standardabweichung und die Halbbreite des
+ * Konfidenzintervalls t(n-1) * s / sqrt(n) nach jeder Wiederholung ohne
+ * erneuten Durchlauf über alle Messwerte bereitstehen.
+ *
+ * Die Quantile der t-Verteilung stehen als constexpr-Tabelle zur Verfügung
+ * (zweiseitig, KONFIDENZ_NIVEAU). Zwischen den Tabellenstufen oberhalb von
+ * 30 Freiheitsgraden gilt der Wert der nächstkleineren Stufe, das Intervall
+ * wird dadurch höchstens etwas zu breit.
+ *
+ * Ein Messwert 0 bedeutet wie überall im Experiment "noch nicht gemessen":
+ * ausMessreihe() übernimmt nur die Messungen vor der ersten 0.
+ */
+
+#ifndef WIND_TURBINE_KONFIDENZ_H
+#define WIND_TURBINE_KONFIDENZ_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+
+// Zweiseitige 95-%-Quantile t(0.975; fg) für fg = 1..30
+static constexpr float KONFIDENZ_T_TABELLE[30] = {
+  12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+
+// t-Quantil zu fg Freiheitsgraden (0 ohne Freiheitsgrade)
+constexpr float tQuantil(int fg) {
+  return fg < 1 ? 0.0f
+       : fg <= 30 ? KONFIDENZ_T_TABELLE[fg - 1]
+       : fg < 40 ? 2.042f
+       : fg < 60 ? 2.021f
+       : fg < 120 ? 2.000f
+       : 1.980f;
+}
+
+class WindTurbineKonfidenz {
+public:
+  // Konstruktor
+  WindTurbineKonfidenz();
+
+  void zuruecksetzen();
+  void fuegeHinzu(float wert);
+
+  // Neu aufbauen aus den ersten Messungen einer Reihe (bis zur ersten 0)
+  // @return Anzahl übernommener Messungen
+  int ausMessreihe(const float* messungen, int maxAnzahl);
+
+  int anzahl() const;
+  float mittelwert() const;
+  float varianz() const;
+  float standardabweichung() const;
+
+  // Halbbreite des Konfidenzintervalls um den Mittelwert (0 bei weniger als 2 Messungen)
+  float halbbreite() const;
+  // Halbbreite relativ zum Betrag des Mittelwerts
+  float relativeHalbbreite() const;
+
+  // Genug Wiederholungen und Intervall eng genug, um den Versuch abzuschließen
+  bool istAusreichend(float zielAnteil = KONFIDENZ_ZIEL_ANTEIL) const;
+
+  // Anzahl Messungen einer Reihe vor der ersten 0
+  static int zaehleMessungen(const float* messungen, int maxAnzahl);
+
+private:
+  int n;
+  double mittel;
+  double quadratsumme;
+};
+
+#endif // WIND_TURBINE_KONFIDENZ_H
@@ -0,0 +1,164 @@
+/**
+ * WindTurbineLenth.cpp
+ * Pseudo-Standardfehler, Fehlergrenzen und Halbnormal-Quantile
+ */
+
+#include "WindTurbineLenth.h"
+#include "WindTurbineAnova.h"
+
+/**
+ * Median eines aufsteigend sortierten Felds
+ */
+static float median(const float* sortiert, int anzahl) {
+  if (anzahl < 1) return 0;
+  if (anzahl % 2 == 1) return sortiert[anzahl / 2];
+  return 0.5 * (sortiert[anzahl / 2 - 1] + sortiert[anzahl / 2]);
+}
+
+WindTurbineLenth::WindTurbineLenth() :
+  gueltig(false),
+  effekte(0),
+  pseudoFehler(0),
+  grenze(0),
+  simultanGrenze(0),
+  fg(0)
+{
+  for (int i = 0; i < EFFEKT_MAX_VERSUCHE - 1; i++) {
+    woerter[i] = 0;
+    werte[i] = 0;
+    quantile[i] = 0;
+  }
+}
+
+/**
+ * Beträge sortieren, PSE aus den gestutzten Beträgen, Grenzen über die t-Verteilung
+ */
+bool WindTurbineLenth::berechne(const WindTurbineEffektAnalyse& analyse, float alpha) {
+  gueltig = false;
+  if (!analyse.istGueltig()) return false;
+
+  effekte = analyse.anzahlVersuche() - 1;
+  if (effekte < LENTH_MIN_EFFEKTE) return false;
+
+  // Einfügesortierung nach Betrag (höchstens 63 Kontraste)
+  float betraege[EFFEKT_MAX_VERSUCHE - 1];
+  for (int i = 0; i < effekte; i++) {
+    unsigned w = i + 1;
+    float b = fabs(analyse.effekt(w));
+    int pos = i;
+    while (pos > 0 && betraege[pos - 1] > b) {
+      betraege[pos] = betraege[pos - 1];
+      woerter[pos] = woerter[pos - 1];
+      pos--;
+    }
+    betraege[pos] = b;
+    woerter[pos] = w;
+  }
+  for (int i = 0; i < effekte; i++) {
+    werte[i] = analyse.effekt(woerter[i]);
+    quantile[i] = normalQuantil(0.5 + 0.5 * (i + 0.5) / effekte);
+  }
+
+  // Sortierung bleibt beim Stutzen erhalten: Präfix unter 2.5 * s0
+  float s0 = LENTH_FAKTOR * median(betraege, effekte);
+  int gestutzt = 0;
+  while (gestutzt < effekte && betraege[gestutzt] < LENTH_GRENZE * s0) gestutzt++;
+  pseudoFehler = LENTH_FAKTOR * median(betraege, gestutzt);
+
+  fg = effekte / 3.0;
+  float gamma = 1.0 - pow(1.0 - alpha, 1.0 / effekte);
+  grenze = WindTurbineAnova::quantilT(alpha, fg) * pseudoFehler;
+  simultanGrenze = WindTurbineAnova::quantilT(gamma, fg) * pseudoFehler;
+
+  gueltig = pseudoFehler > 0;
+  return gueltig;
+}
+
+bool WindTurbineLenth::istGueltig() const {
+  return gueltig;
+}
+
+int WindTurbineLenth::anzahlEffekte() const {
+  return gueltig ? effekte : 0;
+}
+
+unsigned WindTurbineLenth::wort(int rang) const {
+  if (rang < 0 || rang >= effekte) return 0;
+  return woerter[rang];
+}
+
+float WindTurbineLenth::effekt(int rang) const {
+  if (rang < 0 || rang >= effekte) return 0;
+  return werte[rang];
+}
+
+float WindTurbineLenth::quantil(int rang) const {
+  if (rang < 0 || rang >= effekte) return 0;
+  return quantile[rang];
+}
+
+float WindTurbineLenth::pse() const {
+  return gueltig ? pseudoFehler : 0;
+}
+
+float WindTurbineLenth::me() const {
+  return gueltig ? grenze : 0;
+}
+
+float WindTurbineLenth::sme() const {
+  return gueltig ? simultanGrenze : 0;
+}
+
+float WindTurbineLenth::freiheitsgrade() const {
+  return gueltig ? fg : 0;
+}
+
+bool WindTurbineLenth::istAktiv(int rang) const {
+  return gueltig && fabs(effekt(rang)) > simultanGrenze;
+}
+
+bool WindTurbineLenth::istAuffaellig(int rang) const {
+  return gueltig && fabs(effekt(rang)) > grenze;
+}
+
+/**
+ * Φ⁻¹(p) nach Acklam: rationale Näherung im Kern, Randbereiche über sqrt(-2 ln q)
+ * (relativer Fehler < 1.2e-9, für die Diagrammachse mehr als genug)
+ */
+float WindTurbineLenth::normalQuantil(float p) {
+  static const double a[6] = {
+    -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+    1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00
+  };
+  static const double b[5] = {
+    -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+    6.680131188771972e+01, -1.328068155288572e+01
+  };
+  static const double c[6] = {
+    -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+    -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00
+  };
+  static const double d[4] = {
+    7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+    3.754408661907416e+00
+  };
+  const double rand = 0.02425;
+
+  if (p <= 0) return -INFINITY;
+  if (p >= 1) return INFINITY;
+
+  if (p < rand) {
+    double q = sqrt(-2 * log((double)p));
+    return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+           ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+  }
+  if (p > 1 - rand) {
+    double q = sqrt(-2 * log(1 - (double)p));
+    return -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+  }
+  double q = p - 0.5;
+  double r = q * q;
+  return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+         (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+}
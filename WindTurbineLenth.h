@@ -0,0 +1,68 @@
+/**
+ * WindTurbineLenth.h
+ * Effektprüfung nach Lenth und Halbnormalverteilungs-Diagramm
+ *
+ * Ohne Wiederholungen (z.B. Teilplan mit manuell eingegebenen Mittelwerten)
+ * fehlt der reine Fehler, gegen den die ANOVA prüft. Lenth schätzt die Streuung
+ * stattdessen aus den Effekten selbst: In einem gesättigten Plan sind die meisten
+ * der N-1 Kontraste nur Rauschen.
+ *
+ *   s0  = 1.5 * Median |c|
+ *   PSE = 1.5 * Median { |c| : |c| < 2.5 * s0 }     (Pseudo-Standardfehler)
+ *   ME  = t(1 - α/2; m/3) * PSE                      (Fehlergrenze)
+ *   SME = t(1 - γ/2; m/3) * PSE,  γ = 1 - (1 - α)^(1/m)  (simultane Fehlergrenze)
+ *
+ * mit m = N-1 Kontrasten. Effekte über ME gelten als auffällig, über SME als
+ * aktiv. Für das Halbnormal-Diagramm werden die Beträge aufsteigend sortiert
+ * und gegen die Quantile Φ⁻¹(0.5 + 0.5 (i - 0.5) / m) aufgetragen; inaktive
+ * Effekte liegen dann auf einer Geraden durch den Ursprung.
+ */
+
+#ifndef WIND_TURBINE_LENTH_H
+#define WIND_TURBINE_LENTH_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineEffektAnalyse.h"
+
+class WindTurbineLenth {
+public:
+  // Konstruktor
+  WindTurbineLenth();
+
+  // PSE, Grenzen und Halbnormal-Quantile aus einer berechneten Effektanalyse
+  bool berechne(const WindTurbineEffektAnalyse& analyse, float alpha = ANOVA_ALPHA);
+
+  bool istGueltig() const;
+
+  // Kontraste nach Betrag aufsteigend (Rang 0 = kleinster Betrag)
+  int anzahlEffekte() const;
+  unsigned wort(int rang) const;
+  float effekt(int rang) const;
+  float quantil(int rang) const;
+
+  float pse() const;
+  float me() const;
+  float sme() const;
+  float freiheitsgrade() const;
+
+  // Betrag über der simultanen bzw. einfachen Fehlergrenze
+  bool istAktiv(int rang) const;
+  bool istAuffaellig(int rang) const;
+
+  // Quantil der Standardnormalverteilung (rationale Näherung nach Acklam)
+  static float normalQuantil(float p);
+
+private:
+  bool gueltig;
+  int effekte;
+  unsigned woerter[EFFEKT_MAX_VERSUCHE - 1];
+  float werte[EFFEKT_MAX_VERSUCHE - 1];
+  float quantile[EFFEKT_MAX_VERSUCHE - 1];
+  float pseudoFehler;
+  float grenze;
+  float simultanGrenze;
+  float fg;
+};
+
+#endif // WIND_TURBINE_LENTH_H
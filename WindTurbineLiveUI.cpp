@@ -0,0 +1,366 @@
+/**
+ * WindTurbineLiveUI.cpp
+ * Flimmerfreie Live-Anzeigen auf den Messbildschirmen
+ *
+ * Die dynamischen Bereiche (Messwert-Tabelle, Messfortschritt, Mittelwert,
+ * Live-Leistung, Motor-/Akku-Status) werden in kleinen TFT_eSprite-Puffern
+ * aufgebaut und in einem Stück übertragen. Ohne freien Speicher für ein
+ * Sprite wird direkt auf das Display gezeichnet.
+ */
+
+#include "WindTurbineExperiment.h"
+
+/**
+ * Legt die Sprites für die dynamischen Bereiche an (einmalig in setup())
+ */
+void WindTurbineExperiment::initialisiereLiveSprites() {
+  spriteTabelle.setColorDepth(16);
+  spriteFortschritt.setColorDepth(16);
+  spriteMittelwert.setColorDepth(16);
+  spriteLiveWert.setColorDepth(16);
+  spriteStatus.setColorDepth(16);
+
+  bool ok = true;
+  ok = (spriteTabelle.createSprite(95, 96) != nullptr) && ok;
+  ok = (spriteFortschritt.createSprite(275, 15) != nullptr) && ok;
+  ok = (spriteMittelwert.createSprite(225, 18) != nullptr) && ok;
+  ok = (spriteLiveWert.createSprite(150, 18) != nullptr) && ok;
+  ok = (spriteStatus.createSprite(112, 14) != nullptr) && ok;
+
+  if (!ok) {
+    Serial.println("Nicht alle Live-Sprites angelegt - zeichne direkt auf das Display");
+  }
+}
+
+/**
+ * Messreihe des aktuellen Versuchs auf dem jeweiligen Messbildschirm
+ * Wirkungsfläche und Faltung benutzen den Bildschirmaufbau des vollfaktoriellen Versuchs.
+ */
+float* WindTurbineExperiment::aktuelleMessreihe(bool istTeilfaktoriell) {
+  if (istTeilfaktoriell) return teilfaktoriellMessungen[aktuellerVersuch];
+  if (aktuellerModus == ZZP_MESSUNG) return zzpMessungen[aktuellerVersuch];
+  if (aktuellerModus == FALTUNG_MESSUNG) return faltMessungen[aktuellerVersuch];
+  return vollfaktoriellMessungen[aktuellerVersuch];
+}
+
+/**
+ * Mittelwert, Streuung und Konfidenzintervall der bisherigen Messungen des Versuchs
+ */
+WindTurbineKonfidenz WindTurbineExperiment::messreiheKonfidenz(bool istTeilfaktoriell) {
+  WindTurbineKonfidenz konfidenz;
+  konfidenz.ausMessreihe(aktuelleMessreihe(istTeilfaktoriell), aktuelleMessung);
+  return konfidenz;
+}
+
+/**
+ * Zeichnet die Messwerte des aktuellen Versuchs (rechte Spalte der Messungs-Box)
+ * @param istTeilfaktoriell true für den teilfaktoriellen Messbildschirm
+ */
+void WindTurbineExperiment::zeichneMesswertTabelle(bool istTeilfaktoriell) {
+  int x = istTeilfaktoriell ? 320 : 340;
+  int y = 83;
+  float* messungen = aktuelleMessreihe(istTeilfaktoriell);
+
+  bool imSprite = spriteTabelle.created();
+  TFT_eSPI& ziel = imSprite ? static_cast<TFT_eSPI&>(spriteTabelle) : static_cast<TFT_eSPI&>(tft);
+  int ox = imSprite ? 0 : x;
+  int oy = imSprite ? 0 : y;
+
+  ziel.fillRect(ox, oy, 95, 96, TFT_OUTLINE);
+  ziel.setTextSize(1);
+
+  for (int i = 0; i < 5; i++) {
+    int zeileY = oy + i * 20;
+
+    if (i < aktuelleMessung) {
+      // Leistungswert mit Messwert-Rahmen
+      ziel.fillRoundRect(ox, zeileY, 95, 15, 3, TFT_SUCCESS);
+      ziel.setTextColor(TFT_TEXT);
+      ziel.setCursor(ox + 5, zeileY + 2);
+      ziel.print(messungen[i], 2);
+      ziel.print(" uW");
+    } else {
+      // Noch nicht gemessen
+      ziel.drawRoundRect(ox, zeileY, 95, 15, 3, TFT_GRID);
+      ziel.setTextColor(TFT_TEXT);
+      ziel.setCursor(ox + 30, zeileY + 2);
+      ziel.print("---");
+    }
+  }
+
+  if (imSprite) {
+    gebeSpriteAus(spriteTabelle, x, y);
+  }
+}
+
+/**
+ * Zeichnet den Fortschrittsbalken der 5 Messungen inklusive "n/5"
+ */
+void WindTurbineExperiment::zeichneMessfortschritt(bool istTeilfaktoriell) {
+  int x = 170;
+  int y = istTeilfaktoriell ? 232 : 242;
+
+  bool imSprite = spriteFortschritt.created();
+  TFT_eSPI& ziel = imSprite ? static_cast<TFT_eSPI&>(spriteFortschritt) : static_cast<TFT_eSPI&>(tft);
+  int ox = imSprite ? 0 : x;
+  int oy = imSprite ? 0 : y;
+
+  ziel.fillRect(ox, oy, 275, 15, TFT_OUTLINE);
+
+  // Balken für Messfortschritt
+  ziel.drawRect(ox, oy, 250, 15, TFT_GRID);
+  ziel.fillRect(ox + 2, oy + 2, (aktuelleMessung * 246) / 5, 11, TFT_SUCCESS);
+
+  // Zahlenwert des Fortschritts
+  ziel.setTextSize(1);
+  ziel.setTextColor(TFT_TEXT);
+  ziel.setCursor(ox + 255, oy + 3);
+  ziel.print(aktuelleMessung);
+  ziel.print("/5");
+
+  if (imSprite) {
+    gebeSpriteAus(spriteFortschritt, x, y);
+  }
+}
+
+/**
+ * Zeichnet den aktuellen Mittelwert, außer bei Versuchen, in denen der
+ * Mittelwert später manuell berechnet werden soll, und ab zwei Messungen die
+ * relative Halbbreite des Konfidenzintervalls (grün, sobald # abschließen darf)
+ */
+void WindTurbineExperiment::zeichneMittelwertAnzeige(bool istTeilfaktoriell) {
+  int x = 25;
+  int y = istTeilfaktoriell ? 207 : 217;
+
+  bool anzeigen;
+  float* messungen = aktuelleMessreihe(istTeilfaktoriell);
+  if (istTeilfaktoriell) {
+    anzeigen = aktuelleMessung > 0 && aktuellerVersuch != 1 && aktuellerVersuch != 4 && aktuellerVersuch != 6;
+  } else if (aktuellerModus == ZZP_MESSUNG || aktuellerModus == FALTUNG_MESSUNG) {
+    anzeigen = aktuelleMessung == 5;
+  } else {
+    anzeigen = aktuelleMessung == 5 && aktuellerVersuch != 2 && aktuellerVersuch != 5;
+  }
+
+  bool imSprite = spriteMittelwert.created();
+  TFT_eSPI& ziel = imSprite ? static_cast<TFT_eSPI&>(spriteMittelwert) : static_cast<TFT_eSPI&>(tft);
+  int ox = imSprite ? 0 : x;
+  int oy = imSprite ? 0 : y;
+
+  ziel.fillRect(ox, oy, 225, 18, TFT_OUTLINE);
+
+  ziel.setTextSize(1);
+  if (anzeigen) {
+    ziel.setTextColor(TFT_SUBTITLE);
+    ziel.setCursor(ox, oy + 3);
+    ziel.print("Mittelwert:");
+
+    float mittelwert = berechneMittelwert(messungen, aktuelleMessung);
+
+    // Mittelwert mit hervorgehobenem Bereich
+    ziel.fillRoundRect(ox + 70, oy, 70, 18, 3, TFT_HIGHLIGHT);
+    ziel.setTextColor(TFT_TEXT);
+    ziel.setCursor(ox + 75, oy + 3);
+    ziel.print(mittelwert, 2);
+    ziel.print(" uW");
+  }
+
+  // Verrät den Mittelwert nicht und wird deshalb auch bei manueller Berechnung gezeigt
+  WindTurbineKonfidenz konfidenz = messreiheKonfidenz(istTeilfaktoriell);
+  if (konfidenz.anzahl() >= 2 && konfidenz.mittelwert() != 0) {
+    ziel.setTextColor(konfidenz.istAusreichend() ? TFT_SUCCESS : TFT_SUBTITLE);
+    ziel.setCursor(ox + 148, oy + 3);
+    ziel.print("KI +/-");
+    ziel.print(konfidenz.relativeHalbbreite() * 100, 1);
+    ziel.print("%");
+  }
+
+  if (imSprite) {
+    gebeSpriteAus(spriteMittelwert, x, y);
+  }
+}
+
+/**
+ * Zeichnet die aktuell anliegende Leistung rechts in der Ergebnis-Box
+ */
+void WindTurbineExperiment::zeichneLiveLeistung(bool istTeilfaktoriell, float leistung) {
+  int x = 300;
+  int y = istTeilfaktoriell ? 207 : 217;
+
+  bool imSprite = spriteLiveWert.created();
+  TFT_eSPI& ziel = imSprite ? static_cast<TFT_eSPI&>(spriteLiveWert) : static_cast<TFT_eSPI&>(tft);
+  int ox = imSprite ? 0 : x;
+  int oy = imSprite ? 0 : y;
+
+  ziel.fillRect(ox, oy, 150, 18, TFT_OUTLINE);
+
+  ziel.setTextSize(1);
+  ziel.setTextColor(TFT_SUBTITLE);
+  ziel.setCursor(ox, oy + 3);
+  ziel.print("Live:");
+
+  ziel.fillRoundRect(ox + 40, oy, 110, 18, 3, TFT_TITLE_BG);
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setCursor(ox + 45, oy + 3);
+  ziel.print(leistung, 2);
+  ziel.print(" uW");
+
+  if (imSprite) {
+    gebeSpriteAus(spriteLiveWert, x, y);
+  }
+}
+
+/**
+ * y-Position des laufenden Leistungsdiagramms (unter der Ergebnis-Box)
+ */
+int WindTurbineExperiment::leistungsDiagrammY(bool istTeilfaktoriell) {
+  return istTeilfaktoriell ? 266 : 272;
+}
+
+/**
+ * Statusleiste der Messbildschirme (enthält auch die Keypad-Hilfe)
+ * Im teilfaktoriellen Versuch zusätzlich die Taste für den Zwischenstand.
+ */
+void WindTurbineExperiment::zeichneMessStatusleiste(bool istTeilfaktoriell) {
+  bool abschliessbar = aktuelleMessung < 5 && messreiheKonfidenz(istTeilfaktoriell).istAusreichend();
+  if (istTeilfaktoriell && zwischenstandAnsicht) {
+    zeichneStatusleiste(abschliessbar ? "Druecken=Messen, #=Abschliessen, *=Letzte loeschen, C=Messwerte"
+                      : aktuelleMessung < 5 ? "Druecken=Messen, *=Letzte loeschen, C=Messwerte"
+                                            : "Fertig. Druecken=Weiter, C=Messwerte");
+  } else if (istTeilfaktoriell && abschliessbar) {
+    zeichneStatusleiste("Druecken=Messen, #=Abschliessen, *=Letzte loeschen, C=Effekte");
+  } else if (istTeilfaktoriell) {
+    zeichneStatusleiste(aktuelleMessung < 5 ? "Druecken=Messen, #=Wiederholen, *=Letzte loeschen, C=Effekte"
+                                            : "Fertig. Druecken=Weiter, *=Letzte loeschen, C=Effekte");
+  } else if (abschliessbar) {
+    zeichneStatusleiste("Druecken=Messen, #=Abschliessen (KI eng), *=Letzte loeschen");
+  } else if (aktuelleMessung < 5) {
+    zeichneStatusleiste("Druecken=Messen, #=Wiederholen, *=Letzte loeschen");
+  } else {
+    zeichneStatusleiste("Fertig. Druecken=Weiter, *=Letzte loeschen");
+  }
+}
+
+/**
+ * Aktualisiert nach einer Messung nur die veränderten Bereiche
+ * statt den kompletten Messbildschirm neu zu zeichnen
+ */
+void WindTurbineExperiment::aktualisiereMessbildschirm(bool istTeilfaktoriell) {
+  zeichneMesswertTabelle(istTeilfaktoriell);
+  zeichneMessfortschritt(istTeilfaktoriell);
+  zeichneMittelwertAnzeige(istTeilfaktoriell);
+  zeichneMessStatusleiste(istTeilfaktoriell);
+}
+
+/**
+ * Live-Aktualisierung (wird in loop() aufgerufen)
+ * Misst alle LIVE_ANZEIGE_INTERVALL_MS und merkt die geänderten Bereiche im
+ * Bildplaner vor; gezeichnet wird in zeichneBild().
+ */
+void WindTurbineExperiment::aktualisiereLiveAnzeige() {
+  if (millis() - letzteLiveAktualisierung < LIVE_ANZEIGE_INTERVALL_MS) {
+    return;
+  }
+  letzteLiveAktualisierung = millis();
+
+  // Motor-/Akku-Status nur bei Änderung neu zeichnen (Intro hat keinen Titelbalken)
+  if (aktuellerModus != INTRO &&
+      (angezeigterMotorStatus != motorStatusAktuell || angezeigterAkkuProzent != akkuProzent)) {
+    bildPlaner.invalidiere(UI_BEREICH_STATUS);
+  }
+
+  // Live-Leistung und Leistungsdiagramm nur auf den Messbildschirmen (nicht im Zwischenstand)
+  bool messbildschirm = (aktuellerModus == TEILFAKTORIELL_MESSUNG && !zwischenstandAnsicht) ||
+                        aktuellerModus == VOLLFAKTORIELL_MESSUNG || aktuellerModus == ZZP_MESSUNG ||
+                        aktuellerModus == FALTUNG_MESSUNG;
+  if (messbildschirm) {
+    // Ein Wert pro Intervall; fallen Bilder aus, zeichnet das Diagramm später alle neuen Spalten
+    letzteLiveLeistung = messeLeistungLive();
+    leistungsDiagramm.fuegeWertHinzu(letzteLiveLeistung);
+    bildPlaner.invalidiere(UI_BEREICH_LIVE);
+  }
+}
+
+/**
+ * Schnelle Leistungsmessung für die Live-Anzeige (ohne Debug-Ausgabe)
+ * @return Leistung in uW
+ */
+float WindTurbineExperiment::messeLeistungLive() {
+  float busvoltage = ina226.getBusVoltage();
+  float current_mA = ina226.getCurrent_mA();
+  return abs(busvoltage * current_mA) * 1000.0;
+}
+
+/**
+ * Zwischenstand der Effekte während der teilfaktoriellen Messungen
+ * Übernimmt alle abgeschlossenen Versuche (auch nach der Zurück-Taste) und
+ * zeichnet beide Diagramme komplett. Gemessen wird weiter mit dem Drehknopf.
+ */
+void WindTurbineExperiment::zeigeZwischenstand() {
+  tft.fillScreen(TFT_BACKGROUND);
+
+  for (int v = 0; v < 8; v++) {
+    if (v < aktuellerVersuch && teilfaktoriellMittelwerte[v] != 0) {
+      zwischenstand.setzeVersuch(v, teilfaktoriellPlan[v], teilfaktoriellMittelwerte[v]);
+    } else {
+      zwischenstand.entferneVersuch(v);
+    }
+  }
+
+  char titel[50];
+  sprintf(titel, "Zwischenstand: Versuch %d/8", aktuellerVersuch + 1);
+  zeichneTitelbalken(titel);
+  zeichneZwischenstandKopf();
+  zwischenstand.zeichneVollstaendig(10, 68);
+  zeichneMessStatusleiste(true);
+
+  maxCursorPosition = 0;
+  aktuellerModus = TEILFAKTORIELL_MESSUNG;
+}
+
+/**
+ * Einstellungen des aktuellen Versuchs und Messfortschritt unter dem Titel
+ */
+void WindTurbineExperiment::zeichneZwischenstandKopf() {
+  tft.fillRect(10, 44, 460, 18, TFT_BACKGROUND);
+  tft.setTextSize(1);
+
+  char kuerzel[12];
+  for (int i = 0; i < 5; i++) {
+    int x = 10 + i * 78;
+    bool hoch = teilfaktoriellPlan[aktuellerVersuch][i] == 1;
+    tft.fillRoundRect(x, 44, 72, 18, 3, hoch ? 0x04FF : 0x1082);
+    snprintf(kuerzel, sizeof(kuerzel), "%.4s %s", faktorNamen[i], hoch ? "(+)" : "(-)");
+    tft.setTextColor(hoch ? TFT_TEXT : TFT_LIGHT_TEXT);
+    tft.setCursor(x + 6, 49);
+    tft.print(kuerzel);
+  }
+
+  tft.setTextColor(TFT_TEXT);
+  tft.setCursor(404, 49);
+  tft.print("Messung ");
+  tft.print(aktuelleMessung);
+  tft.print("/5");
+}
+
+/**
+ * Nach einem abgeschlossenen Versuch in der Zwischenstand-Ansicht:
+ * Titel und Kopf für den nächsten Versuch, in den Diagrammen nur die Änderungen
+ */
+void WindTurbineExperiment::aktualisiereZwischenstand() {
+  if (!zwischenstand.istGezeichnet()) {
+    zeigeZwischenstand();
+    return;
+  }
+
+  char titel[50];
+  sprintf(titel, "Zwischenstand: Versuch %d/8", aktuellerVersuch + 1);
+  zeichneTitelbalken(titel);
+  zeichneZwischenstandKopf();
+  int neu = zwischenstand.zeichneAenderungen();
+  zeichneMessStatusleiste(true);
+
+  Serial.print("Zwischenstand: ");
+  Serial.print(neu);
+  Serial.println(" Elemente neu gezeichnet");
+}
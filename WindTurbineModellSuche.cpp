@@ -0,0 +1,88 @@
+/**
+ * WindTurbineModellSuche.cpp
+ * Raster- und Parabelsuche über einem angepassten Modell
+ */
+
+#include "WindTurbineModellSuche.h"
+
+static float modellWert(const WindTurbineRegression& modell, const int* zuordnung, int modellFaktoren,
+                        const float* stufen) {
+  if (!zuordnung) return modell.vorhersage(stufen);
+  float x[SUCHE_MAX_FAKTOREN];
+  for (int k = 0; k < modellFaktoren; k++) x[k] = stufen[zuordnung[k]];
+  return modell.vorhersage(x);
+}
+
+bool sucheModellMaximum(const WindTurbineRegression& modell, const int* zuordnung, int modellFaktoren,
+                        const SuchArt* art, int faktoren, float* punkt, float& wert,
+                        SuchZulaessig zulaessig, const void* kontext) {
+  if (faktoren < 1 || faktoren > SUCHE_MAX_FAKTOREN) return false;
+
+  // Raster: feste Faktoren 1 Stufe, Stufen-Faktoren 2, stetige SUCHE_RASTER + 1
+  int stufenAnzahl[SUCHE_MAX_FAKTOREN];
+  long punkte = 1;
+  for (int f = 0; f < faktoren; f++) {
+    stufenAnzahl[f] = art[f] == SUCHE_STETIG ? SUCHE_RASTER + 1 : art[f] == SUCHE_STUFEN ? 2 : 1;
+    punkte *= stufenAnzahl[f];
+  }
+
+  float x[SUCHE_MAX_FAKTOREN];
+  float bester[SUCHE_MAX_FAKTOREN];
+  bool gefunden = false;
+  for (long n = 0; n < punkte; n++) {
+    long rest = n;
+    for (int f = 0; f < faktoren; f++) {
+      int s = rest % stufenAnzahl[f];
+      rest /= stufenAnzahl[f];
+      if (art[f] == SUCHE_STETIG) x[f] = -1.0 + 2.0 * s / SUCHE_RASTER;
+      else if (art[f] == SUCHE_STUFEN) x[f] = s ? 1 : -1;
+      else x[f] = punkt[f];
+    }
+    if (zulaessig && !zulaessig(x, kontext)) continue;
+    float y = modellWert(modell, zuordnung, modellFaktoren, x);
+    if (!gefunden || y > wert) {
+      wert = y;
+      for (int f = 0; f < faktoren; f++) bester[f] = x[f];
+      gefunden = true;
+    }
+  }
+  if (!gefunden) return false;
+
+  // y(t) = y0 + l t + a t² entlang eines Faktors, Scheitel bei a < 0, sonst Rand
+  for (int f = 0; f < faktoren; f++) x[f] = bester[f];
+  for (int runde = 0; runde < SUCHE_VERFEINERUNG_RUNDEN; runde++) {
+    for (int f = 0; f < faktoren; f++) {
+      if (art[f] != SUCHE_STETIG) continue;
+      float alt = x[f];
+      x[f] = -1; float yUnten = modellWert(modell, zuordnung, modellFaktoren, x);
+      x[f] = 0;  float yMitte = modellWert(modell, zuordnung, modellFaktoren, x);
+      x[f] = 1;  float yOben = modellWert(modell, zuordnung, modellFaktoren, x);
+      float a = 0.5 * (yOben + yUnten) - yMitte;
+      float l = 0.5 * (yOben - yUnten);
+
+      float kandidaten[3] = {-1, 1, alt};
+      if (a < 0) kandidaten[2] = constrain(-l / (2 * a), -1.0f, 1.0f);
+      float besteStufe = alt;
+      x[f] = alt;
+      float besterWert = modellWert(modell, zuordnung, modellFaktoren, x);
+      for (int i = 0; i < 3; i++) {
+        x[f] = kandidaten[i];
+        if (zulaessig && !zulaessig(x, kontext)) continue;
+        float y = modellWert(modell, zuordnung, modellFaktoren, x);
+        if (y > besterWert) {
+          besterWert = y;
+          besteStufe = kandidaten[i];
+        }
+      }
+      x[f] = besteStufe;
+    }
+  }
+  float y = modellWert(modell, zuordnung, modellFaktoren, x);
+  if (y >= wert) {
+    wert = y;
+    for (int f = 0; f < faktoren; f++) bester[f] = x[f];
+  }
+
+  for (int f = 0; f < faktoren; f++) punkt[f] = bester[f];
+  return true;
+}
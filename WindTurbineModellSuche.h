@@ -0,0 +1,45 @@
+/**
+ * WindTurbineModellSuche.h
+ * Größter Modellwert im Versuchsbereich [-1, 1]^k unter einer Nebenbedingung
+ *
+ * Gemeinsame Suche für die Wirkungsfläche (ohne Nebenbedingung) und die
+ * Optimierung (fixierte Faktoren, verbotene Kombinationen). Jeder Faktor wird
+ * entweder festgehalten, auf beiden Stufen ±1 ausgewertet oder als stetiger
+ * Faktor auf einem Raster mit SUCHE_RASTER Schritten durchsucht. Der beste
+ * zulässige Rasterpunkt wird danach koordinatenweise verfeinert: Entlang eines
+ * stetigen Faktors ist ein quadratisches Modell eine Parabel, deren Scheitel aus
+ * den Werten bei -1, 0 und 1 folgt. Ein Schritt wird nur übernommen, wenn der
+ * neue Punkt zulässig ist.
+ */
+
+#ifndef WIND_TURBINE_MODELL_SUCHE_H
+#define WIND_TURBINE_MODELL_SUCHE_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineRegression.h"
+
+// Behandlung eines Faktors bei der Suche
+enum SuchArt {
+  SUCHE_FEST,     // Stufe aus dem Startpunkt
+  SUCHE_STUFEN,   // nur -1 und 1
+  SUCHE_STETIG    // Raster über [-1, 1], danach Parabelschritte
+};
+
+// Nebenbedingung: true, wenn die Stufen aller Faktoren zulässig sind
+typedef bool (*SuchZulaessig)(const float* stufen, const void* kontext);
+
+/**
+ * Besten zulässigen Punkt suchen
+ * @param zuordnung Faktor je Modellfaktor (nullptr: Modellfaktor k = Faktor k)
+ * @param art Behandlung je Faktor
+ * @param punkt Startpunkt (Stufen der festen Faktoren), danach der beste Punkt
+ * @param wert Modellwert am besten Punkt
+ * @param zulaessig Nebenbedingung (nullptr: alle Punkte zulässig)
+ * @return false, wenn kein Rasterpunkt zulässig ist (punkt bleibt unverändert)
+ */
+bool sucheModellMaximum(const WindTurbineRegression& modell, const int* zuordnung, int modellFaktoren,
+                        const SuchArt* art, int faktoren, float* punkt, float& wert,
+                        SuchZulaessig zulaessig = nullptr, const void* kontext = nullptr);
+
+#endif // WIND_TURBINE_MODELL_SUCHE_H
@@ -0,0 +1,253 @@
+/**
+ * WindTurbineOptimierung.cpp
+ * Walsh-Transformation über die Ecken, stetige Suche, Prognoseintervall
+ */
+
+#include "WindTurbineOptimierung.h"
+#include "WindTurbineKonfidenz.h"
+#include "WindTurbineModellSuche.h"
+
+// Abstand, ab dem ein stetiger Faktor nicht mehr auf einer Stufe liegt
+#define OPTIMIERUNG_STUFEN_TOLERANZ 1e-4
+
+WindTurbineOptimierung::WindTurbineOptimierung() :
+  faktoren(0),
+  modellFaktoren(0),
+  verbote(0),
+  gueltig(false),
+  wert(0),
+  se(0),
+  breite(0),
+  fg(0),
+  zulaessig(0),
+  eckenWert(0)
+{
+  for (int f = 0; f < OPTIMIERUNG_MAX_FAKTOREN; f++) {
+    zuordnung[f] = f;
+    stetig[f] = false;
+    fixiert[f] = false;
+    fixStufe[f] = 0;
+    optimalStufen[f] = 0;
+  }
+}
+
+bool WindTurbineOptimierung::setzeFaktoren(int faktoren, const int* zuordnung, int modellFaktoren) {
+  gueltig = false;
+  if (faktoren < 1 || faktoren > OPTIMIERUNG_MAX_FAKTOREN || modellFaktoren < 0 || modellFaktoren > faktoren) {
+    Serial.println("Optimierung: ungueltige Anzahl Faktoren");
+    return false;
+  }
+  for (int k = 0; k < modellFaktoren; k++) {
+    if (zuordnung[k] < 0 || zuordnung[k] >= faktoren) {
+      Serial.println("Optimierung: ungueltige Zuordnung");
+      return false;
+    }
+  }
+  this->faktoren = faktoren;
+  this->modellFaktoren = modellFaktoren;
+  for (int k = 0; k < modellFaktoren; k++) this->zuordnung[k] = zuordnung[k];
+  for (int f = 0; f < OPTIMIERUNG_MAX_FAKTOREN; f++) {
+    stetig[f] = false;
+    fixiert[f] = false;
+    fixStufe[f] = 0;
+  }
+  verbote = 0;
+  return true;
+}
+
+void WindTurbineOptimierung::setzeStetig(int faktor, bool stetig) {
+  if (faktor >= 0 && faktor < faktoren) this->stetig[faktor] = stetig;
+}
+
+void WindTurbineOptimierung::fixiere(int faktor, float stufe) {
+  if (faktor < 0 || faktor >= faktoren) return;
+  fixiert[faktor] = true;
+  fixStufe[faktor] = constrain(stufe, -1.0f, 1.0f);
+}
+
+bool WindTurbineOptimierung::verbiete(uint16_t maske, uint16_t hohe) {
+  if (maske == 0 || (maske >> faktoren) != 0) {
+    Serial.println("Optimierung: ungueltige Kombination");
+    return false;
+  }
+  if (verbote >= OPTIMIERUNG_MAX_VERBOTE) {
+    Serial.println("Optimierung: zu viele verbotene Kombinationen");
+    return false;
+  }
+  verbotMaske[verbote] = maske;
+  verbotHohe[verbote] = hohe & maske;
+  verbote++;
+  return true;
+}
+
+bool WindTurbineOptimierung::istFixiert(int faktor) const {
+  return faktor >= 0 && faktor < faktoren && fixiert[faktor];
+}
+
+/**
+ * Fixierte Faktoren auf ihrer Stufe, keine verbotene Kombination vollständig erfüllt
+ */
+bool WindTurbineOptimierung::istZulaessig(const float* stufen) const {
+  for (int f = 0; f < faktoren; f++) {
+    if (fixiert[f] && fabs(stufen[f] - fixStufe[f]) > OPTIMIERUNG_STUFEN_TOLERANZ) return false;
+  }
+  for (int v = 0; v < verbote; v++) {
+    bool verboten = true;
+    for (int f = 0; f < faktoren && verboten; f++) {
+      if (!((verbotMaske[v] >> f) & 1)) continue;
+      verboten = ((verbotHohe[v] >> f) & 1) ? stufen[f] > 0 : stufen[f] < 0;
+    }
+    if (verboten) return false;
+  }
+  return true;
+}
+
+float WindTurbineOptimierung::modellWert(const WindTurbineRegression& modell, const float* stufen) const {
+  float x[OPTIMIERUNG_MAX_FAKTOREN];
+  for (int k = 0; k < modellFaktoren; k++) x[k] = stufen[zuordnung[k]];
+  return modell.vorhersage(x);
+}
+
+/**
+ * Modellwerte aller 2^k Ecken per Walsh-Transformation, beste zulässige Ecke merken
+ */
+bool WindTurbineOptimierung::sucheEcken(const WindTurbineRegression& modell) {
+  const int ecken = 1 << faktoren;
+  float feld[1 << OPTIMIERUNG_MAX_FAKTOREN];
+  for (int c = 0; c < ecken; c++) feld[c] = 0;
+
+  // Koeffizienten nach dem Wort in den Faktoren der Anlage
+  for (int t = 0; t < modell.anzahlTerme(); t++) {
+    uint16_t wort = 0;
+    if (!modell.istQuadratisch(t)) {
+      for (int k = 0; k < modellFaktoren; k++) {
+        if ((modell.wort(t) >> k) & 1) wort |= 1 << zuordnung[k];
+      }
+    }
+    feld[wort] += modell.koeffizient(t);
+  }
+
+  // Butterfly je Faktor: niedrige Stufe a - b, hohe Stufe a + b
+  for (int bit = 1; bit < ecken; bit <<= 1) {
+    for (int i = 0; i < ecken; i++) {
+      if (i & bit) continue;
+      float a = feld[i];
+      float b = feld[i | bit];
+      feld[i] = a - b;
+      feld[i | bit] = a + b;
+    }
+  }
+
+  zulaessig = 0;
+  for (int c = 0; c < ecken; c++) {
+    float x[OPTIMIERUNG_MAX_FAKTOREN];
+    for (int f = 0; f < faktoren; f++) x[f] = ((c >> f) & 1) ? 1 : -1;
+    if (!istZulaessig(x)) continue;
+    if (zulaessig == 0 || feld[c] > wert) {
+      wert = feld[c];
+      for (int f = 0; f < faktoren; f++) optimalStufen[f] = x[f];
+    }
+    zulaessig++;
+  }
+  eckenWert = wert;
+  return zulaessig > 0;
+}
+
+/**
+ * Nebenbedingung für sucheModellMaximum()
+ */
+bool WindTurbineOptimierung::zulaessigFuerSuche(const float* stufen, const void* kontext) {
+  return static_cast<const WindTurbineOptimierung*>(kontext)->istZulaessig(stufen);
+}
+
+/**
+ * Raster über die freien stetigen Faktoren (übrige frei auf ±1, fixierte fest),
+ * danach Parabelschritte je stetigem Faktor innerhalb der Nebenbedingungen
+ */
+void WindTurbineOptimierung::sucheStetig(const WindTurbineRegression& modell) {
+  SuchArt art[OPTIMIERUNG_MAX_FAKTOREN];
+  float x[OPTIMIERUNG_MAX_FAKTOREN];
+  for (int f = 0; f < faktoren; f++) {
+    art[f] = fixiert[f] ? SUCHE_FEST : stetig[f] ? SUCHE_STETIG : SUCHE_STUFEN;
+    x[f] = fixiert[f] ? fixStufe[f] : optimalStufen[f];
+  }
+  float y;
+  if (sucheModellMaximum(modell, zuordnung, modellFaktoren, art, faktoren, x, y, zulaessigFuerSuche, this) && y > wert) {
+    wert = y;
+    for (int f = 0; f < faktoren; f++) optimalStufen[f] = x[f];
+  }
+}
+
+bool WindTurbineOptimierung::suche(const WindTurbineRegression& modell, int mittelung) {
+  gueltig = false;
+  if (!modell.istAngepasst() || faktoren < 1) return false;
+  if (!sucheEcken(modell)) {
+    Serial.println("Optimierung: keine zulaessige Ecke");
+    return false;
+  }
+
+  // Nur ein quadratischer Term eines freien stetigen Faktors lohnt die stetige Suche
+  bool quadratisch = false;
+  for (int t = 0; t < modell.anzahlTerme(); t++) {
+    if (!modell.istQuadratisch(t) || !modell.istGeschaetzt(t)) continue;
+    for (int k = 0; k < modellFaktoren; k++) {
+      int f = zuordnung[k];
+      if (((modell.wort(t) >> k) & 1) && stetig[f] && !fixiert[f]) quadratisch = true;
+    }
+  }
+  if (quadratisch) sucheStetig(modell);
+
+  float x[OPTIMIERUNG_MAX_FAKTOREN];
+  for (int k = 0; k < modellFaktoren; k++) x[k] = optimalStufen[zuordnung[k]];
+  se = modell.vorhersageStandardfehler(x);
+  fg = modell.freiheitsgrade();
+  float streuung = modell.reststreuung() / max(mittelung, 1);
+  breite = tQuantil(fg) * sqrt(streuung + se * se);
+
+  gueltig = true;
+  return true;
+}
+
+bool WindTurbineOptimierung::istGueltig() const {
+  return gueltig;
+}
+
+float WindTurbineOptimierung::optimum() const {
+  return gueltig ? wert : 0;
+}
+
+float WindTurbineOptimierung::stufe(int faktor) const {
+  return (gueltig && faktor >= 0 && faktor < faktoren) ? optimalStufen[faktor] : 0;
+}
+
+float WindTurbineOptimierung::standardfehler() const {
+  return gueltig ? se : 0;
+}
+
+float WindTurbineOptimierung::halbbreite() const {
+  return gueltig ? breite : 0;
+}
+
+int WindTurbineOptimierung::freiheitsgrade() const {
+  return gueltig ? fg : 0;
+}
+
+int WindTurbineOptimierung::anzahlEcken() const {
+  return 1 << faktoren;
+}
+
+int WindTurbineOptimierung::anzahlZulaessig() const {
+  return gueltig ? zulaessig : 0;
+}
+
+float WindTurbineOptimierung::eckenOptimum() const {
+  return gueltig ? eckenWert : 0;
+}
+
+bool WindTurbineOptimierung::istInnen() const {
+  if (!gueltig) return false;
+  for (int f = 0; f < faktoren; f++) {
+    if (stetig[f] && !fixiert[f] && fabs(fabs(optimalStufen[f]) - 1) > OPTIMIERUNG_STUFEN_TOLERANZ) return true;
+  }
+  return false;
+}
@@ -0,0 +1,99 @@
+/**
+ * WindTurbineOptimierung.h
+ * Optimumsuche über einem angepassten Modell mit Nebenbedingungen
+ *
+ * Gesucht wird die Einstellung aller Faktoren mit dem größten Modellwert.
+ * Das Modell (WindTurbineRegression) kennt nur seine eigenen Faktoren; die
+ * Zuordnung bildet sie auf die Faktoren der Anlage ab. Faktoren außerhalb des
+ * Modells ändern den Modellwert nicht, zählen aber für die Nebenbedingungen.
+ *
+ * Nebenbedingungen:
+ * - fixierte Faktoren bleiben auf ihrer Stufe
+ * - verbotene Kombinationen: Maske der beteiligten Faktoren und ihre verbotene
+ *   Seite (Bit gesetzt = hohe Stufe). Ein Punkt ist verboten, wenn jeder Faktor
+ *   der Maske auf seiner verbotenen Seite liegt; die Mitte (0) gehört zu keiner.
+ *
+ * Ecken: Alle 2^k Ecken werden auf einmal ausgewertet. Die Koeffizienten werden
+ * nach ihrem Wort in ein Feld der Länge 2^k gelegt (quadratische Terme auf Wort 0,
+ * an den Ecken ist x² = 1) und mit der schnellen Walsh-Transformation (gleiches
+ * Butterfly-Schema wie der Yates-Algorithmus, k Durchläufe über das Feld) in die
+ * Modellwerte aller Ecken überführt. Index c: Bit j gesetzt = Faktor j auf +1.
+ *
+ * Stetige Faktoren: Ein Modell ohne quadratische Terme ist in jedem Faktor
+ * linear und hat sein Maximum in einer Ecke. Mit quadratischen Termen wird
+ * zusätzlich mit sucheModellMaximum() gesucht (WindTurbineModellSuche.h: stetige
+ * Faktoren auf dem Raster, übrige ±1, fixierte fest), istZulaessig() ist dabei
+ * die Nebenbedingung.
+ *
+ * Prognoseintervall: Modellwert ± t(fg) * sqrt(s² / m + se²) mit der
+ * Reststreuung s², dem Standardfehler se des Modellwerts und m gemittelten
+ * Messungen (OPTIMIERUNG_MITTELUNG = 1: eine Einzelmessung).
+ */
+
+#ifndef WIND_TURBINE_OPTIMIERUNG_H
+#define WIND_TURBINE_OPTIMIERUNG_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineRegression.h"
+
+class WindTurbineOptimierung {
+public:
+  // Konstruktor
+  WindTurbineOptimierung();
+
+  // Faktoren festlegen und Nebenbedingungen zurücksetzen
+  // @param zuordnung Faktor der Anlage je Modellfaktor
+  bool setzeFaktoren(int faktoren, const int* zuordnung, int modellFaktoren);
+  void setzeStetig(int faktor, bool stetig);
+  void fixiere(int faktor, float stufe);
+  // @param maske beteiligte Faktoren, @param hohe verbotene Seite je Faktor (Bit gesetzt = +1)
+  bool verbiete(uint16_t maske, uint16_t hohe);
+
+  bool istFixiert(int faktor) const;
+  bool istZulaessig(const float* stufen) const;
+
+  // Ecken auswerten, bei quadratischen Termen stetig weitersuchen, Prognoseintervall bestimmen
+  // @param mittelung Anzahl gemittelter Messungen, für die das Intervall gilt
+  bool suche(const WindTurbineRegression& modell, int mittelung = OPTIMIERUNG_MITTELUNG);
+
+  bool istGueltig() const;
+  float optimum() const;
+  float stufe(int faktor) const;
+  float standardfehler() const;   // Modellwert am Optimum
+  float halbbreite() const;       // Prognoseintervall (KONFIDENZ_NIVEAU)
+  int freiheitsgrade() const;
+
+  int anzahlEcken() const;
+  int anzahlZulaessig() const;    // Ecken ohne Verstoß gegen die Nebenbedingungen
+  float eckenOptimum() const;
+  // Optimum mit einem stetigen Faktor zwischen den Stufen
+  bool istInnen() const;
+
+private:
+  int faktoren;
+  int modellFaktoren;
+  int zuordnung[OPTIMIERUNG_MAX_FAKTOREN];
+  bool stetig[OPTIMIERUNG_MAX_FAKTOREN];
+  bool fixiert[OPTIMIERUNG_MAX_FAKTOREN];
+  float fixStufe[OPTIMIERUNG_MAX_FAKTOREN];
+  int verbote;
+  uint16_t verbotMaske[OPTIMIERUNG_MAX_VERBOTE];
+  uint16_t verbotHohe[OPTIMIERUNG_MAX_VERBOTE];
+
+  bool gueltig;
+  float wert;
+  float optimalStufen[OPTIMIERUNG_MAX_FAKTOREN];
+  float se;
+  float breite;
+  int fg;
+  int zulaessig;
+  float eckenWert;
+
+  float modellWert(const WindTurbineRegression& modell, const float* stufen) const;
+  bool sucheEcken(const WindTurbineRegression& modell);
+  void sucheStetig(const WindTurbineRegression& modell);
+  static bool zulaessigFuerSuche(const float* stufen, const void* kontext);
+};
+
+#endif // WIND_TURBINE_OPTIMIERUNG_H
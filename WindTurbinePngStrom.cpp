@@ -0,0 +1,318 @@
+/**
+ * WindTurbinePngStrom.cpp
+ * PNG-Kodierung Zeile für Zeile (Deflate mit festen Huffman-Codes)
+ */
+
+#include "WindTurbinePngStrom.h"
+
+// Längen-Codes 257..285: Basislänge und Zusatzbits
+static const uint16_t LAENGE_BASIS[29] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t LAENGE_BITS[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+static uint32_t crcTabelle[256];
+
+static void initialisiereCrc() {
+  static bool fertig = false;
+  if (fertig) return;
+  for (uint32_t n = 0; n < 256; n++) {
+    uint32_t c = n;
+    for (int k = 0; k < 8; k++) {
+      c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    }
+    crcTabelle[n] = c;
+  }
+  fertig = true;
+}
+
+static uint32_t crc32(const uint8_t* daten, size_t laenge, uint32_t crc) {
+  for (size_t i = 0; i < laenge; i++) {
+    crc = crcTabelle[(crc ^ daten[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static void setze32(uint8_t* ziel, uint32_t wert) {
+  ziel[0] = wert >> 24;
+  ziel[1] = wert >> 16;
+  ziel[2] = wert >> 8;
+  ziel[3] = wert;
+}
+
+WindTurbinePngStrom::WindTurbinePngStrom() :
+  schreiber(nullptr),
+  kontext(nullptr),
+  breite(0),
+  hoehe(0),
+  zeile(0),
+  fehler(false),
+  vorherige(nullptr),
+  aktuelle(nullptr),
+  gefiltert(nullptr),
+  bitPuffer(0),
+  bitAnzahl(0),
+  letztesByte(-1),
+  lauf(0),
+  adlerA(1),
+  adlerB(0),
+  idatLaenge(0),
+  ausgegeben(0)
+{
+}
+
+WindTurbinePngStrom::~WindTurbinePngStrom() {
+  gibFrei();
+}
+
+void WindTurbinePngStrom::gibFrei() {
+  free(vorherige);
+  free(aktuelle);
+  free(gefiltert);
+  vorherige = nullptr;
+  aktuelle = nullptr;
+  gefiltert = nullptr;
+}
+
+/**
+ * Schreibt Signatur und IHDR und beginnt den zlib-Strom
+ */
+bool WindTurbinePngStrom::beginne(uint16_t breite, uint16_t hoehe, PngSchreiber schreiber, void* kontext) {
+  gibFrei();
+  initialisiereCrc();
+
+  this->breite = breite;
+  this->hoehe = hoehe;
+  this->schreiber = schreiber;
+  this->kontext = kontext;
+  zeile = 0;
+  fehler = false;
+  bitPuffer = 0;
+  bitAnzahl = 0;
+  letztesByte = -1;
+  lauf = 0;
+  adlerA = 1;
+  adlerB = 0;
+  idatLaenge = 0;
+  ausgegeben = 0;
+
+  size_t zeilenBytes = (size_t)breite * 3;
+  vorherige = (uint8_t*)calloc(zeilenBytes, 1);
+  aktuelle = (uint8_t*)malloc(zeilenBytes);
+  gefiltert = (uint8_t*)malloc(zeilenBytes + 1);
+  if (vorherige == nullptr || aktuelle == nullptr || gefiltert == nullptr || schreiber == nullptr) {
+    Serial.println("PNG: Zeilenpuffer konnte nicht angelegt werden");
+    gibFrei();
+    return false;
+  }
+
+  static const uint8_t signatur[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  uint8_t ihdr[13];
+  setze32(ihdr, breite);
+  setze32(ihdr + 4, hoehe);
+  ihdr[8] = 8;   // Bits pro Kanal
+  ihdr[9] = 2;   // RGB
+  ihdr[10] = 0;  // Deflate
+  ihdr[11] = 0;  // Standardfilter
+  ihdr[12] = 0;  // Kein Interlacing
+  if (!schreibe(signatur, sizeof(signatur)) || !schreibeChunk("IHDR", ihdr, sizeof(ihdr))) {
+    gibFrei();
+    return false;
+  }
+
+  // zlib-Kopf (Deflate, 32 KB Fenster), dann ein einziger Block mit festen Codes
+  ausgabeByte(0x78);
+  ausgabeByte(0x01);
+  schreibeBits(1, 1); // BFINAL
+  schreibeBits(1, 2); // BTYPE = 01
+  return !fehler;
+}
+
+/**
+ * Filtert eine Zeile und kodiert sie
+ * Gewählt wird der Filter mit der kleinsten Summe der Beträge (als int8_t).
+ */
+bool WindTurbinePngStrom::schreibeZeile(const uint16_t* pixel) {
+  if (aktuelle == nullptr || fehler || zeile >= hoehe) return false;
+
+  size_t zeilenBytes = (size_t)breite * 3;
+  for (uint16_t x = 0; x < breite; x++) {
+    uint16_t farbe = pixel[x];
+    uint8_t r = (farbe >> 11) & 0x1F;
+    uint8_t g = (farbe >> 5) & 0x3F;
+    uint8_t b = farbe & 0x1F;
+    aktuelle[x * 3] = (r << 3) | (r >> 2);
+    aktuelle[x * 3 + 1] = (g << 2) | (g >> 4);
+    aktuelle[x * 3 + 2] = (b << 3) | (b >> 2);
+  }
+
+  uint32_t summeNone = 0, summeSub = 0, summeUp = 0;
+  for (size_t i = 0; i < zeilenBytes; i++) {
+    uint8_t links = (i >= 3) ? aktuelle[i - 3] : 0;
+    summeNone += abs((int8_t)aktuelle[i]);
+    summeSub += abs((int8_t)(aktuelle[i] - links));
+    summeUp += abs((int8_t)(aktuelle[i] - vorherige[i]));
+  }
+
+  uint8_t filter = 0;
+  if (summeSub < summeNone) filter = 1;
+  if (summeUp < min(summeNone, summeSub)) filter = 2;
+
+  gefiltert[0] = filter;
+  for (size_t i = 0; i < zeilenBytes; i++) {
+    uint8_t links = (i >= 3) ? aktuelle[i - 3] : 0;
+    if (filter == 0) gefiltert[i + 1] = aktuelle[i];
+    else if (filter == 1) gefiltert[i + 1] = aktuelle[i] - links;
+    else gefiltert[i + 1] = aktuelle[i] - vorherige[i];
+  }
+
+  // Adler-32 über die unkomprimierten Daten (eine Zeile < 5552 Bytes ohne Überlauf)
+  for (size_t i = 0; i <= zeilenBytes; i++) {
+    adlerA += gefiltert[i];
+    adlerB += adlerA;
+    kodiereByte(gefiltert[i]);
+  }
+  adlerA %= 65521;
+  adlerB %= 65521;
+
+  uint8_t* tausch = vorherige;
+  vorherige = aktuelle;
+  aktuelle = tausch;
+  zeile++;
+  return !fehler;
+}
+
+/**
+ * Schließt Deflate-Block, zlib-Strom (Adler-32) und PNG (IEND) ab
+ */
+bool WindTurbinePngStrom::beende() {
+  if (aktuelle == nullptr) return false;
+  bool vollstaendig = (zeile == hoehe) && !fehler;
+
+  gibLaufAus();
+  schreibeLiteral(256); // Blockende
+  if (bitAnzahl > 0) schreibeBits(0, 8 - bitAnzahl);
+
+  uint32_t adler = (adlerB << 16) | adlerA;
+  ausgabeByte(adler >> 24);
+  ausgabeByte(adler >> 16);
+  ausgabeByte(adler >> 8);
+  ausgabeByte(adler);
+  leereIdat();
+  schreibeChunk("IEND", nullptr, 0);
+
+  gibFrei();
+  return vollstaendig && !fehler;
+}
+
+uint32_t WindTurbinePngStrom::geschriebeneBytes() {
+  return ausgegeben;
+}
+
+bool WindTurbinePngStrom::schreibe(const uint8_t* daten, size_t laenge) {
+  if (fehler) return false;
+  if (!schreiber(daten, laenge, kontext)) {
+    fehler = true;
+    return false;
+  }
+  ausgegeben += laenge;
+  return true;
+}
+
+/**
+ * Chunk mit Länge, Typ, Daten und CRC-32 über Typ und Daten
+ */
+bool WindTurbinePngStrom::schreibeChunk(const char* typ, const uint8_t* daten, size_t laenge) {
+  uint8_t kopf[8];
+  setze32(kopf, laenge);
+  memcpy(kopf + 4, typ, 4);
+
+  uint32_t crc = crc32(kopf + 4, 4, 0xFFFFFFFFu);
+  if (laenge > 0) crc = crc32(daten, laenge, crc);
+  uint8_t ende[4];
+  setze32(ende, crc ^ 0xFFFFFFFFu);
+
+  return schreibe(kopf, sizeof(kopf)) &&
+         (laenge == 0 || schreibe(daten, laenge)) &&
+         schreibe(ende, sizeof(ende));
+}
+
+/**
+ * Wiederholt sich ein Byte, wird nur gezählt; ausgegeben wird beim nächsten
+ * anderen Byte (oder bei der größten Länge 258)
+ */
+void WindTurbinePngStrom::kodiereByte(uint8_t wert) {
+  if (wert == letztesByte) {
+    lauf++;
+    if (lauf == 258) gibLaufAus();
+    return;
+  }
+  gibLaufAus();
+  schreibeLiteral(wert);
+  letztesByte = wert;
+}
+
+/**
+ * Gibt gezählte Wiederholungen als Länge mit Abstand 1 aus (ab 3 Bytes)
+ */
+void WindTurbinePngStrom::gibLaufAus() {
+  while (lauf > 0) {
+    if (lauf < 3) {
+      schreibeLiteral(letztesByte);
+      lauf--;
+      continue;
+    }
+
+    uint16_t laenge = min(lauf, (uint16_t)258);
+    int code = 28;
+    while (LAENGE_BASIS[code] > laenge) code--;
+    schreibeLiteral(257 + code);
+    if (LAENGE_BITS[code] > 0) schreibeBits(laenge - LAENGE_BASIS[code], LAENGE_BITS[code]);
+    schreibeHuffman(0, 5); // Abstand 1
+    lauf -= laenge;
+  }
+}
+
+/**
+ * Feste Huffman-Codes für Literale und Längen (RFC 1951, 3.2.6)
+ */
+void WindTurbinePngStrom::schreibeLiteral(uint16_t symbol) {
+  if (symbol < 144) schreibeHuffman(0x30 + symbol, 8);
+  else if (symbol < 256) schreibeHuffman(0x190 + symbol - 144, 9);
+  else if (symbol < 280) schreibeHuffman(symbol - 256, 7);
+  else schreibeHuffman(0xC0 + symbol - 280, 8);
+}
+
+void WindTurbinePngStrom::schreibeBits(uint32_t bits, uint8_t anzahl) {
+  bitPuffer |= bits << bitAnzahl;
+  bitAnzahl += anzahl;
+  while (bitAnzahl >= 8) {
+    ausgabeByte(bitPuffer & 0xFF);
+    bitPuffer >>= 8;
+    bitAnzahl -= 8;
+  }
+}
+
+// Huffman-Codes beginnen mit dem höchstwertigen Bit
+void WindTurbinePngStrom::schreibeHuffman(uint16_t code, uint8_t laenge) {
+  uint16_t umgekehrt = 0;
+  for (uint8_t i = 0; i < laenge; i++) {
+    umgekehrt = (umgekehrt << 1) | ((code >> i) & 1);
+  }
+  schreibeBits(umgekehrt, laenge);
+}
+
+void WindTurbinePngStrom::ausgabeByte(uint8_t wert) {
+  idat[idatLaenge++] = wert;
+  if (idatLaenge == PNG_IDAT_BYTES) leereIdat();
+}
+
+void WindTurbinePngStrom::leereIdat() {
+  if (idatLaenge == 0) return;
+  schreibeChunk("IDAT", idat, idatLaenge);
+  idatLaenge = 0;
+}
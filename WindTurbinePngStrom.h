@@ -0,0 +1,83 @@
+/**
+ * WindTurbinePngStrom.h
+ * PNG-Kodierung Zeile für Zeile mit festem Speicherbedarf
+ *
+ * Das Bild wird nie vollständig gehalten (480x320 wären 300 KB): Der Aufrufer
+ * übergibt jede Zeile als RGB565, die Zeile wird gefiltert (None, Sub oder Up,
+ * je nachdem was die kleinsten Werte ergibt) und sofort deflate-kodiert. Die
+ * Kodierung verwendet einen einzigen Block mit festen Huffman-Codes; Wiederholungen
+ * desselben Bytes werden als Verweis mit Abstand 1 kodiert, so werden
+ * einfarbige Flächen (Sub) und gleiche Zeilen (Up) klein. CRC-32 und
+ * Adler-32 werden fortlaufend berechnet, die Ausgabe geht in IDAT-Chunks zu
+ * PNG_IDAT_BYTES an den Schreiber.
+ *
+ * Speicher: drei Zeilen RGB888 und der IDAT-Puffer (für 480 Pixel ca. 5 KB).
+ */
+
+#ifndef WIND_TURBINE_PNG_STROM_H
+#define WIND_TURBINE_PNG_STROM_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+
+// Gibt fertige Bytes weiter (z.B. an den Webserver)
+// @return false bricht die Kodierung ab
+typedef bool (*PngSchreiber)(const uint8_t* daten, size_t laenge, void* kontext);
+
+class WindTurbinePngStrom {
+public:
+  // Konstruktor und Destruktor
+  WindTurbinePngStrom();
+  ~WindTurbinePngStrom();
+
+  // Signatur und IHDR schreiben, Zeilenpuffer anlegen
+  bool beginne(uint16_t breite, uint16_t hoehe, PngSchreiber schreiber, void* kontext);
+
+  // Eine Zeile (breite Pixel RGB565, nicht byte-getauscht)
+  bool schreibeZeile(const uint16_t* pixel);
+
+  // Deflate-Strom und IEND abschließen, Puffer freigeben
+  bool beende();
+
+  // Bisher an den Schreiber gegebene Bytes
+  uint32_t geschriebeneBytes();
+
+private:
+  PngSchreiber schreiber;
+  void* kontext;
+  uint16_t breite;
+  uint16_t hoehe;
+  uint16_t zeile;
+  bool fehler;
+
+  // Zeilen (RGB888) und gefilterte Zeile mit Filterbyte
+  uint8_t* vorherige;
+  uint8_t* aktuelle;
+  uint8_t* gefiltert;
+
+  // Deflate-Zustand
+  uint32_t bitPuffer;
+  uint8_t bitAnzahl;
+  int16_t letztesByte;   // -1 = noch keines
+  uint16_t lauf;         // Wiederholungen von letztesByte, noch nicht ausgegeben
+  uint32_t adlerA;
+  uint32_t adlerB;
+
+  // Ausgabe
+  uint8_t idat[PNG_IDAT_BYTES];
+  size_t idatLaenge;
+  uint32_t ausgegeben;
+
+  void gibFrei();
+  bool schreibe(const uint8_t* daten, size_t laenge);
+  bool schreibeChunk(const char* typ, const uint8_t* daten, size_t laenge);
+  void kodiereByte(uint8_t wert);
+  void gibLaufAus();
+  void schreibeLiteral(uint16_t symbol);
+  void schreibeBits(uint32_t bits, uint8_t anzahl);
+  void schreibeHuffman(uint16_t code, uint8_t laenge);
+  void ausgabeByte(uint8_t wert);
+  void leereIdat();
+};
+
+#endif // WIND_TURBINE_PNG_STROM_H
@@ -0,0 +1,272 @@
+/**
+ * WindTurbineRegression.cpp
+ * Kleinste Quadrate über die Normalgleichungen (Cholesky-Zerlegung)
+ */
+
+#include "WindTurbineRegression.h"
+
+// Pivot kleiner als dieser Anteil der Diagonale: Term vermengt
+#define REGRESSION_PIVOT_GRENZE 1e-9
+
+WindTurbineRegression::WindTurbineRegression() :
+  terme(0),
+  angepasst(false),
+  beobachtungen(0),
+  bestimmtheit(0),
+  bestimmtheitKorrigiert(0),
+  varianz(0),
+  fg(0)
+{
+  leeren();
+}
+
+void WindTurbineRegression::leeren() {
+  terme = 1;
+  woerter[0] = 0;
+  quadrate[0] = false;
+  angepasst = false;
+}
+
+int WindTurbineRegression::fuegeTermHinzu(uint16_t wort, bool quadratisch) {
+  if (terme >= REGRESSION_MAX_TERME) {
+    Serial.println("Regression: zu viele Terme");
+    return -1;
+  }
+  woerter[terme] = wort;
+  quadrate[terme] = quadratisch;
+  angepasst = false;
+  return terme++;
+}
+
+void WindTurbineRegression::fuegeHaupteffekteHinzu(int faktoren) {
+  for (int f = 0; f < faktoren; f++) {
+    fuegeTermHinzu(1 << f);
+  }
+}
+
+void WindTurbineRegression::fuegeWechselwirkungenHinzu(int faktoren) {
+  for (int a = 0; a < faktoren; a++) {
+    for (int c = a + 1; c < faktoren; c++) {
+      fuegeTermHinzu((1 << a) | (1 << c));
+    }
+  }
+}
+
+void WindTurbineRegression::fuegeQuadratischeTermeHinzu(int faktoren) {
+  for (int f = 0; f < faktoren; f++) {
+    fuegeTermHinzu(1 << f, true);
+  }
+}
+
+double WindTurbineRegression::termWert(int term, const float* stufen) const {
+  double wert = 1;
+  uint16_t wort = woerter[term];
+  for (int f = 0; wort != 0; f++, wort >>= 1) {
+    if (wort & 1) wert *= stufen[f];
+  }
+  return quadrate[term] ? wert * wert : wert;
+}
+
+/**
+ * Normalgleichungen aufstellen, zerlegen, lösen und Güte bestimmen
+ */
+bool WindTurbineRegression::passeAn(const float* stufen, int faktoren, const float* werte, int anzahl) {
+  angepasst = false;
+  if (anzahl < 1 || anzahl > REGRESSION_MAX_BEOBACHTUNGEN) {
+    Serial.println("Regression: ungueltige Anzahl Beobachtungen");
+    return false;
+  }
+
+  const int p = terme;
+  double a[REGRESSION_MAX_TERME][REGRESSION_MAX_TERME];
+  double xy[REGRESSION_MAX_TERME];
+  double x[REGRESSION_MAX_TERME];
+  double summeY = 0;
+  double summeYY = 0;
+
+  for (int i = 0; i < p; i++) {
+    xy[i] = 0;
+    for (int j = 0; j < p; j++) a[i][j] = 0;
+  }
+
+  // X'X (untere Hälfte) und X'y in einem Durchlauf
+  for (int n = 0; n < anzahl; n++) {
+    const float* zeile = stufen + n * faktoren;
+    double y = werte[n];
+    for (int i = 0; i < p; i++) {
+      x[i] = termWert(i, zeile);
+    }
+    for (int i = 0; i < p; i++) {
+      xy[i] += x[i] * y;
+      for (int j = 0; j <= i; j++) a[i][j] += x[i] * x[j];
+    }
+    summeY += y;
+    summeYY += y * y;
+  }
+
+  // Cholesky X'X = L L' in der unteren Hälfte von a, vermengte Terme überspringen
+  int geschaetzteTerme = 0;
+  for (int j = 0; j < p; j++) {
+    double diagonale = a[j][j];
+    double pivot = diagonale;
+    for (int k = 0; k < j; k++) pivot -= a[j][k] * a[j][k];
+
+    geschaetzt[j] = pivot > REGRESSION_PIVOT_GRENZE * max(diagonale, 1.0);
+    if (!geschaetzt[j]) {
+      for (int i = j; i < p; i++) a[i][j] = 0;
+      continue;
+    }
+    geschaetzteTerme++;
+
+    double ljj = sqrt(pivot);
+    a[j][j] = ljj;
+    for (int i = j + 1; i < p; i++) {
+      double summe = a[i][j];
+      for (int k = 0; k < j; k++) summe -= a[i][k] * a[j][k];
+      a[i][j] = summe / ljj;
+    }
+  }
+
+  // L z = X'y, dann L' b = z
+  double z[REGRESSION_MAX_TERME];
+  for (int i = 0; i < p; i++) {
+    if (!geschaetzt[i]) { z[i] = 0; continue; }
+    double summe = xy[i];
+    for (int k = 0; k < i; k++) summe -= a[i][k] * z[k];
+    z[i] = summe / a[i][i];
+  }
+  double loesung[REGRESSION_MAX_TERME];
+  for (int i = p - 1; i >= 0; i--) {
+    if (!geschaetzt[i]) { loesung[i] = 0; continue; }
+    double summe = z[i];
+    for (int k = i + 1; k < p; k++) summe -= a[k][i] * loesung[k];
+    loesung[i] = summe / a[i][i];
+  }
+
+  // Residuen und Quadratsummen (zweiter Durchlauf)
+  double sse = 0;
+  for (int n = 0; n < anzahl; n++) {
+    const float* zeile = stufen + n * faktoren;
+    double modell = 0;
+    for (int i = 0; i < p; i++) {
+      if (geschaetzt[i]) modell += loesung[i] * termWert(i, zeile);
+    }
+    double r = werte[n] - modell;
+    residuen[n] = r;
+    sse += r * r;
+  }
+  double sst = summeYY - summeY * summeY / anzahl;
+
+  beobachtungen = anzahl;
+  fg = anzahl - geschaetzteTerme;
+  varianz = (fg > 0) ? sse / fg : 0;
+  bestimmtheit = (sst > 0) ? 1.0 - sse / sst : 0;
+  bestimmtheitKorrigiert = (sst > 0 && fg > 0) ? 1.0 - (sse / fg) / (sst / (anzahl - 1)) : bestimmtheit;
+
+  // Cholesky-Faktor für vorhersageStandardfehler() aufbewahren
+  for (int i = 0; i < p; i++) {
+    for (int j = 0; j <= i; j++) l[i][j] = a[i][j];
+  }
+
+  // Standardfehler: Var(b_j) = s² * (X'X)^-1_jj = s² * Σ_k (L^-1)_kj²
+  for (int j = 0; j < p; j++) {
+    b[j] = loesung[j];
+    se[j] = 0;
+    if (!geschaetzt[j] || fg <= 0) continue;
+
+    // Spalte j von L^-1 durch Vorwärtseinsetzen von e_j
+    double spalte[REGRESSION_MAX_TERME];
+    double summeQuadrate = 0;
+    for (int i = j; i < p; i++) {
+      if (!geschaetzt[i]) { spalte[i] = 0; continue; }
+      double summe = (i == j) ? 1.0 : 0.0;
+      for (int k = j; k < i; k++) summe -= a[i][k] * spalte[k];
+      spalte[i] = summe / a[i][i];
+      summeQuadrate += spalte[i] * spalte[i];
+    }
+    se[j] = sqrt(varianz * summeQuadrate);
+  }
+
+  angepasst = true;
+  return true;
+}
+
+bool WindTurbineRegression::istAngepasst() const {
+  return angepasst;
+}
+
+int WindTurbineRegression::anzahlTerme() const {
+  return terme;
+}
+
+uint16_t WindTurbineRegression::wort(int term) const {
+  return (term >= 0 && term < terme) ? woerter[term] : 0;
+}
+
+bool WindTurbineRegression::istQuadratisch(int term) const {
+  return term >= 0 && term < terme && quadrate[term];
+}
+
+int WindTurbineRegression::anzahlBeobachtungen() const {
+  return angepasst ? beobachtungen : 0;
+}
+
+float WindTurbineRegression::koeffizient(int term) const {
+  return (angepasst && term >= 0 && term < terme) ? b[term] : 0;
+}
+
+float WindTurbineRegression::standardfehler(int term) const {
+  return (angepasst && term >= 0 && term < terme) ? se[term] : 0;
+}
+
+bool WindTurbineRegression::istGeschaetzt(int term) const {
+  return angepasst && term >= 0 && term < terme && geschaetzt[term];
+}
+
+float WindTurbineRegression::r2() const {
+  return angepasst ? bestimmtheit : 0;
+}
+
+float WindTurbineRegression::r2Korrigiert() const {
+  return angepasst ? bestimmtheitKorrigiert : 0;
+}
+
+float WindTurbineRegression::reststreuung() const {
+  return angepasst ? varianz : 0;
+}
+
+int WindTurbineRegression::freiheitsgrade() const {
+  return angepasst ? fg : 0;
+}
+
+float WindTurbineRegression::residuum(int beobachtung) const {
+  if (!angepasst || beobachtung < 0 || beobachtung >= beobachtungen) return 0;
+  return residuen[beobachtung];
+}
+
+float WindTurbineRegression::vorhersage(const float* stufen) const {
+  if (!angepasst) return 0;
+  double modell = 0;
+  for (int i = 0; i < terme; i++) {
+    if (geschaetzt[i]) modell += b[i] * termWert(i, stufen);
+  }
+  return modell;
+}
+
+/**
+ * Standardfehler des Modellwerts: s * |L^-1 x| durch Vorwärtseinsetzen,
+ * nicht geschätzte Terme bleiben außen vor
+ */
+float WindTurbineRegression::vorhersageStandardfehler(const float* stufen) const {
+  if (!angepasst || fg <= 0) return 0;
+  double z[REGRESSION_MAX_TERME];
+  double summeQuadrate = 0;
+  for (int i = 0; i < terme; i++) {
+    if (!geschaetzt[i]) { z[i] = 0; continue; }
+    double summe = termWert(i, stufen);
+    for (int k = 0; k < i; k++) summe -= l[i][k] * z[k];
+    z[i] = summe / l[i][i];
+    summeQuadrate += z[i] * z[i];
+  }
+  return sqrt(varianz * summeQuadrate);
+}
@@ -0,0 +1,97 @@
+/**
+ * WindTurbineRegression.h
+ * Lineares Modell nach der Methode der kleinsten Quadrate
+ *
+ * Das Modell besteht aus der Konstanten (Term 0) und frei wählbaren Termen:
+ * Produkte von Faktoren (Wort als Bitmaske: 0x1 = A, 0x3 = AB, ...) und
+ * quadratische Terme einzelner Faktoren. Die Faktoren werden kodiert übergeben
+ * (-1 / 1 bzw. ±alpha und 0 im zentralen zusammengesetzten Plan).
+ *
+ * passeAn() sammelt X'X und X'y in einem Durchlauf über die Beobachtungen
+ * (Einzelmessungen oder Versuchsmittelwerte) und löst die Normalgleichungen per
+ * Cholesky-Zerlegung. Alle Matrizen haben feste Größe (REGRESSION_MAX_TERME)
+ * und liegen auf dem Stack bzw. im Objekt, es wird kein Heap benutzt.
+ * Gerechnet wird in double, die Ergebnisse werden als float abgelegt.
+ *
+ * Ein Term, der sich aus den vorherigen linear ergibt (vermengt, z.B. A² = 1 im
+ * zweistufigen Plan), erhält bei der Zerlegung einen verschwindenden Pivot. Er
+ * wird dann nicht geschätzt (Koeffizient 0) und zählt nicht zu den Freiheitsgraden.
+ *
+ * Der Cholesky-Faktor L bleibt im Objekt, damit der Standardfehler des Modellwerts
+ * an beliebigen Stufen x ohne erneute Anpassung folgt: Var = s² x'(X'X)^-1 x = s² |L^-1 x|².
+ */
+
+#ifndef WIND_TURBINE_REGRESSION_H
+#define WIND_TURBINE_REGRESSION_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+
+class WindTurbineRegression {
+public:
+  // Konstruktor
+  WindTurbineRegression();
+
+  // Modell auf die Konstante zurücksetzen
+  void leeren();
+
+  // Term hinzufügen
+  // @param wort Produkt der Faktoren als Bitmaske
+  // @param quadratisch Quadrat eines einzelnen Faktors (wort mit genau einem Bit)
+  // @return Index des Terms, -1 wenn das Modell voll ist
+  int fuegeTermHinzu(uint16_t wort, bool quadratisch = false);
+  void fuegeHaupteffekteHinzu(int faktoren);
+  void fuegeWechselwirkungenHinzu(int faktoren);
+  void fuegeQuadratischeTermeHinzu(int faktoren);
+
+  // Modell anpassen
+  // @param stufen kodierte Faktorstufen [Beobachtung * faktoren + Faktor]
+  // @param werte Messwert je Beobachtung
+  bool passeAn(const float* stufen, int faktoren, const float* werte, int anzahl);
+
+  bool istAngepasst() const;
+  int anzahlTerme() const;
+  uint16_t wort(int term) const;
+  bool istQuadratisch(int term) const;
+  int anzahlBeobachtungen() const;
+
+  // Koeffizient und Standardfehler eines Terms
+  float koeffizient(int term) const;
+  float standardfehler(int term) const;
+  bool istGeschaetzt(int term) const;
+
+  // Modellgüte
+  float r2() const;
+  float r2Korrigiert() const;
+  float reststreuung() const;   // SSE / Freiheitsgrade
+  int freiheitsgrade() const;   // Beobachtungen - geschätzte Terme
+
+  // Residuum einer Beobachtung der letzten Anpassung
+  float residuum(int beobachtung) const;
+
+  // Modellwert für kodierte Faktorstufen
+  float vorhersage(const float* stufen) const;
+  // Standardfehler des Modellwerts (Unsicherheit der Koeffizienten, ohne Reststreuung)
+  float vorhersageStandardfehler(const float* stufen) const;
+
+private:
+  int terme;
+  uint16_t woerter[REGRESSION_MAX_TERME];
+  bool quadrate[REGRESSION_MAX_TERME];
+
+  bool angepasst;
+  int beobachtungen;
+  float b[REGRESSION_MAX_TERME];
+  float se[REGRESSION_MAX_TERME];
+  bool geschaetzt[REGRESSION_MAX_TERME];
+  float l[REGRESSION_MAX_TERME][REGRESSION_MAX_TERME]; // Cholesky-Faktor von X'X (untere Hälfte)
+  float residuen[REGRESSION_MAX_BEOBACHTUNGEN];
+  float bestimmtheit;
+  float bestimmtheitKorrigiert;
+  float varianz;
+  int fg;
+
+  double termWert(int term, const float* stufen) const;
+};
+
+#endif // WIND_TURBINE_REGRESSION_H
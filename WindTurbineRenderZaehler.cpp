@@ -0,0 +1,129 @@
+/**
+ * WindTurbineRenderZaehler.cpp
+ * Zählung von Zeichenaufrufen und übertragenen Pixeln
+ */
+
+#include "WindTurbineRenderZaehler.h"
+#include "WindTurbineSpiegel.h"
+
+bool WindTurbineRenderZaehler::aktiv = false;
+RenderStatistik WindTurbineRenderZaehler::statistik = {0, 0, 0};
+
+void WindTurbineRenderZaehler::starte() {
+  statistik.aufrufe = 0;
+  statistik.pixel = 0;
+  statistik.bytes = 0;
+  aktiv = true;
+}
+
+RenderStatistik WindTurbineRenderZaehler::beende() {
+  aktiv = false;
+  return statistik;
+}
+
+bool WindTurbineRenderZaehler::istAktiv() {
+  return aktiv;
+}
+
+void WindTurbineRenderZaehler::erfassePrimitive(uint32_t pixel) {
+  if (!aktiv) return;
+  statistik.aufrufe++;
+  statistik.pixel += pixel;
+  statistik.bytes += pixel * 2 + RENDER_BYTES_PRO_FENSTER;
+}
+
+/**
+ * Block-Übertragung mit einem Adressfenster (Sprite, DMA, Hintergrund)
+ */
+void WindTurbineRenderZaehler::erfasseBlock(uint32_t pixel) {
+  erfassePrimitive(pixel);
+}
+
+/**
+ * Überträgt ein Sprite in einem Block und meldet es Zähler und Spiegel
+ */
+void gebeSpriteAus(TFT_eSprite& sprite, int32_t x, int32_t y) {
+  sprite.pushSprite(x, y);
+  WindTurbineRenderZaehler::erfasseBlock((uint32_t)sprite.width() * sprite.height());
+  WindTurbineSpiegel::uebernimmBild(x, y, sprite.width(), sprite.height(), (uint16_t*)sprite.getPointer());
+}
+
+void WindTurbineDisplay::erfasse(uint32_t pixel) {
+  if (tiefe == 0) {
+    WindTurbineRenderZaehler::erfassePrimitive(pixel);
+  }
+}
+
+/**
+ * Schattenbild des Spiegels, nur für äußerste Aufrufe
+ */
+TFT_eSPI* WindTurbineDisplay::spiegelZiel() {
+  return (tiefe == 0) ? WindTurbineSpiegel::ziel() : nullptr;
+}
+
+void WindTurbineDisplay::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  erfasse(1);
+  tiefe++;
+  TFT_eSPI::drawPixel(x, y, color);
+  tiefe--;
+
+  TFT_eSPI* schatten = spiegelZiel();
+  if (schatten != nullptr) schatten->drawPixel(x, y, color);
+  if (tiefe == 0) WindTurbineSpiegel::markiere(x, y, 1, 1);
+}
+
+void WindTurbineDisplay::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+  // Zeichenzelle des Standardfonts: 6x8 Pixel je Textgröße
+  erfasse(6 * 8 * size * size);
+  tiefe++;
+  TFT_eSPI::drawChar(x, y, c, color, bg, size);
+  tiefe--;
+
+  TFT_eSPI* schatten = spiegelZiel();
+  if (schatten != nullptr) schatten->drawChar(x, y, c, color, bg, size);
+  if (tiefe == 0) WindTurbineSpiegel::markiere(x, y, 6 * size, 8 * size);
+}
+
+void WindTurbineDisplay::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+  erfasse(max(abs(xe - xs), abs(ye - ys)) + 1);
+  tiefe++;
+  TFT_eSPI::drawLine(xs, ys, xe, ye, color);
+  tiefe--;
+
+  TFT_eSPI* schatten = spiegelZiel();
+  if (schatten != nullptr) schatten->drawLine(xs, ys, xe, ye, color);
+  if (tiefe == 0) WindTurbineSpiegel::markiere(min(xs, xe), min(ys, ye), abs(xe - xs) + 1, abs(ye - ys) + 1);
+}
+
+void WindTurbineDisplay::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  if (h > 0) erfasse(h);
+  tiefe++;
+  TFT_eSPI::drawFastVLine(x, y, h, color);
+  tiefe--;
+
+  TFT_eSPI* schatten = spiegelZiel();
+  if (schatten != nullptr) schatten->drawFastVLine(x, y, h, color);
+  if (tiefe == 0) WindTurbineSpiegel::markiere(x, y, 1, h);
+}
+
+void WindTurbineDisplay::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  if (w > 0) erfasse(w);
+  tiefe++;
+  TFT_eSPI::drawFastHLine(x, y, w, color);
+  tiefe--;
+
+  TFT_eSPI* schatten = spiegelZiel();
+  if (schatten != nullptr) schatten->drawFastHLine(x, y, w, color);
+  if (tiefe == 0) WindTurbineSpiegel::markiere(x, y, w, 1);
+}
+
+void WindTurbineDisplay::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (w > 0 && h > 0) erfasse((uint32_t)w * h);
+  tiefe++;
+  TFT_eSPI::fillRect(x, y, w, h, color);
+  tiefe--;
+
+  TFT_eSPI* schatten = spiegelZiel();
+  if (schatten != nullptr) schatten->fillRect(x, y, w, h, color);
+  if (tiefe == 0) WindTurbineSpiegel::markiere(x, y, w, h);
+}
@@ -0,0 +1,73 @@
+/**
+ * WindTurbineRenderZaehler.h
+ * Zählung von Zeichenaufrufen und über SPI übertragenen Pixeln/Bytes
+ *
+ * WindTurbineDisplay ersetzt TFT_eSPI als Display-Objekt und zählt die
+ * Grundfunktionen (Pixel, Linien, Rechtecke, Zeichen), über die alle
+ * zusammengesetzten Zeichenfunktionen laufen. Block-Übertragungen (Sprites,
+ * DMA, gespeicherte Hintergründe) melden sich über erfasseBlock(); Sprites
+ * werden mit gebeSpriteAus() übertragen, gezählt und dem Spiegel gemeldet.
+ * Gezählt wird nur zwischen starte() und beende().
+ *
+ * Dieselben Grundfunktionen zeichnet WindTurbineDisplay zusätzlich in das
+ * Schattenbild des Spiegels (WindTurbineSpiegel) und meldet den Bereich als
+ * geändert, aber nur solange die Aufzeichnung läuft (Spiegelung, WiFi-Export).
+ */
+
+#ifndef WIND_TURBINE_RENDER_ZAEHLER_H
+#define WIND_TURBINE_RENDER_ZAEHLER_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Adressfenster setzen (CASET, RASET je 1+4 Bytes) und RAMWR (1 Byte)
+#define RENDER_BYTES_PRO_FENSTER 11
+
+// Wird nach jedem Durchlauf eines Bildschirms aufgerufen (warm = zweiter Durchlauf)
+typedef void (*BildschirmGezeichnet)(const char* name, bool warm, void* kontext);
+
+// Ergebnis einer Messung
+struct RenderStatistik {
+  uint32_t aufrufe;  // Zeichenaufrufe bzw. Block-Übertragungen
+  uint32_t pixel;    // Geschriebene Pixel
+  uint32_t bytes;    // Geschätzte SPI-Bytes (Pixel * 2 + Adressfenster)
+};
+
+class WindTurbineRenderZaehler {
+public:
+  static void starte();
+  static RenderStatistik beende();
+  static bool istAktiv();
+
+  static void erfassePrimitive(uint32_t pixel);
+  static void erfasseBlock(uint32_t pixel);
+
+private:
+  static bool aktiv;
+  static RenderStatistik statistik;
+};
+
+// Sprite übertragen (pushSprite), als Block zählen und dem Spiegel melden
+void gebeSpriteAus(TFT_eSprite& sprite, int32_t x, int32_t y);
+
+// Display-Objekt mit Zählung der Grundfunktionen
+class WindTurbineDisplay : public TFT_eSPI {
+public:
+  using TFT_eSPI::drawChar;
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) override;
+  void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override;
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+
+private:
+  // Nur äußerste Aufrufe zählen (drawLine ruft z.B. intern drawFastHLine auf)
+  uint8_t tiefe = 0;
+
+  void erfasse(uint32_t pixel);
+  TFT_eSPI* spiegelZiel();
+};
+
+#endif // WIND_TURBINE_RENDER_ZAEHLER_H
@@ -0,0 +1,439 @@
+/**
+ * WindTurbineSchrift.cpp
+ * Schriftatlanten und Cache vorgemischter Glyphen
+ */
+
+#include "WindTurbineSchrift.h"
+#include "WindTurbineSpiegel.h"
+
+WindTurbineSchrift::WindTurbineSchrift() :
+  tft(nullptr),
+  cachePixel(nullptr),
+  cacheSlotPixel(0),
+  cacheAnzahl(0),
+  zugriffe(0),
+  treffer(0),
+  fehlgriffe(0)
+{
+  memset(atlanten, 0, sizeof(atlanten));
+  memset(cache, 0, sizeof(cache));
+}
+
+void WindTurbineSchrift::begin(TFT_eSPI* display) {
+  tft = display;
+}
+
+/**
+ * Lädt <name>.wsa oder erzeugt den Atlas aus <name>.vlw
+ * @param textGroesse GLCD-Textgröße, die der Atlas ersetzt (1 oder 2)
+ */
+bool WindTurbineSchrift::ladeAtlas(uint8_t textGroesse, const char* name) {
+  if (textGroesse < 1 || textGroesse > SCHRIFT_ATLANTEN) return false;
+  Atlas& atlas = atlanten[textGroesse - 1];
+  leereAtlas(atlas);
+
+  String wsa = String(name) + ".wsa";
+  String vlw = String(name) + ".vlw";
+
+  if (SPIFFS.exists(wsa)) {
+    if (!ladeWsa(atlas, wsa)) {
+      Serial.print("Schrift: Atlas fehlerhaft: ");
+      Serial.println(wsa);
+      leereAtlas(atlas);
+    }
+  }
+
+  if (!atlas.geladen && SPIFFS.exists(vlw)) {
+    if (ladeVlw(atlas, vlw)) {
+      if (speichereWsa(atlas, wsa)) {
+        Serial.print("Schrift: Atlas erzeugt: ");
+        Serial.println(wsa);
+      }
+    } else {
+      Serial.print("Schrift: Smooth-Font fehlerhaft: ");
+      Serial.println(vlw);
+      leereAtlas(atlas);
+    }
+  }
+
+  if (!atlas.geladen) return false;
+
+  if (!bereiteCacheVor()) {
+    leereAtlas(atlas);
+    return false;
+  }
+
+  Serial.print("Schrift ");
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(atlas.anzahl);
+  Serial.print(" Glyphen, ");
+  Serial.print(atlas.zeilenHoehe);
+  Serial.print(" px, ");
+  Serial.print(atlas.pixelBytes);
+  Serial.println(" Bytes");
+  return true;
+}
+
+bool WindTurbineSchrift::verfuegbar(uint8_t textGroesse) {
+  return atlasFuer(textGroesse) != nullptr;
+}
+
+WindTurbineSchrift::Atlas* WindTurbineSchrift::atlasFuer(uint8_t textGroesse) {
+  if (textGroesse < 1 || textGroesse > SCHRIFT_ATLANTEN || cachePixel == nullptr) return nullptr;
+  Atlas* atlas = &atlanten[textGroesse - 1];
+  return atlas->geladen ? atlas : nullptr;
+}
+
+void WindTurbineSchrift::leereAtlas(Atlas& atlas) {
+  free(atlas.glyphen);
+  free(atlas.pixel);
+  memset(&atlas, 0, sizeof(atlas));
+
+  // Einträge dieses Atlas sind ungültig
+  int index = &atlas - atlanten;
+  for (int i = 0; i < SCHRIFT_CACHE_EINTRAEGE; i++) {
+    if (cache[i].atlas == index) cache[i].belegt = false;
+  }
+}
+
+/**
+ * Atlas-Datei: "WSA1", Zeilenhöhe, Leerzeichen-Vorschub, Anzahl (uint16),
+ * Pixel-Bytes (uint32), dann die Glyphen-Tabelle und die Deckungswerte.
+ * Zahlen liegen wie im Speicher des ESP32 (little endian).
+ */
+bool WindTurbineSchrift::ladeWsa(Atlas& atlas, const String& pfad) {
+  File datei = SPIFFS.open(pfad, FILE_READ);
+  if (!datei) return false;
+
+  uint8_t kopf[12];
+  bool ok = datei.read(kopf, sizeof(kopf)) == sizeof(kopf) && memcmp(kopf, "WSA1", 4) == 0;
+  if (ok) {
+    atlas.zeilenHoehe = kopf[4];
+    atlas.leerVorschub = kopf[5];
+    atlas.anzahl = kopf[6] | (kopf[7] << 8);
+    atlas.pixelBytes = kopf[8] | (kopf[9] << 8) | ((uint32_t)kopf[10] << 16) | ((uint32_t)kopf[11] << 24);
+
+    size_t tabelle = atlas.anzahl * sizeof(Glyphe);
+    atlas.glyphen = (Glyphe*)malloc(tabelle);
+    atlas.pixel = (uint8_t*)malloc(atlas.pixelBytes);
+    ok = atlas.anzahl > 0 && atlas.glyphen != nullptr && atlas.pixel != nullptr &&
+         datei.read((uint8_t*)atlas.glyphen, tabelle) == tabelle &&
+         datei.read(atlas.pixel, atlas.pixelBytes) == atlas.pixelBytes;
+  }
+  datei.close();
+
+  // Tabelle gegen die Pixeldaten prüfen
+  for (int i = 0; ok && i < atlas.anzahl; i++) {
+    const Glyphe& g = atlas.glyphen[i];
+    ok = g.offset + (g.breite * g.hoehe + 1) / 2 <= atlas.pixelBytes;
+  }
+
+  atlas.geladen = ok;
+  return ok;
+}
+
+static uint32_t leseU32BE(File& datei) {
+  uint8_t b[4] = {0, 0, 0, 0};
+  datei.read(b, 4);
+  return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3];
+}
+
+/**
+ * Liest eine Smooth-Font-Datei von TFT_eSPI (.vlw)
+ * Kopf: 6 x int32 (Anzahl, Version, Punktgröße, -, Oberlänge, Unterlänge),
+ * pro Glyphe 7 x int32 (Unicode, Höhe, Breite, Vorschub, dY, dX, -),
+ * danach 8 Bit Deckung pro Pixel. Alle Zahlen big endian.
+ */
+bool WindTurbineSchrift::ladeVlw(Atlas& atlas, const String& pfad) {
+  File datei = SPIFFS.open(pfad, FILE_READ);
+  if (!datei) return false;
+
+  uint32_t anzahl = leseU32BE(datei);
+  leseU32BE(datei);
+  leseU32BE(datei);
+  leseU32BE(datei);
+  int16_t oberlaenge = leseU32BE(datei);
+  int16_t unterlaenge = leseU32BE(datei);
+
+  if (anzahl == 0 || anzahl > 1024) {
+    datei.close();
+    return false;
+  }
+
+  atlas.anzahl = anzahl;
+  atlas.glyphen = (Glyphe*)malloc(anzahl * sizeof(Glyphe));
+  int16_t* dy = (int16_t*)malloc(anzahl * sizeof(int16_t));
+  if (atlas.glyphen == nullptr || dy == nullptr) {
+    free(dy);
+    datei.close();
+    return false;
+  }
+
+  // Maße lesen, Deckung wird auf 4 Bit gepackt (eine Glyphe beginnt auf ganzem Byte)
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < anzahl; i++) {
+    Glyphe& g = atlas.glyphen[i];
+    g.code = leseU32BE(datei);
+    g.hoehe = leseU32BE(datei);
+    g.breite = leseU32BE(datei);
+    g.vorschub = leseU32BE(datei);
+    dy[i] = (int16_t)leseU32BE(datei);
+    g.dx = (int8_t)leseU32BE(datei);
+    leseU32BE(datei);
+    g.reserve = 0;
+    g.offset = offset;
+    offset += (g.breite * g.hoehe + 1) / 2;
+
+    // Wie TFT_eSPI: größte Ober- und Unterlänge über alle Glyphen
+    if (dy[i] > oberlaenge) oberlaenge = dy[i];
+    if (g.hoehe - dy[i] > unterlaenge) unterlaenge = g.hoehe - dy[i];
+    if (g.code == ' ') atlas.leerVorschub = g.vorschub;
+  }
+
+  atlas.pixelBytes = offset;
+  atlas.pixel = (uint8_t*)malloc(offset > 0 ? offset : 1);
+  bool ok = atlas.pixel != nullptr;
+
+  uint8_t zeile[256];
+  for (uint32_t i = 0; ok && i < anzahl; i++) {
+    Glyphe& g = atlas.glyphen[i];
+    g.oben = oberlaenge - dy[i];
+    uint8_t* ziel = atlas.pixel + g.offset;
+    int n = 0;
+    for (int y = 0; ok && y < g.hoehe; y++) {
+      ok = datei.read(zeile, g.breite) == g.breite;
+      for (int x = 0; ok && x < g.breite; x++, n++) {
+        uint8_t deckung = (zeile[x] + 8) / 17;
+        if (n & 1) ziel[n >> 1] |= deckung << 4;
+        else ziel[n >> 1] = deckung;
+      }
+    }
+  }
+  datei.close();
+  free(dy);
+
+  if (!ok) return false;
+
+  atlas.zeilenHoehe = oberlaenge + unterlaenge;
+  if (atlas.leerVorschub == 0) atlas.leerVorschub = atlas.zeilenHoehe / 3;
+
+  // Binäre Suche braucht aufsteigende Codes (das Werkzeug sortiert bereits)
+  for (uint32_t i = 1; i < anzahl; i++) {
+    Glyphe g = atlas.glyphen[i];
+    int j = i - 1;
+    while (j >= 0 && atlas.glyphen[j].code > g.code) {
+      atlas.glyphen[j + 1] = atlas.glyphen[j];
+      j--;
+    }
+    atlas.glyphen[j + 1] = g;
+  }
+
+  atlas.geladen = true;
+  return true;
+}
+
+bool WindTurbineSchrift::speichereWsa(const Atlas& atlas, const String& pfad) {
+  File datei = SPIFFS.open(pfad, FILE_WRITE);
+  if (!datei) return false;
+
+  uint8_t kopf[12] = {'W', 'S', 'A', '1', atlas.zeilenHoehe, atlas.leerVorschub,
+                      (uint8_t)(atlas.anzahl & 0xFF), (uint8_t)(atlas.anzahl >> 8),
+                      (uint8_t)(atlas.pixelBytes & 0xFF), (uint8_t)(atlas.pixelBytes >> 8),
+                      (uint8_t)(atlas.pixelBytes >> 16), (uint8_t)(atlas.pixelBytes >> 24)};
+  size_t tabelle = atlas.anzahl * sizeof(Glyphe);
+  bool ok = datei.write(kopf, sizeof(kopf)) == sizeof(kopf) &&
+            datei.write((const uint8_t*)atlas.glyphen, tabelle) == tabelle &&
+            datei.write(atlas.pixel, atlas.pixelBytes) == atlas.pixelBytes;
+  datei.close();
+
+  if (!ok) {
+    Serial.println("Schrift: Atlas konnte nicht gespeichert werden");
+    SPIFFS.remove(pfad);
+  }
+  return ok;
+}
+
+/**
+ * Ein Cache-Eintrag fasst die größte Glyphe aller geladenen Atlanten
+ * Ändert sich diese Größe, wird der Speicher neu angelegt und der Cache geleert.
+ */
+bool WindTurbineSchrift::bereiteCacheVor() {
+  uint16_t groesste = 1;
+  for (int a = 0; a < SCHRIFT_ATLANTEN; a++) {
+    for (int i = 0; atlanten[a].geladen && i < atlanten[a].anzahl; i++) {
+      const Glyphe& g = atlanten[a].glyphen[i];
+      if (g.breite * g.hoehe > groesste) groesste = g.breite * g.hoehe;
+    }
+  }
+
+  if (cachePixel != nullptr && groesste <= cacheSlotPixel) return true;
+
+  free(cachePixel);
+  cachePixel = nullptr;
+  for (int i = 0; i < SCHRIFT_CACHE_EINTRAEGE; i++) {
+    cache[i].belegt = false;
+  }
+
+  cacheSlotPixel = groesste;
+  cacheAnzahl = SCHRIFT_CACHE_MAX_BYTES / (groesste * sizeof(uint16_t));
+  if (cacheAnzahl > SCHRIFT_CACHE_EINTRAEGE) cacheAnzahl = SCHRIFT_CACHE_EINTRAEGE;
+  if (cacheAnzahl < 1) {
+    Serial.println("Schrift: Glyphen zu groß für den Cache");
+    return false;
+  }
+
+  cachePixel = (uint16_t*)malloc(cacheAnzahl * cacheSlotPixel * sizeof(uint16_t));
+  if (cachePixel == nullptr) {
+    Serial.println("Schrift: Kein Speicher für den Glyphen-Cache");
+    return false;
+  }
+  return true;
+}
+
+int WindTurbineSchrift::findeGlyphe(const Atlas& atlas, uint16_t code) {
+  int links = 0;
+  int rechts = atlas.anzahl - 1;
+  while (links <= rechts) {
+    int mitte = (links + rechts) / 2;
+    uint16_t c = atlas.glyphen[mitte].code;
+    if (c == code) return mitte;
+    if (c < code) links = mitte + 1;
+    else rechts = mitte - 1;
+  }
+  return -1;
+}
+
+/**
+ * Liefert die vorgemischte Glyphe, bei Fehlgriff wird der am längsten
+ * nicht genutzte Eintrag überschrieben
+ */
+uint16_t* WindTurbineSchrift::holeGlyphe(int atlas, int glyphe, uint16_t vordergrund, uint16_t hintergrund) {
+  zugriffe++;
+
+  int frei = -1;
+  int aeltester = 0;
+  for (int i = 0; i < cacheAnzahl; i++) {
+    CacheEintrag& e = cache[i];
+    if (!e.belegt) {
+      if (frei < 0) frei = i;
+      continue;
+    }
+    if (e.glyphe == glyphe && e.atlas == atlas && e.vordergrund == vordergrund && e.hintergrund == hintergrund) {
+      e.zuletzt = zugriffe;
+      treffer++;
+      return cachePixel + i * cacheSlotPixel;
+    }
+    if (e.zuletzt < cache[aeltester].zuletzt) aeltester = i;
+  }
+
+  fehlgriffe++;
+  int ziel = (frei >= 0) ? frei : aeltester;
+  CacheEintrag& e = cache[ziel];
+  e.belegt = true;
+  e.atlas = atlas;
+  e.glyphe = glyphe;
+  e.vordergrund = vordergrund;
+  e.hintergrund = hintergrund;
+  e.zuletzt = zugriffe;
+
+  uint16_t* pixel = cachePixel + ziel * cacheSlotPixel;
+  mischeGlyphe(atlanten[atlas], atlanten[atlas].glyphen[glyphe], vordergrund, hintergrund, pixel);
+  return pixel;
+}
+
+/**
+ * Mischt die 16 Deckungsstufen einmal und setzt die Glyphe daraus zusammen
+ * Die Pixel werden byte-getauscht abgelegt, wie pushImage() sie erwartet.
+ */
+void WindTurbineSchrift::mischeGlyphe(const Atlas& atlas, const Glyphe& g, uint16_t vordergrund, uint16_t hintergrund, uint16_t* ziel) {
+  uint16_t stufen[16];
+  int vr = vordergrund >> 11, vg = (vordergrund >> 5) & 0x3F, vb = vordergrund & 0x1F;
+  int hr = hintergrund >> 11, hg = (hintergrund >> 5) & 0x3F, hb = hintergrund & 0x1F;
+  for (int a = 0; a < 16; a++) {
+    int r = (vr * a + hr * (15 - a) + 7) / 15;
+    int gr = (vg * a + hg * (15 - a) + 7) / 15;
+    int b = (vb * a + hb * (15 - a) + 7) / 15;
+    uint16_t farbe = (r << 11) | (gr << 5) | b;
+    stufen[a] = (farbe >> 8) | (farbe << 8);
+  }
+
+  const uint8_t* quelle = atlas.pixel + g.offset;
+  int anzahl = g.breite * g.hoehe;
+  for (int n = 0; n < anzahl; n++) {
+    uint8_t deckung = (n & 1) ? (quelle[n >> 1] >> 4) : (quelle[n >> 1] & 0x0F);
+    ziel[n] = stufen[deckung];
+  }
+}
+
+/**
+ * Dekodiert ein UTF-8-Zeichen und rückt den Zeiger weiter
+ */
+uint16_t WindTurbineSchrift::naechstesZeichen(const char*& text) {
+  uint8_t c = *text++;
+  if (c < 0x80) return c;
+  if ((c & 0xE0) == 0xC0 && (*text & 0xC0) == 0x80) {
+    return ((c & 0x1F) << 6) | (*text++ & 0x3F);
+  }
+  if ((c & 0xF0) == 0xE0 && (text[0] & 0xC0) == 0x80 && (text[1] & 0xC0) == 0x80) {
+    uint16_t code = ((c & 0x0F) << 12) | ((text[0] & 0x3F) << 6) | (text[1] & 0x3F);
+    text += 2;
+    return code;
+  }
+  return c;
+}
+
+/**
+ * Zeichnet einen Text mit einem pushImage() pro sichtbarer Glyphe
+ * Nur was auf dem Display landet, wird in den Spiegel übernommen.
+ */
+bool WindTurbineSchrift::zeichneText(const char* text, int16_t x, int16_t y, uint8_t textGroesse,
+                                     uint16_t vordergrund, uint16_t hintergrund, TFT_eSPI* ziel) {
+  Atlas* atlas = atlasFuer(textGroesse);
+  if (ziel == nullptr) ziel = tft;
+  if (atlas == nullptr || ziel == nullptr) return false;
+
+  int index = atlas - atlanten;
+  ziel->startWrite();
+  while (*text != '\0') {
+    int glyphe = findeGlyphe(*atlas, naechstesZeichen(text));
+    if (glyphe < 0) {
+      x += atlas->leerVorschub;
+      continue;
+    }
+    const Glyphe& g = atlas->glyphen[glyphe];
+    if (g.breite > 0 && g.hoehe > 0) {
+      uint16_t* pixel = holeGlyphe(index, glyphe, vordergrund, hintergrund);
+      ziel->pushImage(x + g.dx, y + g.oben, g.breite, g.hoehe, pixel);
+      if (ziel == tft) WindTurbineSpiegel::uebernimmBild(x + g.dx, y + g.oben, g.breite, g.hoehe, pixel);
+    }
+    x += g.vorschub;
+  }
+  ziel->endWrite();
+  return true;
+}
+
+int16_t WindTurbineSchrift::textBreite(const char* text, uint8_t textGroesse) {
+  Atlas* atlas = atlasFuer(textGroesse);
+  if (atlas == nullptr) return strlen(text) * 6 * textGroesse;
+
+  int16_t breite = 0;
+  while (*text != '\0') {
+    int glyphe = findeGlyphe(*atlas, naechstesZeichen(text));
+    breite += (glyphe >= 0) ? atlas->glyphen[glyphe].vorschub : atlas->leerVorschub;
+  }
+  return breite;
+}
+
+int16_t WindTurbineSchrift::zeilenHoehe(uint8_t textGroesse) {
+  Atlas* atlas = atlasFuer(textGroesse);
+  return (atlas != nullptr) ? atlas->zeilenHoehe : 8 * textGroesse;
+}
+
+uint32_t WindTurbineSchrift::cacheTreffer() {
+  return treffer;
+}
+
+uint32_t WindTurbineSchrift::cacheFehlgriffe() {
+  return fehlgriffe;
+}
@@ -0,0 +1,113 @@
+/**
+ * WindTurbineSchrift.h
+ * Kantengeglättete Schriften aus Atlanten im SPIFFS
+ *
+ * Ein Atlas (.wsa) enthält die Maße aller Glyphen und ihre Deckung mit
+ * 4 Bit pro Pixel. Fehlt er, wird er einmalig aus einer Smooth-Font-Datei
+ * (.vlw, erzeugt mit dem Create_Smooth_Font-Werkzeug von TFT_eSPI) gleichen
+ * Namens erzeugt und gespeichert.
+ *
+ * Die Widgets kennen ihre Hintergrundfarbe (TFT_BACKGROUND, TFT_TITLE_BG,
+ * TFT_STATUS_BAR, ...). Deshalb wird jede Glyphe einmal pro Farbpaar mit dem
+ * Hintergrund gemischt und in einem kleinen LRU-Cache abgelegt. Das Zeichnen
+ * ist danach ein pushImage() pro Zeichen statt Mischen pro Pixel.
+ *
+ * Atlanten ersetzen die GLCD-Textgrößen 1 und 2. Ohne Atlas liefert
+ * zeichneText() false und der Aufrufer zeichnet wie bisher mit der GLCD-Schrift.
+ *
+ * Mitgeliefert werden data/schrift_klein.wsa und data/schrift_gross.wsa
+ * (DejaVu Sans, 10 und 18 px), übertragen mit "ESP32 Sketch Data Upload".
+ * Neu erzeugt werden sie mit make -C host atlanten (host/atlas/SchriftAtlas.cpp).
+ */
+
+#ifndef WIND_TURBINE_SCHRIFT_H
+#define WIND_TURBINE_SCHRIFT_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <SPIFFS.h>
+#include "WindTurbineConstants.h"
+
+#define SCHRIFT_ATLANTEN 2 // Textgröße 1 und 2
+
+class WindTurbineSchrift {
+public:
+  // Konstruktor
+  WindTurbineSchrift();
+
+  void begin(TFT_eSPI* display);
+
+  // Atlas für eine Textgröße laden (Name ohne Endung, z.B. "/schrift_klein")
+  bool ladeAtlas(uint8_t textGroesse, const char* name);
+
+  bool verfuegbar(uint8_t textGroesse);
+
+  // Einzeiliger Text, y ist die Oberkante der Zeile
+  // @param ziel Display oder Sprite, nullptr = Display aus begin()
+  // @return false wenn für die Textgröße kein Atlas geladen ist
+  bool zeichneText(const char* text, int16_t x, int16_t y, uint8_t textGroesse,
+                   uint16_t vordergrund, uint16_t hintergrund, TFT_eSPI* ziel = nullptr);
+
+  int16_t textBreite(const char* text, uint8_t textGroesse);
+  int16_t zeilenHoehe(uint8_t textGroesse);
+
+  // Trefferquote des Glyphen-Cache
+  uint32_t cacheTreffer();
+  uint32_t cacheFehlgriffe();
+
+private:
+  // Maße einer Glyphe (12 Bytes, so auch in der .wsa-Datei)
+  struct Glyphe {
+    uint16_t code;     // Unicode
+    uint8_t breite;
+    uint8_t hoehe;
+    uint8_t vorschub;  // Cursor danach um so viele Pixel weiter
+    int8_t dx;         // Versatz zum Cursor
+    int8_t oben;       // Abstand zur Oberkante der Zeile
+    uint8_t reserve;
+    uint32_t offset;   // Beginn der Deckungswerte in pixel
+  };
+
+  struct Atlas {
+    bool geladen;
+    uint8_t zeilenHoehe;
+    uint8_t leerVorschub; // Für Zeichen ohne Glyphe
+    uint16_t anzahl;
+    Glyphe* glyphen;      // Nach code sortiert
+    uint8_t* pixel;       // 4 Bit Deckung pro Pixel, je Glyphe fortlaufend
+    uint32_t pixelBytes;
+  };
+
+  // Vorgemischte Glyphe, Pixel liegen in cachePixel
+  struct CacheEintrag {
+    bool belegt;
+    uint8_t atlas;
+    uint16_t glyphe;
+    uint16_t vordergrund;
+    uint16_t hintergrund;
+    uint32_t zuletzt;     // Für LRU
+  };
+
+  TFT_eSPI* tft;
+  Atlas atlanten[SCHRIFT_ATLANTEN];
+  CacheEintrag cache[SCHRIFT_CACHE_EINTRAEGE];
+  uint16_t* cachePixel;
+  uint16_t cacheSlotPixel; // Pixel pro Eintrag (größte Glyphe)
+  int cacheAnzahl;         // Nutzbare Einträge (durch SCHRIFT_CACHE_MAX_BYTES begrenzt)
+  uint32_t zugriffe;
+  uint32_t treffer;
+  uint32_t fehlgriffe;
+
+  Atlas* atlasFuer(uint8_t textGroesse);
+  void leereAtlas(Atlas& atlas);
+  bool ladeWsa(Atlas& atlas, const String& pfad);
+  bool ladeVlw(Atlas& atlas, const String& pfad);
+  bool speichereWsa(const Atlas& atlas, const String& pfad);
+  bool bereiteCacheVor();
+  int findeGlyphe(const Atlas& atlas, uint16_t code);
+  uint16_t* holeGlyphe(int atlas, int glyphe, uint16_t vordergrund, uint16_t hintergrund);
+  void mischeGlyphe(const Atlas& atlas, const Glyphe& g, uint16_t vordergrund, uint16_t hintergrund, uint16_t* ziel);
+  static uint16_t naechstesZeichen(const char*& text);
+};
+
+#endif // WIND_TURBINE_SCHRIFT_H
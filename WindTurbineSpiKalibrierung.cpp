@@ -0,0 +1,186 @@
+/**
+ * WindTurbineSpiKalibrierung.cpp
+ * Kalibrierung des SPI-Takts für das Display beim Start
+ */
+
+#include "WindTurbineSpiKalibrierung.h"
+#include <Preferences.h>
+
+uint32_t tftSpiFrequenz = SPI_STANDARD_FREQUENZ;
+
+// Mögliche Takte aufsteigend (der ESP32 teilt 80 MHz, 27 MHz ergibt 26,7 MHz)
+static const uint32_t spiStufen[] = {10000000, 16000000, 20000000, 27000000, 40000000, 80000000};
+static const int SPI_STUFEN_ANZAHL = sizeof(spiStufen) / sizeof(spiStufen[0]);
+
+// Testbereich oben links, wird danach wieder gelöscht
+#define SPI_TEST_BREITE 64
+#define SPI_TEST_HOEHE 4
+#define SPI_TEST_MUSTER 4
+
+WindTurbineSpiKalibrierung::WindTurbineSpiKalibrierung() :
+  tft(nullptr)
+{
+}
+
+void WindTurbineSpiKalibrierung::begin(TFT_eSPI* display) {
+  tft = display;
+}
+
+/**
+ * Übernimmt den gespeicherten Takt, wenn er einen Durchlauf besteht
+ * Andernfalls (oder erzwungen) wird neu kalibriert. Ist schon der langsamste
+ * Takt fehlerhaft, kann das Display nicht zurückgelesen werden und es bleibt
+ * bei SPI_STANDARD_FREQUENZ.
+ */
+uint32_t WindTurbineSpiKalibrierung::stelleTaktEin(bool erzwingen) {
+  if (tft == nullptr) return tftSpiFrequenz;
+
+  uint32_t gespeichert = erzwingen ? 0 : ladeFrequenz();
+  if (findeStufe(gespeichert) >= 0 && gespeichert <= SPI_KALIBRIERUNG_MAX_FREQUENZ) {
+    if (pruefeFrequenz(gespeichert, 1)) {
+      tftSpiFrequenz = gespeichert;
+      Serial.print("SPI-Takt aus NVS: ");
+      Serial.print(gespeichert / 1000000.0, 1);
+      Serial.println(" MHz");
+      return tftSpiFrequenz;
+    }
+    Serial.println("SPI-Takt aus NVS fehlerhaft, kalibriere neu");
+  }
+
+  unsigned long start = millis();
+  int stufe = kalibriere();
+
+  if (stufe < 0) {
+    tftSpiFrequenz = SPI_STANDARD_FREQUENZ;
+    Serial.println("SPI-Kalibrierung: Rücklesen nicht möglich, verwende Standardtakt");
+    return tftSpiFrequenz;
+  }
+
+  tftSpiFrequenz = spiStufen[stufe];
+  speichereFrequenz(tftSpiFrequenz);
+
+  Serial.print("SPI-Takt kalibriert: ");
+  Serial.print(tftSpiFrequenz / 1000000.0, 1);
+  Serial.print(" MHz (");
+  Serial.print(millis() - start);
+  Serial.println(" ms)");
+  return tftSpiFrequenz;
+}
+
+/**
+ * Sucht die höchste fehlerfreie Stufe
+ * Die gefundene Stufe muss zusätzlich den Dauertest bestehen, sonst wird
+ * schrittweise heruntergeschaltet. Gewählt wird eine Stufe darunter
+ * (Sicherheitsreserve), höchstens SPI_KALIBRIERUNG_MAX_FREQUENZ.
+ * @return Index in spiStufen oder -1 wenn schon die langsamste Stufe scheitert
+ */
+int WindTurbineSpiKalibrierung::kalibriere() {
+  int beste = -1;
+  for (int i = 0; i < SPI_STUFEN_ANZAHL; i++) {
+    bool ok = pruefeFrequenz(spiStufen[i], SPI_KALIBRIERUNG_DURCHLAEUFE);
+    Serial.print("  ");
+    Serial.print(spiStufen[i] / 1000000.0, 1);
+    Serial.println(ok ? " MHz ok" : " MHz fehlerhaft");
+    if (!ok) break;
+    beste = i;
+  }
+
+  if (beste < 0) return -1;
+
+  while (beste > 0 && !pruefeFrequenz(spiStufen[beste], SPI_KALIBRIERUNG_DAUERTEST)) {
+    Serial.print("  Dauertest bei ");
+    Serial.print(spiStufen[beste] / 1000000.0, 1);
+    Serial.println(" MHz fehlerhaft");
+    beste--;
+  }
+
+  int gewaehlt = beste > 0 ? beste - 1 : 0;
+  while (gewaehlt > 0 && spiStufen[gewaehlt] > SPI_KALIBRIERUNG_MAX_FREQUENZ) gewaehlt--;
+  Serial.print("  Grenze ");
+  Serial.print(spiStufen[beste] / 1000000.0, 1);
+  Serial.print(" MHz, gewaehlt ");
+  Serial.print(spiStufen[gewaehlt] / 1000000.0, 1);
+  Serial.println(" MHz");
+  return gewaehlt;
+}
+
+/**
+ * Schreibt und liest alle Testmuster mit dem angegebenen Takt
+ */
+bool WindTurbineSpiKalibrierung::pruefeFrequenz(uint32_t frequenz, int durchlaeufe) {
+  uint32_t vorher = tftSpiFrequenz;
+  tftSpiFrequenz = frequenz;
+
+  bool ok = true;
+  for (int d = 0; d < durchlaeufe && ok; d++) {
+    for (int m = 0; m < SPI_TEST_MUSTER && ok; m++) {
+      ok = pruefeMuster(m, d);
+    }
+  }
+
+  // Testbereich mit dem langsamsten Takt löschen, damit sicher nichts stehen bleibt
+  tftSpiFrequenz = spiStufen[0];
+  tft->fillRect(0, 0, SPI_TEST_BREITE, SPI_TEST_HOEHE, TFT_BACKGROUND);
+  tftSpiFrequenz = vorher;
+  return ok;
+}
+
+/**
+ * Ein Testmuster schreiben (pushRect) und zurücklesen (readRect)
+ * 0: 0xAAAA/0x5555 im Wechsel (maximale Flankenzahl)
+ * 1: 0xFFFF/0x0000 im Wechsel (alle Leitungen gleichzeitig)
+ * 2: Wandernde Eins
+ * 3: Pseudozufall (Xorshift, je Durchlauf anders)
+ */
+bool WindTurbineSpiKalibrierung::pruefeMuster(int muster, int durchlauf) {
+  const int anzahl = SPI_TEST_BREITE * SPI_TEST_HOEHE;
+  uint16_t geschrieben[anzahl];
+  uint16_t gelesen[anzahl];
+
+  uint32_t zufall = 0x9E3779B9UL ^ (uint32_t)(durchlauf * 7919 + 1);
+  for (int i = 0; i < anzahl; i++) {
+    switch (muster) {
+      case 0: geschrieben[i] = ((i + durchlauf) & 1) ? 0x5555 : 0xAAAA; break;
+      case 1: geschrieben[i] = ((i + durchlauf) & 1) ? 0x0000 : 0xFFFF; break;
+      case 2: geschrieben[i] = 1 << ((i + durchlauf) % 16); break;
+      default:
+        zufall ^= zufall << 13;
+        zufall ^= zufall >> 17;
+        zufall ^= zufall << 5;
+        geschrieben[i] = (uint16_t)zufall;
+        break;
+    }
+    gelesen[i] = ~geschrieben[i];
+  }
+
+  // pushRect und readRect verwenden dieselbe Byte-Reihenfolge
+  tft->pushRect(0, 0, SPI_TEST_BREITE, SPI_TEST_HOEHE, geschrieben);
+  tft->readRect(0, 0, SPI_TEST_BREITE, SPI_TEST_HOEHE, gelesen);
+
+  return memcmp(geschrieben, gelesen, sizeof(geschrieben)) == 0;
+}
+
+int WindTurbineSpiKalibrierung::findeStufe(uint32_t frequenz) {
+  for (int i = 0; i < SPI_STUFEN_ANZAHL; i++) {
+    if (spiStufen[i] == frequenz) return i;
+  }
+  return -1;
+}
+
+uint32_t WindTurbineSpiKalibrierung::ladeFrequenz() {
+  Preferences nvs;
+  if (!nvs.begin("display", true)) return 0;
+  uint32_t frequenz = nvs.getUInt("spiTakt", 0);
+  nvs.end();
+  return frequenz;
+}
+
+void WindTurbineSpiKalibrierung::speichereFrequenz(uint32_t frequenz) {
+  Preferences nvs;
+  if (!nvs.begin("display", false)) {
+    Serial.println("SPI-Kalibrierung: NVS nicht verfügbar");
+    return;
+  }
+  nvs.putUInt("spiTakt", frequenz);
+  nvs.end();
+}
@@ -0,0 +1,50 @@
+/**
+ * WindTurbineSpiKalibrierung.h
+ * Kalibrierung des SPI-Takts für das Display beim Start
+ *
+ * Schreibt Testmuster mit steigendem Takt in einen kleinen Bildbereich und
+ * liest sie mit SPI_READ_FREQUENCY zurück. Gesucht wird die höchste Frequenz
+ * ohne Fehler, die zusätzlich einen längeren Dauertest besteht (sonst eine
+ * Stufe tiefer). Als Sicherheitsreserve wird eine Stufe darunter gewählt,
+ * höchstens SPI_KALIBRIERUNG_MAX_FREQUENZ. Das Ergebnis liegt im NVS und wird
+ * beim nächsten Start nur noch mit einem Durchlauf bestätigt.
+ *
+ * Die Kalibrierung muss vor initDMA() laufen, da der DMA-Kanal den Takt bei
+ * der Initialisierung übernimmt, und vor der ersten Keypad-Abfrage, da
+ * GPIO 19 auch als Keypad-Spalte dient.
+ */
+
+#ifndef WIND_TURBINE_SPI_KALIBRIERUNG_H
+#define WIND_TURBINE_SPI_KALIBRIERUNG_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+
+// Aktueller Schreibtakt des Displays (SPI_FREQUENCY in User_Setup.h)
+extern uint32_t tftSpiFrequenz;
+
+class WindTurbineSpiKalibrierung {
+public:
+  // Konstruktor
+  WindTurbineSpiKalibrierung();
+
+  // Initialisierung (nach tft.init())
+  void begin(TFT_eSPI* display);
+
+  // Gespeicherten Takt prüfen und übernehmen, sonst neu kalibrieren
+  // @return eingestellte Frequenz in Hz
+  uint32_t stelleTaktEin(bool erzwingen = false);
+
+private:
+  TFT_eSPI* tft;
+
+  int kalibriere();
+  bool pruefeFrequenz(uint32_t frequenz, int durchlaeufe);
+  bool pruefeMuster(int muster, int durchlauf);
+  int findeStufe(uint32_t frequenz);
+  uint32_t ladeFrequenz();
+  void speichereFrequenz(uint32_t frequenz);
+};
+
+#endif // WIND_TURBINE_SPI_KALIBRIERUNG_H
@@ -0,0 +1,327 @@
+/**
+ * WindTurbineSpiegel.cpp
+ * Schattenbild des Displays und Kodierung der geänderten Bereiche
+ */
+
+#include "WindTurbineSpiegel.h"
+
+#if defined(ESP32) && defined(TFT_MISO)
+#include <soc/gpio_sig_map.h>
+#endif
+
+TFT_eSPI* WindTurbineSpiegel::tft = nullptr;
+TFT_eSprite* WindTurbineSpiegel::schatten = nullptr;
+uint16_t* WindTurbineSpiegel::pixel = nullptr;
+bool WindTurbineSpiegel::ruecklesen = false;
+bool WindTurbineSpiegel::aktiv = false;
+DisplayBereich WindTurbineSpiegel::bereiche[SPIEGEL_MAX_BEREICHE];
+int WindTurbineSpiegel::anzahlBereiche = 0;
+int16_t WindTurbineSpiegel::fortschritt = 0;
+int32_t WindTurbineSpiegel::fensterX = 0;
+int32_t WindTurbineSpiegel::fensterY = 0;
+int32_t WindTurbineSpiegel::fensterB = 0;
+int32_t WindTurbineSpiegel::fensterH = 0;
+uint32_t WindTurbineSpiegel::fensterPos = 0;
+
+static bool beruehrenSich(const DisplayBereich& a, const DisplayBereich& b) {
+  return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+         a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+static DisplayBereich vereinige(const DisplayBereich& a, const DisplayBereich& b) {
+  int16_t x1 = min(a.x, b.x);
+  int16_t y1 = min(a.y, b.y);
+  int16_t x2 = max(a.x + a.w, b.x + b.w);
+  int16_t y2 = max(a.y + a.h, b.y + b.h);
+  DisplayBereich v = {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+  return v;
+}
+
+static void schreibe16(uint8_t*& ziel, uint16_t wert) {
+  *ziel++ = wert & 0xFF;
+  *ziel++ = wert >> 8;
+}
+
+/**
+ * Legt das Schattenbild an
+ * 480x320 Pixel mit 16 Bit passen nur in den PSRAM, ohne PSRAM wird
+ * (mit SPIEGEL_RUECKLESEN) vom Display gelesen.
+ */
+bool WindTurbineSpiegel::begin(TFT_eSPI* display) {
+  if (istBereit()) return true;
+  tft = display;
+
+  if (!psramFound()) {
+    if (SPIEGEL_RUECKLESEN) {
+      ruecklesen = true;
+      anzahlBereiche = 0;
+      fortschritt = 0;
+      Serial.println("Spiegel: kein PSRAM, geaenderte Bereiche werden vom Display gelesen");
+      return true;
+    }
+    Serial.println("Spiegel: kein PSRAM, Spiegelung nicht verfuegbar");
+    return false;
+  }
+
+  schatten = new TFT_eSprite(display);
+  schatten->setColorDepth(16);
+  if (schatten->createSprite(480, 320) == nullptr) {
+    Serial.println("Spiegel: Schattenbild konnte nicht angelegt werden");
+    delete schatten;
+    schatten = nullptr;
+    return false;
+  }
+  pixel = (uint16_t*)schatten->getPointer();
+  schatten->fillSprite(TFT_BLACK);
+  anzahlBereiche = 0;
+  fortschritt = 0;
+
+  Serial.println("Spiegel: Schattenbild im PSRAM angelegt");
+  return true;
+}
+
+bool WindTurbineSpiegel::istBereit() {
+  return schatten != nullptr || ruecklesen;
+}
+
+/**
+ * Schaltet die Aufzeichnung ein oder aus
+ * Nach dem Einschalten muss der Bildschirm einmal vollständig neu gezeichnet
+ * werden, da das Schattenbild währenddessen nicht nachgeführt wurde.
+ */
+void WindTurbineSpiegel::setzeAktiv(bool aktiv) {
+  WindTurbineSpiegel::aktiv = aktiv && istBereit();
+  anzahlBereiche = 0;
+  fortschritt = 0;
+  fensterB = 0;
+}
+
+bool WindTurbineSpiegel::istAktiv() {
+  return aktiv;
+}
+
+TFT_eSPI* WindTurbineSpiegel::ziel() {
+  return aktiv ? schatten : nullptr;
+}
+
+/**
+ * Merkt einen geänderten Bereich vor und fasst berührende Bereiche zusammen
+ * Wird der gerade gesendete Bereich erweitert, beginnt er wieder von vorn.
+ */
+void WindTurbineSpiegel::markiere(int32_t x, int32_t y, int32_t w, int32_t h) {
+  if (!aktiv) return;
+
+  // Auf den Bildschirm begrenzen
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > 480) w = 480 - x;
+  if (y + h > 320) h = 320 - y;
+  if (w <= 0 || h <= 0) return;
+
+  DisplayBereich neu = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+
+  bool zusammengefasst = true;
+  while (zusammengefasst) {
+    zusammengefasst = false;
+    for (int i = 0; i < anzahlBereiche; i++) {
+      if (beruehrenSich(bereiche[i], neu)) {
+        neu = vereinige(bereiche[i], neu);
+        bereiche[i] = bereiche[anzahlBereiche - 1];
+        anzahlBereiche--;
+        if (i == 0) fortschritt = 0;
+        zusammengefasst = true;
+        break;
+      }
+    }
+  }
+
+  if (anzahlBereiche < SPIEGEL_MAX_BEREICHE) {
+    bereiche[anzahlBereiche++] = neu;
+  } else {
+    bereiche[anzahlBereiche - 1] = vereinige(bereiche[anzahlBereiche - 1], neu);
+    if (anzahlBereiche == 1) fortschritt = 0;
+  }
+}
+
+void WindTurbineSpiegel::markiereAlles() {
+  if (!aktiv) return;
+  anzahlBereiche = 0;
+  fortschritt = 0;
+  markiere(0, 0, 480, 320);
+}
+
+bool WindTurbineSpiegel::hatAenderungen() {
+  return anzahlBereiche > 0;
+}
+
+/**
+ * Übernimmt einen Pixelblock (Sprite, DMA-Kachel, Glyphe, gesicherte Unterlage)
+ */
+void WindTurbineSpiegel::uebernimmBild(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* daten) {
+  if (!aktiv) return;
+  if (schatten != nullptr && daten != nullptr) schatten->pushImage(x, y, w, h, daten);
+  markiere(x, y, w, h);
+}
+
+/**
+ * Fenster für Farbläufe wie tft.setAddrWindow() (gespeicherte Hintergründe)
+ */
+void WindTurbineSpiegel::beginneFenster(int32_t x, int32_t y, int32_t w, int32_t h) {
+  if (!aktiv) return;
+  fensterX = max(x, (int32_t)0);
+  fensterY = max(y, (int32_t)0);
+  fensterB = min(w, (int32_t)480 - fensterX);
+  fensterH = min(h, (int32_t)320 - fensterY);
+  fensterPos = 0;
+  markiere(fensterX, fensterY, fensterB, fensterH);
+}
+
+/**
+ * Farblauf wie tft.pushBlock() in das offene Fenster
+ */
+void WindTurbineSpiegel::uebernimmLauf(uint16_t farbe, uint32_t anzahl) {
+  if (schatten == nullptr || fensterB <= 0 || fensterH <= 0) return;
+
+  uint16_t getauscht = (farbe >> 8) | (farbe << 8);
+  uint32_t ende = min(fensterPos + anzahl, (uint32_t)(fensterB * fensterH));
+  while (fensterPos < ende) {
+    int32_t zeile = fensterPos / fensterB;
+    int32_t spalte = fensterPos % fensterB;
+    int32_t n = min((int32_t)(ende - fensterPos), fensterB - spalte);
+    uint16_t* ziel = pixel + (fensterY + zeile) * 480 + fensterX + spalte;
+    for (int32_t i = 0; i < n; i++) ziel[i] = getauscht;
+    fensterPos += n;
+  }
+}
+
+void WindTurbineSpiegel::setzeClip(int32_t x, int32_t y, int32_t w, int32_t h) {
+  if (schatten == nullptr) return;
+  schatten->setViewport(x, y, w, h, false);
+}
+
+void WindTurbineSpiegel::hebeClipAuf() {
+  if (schatten == nullptr) return;
+  schatten->resetViewport();
+}
+
+bool WindTurbineSpiegel::kannLesen() {
+  return aktiv;
+}
+
+/**
+ * Liest eine Bildschirmzeile aus dem Schattenbild
+ * Ohne Schattenbild (nur mit SPIEGEL_RUECKLESEN) vom Display.
+ */
+bool WindTurbineSpiegel::leseZeile(int16_t y, uint16_t* ziel) {
+  if (!aktiv || y < 0 || y >= 320) return false;
+
+  const uint16_t* quelle;
+  if (schatten != nullptr) {
+    quelle = pixel + y * 480;
+  } else if (ruecklesen) {
+    leseDisplay(0, y, 480, ziel);
+    quelle = ziel;
+  } else {
+    return false;
+  }
+
+  // Schattenbild und readRect liefern byte-getauschte Pixel
+  for (int16_t x = 0; x < 480; x++) {
+    ziel[x] = (quelle[x] >> 8) | (quelle[x] << 8);
+  }
+  return true;
+}
+
+/**
+ * Kodiert die geänderten Bereiche in Streifen ganzer Zeilen
+ * Ein Streifen wird nur begonnen, wenn er auch im ungünstigsten Fall (jedes
+ * Pixel ein eigener Lauf) in den Puffer passt. Nicht fertig gesendete
+ * Bereiche werden beim nächsten Aufruf fortgesetzt.
+ */
+size_t WindTurbineSpiegel::kodiere(uint8_t* puffer, size_t groesse, unsigned long budgetUs) {
+  if (!aktiv) return 0;
+
+  unsigned long start = micros();
+  size_t belegt = 0;
+
+  while (anzahlBereiche > 0 && micros() - start < budgetUs) {
+    const DisplayBereich& b = bereiche[0];
+    size_t proZeile = (size_t)b.w * 4;
+    if (belegt + SPIEGEL_KOPF_BYTES + proZeile > groesse) break;
+
+    int16_t zeilen = min((int)(b.h - fortschritt),
+                         (int)((groesse - belegt - SPIEGEL_KOPF_BYTES) / proZeile));
+    belegt += kodiereStreifen(b, fortschritt, zeilen, puffer + belegt);
+    fortschritt += zeilen;
+
+    // Fertige Bereiche entfernen, Reihenfolge beibehalten
+    if (fortschritt >= b.h) {
+      for (int i = 1; i < anzahlBereiche; i++) {
+        bereiche[i - 1] = bereiche[i];
+      }
+      anzahlBereiche--;
+      fortschritt = 0;
+    }
+  }
+
+  return belegt;
+}
+
+size_t WindTurbineSpiegel::kodiereStreifen(const DisplayBereich& b, int16_t zeile, int16_t zeilen, uint8_t* puffer) {
+  uint8_t* kopf = puffer;
+  uint8_t* ziel = puffer + SPIEGEL_KOPF_BYTES;
+  uint16_t laeufe = 0;
+  uint16_t laufFarbe = 0;
+  uint16_t laufLaenge = 0;
+  static uint16_t gelesen[480];
+
+  for (int16_t yy = b.y + zeile; yy < b.y + zeile + zeilen; yy++) {
+    const uint16_t* quelle = gelesen;
+    if (schatten != nullptr) {
+      quelle = pixel + yy * 480 + b.x;
+    } else {
+      leseDisplay(b.x, yy, b.w, gelesen);
+    }
+    for (int16_t xx = 0; xx < b.w; xx++) {
+      uint16_t farbe = (quelle[xx] >> 8) | (quelle[xx] << 8);
+      if (laufLaenge > 0 && farbe == laufFarbe && laufLaenge < 0xFFFF) {
+        laufLaenge++;
+      } else {
+        if (laufLaenge > 0) {
+          schreibe16(ziel, laufLaenge);
+          schreibe16(ziel, laufFarbe);
+          laeufe++;
+        }
+        laufFarbe = farbe;
+        laufLaenge = 1;
+      }
+    }
+  }
+  if (laufLaenge > 0) {
+    schreibe16(ziel, laufLaenge);
+    schreibe16(ziel, laufFarbe);
+    laeufe++;
+  }
+
+  *kopf++ = 'R';
+  schreibe16(kopf, b.x);
+  schreibe16(kopf, b.y + zeile);
+  schreibe16(kopf, b.w);
+  schreibe16(kopf, zeilen);
+  schreibe16(kopf, laeufe);
+
+  return ziel - puffer;
+}
+
+/**
+ * Liest einen Zeilenabschnitt vom Display (byte-getauscht wie das Schattenbild)
+ * Die Keypad-Abfrage schaltet GPIO 19 als Spalte um, daher wird der Pin vor
+ * dem Lesen wieder als MISO des Display-SPI verbunden.
+ */
+void WindTurbineSpiegel::leseDisplay(int16_t x, int16_t y, int16_t w, uint16_t* ziel) {
+#if defined(ESP32) && defined(TFT_MISO)
+  pinMode(TFT_MISO, INPUT);
+  pinMatrixInAttach(TFT_MISO, VSPIQ_IN_IDX, false);
+#endif
+  tft->readRect(x, y, w, 1, ziel);
+}
@@ -0,0 +1,96 @@
+/**
+ * WindTurbineSpiegel.h
+ * Schattenbild des Displays für die Spiegelung im Browser
+ *
+ * Das Display kann nicht zuverlässig zurückgelesen werden (GPIO 19 ist
+ * TFT_MISO und Keypad-Spalte). Deshalb führt der Spiegel ein Schattenbild
+ * (480x320, RGB565) im PSRAM: WindTurbineDisplay zeichnet jede Grundfunktion
+ * zusätzlich in das Schattenbild, Block-Übertragungen (Sprites, DMA,
+ * Hintergründe, Glyphen) melden sich wie beim Render-Zähler an der
+ * Aufrufstelle. Geänderte Rechtecke werden gesammelt und zusammengefasst.
+ *
+ * kodiere() schreibt die geänderten Bereiche streifenweise lauflängenkodiert
+ * in einen Puffer, den die Datenverwaltung an den Browser schickt:
+ *   'R', x, y, w, h, Anzahl Läufe (je uint16_t, little endian),
+ *   danach je Lauf Länge und Farbe (RGB565, je uint16_t)
+ * Die Läufe gehen zeilenweise über den ganzen Streifen.
+ *
+ * Gezeichnet und vorgemerkt wird nur, solange die Spiegelung oder der
+ * WiFi-Export läuft (setzeAktiv()), sonst kehren alle Aufrufe sofort zurück
+ * und die Messung zahlt nichts dafür. Beim Einschalten zeichnet der Aufrufer
+ * den Bildschirm einmal vollständig neu, damit das Schattenbild stimmt.
+ *
+ * Ohne PSRAM (z.B. ESP32-DevKitC) gibt es kein Schattenbild, Spiegelung und
+ * Screenshot sind dann nicht verfügbar. SPIEGEL_RUECKLESEN (standardmäßig aus)
+ * liest die geänderten Rechtecke stattdessen zeilenweise vom Display
+ * (readRect, etwa 0,7 ms pro voller Zeile). Wie beim Compositor
+ * (COMPOSITOR_RUECKLESEN) ist das nicht zuverlässig: GPIO 19 ist auch
+ * Keypad-Spalte, eine in dieser Spalte gehaltene Taste verfälscht die
+ * gelesenen Pixel.
+ */
+
+#ifndef WIND_TURBINE_SPIEGEL_H
+#define WIND_TURBINE_SPIEGEL_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineCompositor.h"
+
+// Kopf eines Streifens: Kennung, x, y, w, h, Anzahl Läufe
+#define SPIEGEL_KOPF_BYTES 11
+
+class WindTurbineSpiegel {
+public:
+  // Schattenbild anlegen (nur mit PSRAM), sonst Rücklesen vom Display
+  static bool begin(TFT_eSPI* display);
+  static bool istBereit();
+
+  // Aufzeichnung ein-/ausschalten (Spiegelung oder WiFi-Export läuft)
+  static void setzeAktiv(bool aktiv);
+  static bool istAktiv();
+
+  // Schattenbild als Zeichenziel für WindTurbineDisplay (nullptr ohne Spiegel)
+  static TFT_eSPI* ziel();
+
+  // Geänderten Bereich vormerken
+  static void markiere(int32_t x, int32_t y, int32_t w, int32_t h);
+  static void markiereAlles();
+  static bool hatAenderungen();
+
+  // Block-Übertragungen (Pixel in Display-Byte-Reihenfolge wie bei pushImage)
+  static void uebernimmBild(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* daten);
+  static void beginneFenster(int32_t x, int32_t y, int32_t w, int32_t h);
+  static void uebernimmLauf(uint16_t farbe, uint32_t anzahl);
+
+  // Clipping wie tft.setViewport(x, y, w, h, false)
+  static void setzeClip(int32_t x, int32_t y, int32_t w, int32_t h);
+  static void hebeClipAuf();
+
+  // Eine Zeile RGB565 (480 Pixel) aus dem Schattenbild bzw. vom Display
+  static bool kannLesen();
+  static bool leseZeile(int16_t y, uint16_t* ziel);
+
+  // Geänderte Bereiche kodieren, höchstens groesse Bytes bzw. budgetUs
+  // @return Anzahl geschriebener Bytes (0 = nichts zu senden)
+  static size_t kodiere(uint8_t* puffer, size_t groesse, unsigned long budgetUs);
+
+private:
+  static TFT_eSPI* tft;
+  static TFT_eSprite* schatten;
+  static uint16_t* pixel;   // Pixel des Schattenbilds (byte-getauscht)
+  static bool ruecklesen;   // Ohne Schattenbild: geänderte Bereiche vom Display lesen
+  static bool aktiv;        // Aufzeichnung läuft
+  static DisplayBereich bereiche[SPIEGEL_MAX_BEREICHE];
+  static int anzahlBereiche;
+  static int16_t fortschritt; // Bereits gesendete Zeilen von bereiche[0]
+
+  // Offenes Fenster für uebernimmLauf()
+  static int32_t fensterX, fensterY, fensterB, fensterH;
+  static uint32_t fensterPos;
+
+  static size_t kodiereStreifen(const DisplayBereich& b, int16_t zeile, int16_t zeilen, uint8_t* puffer);
+  static void leseDisplay(int16_t x, int16_t y, int16_t w, uint16_t* ziel);
+};
+
+#endif // WIND_TURBINE_SPIEGEL_H
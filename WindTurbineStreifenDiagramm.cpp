@@ -0,0 +1,215 @@
+/**
+ * WindTurbineStreifenDiagramm.cpp
+ * Laufendes Leistungsdiagramm mit gleitendem Mittelwert und ±1σ-Band
+ */
+
+#include "WindTurbineStreifenDiagramm.h"
+#include "WindTurbineRenderZaehler.h"
+
+WindTurbineStreifenDiagramm::WindTurbineStreifenDiagramm(TFT_eSPI* display) :
+  sprite(display),
+  bereit(false),
+  start(0),
+  anzahl(0),
+  ausstehend(0),
+  skala(0)
+{
+}
+
+/**
+ * Legt das Sprite an und begrenzt das Schieben auf die Zeichenfläche
+ * (die Beschriftung links bleibt stehen)
+ */
+bool WindTurbineStreifenDiagramm::begin() {
+  sprite.setColorDepth(16);
+  if (sprite.createSprite(LIVE_DIAGRAMM_BREITE, LIVE_DIAGRAMM_HOEHE) == nullptr) {
+    Serial.println("Leistungsdiagramm: Kein Speicher fuer Sprite - Diagramm deaktiviert");
+    return false;
+  }
+
+  sprite.setScrollRect(STREIFEN_BESCHRIFTUNG, 0, STREIFEN_SPALTEN, LIVE_DIAGRAMM_HOEHE, TFT_TITLE_BG);
+  baueNeuAuf();
+  bereit = true;
+  return true;
+}
+
+bool WindTurbineStreifenDiagramm::istBereit() {
+  return bereit;
+}
+
+/**
+ * Nimmt einen Messwert auf und berechnet Mittelwert und Standardabweichung
+ * über die letzten LIVE_DIAGRAMM_FENSTER Werte
+ */
+void WindTurbineStreifenDiagramm::fuegeWertHinzu(float leistung) {
+  if (anzahl < STREIFEN_SPALTEN) {
+    anzahl++;
+  } else {
+    start = (start + 1) % STREIFEN_SPALTEN;
+  }
+  int neu = index(anzahl - 1);
+  werte[neu] = leistung;
+
+  int fenster = min(anzahl, (int)LIVE_DIAGRAMM_FENSTER);
+  float summe = 0;
+  for (int k = anzahl - fenster; k < anzahl; k++) {
+    summe += werte[index(k)];
+  }
+  float mittelwert = summe / fenster;
+
+  float quadratsumme = 0;
+  for (int k = anzahl - fenster; k < anzahl; k++) {
+    float abweichung = werte[index(k)] - mittelwert;
+    quadratsumme += abweichung * abweichung;
+  }
+
+  mittel[neu] = mittelwert;
+  sigma[neu] = (fenster > 1) ? sqrt(quadratsumme / (fenster - 1)) : 0;
+
+  ausstehend++;
+}
+
+/**
+ * Zeichnet die seit dem letzten Aufruf hinzugekommenen Spalten
+ * Ist das Zeitbudget des Bildes schon verbraucht, bleiben die Spalten
+ * ausstehend und werden im nächsten Bild gemeinsam nachgezogen.
+ */
+bool WindTurbineStreifenDiagramm::zeichne(int16_t x, int16_t y, unsigned long bildStartUs, unsigned long budgetUs) {
+  if (!bereit || ausstehend == 0) return true;
+
+  if (micros() - bildStartUs > budgetUs) {
+    return false;
+  }
+
+  if (pruefeSkala() || ausstehend >= STREIFEN_SPALTEN) {
+    // Neue Skala oder zu viele ausstehende Spalten: komplett neu aufbauen
+    baueNeuAuf();
+  } else {
+    // Inhalt nach links schieben und nur die neuen Spalten zeichnen
+    sprite.scroll(-ausstehend, 0);
+    for (int i = 0; i < ausstehend; i++) {
+      int k = anzahl - ausstehend + i;
+      zeichneSpalte(STREIFEN_BESCHRIFTUNG + STREIFEN_SPALTEN - ausstehend + i, k);
+    }
+  }
+  ausstehend = 0;
+
+  gebeSpriteAus(sprite, x, y);
+  return true;
+}
+
+void WindTurbineStreifenDiagramm::zeichneVollstaendig(int16_t x, int16_t y) {
+  if (!bereit) return;
+
+  pruefeSkala();
+  baueNeuAuf();
+  ausstehend = 0;
+  gebeSpriteAus(sprite, x, y);
+}
+
+float WindTurbineStreifenDiagramm::gleitenderMittelwert() {
+  return (anzahl > 0) ? mittel[index(anzahl - 1)] : 0;
+}
+
+float WindTurbineStreifenDiagramm::gleitendeStandardabweichung() {
+  return (anzahl > 0) ? sigma[index(anzahl - 1)] : 0;
+}
+
+int WindTurbineStreifenDiagramm::index(int k) {
+  return (start + k) % STREIFEN_SPALTEN;
+}
+
+int16_t WindTurbineStreifenDiagramm::wertZuY(float wert) {
+  int16_t oben = 1;
+  int16_t unten = LIVE_DIAGRAMM_HOEHE - 2;
+  if (skala <= 0) return unten;
+
+  float anteil = constrain(wert / skala, 0.0f, 1.0f);
+  return unten - (int16_t)(anteil * (unten - oben));
+}
+
+/**
+ * Zeichnet eine Spalte: Hintergrund, Gitterlinie, ±1σ-Band, Mittelwert und Momentanwert
+ * @param spalteX x-Position im Sprite
+ * @param k Position im Verlauf (0 = ältester Wert)
+ */
+void WindTurbineStreifenDiagramm::zeichneSpalte(int16_t spalteX, int k) {
+  sprite.drawFastVLine(spalteX, 0, LIVE_DIAGRAMM_HOEHE, TFT_TITLE_BG);
+
+  // Gitterlinie bei halber Skala (gestrichelt)
+  if ((spalteX & 3) == 0) {
+    sprite.drawPixel(spalteX, wertZuY(skala / 2), TFT_GRID);
+  }
+
+  if (k < 0 || k >= anzahl) return;
+  int i = index(k);
+
+  // ±1σ-Band um den gleitenden Mittelwert
+  int16_t bandOben = wertZuY(mittel[i] + sigma[i]);
+  int16_t bandUnten = wertZuY(mittel[i] - sigma[i]);
+  sprite.drawFastVLine(spalteX, bandOben, bandUnten - bandOben + 1, TFT_CHART_BAND);
+
+  // Gleitender Mittelwert
+  sprite.drawPixel(spalteX, wertZuY(mittel[i]), TFT_CHART_ACCENT);
+
+  // Momentanwert, mit dem vorherigen Wert verbunden
+  int16_t yWert = wertZuY(werte[i]);
+  int16_t yVorher = (k > 0) ? wertZuY(werte[index(k - 1)]) : yWert;
+  int16_t yMin = min(yWert, yVorher);
+  int16_t yMax = max(yWert, yVorher);
+  sprite.drawFastVLine(spalteX, yMin, yMax - yMin + 1, TFT_HIGHLIGHT);
+}
+
+void WindTurbineStreifenDiagramm::zeichneBeschriftung() {
+  sprite.fillRect(0, 0, STREIFEN_BESCHRIFTUNG, LIVE_DIAGRAMM_HOEHE, TFT_OUTLINE);
+  sprite.setTextSize(1);
+  sprite.setTextColor(TFT_TEXT);
+  sprite.setCursor(2, 2);
+  sprite.print(skala, 0);
+  sprite.setTextColor(TFT_LIGHT_TEXT);
+  sprite.setCursor(2, LIVE_DIAGRAMM_HOEHE - 9);
+  sprite.print("uW");
+}
+
+/**
+ * Passt die y-Achse an: vergrößern sobald ein Wert über der Skala liegt,
+ * verkleinern wenn der Verlauf unter 30 % der Skala bleibt
+ * @return true wenn sich die Skala geändert hat
+ */
+bool WindTurbineStreifenDiagramm::pruefeSkala() {
+  float maximum = 0;
+  for (int k = 0; k < anzahl; k++) {
+    int i = index(k);
+    maximum = max(maximum, max(werte[i], mittel[i] + sigma[i]));
+  }
+  if (maximum <= 0) return false;
+
+  if (maximum > skala || maximum < skala * 0.3) {
+    // Auf eine runde Zahl (1, 2 oder 5 mal Zehnerpotenz) aufrunden
+    float ziel = maximum * 1.2;
+    float zehner = pow(10, floor(log10(ziel)));
+    float neu = zehner;
+    if (ziel > zehner * 5) neu = zehner * 10;
+    else if (ziel > zehner * 2) neu = zehner * 5;
+    else if (ziel > zehner) neu = zehner * 2;
+
+    if (neu != skala) {
+      skala = neu;
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Zeichnet alle Spalten aus dem Verlauf neu (nur im Sprite-Speicher)
+ */
+void WindTurbineStreifenDiagramm::baueNeuAuf() {
+  zeichneBeschriftung();
+
+  // Neueste Werte rechtsbündig
+  for (int s = 0; s < STREIFEN_SPALTEN; s++) {
+    int k = anzahl - STREIFEN_SPALTEN + s;
+    zeichneSpalte(STREIFEN_BESCHRIFTUNG + s, k);
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ * WindTurbineStreifenDiagramm.h
+ * Laufendes Leistungsdiagramm für die Messbildschirme
+ *
+ * Zeigt die Momentanleistung der letzten Sekunden mit gleitendem Mittelwert
+ * und ±1σ-Band. Pro Bild wird der Sprite-Inhalt um die neuen Spalten nach
+ * links geschoben und nur die neuen Spalten gezeichnet.
+ */
+
+#ifndef WIND_TURBINE_STREIFEN_DIAGRAMM_H
+#define WIND_TURBINE_STREIFEN_DIAGRAMM_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+
+// Breite der Beschriftung links, der Rest ist Zeichenfläche (eine Spalte pro Messwert)
+#define STREIFEN_BESCHRIFTUNG 40
+#define STREIFEN_SPALTEN (LIVE_DIAGRAMM_BREITE - STREIFEN_BESCHRIFTUNG)
+
+class WindTurbineStreifenDiagramm {
+public:
+  // Konstruktor
+  WindTurbineStreifenDiagramm(TFT_eSPI* display);
+
+  // Initialisierung (Sprite anlegen)
+  bool begin();
+  bool istBereit();
+
+  // Neuen Messwert aufnehmen (gezeichnet wird beim nächsten zeichne())
+  void fuegeWertHinzu(float leistung);
+
+  // Ausstehende Spalten zeichnen und übertragen, sofern das Zeitbudget des
+  // Bildes (ab bildStartUs) noch nicht verbraucht ist
+  // @return false wenn das Zeichnen auf das nächste Bild verschoben wurde
+  bool zeichne(int16_t x, int16_t y, unsigned long bildStartUs, unsigned long budgetUs);
+
+  // Komplettes Diagramm aus dem Verlauf neu aufbauen (beim Betreten des Bildschirms)
+  void zeichneVollstaendig(int16_t x, int16_t y);
+
+  // Statistik über das gleitende Fenster
+  float gleitenderMittelwert();
+  float gleitendeStandardabweichung();
+
+private:
+  TFT_eSprite sprite;
+  bool bereit;
+
+  // Ringpuffer mit Momentanwert, Mittelwert und Standardabweichung pro Spalte
+  float werte[STREIFEN_SPALTEN];
+  float mittel[STREIFEN_SPALTEN];
+  float sigma[STREIFEN_SPALTEN];
+  int start;
+  int anzahl;
+  int ausstehend;   // Noch nicht gezeichnete Spalten
+  float skala;      // Oberer Rand der y-Achse in uW
+
+  int index(int k);
+  int16_t wertZuY(float wert);
+  void zeichneSpalte(int16_t spalteX, int k);
+  void zeichneBeschriftung();
+  bool pruefeSkala();
+  void baueNeuAuf();
+};
+
+#endif // WIND_TURBINE_STREIFEN_DIAGRAMM_H
@@ -10,17 +10,28 @@
  * @param titel Text, der im Titelbalken angezeigt wird
  */
   void WindTurbineExperiment::zeichneTitelbalken(const char* titel) {
+    // Neuer Bildschirm: Overlays und Schäden des alten Bildschirms sind überdeckt
+    compositor.neuerBildschirm(titel);
+    
+    // Bildschirm ohne Widgets: Widget-Liste des vorherigen Bildschirms verwerfen
+    widgets.leeren();
+    ersteCursorZeile = -1;
+    
     // Titelbalken mit abgerundetem Hintergrund
     tft.fillRoundRect(10, 10, 460, HEADER_HEIGHT, 5, TFT_TITLE_BG);
     
     // Titel - Textgröße basierend auf Länge anpassen
-    // Kleinere Textgröße für längere Titel verwenden
-    uint8_t textSize = (strlen(titel) > 25) ? 1 : 2;
+    // Kleinere Textgröße für längere Titel verwenden, der Titel muss vor der
+    // Motor-Status-Box enden (sonst überdeckt deren Sprite die Zeichen).
+    // Breiten und Text kommen aus dem Schriftatlas, ohne Atlas aus der GLCD-Schrift.
+    uint8_t textSize = (schrift.textBreite(titel, 2) > TITEL_MAX_BREITE) ? 1 : 2;
     
-    tft.setTextSize(textSize);
-    tft.setTextColor(TFT_HEADER);
-    tft.setCursor(25, textSize == 1 ? 20 : 18);
-    tft.print(titel);
+    // Auch in kleiner Schrift zu lang, daher kürzen
+    char gekuerzterTitel[WIDGET_MAX_TEXT];
+    strncpy(gekuerzterTitel, titel, WIDGET_MAX_TEXT - 1);
+    gekuerzterTitel[WIDGET_MAX_TEXT - 1] = '\0';
+    widgets.kuerze(gekuerzterTitel, TITEL_MAX_BREITE, textSize);
+    widgets.schreibe(gekuerzterTitel, 25, textSize == 1 ? 20 : 18, textSize, TFT_HEADER, TFT_TITLE_BG);
     
     // Motor-Status-Box zeichnen
     zeichneMotorStatusBox();
@@ -31,43 +42,76 @@
  * @param status Text, der in der Statusleiste angezeigt wird
  */
 void WindTurbineExperiment::zeichneStatusleiste(const char* status) {
+  zeichneStatusleiste(tft, status);
+}
+
+/**
+ * Pause einer Fortschritts- oder Ergebnisanimation
+ * Entfällt im Render-Benchmark, damit nur das Zeichnen gemessen wird.
+ */
+void WindTurbineExperiment::pausiereAnimation(unsigned long ms) {
+  if (!renderBenchmarkAktiv) delay(ms);
+}
+
+/**
+ * Zeichnet die Statusleiste auf ein beliebiges Ziel (Display oder Sprite)
+ */
+void WindTurbineExperiment::zeichneStatusleiste(TFT_eSPI& ziel, const char* status) {
   // Statusleiste am unteren Rand
-  tft.fillRect(0, 320-STATUS_BAR_HEIGHT, 480, STATUS_BAR_HEIGHT, TFT_STATUS_BAR);
+  ziel.fillRect(0, 320-STATUS_BAR_HEIGHT, 480, STATUS_BAR_HEIGHT, TFT_STATUS_BAR);
   
   // Zurück-Button am rechten Rand - schmaler und weiter rechts platziert
-  tft.fillRoundRect(420, 320-STATUS_BAR_HEIGHT+2, 55, STATUS_BAR_HEIGHT-4, 3, TFT_SUBTITLE);
+  ziel.fillRoundRect(420, 320-STATUS_BAR_HEIGHT+2, 55, STATUS_BAR_HEIGHT-4, 3, TFT_SUBTITLE);
   
-  // WICHTIG: Textgröße explizit auf 1 setzen vor dem Zeichnen des Buttons
-  tft.setTextSize(1);
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(425, 320-12);
-  tft.print("D=Zur.");
+  // Texte über den Schriftatlas (Textgröße 1), ohne Atlas in der GLCD-Schrift
+  widgets.schreibe("D=Zur.", 425, 320-12, 1, TFT_TEXT, TFT_SUBTITLE, &ziel);
   
-  // Status-Text mit dynamischer Anpassung
-  // tft.setTextSize(1); // Bereits oben gesetzt
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(10, 320-15);
+  // Status-Text auf den verfügbaren Platz (abzüglich Zurück-Button und Rand) kürzen
+  int maxWidth = 410;
+  char gekuerzterStatus[WIDGET_MAX_TEXT];
+  strncpy(gekuerzterStatus, status, WIDGET_MAX_TEXT - 1);
+  gekuerzterStatus[WIDGET_MAX_TEXT - 1] = '\0';
+  widgets.kuerze(gekuerzterStatus, maxWidth, 1);
+  widgets.schreibe(gekuerzterStatus, 10, 320-15, 1, TFT_TEXT, TFT_STATUS_BAR, &ziel);
+}
+
+/**
+ * Zeichnet den statischen Hintergrund eines Bildschirms
+ * Aus dem Zwischenspeicher in einem Block, sonst direkt. Beim geclippten
+ * Neuzeichnen (Compositor) wird immer direkt gezeichnet, da die Block-
+ * Übertragung den Viewport nicht beachtet.
+ */
+void WindTurbineExperiment::zeigeStatischenHintergrund(HintergrundKennung id, EbenenZeichner zeichner) {
+  if (compositor.istReparaturAktiv() || !hintergrundCache.zeige(id, zeichner)) {
+    zeichner(tft);
+  }
+}
+
+/**
+ * Beginnt einen Bildschirm, der aus Widgets aufgebaut wird
+ * Legt Titelbalken und Statusleiste an, der Bildschirm ergänzt seine Widgets
+ * und ruft danach zeichneWidgetBildschirm() auf.
+ */
+void WindTurbineExperiment::beginneWidgetBildschirm(const char* titel, const char* status) {
+  tft.fillScreen(TFT_BACKGROUND);
+  compositor.neuerBildschirm(titel);
   
-  // Textlänge berechnen
-  int textLength = strlen(status);
+  widgets.leeren();
+  ersteCursorZeile = -1;
   
-  // Verfügbarer Platz für Text (abzüglich Zurück-Button und Rand)
-  int maxWidth = 410;
+  int titelbalken = widgets.fuegeHinzu(WIDGET_TITELBALKEN, 10, 10, 460, HEADER_HEIGHT);
+  widgets.setzeText(titelbalken, titel);
   
-  if (textLength * 6 > maxWidth) {
-    // Text ist zu lang, daher kürzen
-    int maxChars = maxWidth / 6;
-    char gekuerzterStatus[100];
-    strncpy(gekuerzterStatus, status, maxChars - 3);
-    gekuerzterStatus[maxChars - 3] = '.';
-    gekuerzterStatus[maxChars - 2] = '.';
-    gekuerzterStatus[maxChars - 1] = '.';
-    gekuerzterStatus[maxChars] = '\0';
-    tft.print(gekuerzterStatus);
-  } else {
-    // Text passt, vollständig anzeigen
-    tft.print(status);
-  }
+  int statusleiste = widgets.fuegeHinzu(WIDGET_STATUSLEISTE, 0, 320-STATUS_BAR_HEIGHT, 480, STATUS_BAR_HEIGHT);
+  widgets.setzeText(statusleiste, status);
+}
+
+/**
+ * Zeichnet alle Widgets des neuen Bildschirms und die Motor-Status-Box im Titelbalken
+ */
+void WindTurbineExperiment::zeichneWidgetBildschirm() {
+  widgets.zeichne();
+  zeichneMotorStatusBox();
 }
 
 /**
@@ -76,35 +120,45 @@ void WindTurbineExperiment::zeichneStatusleiste(const char* status) {
  * ANGEPASST: Weiter nach links verschoben + Spannung anzeigen
  */
 void WindTurbineExperiment::zeichneMotorStatusBox() {
+  // NEU: Bereich 248,10 - 360,24 wird im Sprite aufgebaut und in einem Stück übertragen
+  bool imSprite = spriteStatus.created();
+  TFT_eSPI& ziel = imSprite ? static_cast<TFT_eSPI&>(spriteStatus) : static_cast<TFT_eSPI&>(tft);
+  int ox = imSprite ? 248 : 0;
+  int oy = imSprite ? 10 : 0;
+  
+  if (imSprite) {
+    spriteStatus.fillSprite(TFT_TITLE_BG);
+  }
+  
   // Motor-Status - VERSCHOBEN: von 320 auf 250
-  int boxX = 250;
-  int boxY = 12;
+  int boxX = 250 - ox;
+  int boxY = 12 - oy;
   int boxSize = 10;
   
   // Hintergrund (schwarz für besseren Kontrast)
-  tft.fillRect(boxX-1, boxY-1, boxSize+2, boxSize+2, TFT_BLACK);
+  ziel.fillRect(boxX-1, boxY-1, boxSize+2, boxSize+2, TFT_BLACK);
   
   // Status-Box zeichnen
   if (motorStatusAktuell) {
     // Motor angeschlossen: Grüne Box
-    tft.fillRect(boxX, boxY, boxSize, boxSize, TFT_SUCCESS);
+    ziel.fillRect(boxX, boxY, boxSize, boxSize, TFT_SUCCESS);
   } else {
     // Motor nicht angeschlossen: Rote Box
-    tft.fillRect(boxX, boxY, boxSize, boxSize, TFT_WARNING);
+    ziel.fillRect(boxX, boxY, boxSize, boxSize, TFT_WARNING);
   }
   
   // Weißer Rand für bessere Sichtbarkeit
-  tft.drawRect(boxX, boxY, boxSize, boxSize, TFT_WHITE);
+  ziel.drawRect(boxX, boxY, boxSize, boxSize, TFT_WHITE);
   
   // Akku-Status - VERSCHOBEN: von 340 auf 270
-  int battX = 270;
-  int battY = 12;
+  int battX = 270 - ox;
+  int battY = 12 - oy;
   int battW = 20;
   int battH = 10;
   
   // Akku-Rahmen
-  tft.drawRect(battX, battY, battW, battH, TFT_WHITE);
-  tft.fillRect(battX + battW, battY + 2, 2, battH - 4, TFT_WHITE); // Plus-Pol
+  ziel.drawRect(battX, battY, battW, battH, TFT_WHITE);
+  ziel.fillRect(battX + battW, battY + 2, 2, battH - 4, TFT_WHITE); // Plus-Pol
   
   // Akku-Füllung basierend auf Prozent
   int fuellBreite = (akkuProzent * (battW - 2)) / 100;
@@ -114,16 +168,24 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
   else if (akkuProzent > 20) fuellFarbe = TFT_HIGHLIGHT;
   else fuellFarbe = TFT_WARNING;
   
-  tft.fillRect(battX + 1, battY + 1, fuellBreite, battH - 2, fuellFarbe);
+  ziel.fillRect(battX + 1, battY + 1, fuellBreite, battH - 2, fuellFarbe);
   
   // ERWEITERT: Prozentanzeige UND Spannung - kompakter dargestellt
-  tft.setTextSize(1);
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(battX + battW + 8, battY + 2);
-  tft.print(akkuProzent);
-  tft.print("% ");
-  tft.print(akkuSpannung, 1); // Eine Nachkommastelle
-  tft.print("V");
+  ziel.setTextSize(1);
+  ziel.setTextColor(TFT_TEXT);
+  ziel.setCursor(battX + battW + 8, battY + 2);
+  ziel.print(akkuProzent);
+  ziel.print("% ");
+  ziel.print(akkuSpannung, 1); // Eine Nachkommastelle
+  ziel.print("V");
+  
+  if (imSprite) {
+    gebeSpriteAus(spriteStatus, 248, 10);
+  }
+  
+  // Angezeigte Werte merken, damit die Live-Anzeige nur bei Änderungen neu zeichnet
+  angezeigterMotorStatus = motorStatusAktuell;
+  angezeigterAkkuProzent = akkuProzent;
 }
  
 /**
@@ -131,20 +193,39 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
  * Enthält Titel, Einführungstext und Optionen
  */
  void WindTurbineExperiment::zeigeIntro() {
+  // Intro hat keinen Titelbalken - Bildschirm direkt beim Compositor anmelden
+  compositor.neuerBildschirm("Intro");
+  widgets.leeren();
+  ersteCursorZeile = -1;
+  
+  // Der Startbildschirm ist vollständig statisch
+  zeigeStatischenHintergrund(HINTERGRUND_INTRO, [this](TFT_eSPI& ziel) {
+    zeichneIntroHintergrund(ziel);
+  });
+
+  // --- Abschluss ---
+  maxCursorPosition = 0;
+  aktuellerModus = INTRO;
+}
+
+/**
+ * Zeichnet den Startbildschirm auf ein beliebiges Ziel (Display oder Sprite)
+ */
+void WindTurbineExperiment::zeichneIntroHintergrund(TFT_eSPI& ziel) {
   // Bildschirm leeren
-  tft.fillScreen(TFT_BACKGROUND);
+  ziel.fillScreen(TFT_BACKGROUND);
 
   // Hilfsfunktion: Text zentriert in Box zeichnen
   auto drawCenteredBox = [&](const char* txt, uint8_t ts, int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, uint16_t boxCol, uint16_t txtCol) {
-    tft.fillRoundRect(boxX, boxY, boxW, boxH, 5, boxCol);
-    tft.setTextSize(ts);
-    tft.setTextColor(txtCol);
+    ziel.fillRoundRect(boxX, boxY, boxW, boxH, 5, boxCol);
+    ziel.setTextSize(ts);
+    ziel.setTextColor(txtCol);
     int16_t txtW = strlen(txt) * 6 * ts;
     int16_t txtH = 8 * ts;
     int16_t txtX = boxX + (boxW - txtW) / 2;
     int16_t txtY = boxY + (boxH - txtH) / 2; // vertikal zentriert
-    tft.setCursor(txtX, txtY);
-    tft.print(txt);
+    ziel.setCursor(txtX, txtY);
+    ziel.print(txt);
   };
 
   // --- Titel ---
@@ -152,7 +233,7 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
   const uint8_t tsTitle = 2;
   int16_t titleW = strlen(title) * 6 * tsTitle;
   int16_t titleH = 8 * tsTitle;
-  int16_t titleX = (tft.width() - titleW - 20) / 2;
+  int16_t titleX = (ziel.width() - titleW - 20) / 2;
   int16_t titleY = 10;
   drawCenteredBox(title, tsTitle, titleX, titleY, titleW + 20, titleH + 10, TFT_TITLE_BG, TFT_HEADER);
 
@@ -161,23 +242,23 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
   const uint8_t tsSub = 2;
   int16_t subW = strlen(subtitle) * 6 * tsSub;
   int16_t subH = 8 * tsSub;
-  int16_t subX = (tft.width() - subW - 20) / 2;
+  int16_t subX = (ziel.width() - subW - 20) / 2;
   int16_t subY = titleY + titleH + 20;
   drawCenteredBox(subtitle, tsSub, subX, subY, subW + 20, subH + 10, TFT_OUTLINE, TFT_TEXT);
 
   // --- Trennlinie ---
   int16_t lineY = subY + subH + 15;
-  tft.drawLine(20, lineY, tft.width() - 20, lineY, TFT_GRID);
+  ziel.drawLine(20, lineY, ziel.width() - 20, lineY, TFT_GRID);
 
   // --- Einführungstext ---
   const char* intro = "In diesem Experiment werden Sie:";
   const uint8_t tsIntro = 1;
-  tft.setTextSize(tsIntro);
-  tft.setTextColor(TFT_LIGHT_TEXT);
+  ziel.setTextSize(tsIntro);
+  ziel.setTextColor(TFT_LIGHT_TEXT);
   // Mehr Abstand unterhalb der Linie
   int16_t introY = lineY + 20;
-  tft.setCursor(20, introY);
-  tft.print(intro);
+  ziel.setCursor(20, introY);
+  ziel.print(intro);
 
   // --- Schritte ---
   const char* steps[4] = {
@@ -195,12 +276,12 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
     char numTxt[2] = { char('1' + i), '\0' };
     drawCenteredBox(numTxt, tsIntro, 20, boxY, stepBoxSize, stepBoxSize, TFT_HIGHLIGHT, TFT_BACKGROUND);
     // Beschreibung daneben (vertikal zentriert)
-    tft.setTextSize(tsIntro);
-    tft.setTextColor(TFT_TEXT);
+    ziel.setTextSize(tsIntro);
+    ziel.setTextColor(TFT_TEXT);
     int16_t txtH = 8 * tsIntro;
     int16_t txtY = boxY + (stepBoxSize - txtH) / 2;
-    tft.setCursor(40, txtY);
-    tft.print(steps[i]);
+    ziel.setCursor(40, txtY);
+    ziel.print(steps[i]);
     stepY += 20;
   }
 
@@ -209,131 +290,120 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
   const uint8_t tsFaktor = 1;
   int16_t faktW = strlen(faktorText) * 6 * tsFaktor;
   int16_t faktH = 8 * tsFaktor;
-  int16_t faktX = (tft.width() - faktW - 20) / 2;
-  int16_t faktY = tft.height() - 100; // Höher positioniert für Platz für Buttons
+  int16_t faktX = (ziel.width() - faktW - 20) / 2;
+  int16_t faktY = ziel.height() - 100; // Höher positioniert für Platz für Buttons
   drawCenteredBox(faktorText, tsFaktor, faktX, faktY, faktW + 20, faktH + 10, TFT_OUTLINE, TFT_SUBTITLE);
 
   // --- Buttons für Datenverwaltung ---
   // Button für gespeicherte Versuche
-  tft.fillRoundRect(20, tft.height() - 70, 210, 30, 5, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setTextSize(1);
-  tft.setCursor(30, tft.height() - 60);
-  tft.print("1: Gespeicherte Versuche");
+  ziel.fillRoundRect(20, ziel.height() - 70, 210, 30, 5, TFT_TITLE_BG);
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setTextSize(1);
+  ziel.setCursor(30, ziel.height() - 60);
+  ziel.print("1: Gespeicherte Versuche");
 
   // Button für Export
-  tft.fillRoundRect(250, tft.height() - 70, 210, 30, 5, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setTextSize(1);
-  tft.setCursor(260, tft.height() - 60);
-  tft.print("2: Daten exportieren");
+  ziel.fillRoundRect(250, ziel.height() - 70, 210, 30, 5, TFT_TITLE_BG);
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setTextSize(1);
+  ziel.setCursor(260, ziel.height() - 60);
+  ziel.print("2: Daten exportieren");
 
   // --- Steuerungshinweis ---
   const char* hint = "Druecken zum Starten";
   const uint8_t tsHint = 1;
   int16_t hintW = strlen(hint) * 6 * tsHint;
   int16_t hintH = 8 * tsHint;
-  int16_t hintX = (tft.width() - hintW - 20) / 2;
-  int16_t hintYpos = tft.height() - hintH - 35; // Höher positioniert
+  int16_t hintX = (ziel.width() - hintW - 20) / 2;
+  int16_t hintYpos = ziel.height() - hintH - 35; // Höher positioniert
   drawCenteredBox(hint, tsHint, hintX, hintYpos - 5, hintW + 20, hintH + 10, TFT_SUCCESS, TFT_TEXT);
 
   // --- Anleitung ---
-  zeichneStatusleiste("Druecken: Starten | 1: Gespeicherte Versuche | 2: Daten exportieren");
-
-  // --- Abschluss ---
-  maxCursorPosition = 0;
-  aktuellerModus = INTRO;
+  zeichneStatusleiste(ziel, "Druecken: Starten | 1: Gespeicherte Versuche | 2: Daten exportieren");
 }
 
- 
 /**
  * Zeigt den teilfaktoriellen Versuchsplan mit allen Faktoreinstellungen an
  */
  void WindTurbineExperiment::zeigeTeilfaktoriellPlan() {
-   tft.fillScreen(TFT_BACKGROUND);
-   
-   // Titelbereich
-   zeichneTitelbalken("Teilfaktorieller Versuchsplan (2^(5-2))");
-   
-   // Tabellenrahmen
-   tft.drawRoundRect(15, 48, 450, 190, 5, TFT_OUTLINE);
-   
-   // Spaltentrenner für Überschriften
-   for (int i = 0; i <= 5; i++) {
-     int x = 15 + i * 75;
-     tft.drawLine(x, 48, x, 70, TFT_GRID);
-   }
-   
-   // Faktoren als Spaltenüberschriften mit Hintergrund
-   tft.fillRect(15, 48, 450, 22, TFT_TITLE_BG);
-   tft.setTextSize(1);
-   tft.setTextColor(TFT_HIGHLIGHT);
+   beginneWidgetBildschirm("Teilfaktorieller Plan (2^(5-2))",
+                           "Druecken Sie den Drehknopf, um mit den Messungen zu beginnen.");
    
-   // Tabellenüberschriften
-   tft.setCursor(25, 55);
-   tft.print("Nr.");
+   // Tabelle: die 1px-Lücken zwischen den Zeilen bilden die Gitterlinien
+   int tabelle = widgets.fuegeHinzu(WIDGET_BOX, 15, 48, 450, 191);
+   widgets.setzeFarben(tabelle, TFT_TEXT, TFT_GRID);
+   widgets.setzeRadius(tabelle, 5);
    
+   // Faktoren als Spaltenüberschriften
+   char zeile[WIDGET_MAX_TEXT];
+   strcpy(zeile, "Nr.");
    for (int i = 0; i < 5; i++) {
-     tft.setCursor(55 + i * 75, 55);
+     strcat(zeile, "|");
      // Prüfen ob der Name zu lang ist und ggf. abkürzen
      if (strlen(faktorNamen[i]) > 9) {
-       char kurzname[10];
-       strncpy(kurzname, faktorNamen[i], 8);
-       kurzname[8] = '.';
-       kurzname[9] = '\0';
-       tft.print(kurzname);
+       strncat(zeile, faktorNamen[i], 8);
+       strcat(zeile, ".");
      } else {
-       tft.print(faktorNamen[i]);
+       strcat(zeile, faktorNamen[i]);
      }
    }
-   
-   // Zeilen zeichnen
-   for (int i = 0; i <= 8; i++) {
-     tft.drawLine(15, 70 + i * 21, 465, 70 + i * 21, TFT_GRID);
+   int kopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 16, 49, 448, 21, tabelle);
+   widgets.setzeFarben(kopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+   widgets.setzeText(kopf, zeile);
+   widgets.setzeSpalte(kopf, 0, 9);
+   for (int j = 0; j < 5; j++) {
+     widgets.setzeSpalte(kopf, j + 1, 39 + j * 75);
    }
    
-   // Tabelleninhalt
-   tft.setTextColor(TFT_TEXT);
+   // Tabelleninhalt: Nummer und erster Faktor (gerade Zeilen leicht abgedunkelt),
+   // daneben die übrigen Faktoren
    for (int i = 0; i < 8; i++) {
-     // Versuchsnummer mit Highlight für gerade/ungerade Zeilen
-     if (i % 2 == 0) {
-       tft.fillRect(16, 71 + i * 21, 74, 20, 0x1082); // Leicht abgedunkelter Hintergrund
-     }
-     tft.setCursor(25, 80 + i * 21);
-     tft.print(i + 1);
+     int links = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 16, 71 + i * 21, 74, 20, tabelle);
+     widgets.setzeFarben(links, TFT_TEXT, (i % 2 == 0) ? 0x1082 : TFT_BACKGROUND);
+     int rechts = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 90, 71 + i * 21, 374, 20, tabelle);
+     widgets.setzeFarben(rechts, TFT_TEXT, TFT_BACKGROUND);
+     
+     char linkerText[WIDGET_MAX_TEXT];
+     snprintf(linkerText, sizeof(linkerText), "%d|", i + 1);
+     widgets.setzeSpalte(links, 0, 9);
+     zeile[0] = '\0';
      
      // Faktorstufen
      for (int j = 0; j < 5; j++) {
-       tft.setCursor(55 + j * 75, 80 + i * 21);
+       int id = (j == 0) ? links : rechts;
+       int spalte = (j == 0) ? 1 : j - 1;
+       int16_t x = 39 + j * 75 - ((j == 0) ? 0 : 74);
+       char* text = (j == 0) ? linkerText : zeile;
+       if (j > 1) strcat(text, "|");
        if (teilfaktoriellPlan[i][j] == -1) {
-         tft.setTextColor(TFT_LIGHT_TEXT);
-         tft.print("-");
-         tft.print(faktorEinheitenNiedrig[j]);
+         strcat(text, "-");
+         strcat(text, faktorEinheitenNiedrig[j]);
+         widgets.setzeSpalte(id, spalte, x, TFT_LIGHT_TEXT);
        } else if (teilfaktoriellPlan[i][j] == 1) {
-         tft.setTextColor(TFT_HIGHLIGHT);
-         tft.print("+");
-         tft.print(faktorEinheitenHoch[j]);
+         strcat(text, "+");
+         strcat(text, faktorEinheitenHoch[j]);
+         widgets.setzeSpalte(id, spalte, x, TFT_HIGHLIGHT);
        } else {
-         tft.print("N/A");
+         strcat(text, "N/A");
+         widgets.setzeSpalte(id, spalte, x);
        }
-       tft.setTextColor(TFT_TEXT);
      }
+     widgets.setzeText(links, linkerText);
+     widgets.setzeText(rechts, zeile);
    }
    
    // Legende in einem Infokasten
-   tft.fillRoundRect(20, 245, 440, 40, 5, TFT_OUTLINE);
-   tft.setTextColor(TFT_LIGHT_TEXT);
-   tft.setCursor(30, 255);
-   tft.print("-: ");
-   tft.setTextColor(TFT_TEXT);
-   tft.print("niedrige Stufe  ");
-   tft.setTextColor(TFT_LIGHT_TEXT);
-   tft.print("+: ");
-   tft.setTextColor(TFT_HIGHLIGHT);
-   tft.print("hohe Stufe");
-   
-   // Anleitung
-   zeichneStatusleiste("Druecken Sie den Drehknopf, um mit den Messungen zu beginnen.");
+   int legendenBox = widgets.fuegeHinzu(WIDGET_BOX, 20, 245, 440, 40);
+   widgets.setzeFarben(legendenBox, TFT_TEXT, TFT_OUTLINE);
+   widgets.setzeRadius(legendenBox, 5);
+   int legende = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 30, 251, 420, 14, legendenBox);
+   widgets.setzeText(legende, "-: |niedrige Stufe|+: |hohe Stufe");
+   widgets.setzeSpalte(legende, 0, 0, TFT_LIGHT_TEXT);
+   widgets.setzeSpalte(legende, 1, 18, TFT_TEXT);
+   widgets.setzeSpalte(legende, 2, 114, TFT_LIGHT_TEXT);
+   widgets.setzeSpalte(legende, 3, 132, TFT_HIGHLIGHT);
+   
+   zeichneWidgetBildschirm();
    
    maxCursorPosition = 0;
    aktuellerModus = TEILFAKTORIELL_PLAN;
@@ -344,7 +414,16 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
  * Ermöglicht die Durchführung von 5 Messungen pro Versuch
  */
  void WindTurbineExperiment::zeigeTeilfaktoriellMessung() {
-   tft.fillScreen(TFT_BACKGROUND);
+   // Statischer Rahmen (Boxen, Überschriften, Faktornamen) aus dem Zwischenspeicher
+   // Zwischenstand der Effekte statt Messbildschirm
+   if (zwischenstandAnsicht) {
+     zeigeZwischenstand();
+     return;
+   }
+   
+   zeigeStatischenHintergrund(HINTERGRUND_TEIL_MESSUNG, [this](TFT_eSPI& ziel) {
+     zeichneTeilMessungHintergrund(ziel);
+   });
    
    // Titelbereich mit Versuchsinfo
    char titel[50];
@@ -355,196 +434,158 @@ void WindTurbineExperiment::zeichneMotorStatusBox() {
    tft.fillRoundRect(380, 15, 90, 20, 5, TFT_TITLE_BG);
    tft.fillRect(382, 17, (aktuellerVersuch * 86) / 8, 16, TFT_HIGHLIGHT);
    
-   // Bereich für Faktoreinstellungen - breiter für den Text
-   tft.fillRoundRect(15, 50, 210, 140, 5, TFT_OUTLINE);
-   
-   // Überschrift - mit Zeilenumbruch für bessere Lesbarkeit
-   tft.setTextSize(1);
-   tft.setTextColor(TFT_HIGHLIGHT);
-   tft.setCursor(25, 60);
-   tft.print("Bitte stellen Sie");
-   tft.setCursor(25, 72);
-   tft.print("folgende Werte ein:");
-   
-   // Faktoren mit visueller Hervorhebung
-   tft.setTextColor(TFT_TEXT);
+   // Faktorwerte als Widgets (hinter "Faktorname: " aus dem Hintergrund)
+   // mit Kennzeichnung der Stufe
    for (int i = 0; i < 5; i++) {
      int y = 85 + i * 20;
+     int16_t x = 25 + (strlen(faktorNamen[i]) + 2) * 6;
+     int stufe = teilfaktoriellPlan[aktuellerVersuch][i];
+     if (stufe != -1 && stufe != 1) continue;
      
-     // Faktorname
-     tft.setCursor(25, y);
-     tft.print(faktorNamen[i]);
-     tft.print(": ");
+     int wert = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, x, y - 2, 220 - x, 15);
+     widgets.setzeFarben(wert, (stufe == 1) ? TFT_HIGHLIGHT : TFT_LIGHT_TEXT, TFT_OUTLINE);
+     widgets.setzeText(wert, (stufe == 1) ? faktorEinheitenHoch[i] : faktorEinheitenNiedrig[i]);
      
-     // Wert mit farbiger Kennzeichnung
-     if (teilfaktoriellPlan[aktuellerVersuch][i] == -1) {
-       tft.setTextColor(TFT_LIGHT_TEXT);
-       tft.print(faktorEinheitenNiedrig[i]);
-       // Visuelle Kennzeichnung "niedrig"
-       tft.fillRoundRect(175, y-2, 40, 15, 3, 0x1082);
-       tft.setCursor(183, y);
-       tft.print("(-)");
-     } else if (teilfaktoriellPlan[aktuellerVersuch][i] == 1) {
-       tft.setTextColor(TFT_HIGHLIGHT);
-       tft.print(faktorEinheitenHoch[i]);
-       // Visuelle Kennzeichnung "hoch"
-       tft.fillRoundRect(175, y-2, 40, 15, 3, 0x04FF);
-       tft.setCursor(183, y);
-       tft.print("(+)");
-     }
-     tft.setTextColor(TFT_TEXT);
+     int kennung = widgets.fuegeHinzu(WIDGET_BOX, 175, y - 2, 40, 15, wert);
+     widgets.setzeFarben(kennung, (stufe == 1) ? TFT_HIGHLIGHT : TFT_LIGHT_TEXT, (stufe == 1) ? 0x04FF : 0x1082);
+     widgets.setzeRadius(kennung, 3);
+     widgets.setzeText(kennung, (stufe == 1) ? "(+)" : "(-)");
    }
+   widgets.zeichne();
    
-   // Bereich für Messungen
-   tft.fillRoundRect(235, 50, 230, 140, 5, TFT_OUTLINE);
-   
-   // Überschrift
-   tft.setTextColor(TFT_HIGHLIGHT);
-   tft.setCursor(245, 60);
-   tft.println("Durchgefuehrte Messungen:");
-   
-   // Messungen mit Fortschrittsanzeige
-   tft.setTextColor(TFT_TEXT);
-   for (int i = 0; i < 5; i++) {
-     int y = 85 + i * 20;
-     tft.setCursor(245, y);
-     tft.print("Messung ");
-     tft.print(i + 1);
-     tft.print(": ");
-     
-     // Messwert oder Platzhalter
-     if (i < aktuelleMessung) {
-       // Leistungswert mit Messwert-Rahmen
-       tft.fillRoundRect(320, y-2, 95, 15, 3, TFT_SUCCESS);
-       tft.setTextColor(TFT_TEXT);
-       tft.setCursor(325, y);
-       tft.print(teilfaktoriellMessungen[aktuellerVersuch][i], 2);
-       tft.print(" uW");
-     } else {
-       // Noch nicht gemessen
-       tft.drawRoundRect(320, y-2, 95, 15, 3, TFT_GRID);
-       tft.setCursor(350, y);
-       tft.print("---");
-     }
-   }
+   // Messwerte oder Platzhalter (als Sprite, wird nach jeder Messung einzeln aktualisiert)
+   zeichneMesswertTabelle(true);
    
-   // Aktuelle Ergebnisse - Mittelwert nur anzeigen, wenn er nicht später berechnet werden soll
-   if (aktuelleMessung > 0) {
-     tft.fillRoundRect(15, 200, 450, 60, 5, TFT_OUTLINE);
-     
-     // Messfortschritt immer anzeigen
-     tft.setTextColor(TFT_SUBTITLE);
-     tft.setCursor(25, 235);
-     tft.print("Messfortschritt: ");
-     
-     // Balken für Messfortschritt
-     tft.drawRect(170, 232, 250, 15, TFT_GRID);
-     tft.fillRect(172, 234, (aktuelleMessung * 246) / 5, 11, TFT_SUCCESS);
-     
-     // Zahlenwert des Fortschritts
-     tft.setTextColor(TFT_TEXT);
-     tft.setCursor(425, 235);
-     tft.print(aktuelleMessung);
-     tft.print("/5");
-     
-     // Mittelwert anzeigen, außer bei Versuchen, wo der Benutzer später den Mittelwert berechnen soll
-     if (aktuellerVersuch != 1 && aktuellerVersuch != 4 && aktuellerVersuch != 6) {
-       tft.setTextColor(TFT_SUBTITLE);
-       tft.setCursor(25, 210);
-       tft.print("Aktueller Mittelwert: ");
-       
-       float summe = 0;
-       for (int i = 0; i < aktuelleMessung; i++) {
-         summe += teilfaktoriellMessungen[aktuellerVersuch][i];
-       }
-       float mittelwert = summe / aktuelleMessung;
-       
-       // Mittelwert mit hervorgehobenem Bereich
-       tft.fillRoundRect(170, 207, 80, 18, 3, TFT_HIGHLIGHT);
-       tft.setTextColor(TFT_TEXT);
-       tft.setCursor(175, 210);
-       tft.print(mittelwert, 2);
-       tft.print(" uW");
-     }
-     
-   }
+   // Messfortschritt, Mittelwert und Live-Leistung in der Ergebnis-Box
+   zeichneMessfortschritt(true);
+   zeichneMittelwertAnzeige(true);
+   zeichneLiveLeistung(true, letzteLiveLeistung);
    
-   // Keypad-Hilfe
-   tft.fillRoundRect(15, 270, 450, 30, 5, TFT_SUBTITLE);
-   tft.setTextColor(TFT_TEXT);
-   tft.setCursor(20, 280);
-   tft.println("Keypad: # = Messung wiederholen, * = Letzte Messung loeschen");
+   // Laufendes Leistungsdiagramm
+   leistungsDiagramm.zeichneVollstaendig(15, leistungsDiagrammY(true));
    
-   // Anleitung je nach Status
-   if (aktuelleMessung < 5) {
-     zeichneStatusleiste("Druecken Sie den Drehknopf, um eine Messung durchzufuehren.");
-   } else {
-     zeichneStatusleiste("Alle Messungen abgeschlossen. Druecken zum Fortfahren.");
-   }
+   // Anleitung je nach Status (mit Keypad-Hilfe)
+   zeichneMessStatusleiste(true);
    
    maxCursorPosition = 0;
    aktuellerModus = TEILFAKTORIELL_MESSUNG;
  }
  
+/**
+ * Zeichnet den statischen Teil des teilfaktoriellen Messbildschirms
+ * Enthält nur Inhalte, die für alle Versuche gleich sind
+ */
+void WindTurbineExperiment::zeichneTeilMessungHintergrund(TFT_eSPI& ziel) {
+  ziel.fillScreen(TFT_BACKGROUND);
+  
+  // Bereich für Faktoreinstellungen - breiter für den Text
+  ziel.fillRoundRect(15, 50, 210, 140, 5, TFT_OUTLINE);
+  
+  // Überschrift - mit Zeilenumbruch für bessere Lesbarkeit
+  ziel.setTextSize(1);
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setCursor(25, 60);
+  ziel.print("Bitte stellen Sie");
+  ziel.setCursor(25, 72);
+  ziel.print("folgende Werte ein:");
+  
+  // Faktornamen
+  ziel.setTextColor(TFT_TEXT);
+  for (int i = 0; i < 5; i++) {
+    ziel.setCursor(25, 85 + i * 20);
+    ziel.print(faktorNamen[i]);
+    ziel.print(": ");
+  }
+  
+  // Bereich für Messungen
+  ziel.fillRoundRect(235, 50, 230, 140, 5, TFT_OUTLINE);
+  
+  // Überschrift
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setCursor(245, 60);
+  ziel.println("Durchgefuehrte Messungen:");
+  
+  ziel.setTextColor(TFT_TEXT);
+  for (int i = 0; i < 5; i++) {
+    ziel.setCursor(245, 85 + i * 20);
+    ziel.print("Messung ");
+    ziel.print(i + 1);
+    ziel.print(": ");
+  }
+  
+  // Aktuelle Ergebnisse - Box immer anzeigen, damit die Live-Leistung Platz hat
+  ziel.fillRoundRect(15, 200, 450, 60, 5, TFT_OUTLINE);
+  
+  ziel.setTextColor(TFT_SUBTITLE);
+  ziel.setCursor(25, 235);
+  ziel.print("Messfortschritt: ");
+  
+  // Darunter liegt das laufende Leistungsdiagramm, die Keypad-Hilfe steht in der Statusleiste
+}
+ 
 /**
  * Zeigt die Auswertung des teilfaktoriellen Versuchs an
  * Stellt Mittelwerte, Standardabweichungen und Effekte dar
  */
 void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
-  tft.fillScreen(TFT_BACKGROUND);
+  beginneWidgetBildschirm("Teilfaktorieller Versuch: Ergebnisse",
+                          "Druecken: Vollfakt. Versuch | 5: ANOVA | 6: Halbnormal | 7: Faltung");
   
-  // Titelbereich
-  zeichneTitelbalken("Teilfaktorieller Versuch: Ergebnisse");
+  // Konfidenzintervalle aus den Einzelmessungen
+  aktualisiereAuswertung();
   
   // Ergebnistabelle
-  tft.fillRoundRect(10, 48, 230, 190, 5, TFT_OUTLINE);
+  int tabelle = widgets.fuegeHinzu(WIDGET_BOX, 10, 48, 230, 190);
+  widgets.setzeFarben(tabelle, TFT_TEXT, TFT_OUTLINE);
+  widgets.setzeRadius(tabelle, 5);
   
   // Tabellenüberschrift
-  tft.fillRect(11, 49, 228, 20, TFT_TITLE_BG);
-  tft.setTextSize(1);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setCursor(20, 55);
-  tft.print("Nr.");
-  tft.setCursor(50, 55);
-  tft.print("Mittelwert (uW)");
-  tft.setCursor(150, 55);
-  tft.print("Std.-Abw.");
-  
-  // Trennlinien
-  tft.drawLine(45, 49, 45, 238, TFT_GRID);
-  tft.drawLine(140, 49, 140, 238, TFT_GRID);
-  
-  // Mittelwerte und Standardabweichungen anzeigen
-  tft.setTextColor(TFT_TEXT);
+  int kopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 11, 49, 228, 20, tabelle);
+  widgets.setzeFarben(kopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+  widgets.setzeText(kopf, "Nr.|Mittel +/-KI|Std.-Abw.");
+  widgets.setzeSpalte(kopf, 0, 9);
+  widgets.setzeSpalte(kopf, 1, 39);
+  widgets.setzeSpalte(kopf, 2, 139);
+  
+  // Mittelwerte und Standardabweichungen, die Halbbreite des Konfidenzintervalls
+  // direkt hinter dem Mittelwert
+  char zeile[WIDGET_MAX_TEXT];
   for (int i = 0; i < 8; i++) {
-    int y = 78 + i * 20;
+    int id = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 11, 69 + i * 20, 228, 19, tabelle);
+    widgets.setzeFarben(id, TFT_TEXT, (i % 2 == 0) ? 0x1082 : TFT_OUTLINE);
     
-    // Zeilenhintergrund
-    if (i % 2 == 0) {
-      tft.fillRect(11, y-9, 228, 19, 0x1082);
+    char mittel[16];
+    snprintf(mittel, sizeof(mittel), "%.2f", teilfaktoriellMittelwerte[i]);
+    char ki[16] = "";
+    float halbbreite = teilAnalyse.versuchsHalbbreite(i);
+    if (halbbreite > 0) {
+      snprintf(ki, sizeof(ki), "+/-%.2f", halbbreite);
     }
-    
-    // Versuchsnummer
-    tft.setCursor(25, y);
-    tft.print(i + 1);
-    
-    // Mittelwert
-    tft.setCursor(60, y);
-    tft.print(teilfaktoriellMittelwerte[i], 2);
-    
-    // Standardabweichung
-    tft.setCursor(150, y);
-    tft.print(teilfaktoriellStandardabweichungen[i], 3);
+    snprintf(zeile, sizeof(zeile), "%d|%s|%s|%.3f", i + 1, mittel, ki, teilfaktoriellStandardabweichungen[i]);
+    widgets.setzeText(id, zeile);
+    widgets.setzeSpalte(id, 0, 14);
+    widgets.setzeSpalte(id, 1, 39);
+    widgets.setzeSpalte(id, 2, 39 + schrift.textBreite(mittel, 1), TFT_LIGHT_TEXT);
+    widgets.setzeSpalte(id, 3, 139);
   }
   
+  // Trennlinien (nach den Zeilen angelegt, damit sie darüber liegen)
+  int linie = widgets.fuegeHinzu(WIDGET_BOX, 45, 49, 1, 189, tabelle);
+  widgets.setzeFarben(linie, TFT_GRID, TFT_GRID);
+  linie = widgets.fuegeHinzu(WIDGET_BOX, 140, 49, 1, 189, tabelle);
+  widgets.setzeFarben(linie, TFT_GRID, TFT_GRID);
+  
   // ============ KORRIGIERTE HAUPTEFFEKTE-ANZEIGE MIT MEHR PLATZ ============
-  tft.fillRoundRect(245, 48, 235, 140, 5, TFT_OUTLINE); // Breiter: 220->235
+  int effektBox = widgets.fuegeHinzu(WIDGET_BOX, 245, 48, 235, 140);
+  widgets.setzeFarben(effektBox, TFT_TEXT, TFT_OUTLINE);
+  widgets.setzeRadius(effektBox, 5);
   
   // Überschrift
-  tft.fillRect(246, 49, 233, 20, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setCursor(320, 55);
-  tft.println("Haupteffekte");
+  int effektKopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 246, 49, 233, 20, effektBox);
+  widgets.setzeFarben(effektKopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+  snprintf(zeile, sizeof(zeile), "Haupteffekte (Aufl. %s)", WindTurbineAliasStruktur::aufloesungText(teilAlias.aufloesung()));
+  widgets.setzeText(effektKopf, zeile);
+  widgets.setzeSpalte(effektKopf, 0, 44);
   
   // Kurze Faktornamen definieren für bessere Darstellung
   const char* kurzeFaktorNamen[] = {"Steigung", "Groesse", "Abstand", "Luftst.", "Blattanz."};
@@ -557,91 +598,85 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
     }
   }
   
-  // VERBESSERTES LAYOUT: Name (feste Breite) - Wert - Balken
+  // VERBESSERTES LAYOUT: Name (feste Breite) - Wert - Aliase - Balken
   for (int i = 0; i < 5; i++) {
-    int y = 80 + i * 20;
-    
-    // Zeilenhintergrund für bessere Lesbarkeit
-    if (i % 2 == 0) {
-      tft.fillRect(246, y-9, 233, 19, 0x1082);
-    }
-    
-    // 1. Faktorname (links, feste Breite)
-    tft.setTextColor(TFT_TEXT);
-    tft.setCursor(255, y);
-    tft.print(kurzeFaktorNamen[i]);
-    tft.print(":");
-    
-    // 2. Effektwert (mitte) - genug Abstand zum Namen
-    tft.setCursor(330, y); // Weiter rechts verschoben: 320->330
-    if (effekte[i] >= 0) {
-      tft.setTextColor(TFT_SUCCESS);
-      tft.print("+");
-    } else {
-      tft.setTextColor(TFT_WARNING);
-    }
-    tft.print(effekte[i], 2);
-    tft.print("uW"); // Einheit hinzugefügt
-    tft.setTextColor(TFT_TEXT);
+    int y = 71 + i * 20;
+    int id = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 246, y, 233, 19, effektBox);
+    widgets.setzeFarben(id, TFT_TEXT, (i % 2 == 0) ? 0x1082 : TFT_OUTLINE);
     
-    // 3. Balken für relative Stärke (ganz rechts)
-    int balkenBreite = maxEffektBetrag > 0 ? (abs(effekte[i]) / maxEffektBetrag) * 50 : 0;
-    if (balkenBreite < 3 && effekte[i] != 0) balkenBreite = 3; // Mindestbreite
+    // Vermengte Zweifach-Wechselwirkungen, z.B. "=BD=CE"
+    char kette[16];
+    teilAlias.formatiereKette(1u << i, kette, sizeof(kette), 2);
+    const char* aliase = strchr(kette, '=');
     
-    int balkenStart = 420; // Noch weiter rechts: 380->420
+    snprintf(zeile, sizeof(zeile), "%s:|%s%.2fuW|%s", kurzeFaktorNamen[i], (effekte[i] >= 0) ? "+" : "",
+             effekte[i], (aliase != nullptr) ? aliase : "");
+    widgets.setzeText(id, zeile);
+    widgets.setzeSpalte(id, 0, 9);
+    widgets.setzeSpalte(id, 1, 84, (effekte[i] >= 0) ? TFT_SUCCESS : TFT_WARNING);
+    widgets.setzeSpalte(id, 2, 138, TFT_LIGHT_TEXT);
     
-    if (effekte[i] > 0) {
-      tft.fillRect(balkenStart, y-7, balkenBreite, 14, TFT_SUCCESS);
-    } else if (effekte[i] < 0) {
-      tft.fillRect(balkenStart, y-7, balkenBreite, 14, TFT_WARNING);
-    }
+    // Balken für relative Stärke (ganz rechts), mit Rahmen für bessere Sichtbarkeit
+    if (effekte[i] == 0) continue;
+    int balkenBreite = maxEffektBetrag > 0 ? (abs(effekte[i]) / maxEffektBetrag) * 40 : 0;
+    if (balkenBreite < 3) balkenBreite = 3; // Mindestbreite
     
-    // Rahmen um Balken für bessere Sichtbarkeit
-    if (effekte[i] != 0) {
-      tft.drawRect(balkenStart, y-7, balkenBreite, 14, TFT_GRID);
-    }
+    int balken = widgets.fuegeHinzu(WIDGET_BOX, 430, y + 2, balkenBreite, 14, id);
+    widgets.setzeFarben(balken, TFT_TEXT, (effekte[i] > 0) ? TFT_SUCCESS : TFT_WARNING);
+    widgets.setzeAkzent(balken, TFT_GRID);
+    widgets.setzeAusgewaehlt(balken, true);
   }
   
+  // Konfidenzintervall der Effekte (gleich für alle Spalten des Plans)
+  if (teilAnalyse.konfidenzHalbbreite() > 0) {
+    snprintf(zeile, sizeof(zeile), "KI %d%%: Effekt +/-%.2fuW (FG %d)", KONFIDENZ_NIVEAU,
+             teilAnalyse.konfidenzHalbbreite(), teilAnalyse.freiheitsgrade());
+  } else {
+    strcpy(zeile, "KI: keine Wiederholungen");
+  }
+  int kiZeile = widgets.fuegeHinzu(WIDGET_TEXT, 255, 173, 220, 12, effektBox);
+  widgets.setzeFarben(kiZeile, TFT_LIGHT_TEXT, TFT_OUTLINE);
+  widgets.setzeText(kiZeile, zeile);
+  
   // Ausgewählte Faktoren
-  tft.fillRoundRect(245, 198, 235, 40, 5, TFT_SUCCESS); // Angepasst an neue Breite
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(255, 208);
-  tft.println("Ausgewaehlte Faktoren:");
+  int auswahlBox = widgets.fuegeHinzu(WIDGET_BOX, 245, 198, 235, 40);
+  widgets.setzeFarben(auswahlBox, TFT_TEXT, TFT_SUCCESS);
+  widgets.setzeRadius(auswahlBox, 5);
+  int auswahlTitel = widgets.fuegeHinzu(WIDGET_TEXT, 255, 205, 220, 12, auswahlBox);
+  widgets.setzeFarben(auswahlTitel, TFT_TEXT, TFT_SUCCESS);
+  widgets.setzeText(auswahlTitel, "Ausgewaehlte Faktoren:");
   
-  // Faktornamen
-  tft.setCursor(255, 223);
+  zeile[0] = '\0';
   for (int i = 0; i < 3; i++) {
-    if (i > 0) tft.print(", ");
-    tft.print(faktorNamen[ausgewaehlteVollfaktoren[i]]);
+    if (i > 0) strcat(zeile, ", ");
+    strcat(zeile, faktorNamen[ausgewaehlteVollfaktoren[i]]);
   }
+  int auswahlNamen = widgets.fuegeHinzu(WIDGET_TEXT, 255, 220, 220, 12, auswahlBox);
+  widgets.setzeFarben(auswahlNamen, TFT_TEXT, TFT_SUCCESS);
+  widgets.setzeText(auswahlNamen, zeile);
   
   // Diagramm-Optionen-Box
-  tft.fillRoundRect(10, 248, 470, 50, 5, TFT_OUTLINE); // Breiter für neue Box-Breite
+  int optionen = widgets.fuegeHinzu(WIDGET_BOX, 10, 248, 470, 50);
+  widgets.setzeFarben(optionen, TFT_TEXT, TFT_OUTLINE);
+  widgets.setzeRadius(optionen, 5);
   
-  // Optionen in einer Zeile mit visuellen Buttons
+  // Optionen in einer Zeile mit visuellen Buttons (zweizeilige Beschriftung)
+  const char* optionZeile1[] = {"1: Balken-", "2: Main", "3: Inter-", "4: Pareto-"};
+  const char* optionZeile2[] = {"diagramm", "Effects Plot", "action Plot", "diagramm"};
   for (int i = 0; i < 4; i++) {
-    tft.fillRoundRect(25 + i*115, 258, 105, 30, 5, TFT_TITLE_BG);
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(30 + i*115, 260);
-    
-    switch(i) {
-      case 0: tft.print("1: Balken-"); break;
-      case 1: tft.print("2: Main"); break;
-      case 2: tft.print("3: Inter-"); break;
-      case 3: tft.print("4: Pareto-"); break;
-    }
+    int knopf = widgets.fuegeHinzu(WIDGET_BOX, 25 + i * 115, 258, 105, 30, optionen);
+    widgets.setzeFarben(knopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+    widgets.setzeRadius(knopf, 5);
     
-    tft.setCursor(30 + i*115, 273);
-    switch(i) {
-      case 0: tft.print("diagramm"); break;
-      case 1: tft.print("Effects Plot"); break;
-      case 2: tft.print("action Plot"); break;
-      case 3: tft.print("diagramm"); break;
-    }
+    int oben = widgets.fuegeHinzu(WIDGET_TEXT, 30 + i * 115, 259, 95, 10, knopf);
+    widgets.setzeFarben(oben, TFT_HIGHLIGHT, TFT_TITLE_BG);
+    widgets.setzeText(oben, optionZeile1[i]);
+    int unten = widgets.fuegeHinzu(WIDGET_TEXT, 30 + i * 115, 272, 95, 10, knopf);
+    widgets.setzeFarben(unten, TFT_HIGHLIGHT, TFT_TITLE_BG);
+    widgets.setzeText(unten, optionZeile2[i]);
   }
   
-  // Anleitung
-  zeichneStatusleiste("Druecken: Vollfakt. Versuch");
+  zeichneWidgetBildschirm();
   
   maxCursorPosition = 0;
   aktuellerModus = TEILFAKTORIELL_AUSWERTUNG;
@@ -653,145 +688,97 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
  * Zeigt den vollfaktoriellen Versuchsplan mit den drei wichtigsten Faktoren an
  */
   void WindTurbineExperiment::zeigeVollfaktoriellPlan() {
-    tft.fillScreen(TFT_BACKGROUND);
-    
-    // Titelbereich
-    zeichneTitelbalken("Vollfaktorieller Versuchsplan (2^3)");
+    beginneWidgetBildschirm("Vollfaktorieller Versuchsplan (2^3)",
+                            "Druecken Sie den Drehknopf, um mit den Messungen zu beginnen.");
     
     // Fixierte Faktoren Sektion - kompakter
-    tft.fillRoundRect(20, 48, 440, 60, 5, TFT_OUTLINE);
-    tft.fillRect(21, 49, 438, 18, TFT_TITLE_BG);
-    tft.setTextSize(1);
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(30, 55);
-    tft.print("Fixierte Faktoren (konstant):");
-    
-    tft.setTextColor(TFT_TEXT);
-    int yPos = 72;
-    bool hatFixierteFaktoren = false;
-    String fixierteText = "";
+    int fixBox = widgets.fuegeHinzu(WIDGET_BOX, 20, 48, 440, 60);
+    widgets.setzeFarben(fixBox, TFT_TEXT, TFT_OUTLINE);
+    widgets.setzeRadius(fixBox, 5);
+    int fixKopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 21, 49, 438, 18, fixBox);
+    widgets.setzeFarben(fixKopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+    widgets.setzeText(fixKopf, "Fixierte Faktoren (konstant):");
+    widgets.setzeSpalte(fixKopf, 0, 9);
     
+    char fixierteText[2 * WIDGET_MAX_TEXT] = "";
     for (int i = 0; i < 5; i++) {
       if (fixierteFaktorwerte[i] != 99) {
-        if (hatFixierteFaktoren) fixierteText += ", ";
-        fixierteText += faktorNamen[i];
-        fixierteText += "=";
-        if (fixierteFaktorwerte[i] == 1) {
-          fixierteText += faktorEinheitenHoch[i];
-        } else {
-          fixierteText += faktorEinheitenNiedrig[i];
-        }
-        hatFixierteFaktoren = true;
+        if (fixierteText[0] != '\0') strcat(fixierteText, ", ");
+        strcat(fixierteText, faktorNamen[i]);
+        strcat(fixierteText, "=");
+        strcat(fixierteText, fixierteFaktorwerte[i] == 1 ? faktorEinheitenHoch[i] : faktorEinheitenNiedrig[i]);
       }
     }
+    if (fixierteText[0] == '\0') strcpy(fixierteText, "Keine Faktoren fixiert");
     
-    if (!hatFixierteFaktoren) {
-      tft.setCursor(40, yPos);
-      tft.print("Keine Faktoren fixiert");
-    } else {
-      tft.setCursor(40, yPos);
-      tft.print(fixierteText);
-      if (fixierteText.length() > 50) {
-        // Text umbrechen falls zu lang
-        tft.setCursor(40, yPos + 15);
-        String zweiteTeil = fixierteText.substring(50);
-        tft.print(zweiteTeil);
-      }
+    // Text nach 50 Zeichen in der zweiten Zeile fortsetzen
+    char ersteZeile[WIDGET_MAX_TEXT];
+    strncpy(ersteZeile, fixierteText, 50);
+    ersteZeile[50] = '\0';
+    int fixZeile = widgets.fuegeHinzu(WIDGET_TEXT, 40, 68, 410, 16, fixBox);
+    widgets.setzeFarben(fixZeile, TFT_TEXT, TFT_OUTLINE);
+    widgets.setzeText(fixZeile, ersteZeile);
+    if (strlen(fixierteText) > 50) {
+      int fixZeile2 = widgets.fuegeHinzu(WIDGET_TEXT, 40, 83, 410, 16, fixBox);
+      widgets.setzeFarben(fixZeile2, TFT_TEXT, TFT_OUTLINE);
+      widgets.setzeText(fixZeile2, fixierteText + 50);
     }
     
-    // Vollfaktorieller Plan - korrekte Y-Position
-    tft.fillRoundRect(20, 118, 440, 170, 5, TFT_OUTLINE);
-    
-    // Tabellenüberschrift
-    tft.fillRect(21, 119, 438, 20, TFT_TITLE_BG);
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(30, 125);
-    tft.print("Nr.");
+    // Tabelle: die 1px-Lücken zwischen den Zeilen bilden die Gitterlinien
+    int tabelle = widgets.fuegeHinzu(WIDGET_BOX, 20, 118, 440, 167);
+    widgets.setzeFarben(tabelle, TFT_TEXT, TFT_GRID);
+    widgets.setzeRadius(tabelle, 5);
     
+    // Faktornamen als Spaltenüberschriften (gekürzt falls nötig)
+    char zeile[WIDGET_MAX_TEXT];
+    strcpy(zeile, "Nr.");
     for (int i = 0; i < 3; i++) {
       int faktorIndex = ausgewaehlteVollfaktoren[i];
-      tft.setCursor(70 + i * 120, 125);
-      // Faktorname kürzen falls nötig
+      strcat(zeile, "|");
       if (strlen(faktorNamen[faktorIndex]) > 9) {
-        char kurzname[10];
-        strncpy(kurzname, faktorNamen[faktorIndex], 8);
-        kurzname[8] = '.';
-        kurzname[9] = '\0';
-        tft.print(kurzname);
+        strncat(zeile, faktorNamen[faktorIndex], 8);
+        strcat(zeile, ".");
       } else {
-        tft.print(faktorNamen[faktorIndex]);
+        strcat(zeile, faktorNamen[faktorIndex]);
       }
     }
-    
-    // Vollfaktoriellen Plan erstellen
-    int vollfaktoriellPlan[8][5];
-    for (int i = 0; i < 8; i++) {
-      for (int j = 0; j < 5; j++) {
-        if (fixierteFaktorwerte[j] != 99) {
-          vollfaktoriellPlan[i][j] = fixierteFaktorwerte[j];
-        } else {
-          vollfaktoriellPlan[i][j] = 0;
-        }
-      }
+    int kopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 21, 119, 438, 20, tabelle);
+    widgets.setzeFarben(kopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+    widgets.setzeText(kopf, zeile);
+    widgets.setzeSpalte(kopf, 0, 9);
+    for (int j = 0; j < 3; j++) {
+      widgets.setzeSpalte(kopf, j + 1, 49 + j * 120);
     }
     
+    // Tabelleninhalt: Nummer links, Faktorstufen rechts der senkrechten Linie
     for (int i = 0; i < 8; i++) {
-      vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[0]] = (i & 1) ? 1 : -1;
-      vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[1]] = (i & 2) ? 1 : -1;
-      vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[2]] = (i & 4) ? 1 : -1;
-    }
-    
-    // Trennlinien - korrekte Positionen
-    for (int i = 0; i <= 8; i++) {
-      tft.drawLine(21, 139 + i * 18, 458, 139 + i * 18, TFT_GRID);
-    }
-    
-    tft.drawLine(60, 119, 60, 283, TFT_GRID);
-    tft.drawLine(180, 119, 180, 283, TFT_GRID);
-    tft.drawLine(300, 119, 300, 283, TFT_GRID);
-    
-    // Tabelleninhalt - korrekte Y-Positionen
-    tft.setTextColor(TFT_TEXT);
-    for (int i = 0; i < 8; i++) {
-      int y = 150 + i * 18;
+      uint16_t hintergrund = (i % 2 == 0) ? 0x1082 : TFT_OUTLINE;
+      int nummer = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 21, 140 + i * 18, 39, 17, tabelle);
+      widgets.setzeFarben(nummer, TFT_TEXT, hintergrund);
+      snprintf(zeile, sizeof(zeile), "%d", i + 1);
+      widgets.setzeText(nummer, zeile);
+      widgets.setzeSpalte(nummer, 0, 17);
       
-      if (i % 2 == 0) {
-        tft.fillRect(21, y-8, 438, 17, 0x1082);
-      }
-      
-      // Versuchsnummer
-      tft.setCursor(38, y);
-      tft.print(i + 1);
-      
-      // Faktorstufen
+      int stufen = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 61, 140 + i * 18, 398, 17, tabelle);
+      widgets.setzeFarben(stufen, TFT_TEXT, hintergrund);
+      zeile[0] = '\0';
       for (int j = 0; j < 3; j++) {
         int faktorIndex = ausgewaehlteVollfaktoren[j];
-        int x = 70 + j * 120;
-        
-        if (vollfaktoriellPlan[i][faktorIndex] == -1) {
-          tft.fillRoundRect(x, y-6, 12, 12, 3, 0x1082);
-          tft.setTextColor(TFT_LIGHT_TEXT);
-          tft.setCursor(x+3, y);
-          tft.print("-");
-          
-          tft.setTextColor(TFT_TEXT);
-          tft.setCursor(x+15, y);
-          tft.print(faktorEinheitenNiedrig[faktorIndex]);
-        } else if (vollfaktoriellPlan[i][faktorIndex] == 1) {
-          tft.fillRoundRect(x, y-6, 12, 12, 3, 0x04FF);
-          tft.setTextColor(TFT_HIGHLIGHT);
-          tft.setCursor(x+3, y);
-          tft.print("+");
-          
-          tft.setTextColor(TFT_TEXT);
-          tft.setCursor(x+15, y);
-          tft.print(faktorEinheitenHoch[faktorIndex]);
+        if (j > 0) strcat(zeile, "|");
+        if (vollfaktoriellPlan[i][j] == -1) {
+          strcat(zeile, "-");
+          strcat(zeile, faktorEinheitenNiedrig[faktorIndex]);
+          widgets.setzeSpalte(stufen, j, 9 + j * 120, TFT_LIGHT_TEXT);
+        } else {
+          strcat(zeile, "+");
+          strcat(zeile, faktorEinheitenHoch[faktorIndex]);
+          widgets.setzeSpalte(stufen, j, 9 + j * 120, TFT_HIGHLIGHT);
         }
       }
+      widgets.setzeText(stufen, zeile);
     }
     
-    // Anleitung
-    zeichneStatusleiste("Druecken Sie den Drehknopf, um mit den Messungen zu beginnen.");
+    zeichneWidgetBildschirm();
     
     maxCursorPosition = 0;
     aktuellerModus = VOLLFAKTORIELL_PLAN;
@@ -802,7 +789,10 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
  * Ermöglicht die Durchführung von 5 Messungen pro Versuch
  */
   void WindTurbineExperiment::zeigeVollfaktoriellMessung() {
-    tft.fillScreen(TFT_BACKGROUND);
+    // Statischer Rahmen (Boxen, Überschriften, Faktornamen) aus dem Zwischenspeicher
+    zeigeStatischenHintergrund(HINTERGRUND_VOLL_MESSUNG, [this](TFT_eSPI& ziel) {
+      zeichneVollMessungHintergrund(ziel);
+    });
     
     // Titelbereich mit Versuchsinfo
     char titel[50];
@@ -813,306 +803,199 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
     tft.fillRoundRect(380, 15, 90, 20, 5, TFT_TITLE_BG);
     tft.fillRect(382, 17, (aktuellerVersuch * 86) / 8, 16, TFT_HIGHLIGHT);
     
-    // Plan erstellen
-    int vollfaktoriellPlan[8][5];
-    for (int i = 0; i < 8; i++) {
-      for (int j = 0; j < 5; j++) {
-        if (fixierteFaktorwerte[j] != 99) {
-          vollfaktoriellPlan[i][j] = fixierteFaktorwerte[j];
-        } else {
-          vollfaktoriellPlan[i][j] = 0;
-        }
-      }
-    }
-    
-    for (int i = 0; i < 8; i++) {
-      vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[0]] = (i & 1) ? 1 : -1;
-      vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[1]] = (i & 2) ? 1 : -1;
-      vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[2]] = (i & 4) ? 1 : -1;
-    }
-    
-    // Faktoreinstellungen - erweitert für alle 5 Faktoren
-    tft.fillRoundRect(15, 50, 230, 150, 5, TFT_OUTLINE);
-    
-    tft.setTextSize(1);
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(25, 60);
-    tft.print("Alle Faktoreinstellungen:");
-    
-    tft.setTextColor(TFT_TEXT);
+    // Faktoreinstellungen als Widgets - Symbol und Wert hinter den Faktornamen,
+    // fixierte Faktoren mit Kennzeichnung
     for (int i = 0; i < 5; i++) {
       int y = 75 + i * 22;
+      bool fixiert = (fixierteFaktorwerte[i] != 99);
+      int stufe = fixiert ? fixierteFaktorwerte[i] : vollfaktoriellStufe(aktuellerVersuch, i);
+      if (stufe != -1 && stufe != 1) continue;
       
-      // Faktorname - gekürzt
-      tft.setCursor(25, y);
-      if (strlen(faktorNamen[i]) > 8) {
-        char kurzname[9];
-        strncpy(kurzname, faktorNamen[i], 7);
-        kurzname[7] = '.';
-        kurzname[8] = '\0';
-        tft.print(kurzname);
-      } else {
-        tft.print(faktorNamen[i]);
-      }
-      tft.print(": ");
+      int symbol = widgets.fuegeHinzu(WIDGET_BOX, 95, y - 3, 15, 12);
+      widgets.setzeFarben(symbol, TFT_TEXT, (stufe == 1) ? 0x04FF : 0x1082);
+      widgets.setzeRadius(symbol, 3);
+      int zeichen = widgets.fuegeHinzu(WIDGET_TEXT, 98, y - 2, 8, 10, symbol);
+      uint16_t zeichenFarbe = (stufe == -1) ? TFT_LIGHT_TEXT : (fixiert ? TFT_SUCCESS : TFT_HIGHLIGHT);
+      widgets.setzeFarben(zeichen, zeichenFarbe, (stufe == 1) ? 0x04FF : 0x1082);
+      widgets.setzeText(zeichen, (stufe == 1) ? "+" : "-");
       
-      // Korrigierte Positionen für Symbole und Text
-      if (fixierteFaktorwerte[i] != 99) {
-        // Fixierter Faktor
-        if (fixierteFaktorwerte[i] == -1) {
-          tft.fillRoundRect(95, y-3, 15, 12, 3, 0x1082);
-          tft.setTextColor(TFT_LIGHT_TEXT);
-          tft.setCursor(98, y);
-          tft.print("-");
-          
-          tft.setTextColor(TFT_TEXT);
-          tft.setCursor(115, y);
-          tft.print(faktorEinheitenNiedrig[i]);
-          
-          tft.setTextColor(TFT_LIGHT_TEXT);
-          tft.setCursor(180, y);
-          tft.print("(fix)");
-        } else {
-          tft.fillRoundRect(95, y-3, 15, 12, 3, 0x04FF);
-          tft.setTextColor(TFT_SUCCESS);
-          tft.setCursor(98, y);
-          tft.print("+");
-          
-          tft.setTextColor(TFT_TEXT);
-          tft.setCursor(115, y);
-          tft.print(faktorEinheitenHoch[i]);
-          
-          tft.setTextColor(TFT_LIGHT_TEXT);
-          tft.setCursor(180, y);
-          tft.print("(fix)");
-        }
-      } else {
-        // Variabler Faktor
-        if (vollfaktoriellPlan[aktuellerVersuch][i] == -1) {
-          tft.fillRoundRect(95, y-3, 15, 12, 3, 0x1082);
-          tft.setTextColor(TFT_LIGHT_TEXT);
-          tft.setCursor(98, y);
-          tft.print("-");
-          
-          tft.setTextColor(TFT_TEXT);
-          tft.setCursor(115, y);
-          tft.print(faktorEinheitenNiedrig[i]);
-        } else if (vollfaktoriellPlan[aktuellerVersuch][i] == 1) {
-          tft.fillRoundRect(95, y-3, 15, 12, 3, 0x04FF);
-          tft.setTextColor(TFT_HIGHLIGHT);
-          tft.setCursor(98, y);
-          tft.print("+");
-          
-          tft.setTextColor(TFT_TEXT);
-          tft.setCursor(115, y);
-          tft.print(faktorEinheitenHoch[i]);
-        }
-      }
-      tft.setTextColor(TFT_TEXT);
+      char zeile[WIDGET_MAX_TEXT];
+      snprintf(zeile, sizeof(zeile), "%s|%s", (stufe == 1) ? faktorEinheitenHoch[i] : faktorEinheitenNiedrig[i],
+               fixiert ? "(fix)" : "");
+      int wert = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 112, y - 2, 125, 12);
+      widgets.setzeFarben(wert, TFT_TEXT, TFT_OUTLINE);
+      widgets.setzeText(wert, zeile);
+      widgets.setzeSpalte(wert, 0, 3);
+      widgets.setzeSpalte(wert, 1, 68, TFT_LIGHT_TEXT);
     }
+    widgets.zeichne();
     
-    // Messungen - Position angepasst
-    tft.fillRoundRect(255, 50, 210, 150, 5, TFT_OUTLINE);
+    // Messwerte oder Platzhalter (als Sprite)
+    zeichneMesswertTabelle(false);
     
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(265, 60);
-    tft.println("Durchgefuehrte Messungen:");
+    // Messfortschritt, Mittelwert und Live-Leistung in der Ergebnis-Box
+    zeichneMessfortschritt(false);
+    zeichneMittelwertAnzeige(false);
+    zeichneLiveLeistung(false, letzteLiveLeistung);
     
-    tft.setTextColor(TFT_TEXT);
-    for (int i = 0; i < 5; i++) {
-      int y = 85 + i * 20;
-      tft.setCursor(265, y);
-      tft.print("Messung ");
-      tft.print(i + 1);
-      tft.print(": ");
-      
-      if (i < aktuelleMessung) {
-        tft.fillRoundRect(340, y-2, 95, 15, 3, TFT_SUCCESS);
-        tft.setTextColor(TFT_TEXT);
-        tft.setCursor(345, y);
-        tft.print(vollfaktoriellMessungen[aktuellerVersuch][i], 2);
-        tft.print(" uW");
-      } else {
-        tft.drawRoundRect(340, y-2, 95, 15, 3, TFT_GRID);
-        tft.setCursor(370, y);
-        tft.print("---");
-      }
-    }
+    // Laufendes Leistungsdiagramm
+    leistungsDiagramm.zeichneVollstaendig(15, leistungsDiagrammY(false));
     
-    // Rest der Funktion bleibt unverändert...
-    // (Aktuelle Ergebnisse, Keypad-Hilfe, Anleitung)
-    
-    if (aktuelleMessung > 0) {
-      tft.fillRoundRect(15, 210, 450, 60, 5, TFT_OUTLINE);
-      
-      tft.setTextColor(TFT_SUBTITLE);
-      tft.setCursor(25, 245);
-      tft.print("Messfortschritt: ");
-      
-      tft.drawRect(170, 242, 250, 15, TFT_GRID);
-      tft.fillRect(172, 244, (aktuelleMessung * 246) / 5, 11, TFT_SUCCESS);
-      
-      tft.setTextColor(TFT_TEXT);
-      tft.setCursor(425, 245);
-      tft.print(aktuelleMessung);
-      tft.print("/5");
-      
-      if (aktuelleMessung == 5 && aktuellerVersuch != 2 && aktuellerVersuch != 5) {
-        tft.setTextColor(TFT_SUBTITLE);
-        tft.setCursor(25, 220);
-        tft.print("Aktueller Mittelwert: ");
-        
-        float summe = 0;
-        for (int i = 0; i < aktuelleMessung; i++) {
-          summe += vollfaktoriellMessungen[aktuellerVersuch][i];
-        }
-        float mittelwert = summe / aktuelleMessung;
-        
-        tft.fillRoundRect(170, 217, 80, 18, 3, TFT_HIGHLIGHT);
-        tft.setTextColor(TFT_TEXT);
-        tft.setCursor(175, 220);
-        tft.print(mittelwert, 2);
-        tft.print(" uW");
-      }
-    }
-    
-    tft.fillRoundRect(15, 280, 450, 30, 5, TFT_SUBTITLE);
-    tft.setTextColor(TFT_TEXT);
-    tft.setCursor(20, 290);
-    tft.println("Keypad: # = Messung wiederholen, * = Letzte Messung loeschen");
-    
-    if (aktuelleMessung < 5) {
-      zeichneStatusleiste("Druecken Sie den Drehknopf, um eine Messung durchzufuehren.");
-    } else {
-      zeichneStatusleiste("Alle Messungen abgeschlossen. Druecken zum Fortfahren.");
-    }
+    // Anleitung je nach Status (mit Keypad-Hilfe)
+    zeichneMessStatusleiste(false);
     
     maxCursorPosition = 0;
     aktuellerModus = VOLLFAKTORIELL_MESSUNG;
   }
  
+/**
+ * Zeichnet den statischen Teil des vollfaktoriellen Messbildschirms
+ * Enthält nur Inhalte, die für alle Versuche gleich sind
+ */
+void WindTurbineExperiment::zeichneVollMessungHintergrund(TFT_eSPI& ziel) {
+  ziel.fillScreen(TFT_BACKGROUND);
+  
+  // Faktoreinstellungen - erweitert für alle 5 Faktoren
+  ziel.fillRoundRect(15, 50, 230, 150, 5, TFT_OUTLINE);
+  
+  ziel.setTextSize(1);
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setCursor(25, 60);
+  ziel.print("Alle Faktoreinstellungen:");
+  
+  ziel.setTextColor(TFT_TEXT);
+  for (int i = 0; i < 5; i++) {
+    // Faktorname - gekürzt
+    ziel.setCursor(25, 75 + i * 22);
+    if (strlen(faktorNamen[i]) > 8) {
+      char kurzname[9];
+      strncpy(kurzname, faktorNamen[i], 7);
+      kurzname[7] = '.';
+      kurzname[8] = '\0';
+      ziel.print(kurzname);
+    } else {
+      ziel.print(faktorNamen[i]);
+    }
+    ziel.print(": ");
+  }
+  
+  // Messungen - Position angepasst
+  ziel.fillRoundRect(255, 50, 210, 150, 5, TFT_OUTLINE);
+  
+  ziel.setTextColor(TFT_HIGHLIGHT);
+  ziel.setCursor(265, 60);
+  ziel.println("Durchgefuehrte Messungen:");
+  
+  ziel.setTextColor(TFT_TEXT);
+  for (int i = 0; i < 5; i++) {
+    ziel.setCursor(265, 85 + i * 20);
+    ziel.print("Messung ");
+    ziel.print(i + 1);
+    ziel.print(": ");
+  }
+  
+  // Ergebnis-Box immer anzeigen, damit die Live-Leistung Platz hat
+  ziel.fillRoundRect(15, 210, 450, 60, 5, TFT_OUTLINE);
+  
+  ziel.setTextColor(TFT_SUBTITLE);
+  ziel.setCursor(25, 245);
+  ziel.print("Messfortschritt: ");
+  
+  // Darunter liegt das laufende Leistungsdiagramm, die Keypad-Hilfe steht in der Statusleiste
+}
+ 
 /**
  * Zeigt die Auswertung des vollfaktoriellen Versuchs an
  * Stellt Mittelwerte, Standardabweichungen und Faktoreinstellungen dar
  */
  void WindTurbineExperiment::zeigeVollfaktoriellAuswertung() {
-   tft.fillScreen(TFT_BACKGROUND);
+   beginneWidgetBildschirm("Vollfaktorieller Versuch: Ergebnisse", "Druecken: Regression");
    
-   // Titelbereich
-   zeichneTitelbalken("Vollfaktorieller Versuch: Ergebnisse");
+   // Konfidenzintervalle aus den Einzelmessungen
+   aktualisiereAuswertung();
    
-   // Ergebnistabelle - Höhe reduziert um die 8. Zeile anzupassen
-   tft.fillRoundRect(10, 48, 460, 150, 5, TFT_OUTLINE);
-   
-   // Tabellenüberschrift
-   tft.fillRect(11, 49, 458, 20, TFT_TITLE_BG);
-   tft.setTextSize(1);
-   tft.setTextColor(TFT_HIGHLIGHT);
-   tft.setCursor(20, 55);
-   tft.print("Nr.");
-   tft.setCursor(50, 55);
-  tft.print("Mittelwert (uW)");
-   tft.setCursor(170, 55);
-   tft.print("Std.-Abw.");
-   tft.setCursor(280, 55);
-   tft.print("Faktoreinstellungen");
-   
-   // Trennlinien
-   tft.drawLine(45, 49, 45, 197, TFT_GRID);
-   tft.drawLine(140, 49, 140, 197, TFT_GRID);
-   tft.drawLine(260, 49, 260, 197, TFT_GRID);
-   
-   // Vollfaktorieller Plan erstellen
-   int vollfaktoriellPlan[8][5];
-   for (int i = 0; i < 8; i++) {
-     for (int j = 0; j < 5; j++) {
-       vollfaktoriellPlan[i][j] = 0;
-     }
-   }
-   
-   for (int i = 0; i < 8; i++) {
-     vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[0]] = (i & 1) ? 1 : -1;
-     vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[1]] = (i & 2) ? 1 : -1;
-     vollfaktoriellPlan[i][ausgewaehlteVollfaktoren[2]] = (i & 4) ? 1 : -1;
-   }
-   
-   // Mittelwerte und Standardabweichungen anzeigen - kompakter Layout
-   tft.setTextColor(TFT_TEXT);
-   for (int i = 0; i < 8; i++) {
-     int y = 80 + i * 17; // Reduzierte Zeilenhöhe von 20 auf 17
-     
-     // Zeilenhintergrund
-     if (i % 2 == 0) {
-       tft.fillRect(11, y-8, 458, 16, 0x1082);
-     }
-     
-     // Versuchsnummer
-     tft.setCursor(25, y);
-     tft.print(i + 1);
-     
-     // Mittelwert
-     tft.setCursor(60, y);
-     tft.print(vollfaktoriellMittelwerte[i], 2);
+   // Ergebnistabelle - Höhe reduziert um die 8. Zeile anzupassen
+   int tabelle = widgets.fuegeHinzu(WIDGET_BOX, 10, 48, 460, 150);
+   widgets.setzeFarben(tabelle, TFT_TEXT, TFT_OUTLINE);
+   widgets.setzeRadius(tabelle, 5);
+   
+   // Tabellenüberschrift
+   int kopf = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 11, 49, 458, 20, tabelle);
+   widgets.setzeFarben(kopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+   widgets.setzeText(kopf, "Nr.|Mittel +/-KI|Std.-Abw.|Faktoreinstellungen");
+   widgets.setzeSpalte(kopf, 0, 9);
+   widgets.setzeSpalte(kopf, 1, 39);
+   widgets.setzeSpalte(kopf, 2, 159);
+   widgets.setzeSpalte(kopf, 3, 269);
+   
+   // Mittelwerte und Standardabweichungen - kompakter Layout (Zeilenhöhe 17)
+   char zeile[WIDGET_MAX_TEXT];
+   for (int i = 0; i < 8; i++) {
+     int y = 72 + i * 17;
+     int id = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 11, y, 458, 16, tabelle);
+     widgets.setzeFarben(id, TFT_TEXT, (i % 2 == 0) ? 0x1082 : TFT_OUTLINE);
      
-     // Standardabweichung
-     tft.setCursor(170, y);
-     tft.print(vollfaktoriellStandardabweichungen[i], 3);
+     char mittel[16];
+     snprintf(mittel, sizeof(mittel), "%.2f", vollfaktoriellMittelwerte[i]);
+     char ki[16] = "";
+     float halbbreite = vollAnalyse.versuchsHalbbreite(i);
+     if (halbbreite > 0) {
+       snprintf(ki, sizeof(ki), "+/-%.2f", halbbreite);
+     }
+     snprintf(zeile, sizeof(zeile), "%d|%s|%s|%.3f", i + 1, mittel, ki, vollfaktoriellStandardabweichungen[i]);
+     widgets.setzeText(id, zeile);
+     widgets.setzeSpalte(id, 0, 14);
+     widgets.setzeSpalte(id, 1, 39);
+     widgets.setzeSpalte(id, 2, 39 + schrift.textBreite(mittel, 1), TFT_LIGHT_TEXT);
+     widgets.setzeSpalte(id, 3, 159);
      
-     // Faktoreinstellungen visualisieren
-     int xOffset = 280;
+     // Faktoreinstellungen als farbkodierte Kennzeichen
      for (int j = 0; j < 3; j++) {
-       int faktorIndex = ausgewaehlteVollfaktoren[j];
-       
-       // Farbkodierte Box für die Faktoreinstellung
-       if (vollfaktoriellPlan[i][faktorIndex] == -1) {
-         tft.fillRoundRect(xOffset, y-5, 20, 12, 3, 0x1082);
-         tft.setTextColor(TFT_LIGHT_TEXT);
-       } else {
-         tft.fillRoundRect(xOffset, y-5, 20, 12, 3, 0x04FF);
-         tft.setTextColor(TFT_HIGHLIGHT);
-       }
-       
-       // Symbol für die Stufe
-       tft.setCursor(xOffset+6, y);
-       tft.print(vollfaktoriellPlan[i][faktorIndex] == -1 ? "-" : "+");
-       tft.setTextColor(TFT_TEXT);
-       
-       // Nächste Position
-       xOffset += 50;
+       bool hoch = (vollfaktoriellPlan[i][j] != -1);
+       int kennung = widgets.fuegeHinzu(WIDGET_BOX, 280 + j * 50, y + 3, 20, 12, id);
+       widgets.setzeFarben(kennung, hoch ? TFT_HIGHLIGHT : TFT_LIGHT_TEXT, hoch ? 0x04FF : 0x1082);
+       widgets.setzeRadius(kennung, 3);
+       widgets.setzeText(kennung, hoch ? "+" : "-");
      }
    }
    
-   // Legende für Faktoreinstellungen - Position angepasst
-   tft.fillRoundRect(10, 208, 460, 20, 5, TFT_SUBTITLE);
-   tft.setTextColor(TFT_TEXT);
-   tft.setCursor(20, 212);
-   tft.print("Faktoren: ");
+   // Trennlinien (nach den Zeilen angelegt, damit sie darüber liegen)
+   const int16_t linienX[] = {45, 140, 260};
+   for (int i = 0; i < 3; i++) {
+     int linie = widgets.fuegeHinzu(WIDGET_BOX, linienX[i], 49, 1, 148, tabelle);
+     widgets.setzeFarben(linie, TFT_GRID, TFT_GRID);
+   }
    
-   int xOffset = 80;
+   // Legende für Faktoreinstellungen
+   int legendenBox = widgets.fuegeHinzu(WIDGET_BOX, 10, 208, 460, 20);
+   widgets.setzeFarben(legendenBox, TFT_TEXT, TFT_SUBTITLE);
+   widgets.setzeRadius(legendenBox, 5);
+   strcpy(zeile, "Faktoren:");
    for (int i = 0; i < 3; i++) {
-     int faktorIndex = ausgewaehlteVollfaktoren[i];
-     tft.setCursor(xOffset, 212);
-     tft.print(i+1);
-     tft.print("=");
-     tft.print(faktorNamen[faktorIndex]);
-     
-     xOffset += 120;
+     char eintrag[WIDGET_MAX_TEXT];
+     snprintf(eintrag, sizeof(eintrag), "|%d=%s", i + 1, faktorNamen[ausgewaehlteVollfaktoren[i]]);
+     strncat(zeile, eintrag, sizeof(zeile) - strlen(zeile) - 1);
+   }
+   int legende = widgets.fuegeHinzu(WIDGET_TABELLENZEILE, 20, 210, 440, 16, legendenBox);
+   widgets.setzeFarben(legende, TFT_TEXT, TFT_SUBTITLE);
+   widgets.setzeText(legende, zeile);
+   for (int i = 0; i < 4; i++) {
+     widgets.setzeSpalte(legende, i, (i == 0) ? 0 : 60 + (i - 1) * 120);
    }
    
-   // Diagramm-Button - Position angepasst
-   tft.fillRoundRect(10, 235, 220, 30, 5, TFT_TITLE_BG);
-   tft.setTextColor(TFT_HIGHLIGHT);
-   tft.setCursor(15, 245);
-   tft.print("1 = Ergebnis-Diagramm");
+   // Diagramm-Button
+   int diagrammKnopf = widgets.fuegeHinzu(WIDGET_BOX, 10, 235, 220, 30);
+   widgets.setzeFarben(diagrammKnopf, TFT_HIGHLIGHT, TFT_TITLE_BG);
+   widgets.setzeRadius(diagrammKnopf, 5);
+   widgets.setzeText(diagrammKnopf, "1 = Ergebnis-Diagramm");
    
-   // Weiter-Button - Position angepasst
-   tft.fillRoundRect(240, 235, 230, 30, 5, TFT_SUCCESS);
-   tft.setTextColor(TFT_TEXT);
-   tft.setCursor(255, 245);
-   tft.print("Weiter zum Regressionsmodell");
+   // Weiter-Button
+   int weiterKnopf = widgets.fuegeHinzu(WIDGET_BOX, 240, 235, 230, 30);
+   widgets.setzeFarben(weiterKnopf, TFT_TEXT, TFT_SUCCESS);
+   widgets.setzeRadius(weiterKnopf, 5);
+   widgets.setzeText(weiterKnopf, "Weiter zum Regressionsmodell");
    
-   // Anleitung
-   zeichneStatusleiste("Druecken: Regression");
+   zeichneWidgetBildschirm();
    
    maxCursorPosition = 0;
    aktuellerModus = VOLLFAKTORIELL_AUSWERTUNG;
@@ -1163,7 +1046,8 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    tft.setTextColor(TFT_TEXT);
    
    // Konstantterm
-   float b0 = berechneRegressionsKoeffizient(0);
+   aktualisiereAuswertung();
+   float b0 = regression.koeffizient(0);
    tft.setCursor(30, 180);
    tft.print("b0 = ");
    
@@ -1175,7 +1059,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    // Faktorkoeffizienten
    for (int i = 0; i < 3; i++) {
      int faktorIndex = ausgewaehlteVollfaktoren[i];
-     float bi = berechneRegressionsKoeffizient(i + 1);
+     float bi = regression.koeffizient(i + 1);
      int y = 200 + i * 20;
      
      // Faktorname
@@ -1195,6 +1079,15 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
      
      tft.setCursor(145, y);
      tft.print(bi, 2);
+     
+     // Standardfehler (nur mit Reststreuung aus den Einzelmessungen)
+     if (regression.standardfehler(i + 1) > 0) {
+       tft.setTextColor(TFT_LIGHT_TEXT);
+       tft.setCursor(198, y);
+       tft.print("+-");
+       tft.print(regression.standardfehler(i + 1), 1);
+       tft.setTextColor(TFT_TEXT);
+     }
    }
    
    // Modellqualität-Bereich
@@ -1210,7 +1103,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    tft.setCursor(260, 180);
    tft.print("R^2 = ");
    
-   float r2 = berechneR2();
+   float r2 = constrain(regression.r2(), 0.0f, 1.0f);
    
    // R² farbig anzeigen nach Qualität
    if (r2 > 0.8) {
@@ -1224,6 +1117,14 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    tft.setCursor(315, 180);
    tft.print(r2, 3);
    
+   // Korrigiertes R² (berücksichtigt die Anzahl der Terme)
+   float r2Korr = constrain(regression.r2Korrigiert(), 0.0f, 1.0f);
+   tft.setCursor(372, 180);
+   tft.print("korr.");
+   tft.fillRoundRect(405, 177, 50, 15, 3, TFT_TITLE_BG);
+   tft.setCursor(410, 180);
+   tft.print(r2Korr, 3);
+   
    // Optimale Einstellungen - vergrößert für perfekte Passung
    tft.fillRoundRect(250, 205, 210, 85, 5, TFT_SUCCESS);
    
@@ -1235,7 +1136,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    // Faktoren und Empfehlungen - mehr Platz zwischen den Zeilen
    for (int i = 0; i < 3; i++) {
      int faktorIndex = ausgewaehlteVollfaktoren[i];
-     float koeff = berechneRegressionsKoeffizient(i + 1);
+     float koeff = regression.koeffizient(i + 1);
      int y = 235 + i * 20; // Mehr Abstand zwischen den Zeilen
      
      // Faktorname - gekürzt wenn zu lang
@@ -1266,7 +1167,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    }
    
    // Anleitung
-   zeichneStatusleiste("Druecken Sie den Drehknopf, um die Zusammenfassung anzuzeigen.");
+   zeichneStatusleiste("Druecken: Zusammenfassung | 1: Wirkungsflaeche (ZZP)");
    
    maxCursorPosition = 0;
    aktuellerModus = REGRESSION;
@@ -1274,9 +1175,72 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
  
 /**
  * Zeigt eine Zusammenfassung des gesamten Experiments an
- * Enthält Faktoren-Rangliste und optimale Einstellungen
+ * Berechnet vorher das Optimum und speichert den Versuch danach automatisch.
  */
  void WindTurbineExperiment::zeigeZusammenfassung() {
+   // Optimierung zuerst (eigener Fortschrittsbildschirm), danach die Zusammenfassung
+   berechnePrognose();
+   zeichneZusammenfassung();
+   
+   // Beim Render-Benchmark nicht speichern (Testdaten)
+   if (renderBenchmarkAktiv) {
+     maxCursorPosition = 0;
+     aktuellerModus = ZUSAMMENFASSUNG;
+     return;
+   }
+   
+   // Automatisches Speichern des Versuchs
+   char autoBeschreibung[100];
+   sprintf(autoBeschreibung, "Versuch %d", anzahlGespeicherteVersuche + 1);
+   
+   // Speichern mit Fehlerbehandlung
+   bool saveSuccess = dataManager.saveExperiment(autoBeschreibung, teilfaktoriellMessungen, 
+                            teilfaktoriellMittelwerte, teilfaktoriellStandardabweichungen,
+                            vollfaktoriellMessungen, vollfaktoriellMittelwerte, 
+                            vollfaktoriellStandardabweichungen, effekte, 
+                            ausgewaehlteVollfaktoren,
+                            zzpMessungen, zzpMittelwerte, zzpStandardabweichungen, wirkungsflaeche);
+   
+   // Speicherstatus anzeigen - nur kurz
+   if (saveSuccess) {
+     // Erfolgsmeldung kurz anzeigen
+     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_SUCCESS);
+     tft.setTextColor(TFT_TEXT);
+     tft.setTextSize(1);
+     tft.setCursor(130, 290);
+     tft.print("Versuch erfolgreich gespeichert");
+     
+     // Kurze Verzögerung, dann Meldung löschen
+     delay(1500);
+     
+     // Meldung übermalen mit Hintergrundfarbe
+     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_BACKGROUND);
+   } else {
+     // Fehlermeldung kurz anzeigen
+     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_WARNING);
+     tft.setTextColor(TFT_TEXT);
+     tft.setTextSize(1);
+     tft.setCursor(130, 290);
+     tft.print("Fehler beim Speichern!");
+     
+     // Kurze Verzögerung, dann Meldung löschen
+     delay(1500);
+     
+     // Meldung übermalen mit Hintergrundfarbe
+     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_BACKGROUND);
+   }
+   
+   maxCursorPosition = 0;
+   aktuellerModus = ZUSAMMENFASSUNG;
+ }
+ 
+/**
+ * Zeichnet die Zusammenfassung mit dem zuletzt berechneten Optimum
+ * Ohne Berechnung und Speichern, daher auch für das Neuzeichnen unter Overlays.
+ */
+ void WindTurbineExperiment::zeichneZusammenfassung() {
+   float prognose = optimierung.optimum();
+   
    tft.fillScreen(TFT_BACKGROUND);
    
    // Titelbereich
@@ -1375,28 +1339,29 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
      tft.setTextColor(TFT_TEXT);
      tft.setCursor(330, y);
      tft.print(faktorNamen[faktorIndex]);
-     tft.print(": ");
      
-     // Optimaler Wert mit farbiger Kennzeichnung
-     if (effekte[faktorIndex] > 0) {
+     // Optimaler Wert mit farbiger Kennzeichnung (Einheit muss in den Kasten passen)
+     // Stufe aus der Optimumsuche, ohne gültiges Optimum nach der Effektrichtung
+     float stufe = optimierung.istGueltig() ? optimierung.stufe(faktorIndex) : effekte[faktorIndex];
+     if (stufe > 0) {
        // Hohe Stufe ist optimal
-       tft.fillRoundRect(420, y-7, 15, 15, 3, 0x04FF);
+       tft.fillRoundRect(400, y-7, 15, 15, 3, 0x04FF);
        tft.setTextColor(TFT_HIGHLIGHT);
-       tft.setCursor(424, y);
+       tft.setCursor(404, y);
        tft.print("+");
        
        tft.setTextColor(TFT_TEXT);
-       tft.setCursor(440, y);
+       tft.setCursor(418, y);
        tft.print(faktorEinheitenHoch[faktorIndex]);
      } else {
        // Niedrige Stufe ist optimal
-       tft.fillRoundRect(420, y-7, 15, 15, 3, 0x1082);
+       tft.fillRoundRect(400, y-7, 15, 15, 3, 0x1082);
        tft.setTextColor(TFT_LIGHT_TEXT);
-       tft.setCursor(424, y);
+       tft.setCursor(404, y);
        tft.print("-");
        
        tft.setTextColor(TFT_TEXT);
-       tft.setCursor(440, y);
+       tft.setCursor(418, y);
        tft.print(faktorEinheitenNiedrig[faktorIndex]);
      }
    }
@@ -1407,61 +1372,23 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    // Überschrift
    tft.setTextColor(TFT_TEXT);
   
-   tft.setCursor(20, 240);
+   tft.setCursor(20, 235);
    tft.println("Vorhergesagte maximale Leistung bei optimalen Einstellungen:");
    
    // Wert - nur einmal anzeigen
-   float prognose = berechnePrognose();
    tft.setTextSize(2);
-   tft.setCursor(150, 245);
+   tft.setCursor(150, 249);
    tft.print(prognose, 2);
+   if (optimierung.halbbreite() > 0) {
+     tft.print(" +/- ");
+     tft.print(optimierung.halbbreite(), 2);
+   }
    tft.print(" uW");
    
    // Anleitung - Automatisches Speichern und Zurück zum Start
-   zeichneStatusleiste("Druecken: Zum Startbildschirm zurueckkehren");
-   
-   // Automatisches Speichern des Versuchs
-   char autoBeschreibung[100];
-   sprintf(autoBeschreibung, "Versuch %d", anzahlGespeicherteVersuche + 1);
-   
-   // Speichern mit Fehlerbehandlung
-   bool saveSuccess = dataManager.saveExperiment(autoBeschreibung, teilfaktoriellMessungen, 
-                            teilfaktoriellMittelwerte, teilfaktoriellStandardabweichungen,
-                            vollfaktoriellMessungen, vollfaktoriellMittelwerte, 
-                            vollfaktoriellStandardabweichungen, effekte, 
-                            ausgewaehlteVollfaktoren);
-   
-   // Speicherstatus anzeigen - nur kurz
-   if (saveSuccess) {
-     // Erfolgsmeldung kurz anzeigen
-     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_SUCCESS);
-     tft.setTextColor(TFT_TEXT);
-     tft.setTextSize(1);
-     tft.setCursor(130, 290);
-     tft.print("Versuch erfolgreich gespeichert");
-     
-     // Kurze Verzögerung, dann Meldung löschen
-     delay(1500);
-     
-     // Meldung übermalen mit Hintergrundfarbe
-     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_BACKGROUND);
-   } else {
-     // Fehlermeldung kurz anzeigen
-     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_WARNING);
-     tft.setTextColor(TFT_TEXT);
-     tft.setTextSize(1);
-     tft.setCursor(130, 290);
-     tft.print("Fehler beim Speichern!");
-     
-     // Kurze Verzögerung, dann Meldung löschen
-     delay(1500);
-     
-     // Meldung übermalen mit Hintergrundfarbe
-     tft.fillRoundRect(120, 280, 240, 30, 5, TFT_BACKGROUND);
-   }
-   
-   maxCursorPosition = 0;
-   aktuellerModus = ZUSAMMENFASSUNG;
+   zeichneStatusleiste(anzahlEingegebeneVerbote > 0
+     ? "Druecken: Start | 2: Einstellung nicht machbar | 3: alle erlauben"
+     : "Druecken: Start | 2: Einstellung am Stand nicht machbar");
  }
  
  // Moderne Feedback-Anzeige Hilfsfunktion
@@ -1469,17 +1396,15 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    tft.fillScreen(TFT_BACKGROUND);
    
    // Moderner Titelbereich mit Farbverlauf
-   if (korrekt) {
-     // Erfolg - Grün-Verlauf
-     for (int i = 0; i < 40; i++) {
-       uint16_t color = tft.color565(0, 100 + i*2, 20 + i);
-       tft.drawFastHLine(0, 20 + i, 480, color);
-     }
+   // Erfolg - Grün-Verlauf, Fehler - Orange-Verlauf
+   auto verlaufErfolg = [](int16_t i, void* k) -> uint16_t { return ((TFT_eSPI*)k)->color565(0, 100 + i*2, 20 + i); };
+   auto verlaufFehler = [](int16_t i, void* k) -> uint16_t { return ((TFT_eSPI*)k)->color565(150 + i, 80 + i/2, 0); };
+   ZeilenFarbe verlauf = korrekt ? (ZeilenFarbe)verlaufErfolg : (ZeilenFarbe)verlaufFehler;
+   if (dmaRenderer.istBereit() && !compositor.istReparaturAktiv()) {
+     dmaRenderer.fuelleZeilenweise(0, 20, 480, 40, verlauf, &tft);
    } else {
-     // Fehler - Orange-Verlauf
      for (int i = 0; i < 40; i++) {
-       uint16_t color = tft.color565(150 + i, 80 + i/2, 0);
-       tft.drawFastHLine(0, 20 + i, 480, color);
+       tft.drawFastHLine(0, 20 + i, 480, verlauf(i, &tft));
      }
    }
    
@@ -1621,9 +1546,11 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    } else {
      messungen = vollfaktoriellMessungen[versuchIndex];
    }
+   // Vorzeitig abgeschlossene Versuche haben weniger als 5 Messungen
+   int anzahl = WindTurbineKonfidenz::zaehleMessungen(messungen, 5);
    
    // Messwerte als Tabelle
-   for (int i = 0; i < 5; i++) {
+   for (int i = 0; i < anzahl; i++) {
      int y = 120 + i * 17;
      
      // Zellhintergrund
@@ -1726,7 +1653,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    float mittelwert = eingabe.toFloat();
    
    // Korrekten Mittelwert berechnen zum Vergleich
-   float korrekt = berechneMittelwert(messungen, 5);
+   float korrekt = berechneMittelwert(messungen, anzahl);
    
    // Prüfen und moderne Feedback-Anzeige
    bool istKorrekt = abs(mittelwert - korrekt) < 0.1;
@@ -1829,8 +1756,9 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    // Messungen anzeigen
    tft.setTextColor(TFT_TEXT);
    
-   // Messwerte als Tabelle
-   for (int i = 0; i < 5; i++) {
+   // Messwerte als Tabelle (vorzeitig abgeschlossene Versuche haben weniger als 5)
+   int anzahl = WindTurbineKonfidenz::zaehleMessungen(messungen, 5);
+   for (int i = 0; i < anzahl; i++) {
      int y = 120 + i * 17;
      
      // Zellhintergrund
@@ -1960,7 +1888,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    float std = eingabe.toFloat();
    
    // Korrekten Wert berechnen
-   float korrekt = berechneStandardabweichung(messungen, 5, mittelwert);
+   float korrekt = berechneStandardabweichung(messungen, anzahl, mittelwert);
    
    // Prüfen und moderne Feedback-Anzeige
    bool istKorrekt = abs(std - korrekt) < 0.1;
@@ -2393,7 +2321,7 @@ void WindTurbineExperiment::zeigeTeilfaktoriellAuswertung() {
    tft.fillScreen(TFT_BACKGROUND);
    
    // Titelbereich
-   zeichneTitelbalken("Teilfaktorieller Versuch: Effekt-Diagramm");
+   zeichneTitelbalken("Teilfaktoriell: Effekt-Diagramm");
    
    // Diagramm zentral anzeigen - X-Koordinate angepasst für bessere Zentrierung
    zeigeEffekteDiagramm(340, 170);
@@ -2440,7 +2368,7 @@ void WindTurbineExperiment::zeigeVollfaktoriellDiagrammAnsicht() {
   tft.fillScreen(TFT_BACKGROUND);
   
   // Titelbereich
-  zeichneTitelbalken("Vollfaktorieller Versuch: Ergebnis-Diagramm");
+  zeichneTitelbalken("Vollfaktoriell: Ergebnis-Diagramm");
   
   // Diagramm zentral anzeigen
   zeigeVollfaktoriellDiagramm(340, 230);
@@ -2629,3 +2557,257 @@ void WindTurbineExperiment::zeigeParetoEffekteDiagrammAnsicht() {
   // Zurück zur Auswertung
   zeigeTeilfaktoriellAuswertung();
 }
+
+/**
+ * Zeigt das Halbnormal-Diagramm mit Lenths Pseudo-Standardfehler und wartet auf den Drehknopf
+ * Prüft die Effekte auch ohne Wiederholungen (z.B. manuell eingegebene Mittelwerte)
+ */
+void WindTurbineExperiment::zeigeHalbnormalDiagrammAnsicht() {
+  tft.fillScreen(TFT_BACKGROUND);
+  aktualisiereAuswertung();
+  
+  // Titelbereich
+  zeichneTitelbalken("Halbnormal-Diagramm (Lenth)");
+  
+  // Kennwerte nach Lenth
+  tft.fillRoundRect(20, 50, 440, 25, 5, TFT_OUTLINE);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_TEXT);
+  tft.setCursor(30, 57);
+  if (teilLenth.istGueltig()) {
+    tft.print("PSE = ");
+    tft.print(teilLenth.pse(), 3);
+    tft.print(" uW   ME = ");
+    tft.print(teilLenth.me(), 3);
+    tft.print("   SME = ");
+    tft.print(teilLenth.sme(), 3);
+    tft.print("   (FG ");
+    tft.print(teilLenth.freiheitsgrade(), 1);
+    tft.print(")");
+  } else {
+    tft.print(teilAnalyse.istGueltig() ? "PSE = 0: alle kleinen Kontraste exakt 0, keine Pruefung moeglich"
+                                       : "Keine Effekte berechnet - erst Mittelwerte messen oder eingeben");
+  }
+  
+  // Diagramm anzeigen
+  zeigeHalbnormalDiagramm(340, 230);
+  
+  // Legende: Kontraste über der Fehlergrenze
+  tft.fillRoundRect(20, 260, 440, 80, 5, TFT_OUTLINE);
+  tft.fillRect(21, 261, 438, 18, TFT_TITLE_BG);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(25, 265);
+  tft.print("Effekte ueber ME (orange) bzw. SME (rot, aktiv):");
+  
+  int zeile = 0;
+  for (int rang = teilLenth.anzahlEffekte() - 1; rang >= 0 && zeile < 6; rang--) {
+    if (!teilLenth.istAuffaellig(rang)) break;
+    
+    // Zwei Spalten zu je drei Zeilen
+    int x = (zeile < 3) ? 30 : 250;
+    int y = 285 + (zeile % 3) * 18;
+    
+    char kette[20];
+    teilAlias.formatiereKette(teilLenth.wort(rang), kette, sizeof(kette), 2);
+    tft.setCursor(x, y);
+    tft.setTextColor(teilLenth.istAktiv(rang) ? TFT_WARNING : TFT_CHART_ACCENT);
+    tft.print(kette);
+    tft.setTextColor(TFT_TEXT);
+    tft.print(" (");
+    if (teilLenth.effekt(rang) >= 0) tft.print("+");
+    tft.print(teilLenth.effekt(rang), 2);
+    tft.print(" uW)");
+    zeile++;
+  }
+  if (zeile == 0) {
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.setCursor(30, 285);
+    tft.print(teilLenth.istGueltig() ? "Kein Effekt ueber ME - alle Kontraste im Rauschen"
+                                     : "-");
+  }
+  
+  // Anleitung
+  zeichneStatusleiste("Druecken Sie den Drehknopf, um zur Auswertung zurueckzukehren.");
+  
+  // Warten auf Knopfdruck
+  bool warten = true;
+  while (warten) {
+    if (digitalRead(ENCODER_BUTTON) == LOW) {
+      if (!buttonPressed && (millis() - lastDebounceTime > debounceDelay)) {
+        buttonPressed = true;
+        lastDebounceTime = millis();
+        warten = false;
+      }
+    } else {
+      buttonPressed = false;
+    }
+    
+    // Keypad abfragen
+    char key = keypad.getKey();
+    if (key) {
+      if (key == '#' || key == 'D') {
+        warten = false;
+      }
+    }
+  }
+  
+  // Zurück zur Auswertung
+  zeigeTeilfaktoriellAuswertung();
+}
+
+/**
+ * Zeigt die ANOVA-Tabelle des teilfaktoriellen Versuchs und wartet auf den Drehknopf
+ */
+void WindTurbineExperiment::zeigeAnovaTabelleAnsicht() {
+  zeigeAnovaTabelle();
+  
+  // Warten auf Knopfdruck
+  bool warten = true;
+  while (warten) {
+    if (digitalRead(ENCODER_BUTTON) == LOW) {
+      if (!buttonPressed && (millis() - lastDebounceTime > debounceDelay)) {
+        buttonPressed = true;
+        lastDebounceTime = millis();
+        warten = false;
+      }
+    } else {
+      buttonPressed = false;
+    }
+    
+    // Keypad abfragen
+    char key = keypad.getKey();
+    if (key) {
+      if (key == '#' || key == 'D') {
+        warten = false;
+      }
+    }
+  }
+  
+  // Zurück zur Auswertung
+  zeigeTeilfaktoriellAuswertung();
+}
+
+/**
+ * Zeichnet die ANOVA-Tabelle: Quadratsumme, Freiheitsgrade, mittleres Quadrat,
+ * F-Wert und p-Wert je Effekt sowie Modell, Reststreuung und Gesamt
+ */
+void WindTurbineExperiment::zeigeAnovaTabelle() {
+  aktualisiereAuswertung();
+  bool pruefung = teilAnova.hatPruefung();
+  
+  tft.fillScreen(TFT_BACKGROUND);
+  zeichneTitelbalken("Teilfaktoriell: ANOVA-Tabelle");
+  
+  // Tabelle
+  tft.fillRoundRect(10, 48, 460, 202, 5, TFT_OUTLINE);
+  tft.fillRect(11, 49, 458, 20, TFT_TITLE_BG);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  
+  const int spalten[] = {18, 108, 162, 222, 250, 312, 372, 432};
+  const char* kopf[] = {"Quelle", "Effekt", "SQ", "FG", "MQ", "F", "p", ""};
+  for (int s = 0; s < 7; s++) {
+    tft.setCursor(spalten[s], 55);
+    tft.print(kopf[s]);
+  }
+  
+  const char* kurzeFaktorNamen[] = {"Steigung", "Groesse", "Abstand", "Luftst.", "Blattanz."};
+  
+  int anzahl = teilAnova.anzahlEffekte();
+  for (int zeile = 0; zeile < anzahl + 3; zeile++) {
+    const AnovaZeile& z = zeile < anzahl ? teilAnova.effektZeile(zeile)
+                        : zeile == anzahl ? teilAnova.modellZeile()
+                        : zeile == anzahl + 1 ? teilAnova.restZeile()
+                        : teilAnova.gesamtZeile();
+    int y = 76 + zeile * 17 + (zeile >= anzahl ? 4 : 0);
+    
+    if (zeile % 2 == 0) {
+      tft.fillRect(11, y - 4, 458, 16, 0x1082);
+    }
+    if (zeile == anzahl) {
+      tft.drawLine(11, y - 5, 468, y - 5, TFT_GRID);
+    }
+    
+    // Quelle
+    tft.setTextColor(TFT_TEXT);
+    tft.setCursor(spalten[0], y);
+    if (zeile < anzahl) {
+      if (z.faktor >= 0 && z.faktor < 5) {
+        tft.print((char)('A' + z.faktor));
+        tft.print(" ");
+        tft.print(kurzeFaktorNamen[z.faktor]);
+      } else {
+        // Wechselwirkungsspalte: kurze Aliaskette, z.B. "BC=DE"
+        char kette[16];
+        teilAlias.formatiereKette(z.wort, kette, sizeof(kette), 2);
+        tft.print(kette);
+      }
+    } else {
+      tft.print(zeile == anzahl ? "Modell" : (zeile == anzahl + 1 ? "Rest" : "Gesamt"));
+    }
+    
+    // Effekt (nur Effektzeilen)
+    if (zeile < anzahl) {
+      tft.setCursor(spalten[1], y);
+      tft.setTextColor(z.effekt >= 0 ? TFT_SUCCESS : TFT_WARNING);
+      if (z.effekt >= 0) tft.print("+");
+      tft.print(z.effekt, 2);
+      tft.setTextColor(TFT_TEXT);
+    }
+    
+    tft.setCursor(spalten[2], y);
+    tft.print(z.quadratsumme, 1);
+    tft.setCursor(spalten[3], y);
+    tft.print(z.freiheitsgrade);
+    
+    // Gesamt ohne mittleres Quadrat, F und p
+    if (zeile == anzahl + 2) continue;
+    if (z.freiheitsgrade > 0) {
+      tft.setCursor(spalten[4], y);
+      tft.print(z.mittleresQuadrat, 1);
+    }
+    
+    // F und p gegen die Reststreuung
+    if (zeile == anzahl + 1) continue;
+    tft.setCursor(spalten[5], y);
+    if (!pruefung) {
+      tft.print("-");
+      continue;
+    }
+    tft.print(z.f, 1);
+    
+    tft.setCursor(spalten[6], y);
+    tft.setTextColor(z.p < ANOVA_ALPHA ? TFT_HIGHLIGHT : TFT_LIGHT_TEXT);
+    if (z.p < 0.001) {
+      tft.print("<0.001");
+    } else {
+      tft.print(z.p, 4);
+    }
+    
+    // Sterne: * p < 0.05, ** p < 0.01, *** p < 0.001
+    tft.setCursor(spalten[7], y);
+    if (z.p < 0.001) tft.print("***");
+    else if (z.p < 0.01) tft.print("**");
+    else if (z.p < ANOVA_ALPHA) tft.print("*");
+    tft.setTextColor(TFT_TEXT);
+  }
+  
+  // Informationsbox
+  tft.fillRoundRect(10, 256, 460, 38, 5, TFT_OUTLINE);
+  tft.setTextColor(TFT_SUBTITLE);
+  tft.setCursor(20, 263);
+  if (pruefung) {
+    tft.print("F-Test gegen die Streuung der Wiederholungen (FG = ");
+    tft.print(teilAnova.restZeile().freiheitsgrade);
+    tft.print(")");
+    tft.setCursor(20, 279);
+    tft.print("* p<0.05  ** p<0.01  *** p<0.001   Fixierung nur bei p < ");
+    tft.print(ANOVA_ALPHA, 2);
+  } else {
+    tft.print("Keine verwertbaren Wiederholungen (Mittelwerte manuell eingegeben):");
+    tft.setCursor(20, 279);
+    tft.print("kein F-Test moeglich, Auswahl nach Effektstaerke.");
+  }
+  
+  zeichneStatusleiste("Druecken Sie den Drehknopf, um zur Auswertung zurueckzukehren.");
+}
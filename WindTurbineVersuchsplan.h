@@ -0,0 +1,197 @@
+/**
+ * WindTurbineVersuchsplan.h
+ * Zweistufige (teil-)faktorielle Versuchspläne zur Übersetzungszeit
+ *
+ * Versuchsplan2kp<K, P, Woerter...> erzeugt den Plan 2^(K-P) für K Faktoren:
+ * Die ersten K-P Spalten (Basisfaktoren A, B, C, ...) laufen in Standardreihenfolge
+ * (A wechselt bei jedem Versuch, B bei jedem zweiten, ...). Jede weitere Spalte
+ * ist das Produkt der Basisfaktoren ihres Generatorworts, als Bitmaske kodiert:
+ *   0x3 = AB, 0x5 = AC, 0x6 = BC, 0x7 = ABC
+ *
+ * Die Tabelle (-1 = niedrige, 1 = hohe Stufe) ist ein constexpr-Objekt und
+ * liegt damit im Flash; zur Laufzeit wird nichts berechnet. static_assert prüft
+ * für jeden verwendeten Plan, dass alle Spalten ausgewogen (gleich viele -1 und 1)
+ * und paarweise orthogonal sind. Ein Generatorwort, das eine andere Spalte
+ * wiederholt, lässt die Übersetzung deshalb fehlschlagen.
+ *
+ * Ebenfalls zur Übersetzungszeit stehen die definierende Relation und die
+ * Auflösung fest. Die Wörter der Relation sind hier Bitmasken über alle K Faktoren
+ * (0x1 = A, ..., 0x8 = D): Generator D = AB ergibt I = ABD = 0xB. Die Relation
+ * besteht aus allen Produkten (XOR) der P Generatorwörter.
+ *
+ * Geschrieben für C++11 (constexpr-Funktionen mit einer return-Anweisung).
+ */
+
+#ifndef WIND_TURBINE_VERSUCHSPLAN_H
+#define WIND_TURBINE_VERSUCHSPLAN_H
+
+#include <stdint.h>
+
+// Indexfolge 0..N-1 für die Erzeugung der Tabelle
+template <int... I> struct VersuchsplanIndizes {};
+template <int N, int... I> struct VersuchsplanFolge : VersuchsplanFolge<N - 1, N - 1, I...> {};
+template <int... I> struct VersuchsplanFolge<0, I...> { typedef VersuchsplanIndizes<I...> typ; };
+
+// Generatorwörter als Typ, damit sie neben der Indexfolge abgeleitet werden können
+template <unsigned... W> struct VersuchsplanWoerter {};
+
+// k-tes Generatorwort
+constexpr unsigned versuchsplanWort(int) {
+  return 0;
+}
+template <typename... R>
+constexpr unsigned versuchsplanWort(int k, unsigned wort, R... rest) {
+  return k == 0 ? wort : versuchsplanWort(k - 1, rest...);
+}
+
+// Produkt der Stufen aller Basisfaktoren im Wort
+constexpr int versuchsplanProdukt(unsigned wort, int versuch) {
+  return wort == 0 ? 1
+       : (((wort & 1) && !(versuch & 1)) ? -1 : 1) * versuchsplanProdukt(wort >> 1, versuch >> 1);
+}
+
+// Stufe eines Faktors in einem Versuch
+template <int BASIS, unsigned... W>
+constexpr int versuchsplanStufe(int versuch, int faktor) {
+  return faktor < BASIS ? (((versuch >> faktor) & 1) ? 1 : -1)
+                        : versuchsplanProdukt(versuchsplanWort(faktor - BASIS, W...), versuch);
+}
+
+// Summe der Stufen einer Spalte ab Versuch v (0 = ausgewogen)
+template <int BASIS, unsigned... W>
+constexpr int versuchsplanSpaltensumme(int faktor, int v, int versuche) {
+  return v == versuche ? 0
+       : versuchsplanStufe<BASIS, W...>(v, faktor) + versuchsplanSpaltensumme<BASIS, W...>(faktor, v + 1, versuche);
+}
+
+// Skalarprodukt zweier Spalten ab Versuch v (0 = orthogonal)
+template <int BASIS, unsigned... W>
+constexpr int versuchsplanSkalarprodukt(int a, int b, int v, int versuche) {
+  return v == versuche ? 0
+       : versuchsplanStufe<BASIS, W...>(v, a) * versuchsplanStufe<BASIS, W...>(v, b)
+         + versuchsplanSkalarprodukt<BASIS, W...>(a, b, v + 1, versuche);
+}
+
+template <int BASIS, unsigned... W>
+constexpr bool versuchsplanAusgewogen(int faktor, int faktoren, int versuche) {
+  return faktor == faktoren ||
+         (versuchsplanSpaltensumme<BASIS, W...>(faktor, 0, versuche) == 0 &&
+          versuchsplanAusgewogen<BASIS, W...>(faktor + 1, faktoren, versuche));
+}
+
+// Alle Paare (a, b) mit a < b
+template <int BASIS, unsigned... W>
+constexpr bool versuchsplanOrthogonal(int a, int b, int faktoren, int versuche) {
+  return a >= faktoren - 1 ||
+         (b == faktoren ? versuchsplanOrthogonal<BASIS, W...>(a + 1, a + 2, faktoren, versuche)
+                        : versuchsplanSkalarprodukt<BASIS, W...>(a, b, 0, versuche) == 0 &&
+                          versuchsplanOrthogonal<BASIS, W...>(a, b + 1, faktoren, versuche));
+}
+
+// Generatorwörter dürfen nur Basisfaktoren enthalten
+constexpr bool versuchsplanWoerterGueltig(int) {
+  return true;
+}
+template <typename... R>
+constexpr bool versuchsplanWoerterGueltig(int basis, unsigned wort, R... rest) {
+  return wort != 0 && wort < (1u << basis) && versuchsplanWoerterGueltig(basis, rest...);
+}
+
+// Wort i der definierenden Relation: Produkt der Generatoren in den Bits von i
+template <int BASIS, unsigned... W>
+constexpr unsigned versuchsplanRelation(int i, int k) {
+  return i == 0 ? 0
+       : (((i & 1) ? (versuchsplanWort(k, W...) | (1u << (BASIS + k))) : 0u) ^
+          versuchsplanRelation<BASIS, W...>(i >> 1, k + 1));
+}
+
+// Anzahl Faktoren in einem Wort
+constexpr int versuchsplanWortLaenge(unsigned wort) {
+  return wort == 0 ? 0 : (int)(wort & 1) + versuchsplanWortLaenge(wort >> 1);
+}
+
+// Kürzestes Wort der Relation ab Wort i (Auflösung)
+template <int BASIS, unsigned... W>
+constexpr int versuchsplanKuerzestesWort(int i, int anzahl) {
+  return i > anzahl ? 32
+       : (versuchsplanWortLaenge(versuchsplanRelation<BASIS, W...>(i, 0)) <
+          versuchsplanKuerzestesWort<BASIS, W...>(i + 1, anzahl))
+         ? versuchsplanWortLaenge(versuchsplanRelation<BASIS, W...>(i, 0))
+         : versuchsplanKuerzestesWort<BASIS, W...>(i + 1, anzahl);
+}
+
+template <typename Tabelle, int FAKTOREN, int BASIS, unsigned... W, int... I>
+constexpr Tabelle versuchsplanTabelle(VersuchsplanWoerter<W...>, VersuchsplanIndizes<I...>) {
+  return Tabelle{ { versuchsplanStufe<BASIS, W...>(I / FAKTOREN, I % FAKTOREN)... } };
+}
+
+template <int K, int P, unsigned... Woerter>
+class Versuchsplan2kp {
+public:
+  static constexpr int FAKTOREN = K;
+  static constexpr int BASIS = K - P;
+  static constexpr int VERSUCHE = 1 << (K - P);
+
+  struct Tabelle {
+    int stufen[VERSUCHE][FAKTOREN];
+  };
+
+  static_assert(P >= 0 && P < K && K <= 16, "Versuchsplan: ungueltige Faktoranzahl oder Fraktion");
+  static_assert(sizeof...(Woerter) == P, "Versuchsplan: genau P Generatorwoerter erforderlich");
+  static_assert(versuchsplanWoerterGueltig(K - P, Woerter...),
+                "Versuchsplan: Generatorwort enthaelt keine oder unbekannte Basisfaktoren");
+  static_assert(versuchsplanAusgewogen<K - P, Woerter...>(0, K, 1 << (K - P)),
+                "Versuchsplan: Spalte nicht ausgewogen");
+  static_assert(versuchsplanOrthogonal<K - P, Woerter...>(0, 1, K, 1 << (K - P)),
+                "Versuchsplan: Spalten nicht orthogonal");
+
+  // Spalte eines Faktors als Produkt der Basisfaktoren (Bitmaske wie die Generatorwörter)
+  static constexpr unsigned spaltenWort(int faktor) {
+    return faktor < K - P ? 1u << faktor : versuchsplanWort(faktor - (K - P), Woerter...);
+  }
+
+  // Definierende Relation I = W1 = W2 = ... (ohne I), Wörter über alle K Faktoren
+  static constexpr int RELATIONSWOERTER = (1 << P) - 1;
+  static constexpr unsigned definierendesWort(int i) {
+    return versuchsplanRelation<K - P, Woerter...>(i + 1, 0);
+  }
+
+  // Auflösung: Länge des kürzesten Worts der Relation, 0 = vollständiger Plan
+  static constexpr int AUFLOESUNG = P == 0 ? 0 : versuchsplanKuerzestesWort<K - P, Woerter...>(1, (1 << P) - 1);
+
+  // Wort i der Aliaskette eines Effekts (i = 0: der Effekt selbst)
+  static constexpr unsigned aliasWort(unsigned effekt, int i) {
+    return i == 0 ? effekt : effekt ^ definierendesWort(i - 1);
+  }
+
+  // Plan als Tabelle [Versuch][Faktor]
+  static constexpr Tabelle tabelle = versuchsplanTabelle<Tabelle, K, K - P>(
+    VersuchsplanWoerter<Woerter...>(), typename VersuchsplanFolge<(1 << (K - P)) * K>::typ());
+};
+
+template <int K, int P, unsigned... Woerter>
+constexpr typename Versuchsplan2kp<K, P, Woerter...>::Tabelle Versuchsplan2kp<K, P, Woerter...>::tabelle;
+
+// Pläne des Versuchsstands
+typedef Versuchsplan2kp<5, 2, 0x3, 0x5> TeilfaktoriellPlan;       // 2^(5-2): D = AB, E = AC
+typedef Versuchsplan2kp<3, 0> VollfaktoriellPlan;                 // 2^3 der drei wichtigsten Faktoren
+
+// Varianten für Aufbauten mit anderer Faktoranzahl (je 8 Versuche)
+typedef Versuchsplan2kp<4, 1, 0x7> TeilfaktoriellPlan4;           // 2^(4-1): D = ABC
+typedef Versuchsplan2kp<6, 3, 0x3, 0x5, 0x6> TeilfaktoriellPlan6; // 2^(6-3): D = AB, E = AC, F = BC
+typedef Versuchsplan2kp<7, 4, 0x3, 0x5, 0x6, 0x7> TeilfaktoriellPlan7; // 2^(7-4), gesättigt: G = ABC
+
+// Erst der Zugriff instanziiert die Klasse und damit ihre Prüfungen
+static_assert(TeilfaktoriellPlan::VERSUCHE == 8 && VollfaktoriellPlan::VERSUCHE == 8, "Versuchsplan: 8 Versuche erwartet");
+static_assert(TeilfaktoriellPlan4::VERSUCHE == 8 && TeilfaktoriellPlan6::VERSUCHE == 8 &&
+              TeilfaktoriellPlan7::VERSUCHE == 8, "Versuchsplan: Varianten mit 8 Versuchen erwartet");
+
+// Vermengung der Pläne: I = ABD = ACE = BCDE, also A = BD = CE = ABCDE usw.
+static_assert(TeilfaktoriellPlan::definierendesWort(0) == 0x0B && TeilfaktoriellPlan::definierendesWort(1) == 0x15 &&
+              TeilfaktoriellPlan::definierendesWort(2) == 0x1E, "Versuchsplan: definierende Relation I = ABD = ACE = BCDE erwartet");
+static_assert(TeilfaktoriellPlan::aliasWort(0x1, 1) == 0xA, "Versuchsplan: A = BD erwartet");
+static_assert(TeilfaktoriellPlan::AUFLOESUNG == 3 && VollfaktoriellPlan::AUFLOESUNG == 0, "Versuchsplan: Aufloesung III bzw. vollstaendig erwartet");
+static_assert(TeilfaktoriellPlan4::AUFLOESUNG == 4 && TeilfaktoriellPlan6::AUFLOESUNG == 3 &&
+              TeilfaktoriellPlan7::AUFLOESUNG == 3, "Versuchsplan: Aufloesung der Varianten");
+
+#endif // WIND_TURBINE_VERSUCHSPLAN_H
@@ -10,11 +10,39 @@
 
 #include "WindTurbineExperiment.h"
 
+
+/**
+ * Datenstand der Diagramme: Prüfsumme über alle Werte, aus denen sie berechnet werden
+ * Solange er sich nicht ändert, spielt das Diagramm-Modell die gespeicherte Geometrie ab.
+ */
+uint32_t WindTurbineExperiment::diagrammDatenstand() {
+  uint32_t stand = WindTurbineDiagrammModell::pruefsumme(teilfaktoriellMittelwerte, sizeof(teilfaktoriellMittelwerte));
+  stand = WindTurbineDiagrammModell::pruefsumme(vollfaktoriellMittelwerte, sizeof(vollfaktoriellMittelwerte), stand);
+  // Einzelmessungen bestimmen die Fehlerbalken (Konfidenzintervalle)
+  stand = WindTurbineDiagrammModell::pruefsumme(teilfaktoriellMessungen, sizeof(teilfaktoriellMessungen), stand);
+  stand = WindTurbineDiagrammModell::pruefsumme(vollfaktoriellMessungen, sizeof(vollfaktoriellMessungen), stand);
+  return WindTurbineDiagrammModell::pruefsumme(effekte, sizeof(effekte), stand);
+}
+
 /**
  * Zeigt ein Haupteffekte-Diagramm (Main Effects Plot) an
  * Berechnet Mittelwerte für -1 und +1 Level aus den teilfaktoriellen Daten
  */
 void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
+  if (diagrammModell.beginneAufnahme(DIAGRAMM_HAUPTEFFEKTE, 0, 0, diagrammDatenstand())) {
+    baueHaupteffekteDiagramm();
+    diagrammModell.beendeAufnahme();
+  }
+  diagrammModell.zeichne(DIAGRAMM_HAUPTEFFEKTE);
+}
+
+/**
+ * Berechnet das Haupteffekte-Diagramm und nimmt es im Diagramm-Modell auf
+ * Die Beschriftungen übernehmen die aktuelle Textgröße des Bildschirms.
+ */
+void WindTurbineExperiment::baueHaupteffekteDiagramm() {
+  WindTurbineDiagrammModell& m = diagrammModell;
+
   // Diagrammbereich definieren
   int startX = 40;
   int startY = 80;
@@ -22,10 +50,10 @@ void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
   int plotHeight = 180;
   int factorHeight = plotHeight / 3;
   int factorWidth = plotWidth / 3;
-  
+
   // Hauptrahmen für das gesamte Diagramm
-  tft.drawRoundRect(startX-10, startY-10, plotWidth+20, plotHeight+30, 5, TFT_OUTLINE);
-  
+  m.rundRechteck(startX-10, startY-10, plotWidth+20, plotHeight+30, 5, TFT_OUTLINE);
+
   // Prüfen, ob echte Effekte vorhanden sind
   bool alleNullWerte = true;
   for (int i = 0; i < 5; i++) {
@@ -34,12 +62,12 @@ void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
       break;
     }
   }
-  
+
   // KORRIGIERT: Berechne Gesamtmittelwert und Response-Bereich für Y-Achsen-Skalierung
   float gesamtmittelwert = 0;
   float minResponse = 999;
   float maxResponse = -999;
-  
+
   if (alleNullWerte) {
     // Testdaten
     gesamtmittelwert = 3.2;
@@ -53,57 +81,60 @@ void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
       if (teilfaktoriellMittelwerte[i] > maxResponse) maxResponse = teilfaktoriellMittelwerte[i];
     }
     gesamtmittelwert /= 8.0;
-    
+
     // Erweitere den Bereich um 10% für bessere Darstellung
     float range = maxResponse - minResponse;
     if (range < 0.5) range = 0.5; // Mindestbereich
     minResponse -= range * 0.1;
     maxResponse += range * 0.1;
   }
-  
-  // Faktoren in der oberen Reihe (erste 3)
-  for (int i = 0; i < 3; i++) {
-    int x = startX + i * factorWidth;
-    int y = startY;
-    
+
+  // Y-Skalierung ist für alle Faktoren gleich
+  float y_range = maxResponse - minResponse;
+  // Sicherstellen, dass y_range nicht zu klein ist
+  if (y_range < 0.5) y_range = 0.5;
+
+  // Korrigierte Berechnung der Skalierung mit mehr Platz am Rand
+  float y_scale = (float)(factorHeight - 60) / y_range;
+
+  // Faktoren 1-3 in der oberen Reihe, 4-5 mittig versetzt in der unteren Reihe
+  for (int i = 0; i < 5; i++) {
+    int x = (i < 3) ? startX + i * factorWidth : startX + (i - 3) * factorWidth + factorWidth/2;
+    int y = (i < 3) ? startY : startY + factorHeight + 20;
+
     // Rahmen mit abgerundeten Ecken
-    tft.drawRoundRect(x, y, factorWidth, factorHeight, 3, TFT_GRID);
-    
+    m.rundRechteck(x, y, factorWidth, factorHeight, 3, TFT_GRID);
+
     // Farbigen Hintergrund für den Faktornamen
-    tft.fillRoundRect(x+5, y+5, factorWidth-10, 20, 3, TFT_TITLE_BG);
-    
+    m.rundFlaeche(x+5, y+5, factorWidth-10, 20, 3, TFT_TITLE_BG);
+
     // Faktorname
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(x + factorWidth/2 - 20, y + 12);
-    tft.print(faktorNamen[i]);
-    
+    m.text(x + factorWidth/2 - 20, y + 12, TFT_HIGHLIGHT, faktorNamen[i], 0);
+
     // Y-Achse
-    tft.drawFastVLine(x + 20, y + 25, factorHeight - 35, TFT_GRID);
-    
+    m.vLinie(x + 20, y + 25, factorHeight - 35, TFT_GRID);
+
     // X-Achse
-    tft.drawFastHLine(x + 20, y + factorHeight - 15, factorWidth - 40, TFT_GRID);
-    
+    m.hLinie(x + 20, y + factorHeight - 15, factorWidth - 40, TFT_GRID);
+
     // X-Achsen-Positionen
     int x1 = x + 35;  // -1 Level
     int x2 = x + factorWidth - 35;  // +1 Level
-    
+
     // Vertikale Linien für -1 und +1 Level
-    tft.drawFastVLine(x1, y + factorHeight - 20, 10, TFT_GRID);
-    tft.drawFastVLine(x2, y + factorHeight - 20, 10, TFT_GRID);
-    
+    m.vLinie(x1, y + factorHeight - 20, 10, TFT_GRID);
+    m.vLinie(x2, y + factorHeight - 20, 10, TFT_GRID);
+
     // X-Achse Beschriftung
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x1 - 5, y + factorHeight - 10);
-    tft.print("-1");
-    tft.setCursor(x2 - 5, y + factorHeight - 10);
-    tft.print("+1");
-    
+    m.text(x1 - 5, y + factorHeight - 10, TFT_LIGHT_TEXT, "-1", 0);
+    m.text(x2 - 5, y + factorHeight - 10, TFT_LIGHT_TEXT, "+1", 0);
+
     // KORRIGIERT: Berechne echte Mittelwerte für -1 und +1 Level
     float mittelwert_niedrig = 0;
     float mittelwert_hoch = 0;
     int anzahl_niedrig = 0;
     int anzahl_hoch = 0;
-    
+
     if (alleNullWerte) {
       // Testdaten - berechne aus Gesamtmittelwert und Effekt
       float testEffekte[5] = {0.5, -0.3, 0.2, -0.7, 0.4};
@@ -120,10 +151,10 @@ void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
           anzahl_hoch++;
         }
       }
-      
+
       if (anzahl_niedrig > 0) mittelwert_niedrig /= anzahl_niedrig;
       if (anzahl_hoch > 0) mittelwert_hoch /= anzahl_hoch;
-      
+
       // Fallback falls keine Daten vorhanden
       if (anzahl_niedrig == 0) {
         mittelwert_niedrig = gesamtmittelwert * 0.9;
@@ -132,170 +163,43 @@ void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
         mittelwert_hoch = gesamtmittelwert * 1.1;
       }
     }
-    
-    // Y-Positionen basierend auf tatsächlichen Werten - VERBESSERTE Float-Berechnung
-    float y_range = maxResponse - minResponse;
-    // Sicherstellen, dass y_range nicht zu klein ist
-    if (y_range < 0.5) y_range = 0.5;
-    
-    // Korrigierte Berechnung der Skalierung mit mehr Platz am Rand
-    float y_scale = (float)(factorHeight - 60) / y_range;
-    
+
     // Korrigierte Y-Positionen mit Begrenzung, damit sie im sichtbaren Bereich bleiben
     int y1 = y + factorHeight - 25 - (int)((mittelwert_niedrig - minResponse) * y_scale);
     int y2 = y + factorHeight - 25 - (int)((mittelwert_hoch - minResponse) * y_scale);
-    
+
     // Sicherstellen, dass die Punkte innerhalb des Diagramms bleiben
     y1 = constrain(y1, y + 30, y + factorHeight - 20);
     y2 = constrain(y2, y + 30, y + factorHeight - 20);
-    
+
     // Effekt-Linie zeichnen
     float effekt = mittelwert_hoch - mittelwert_niedrig;
     uint16_t lineColor = (effekt > 0) ? TFT_SUCCESS : TFT_WARNING;
-    
-    tft.drawLine(x1, y1, x2, y2, lineColor);
+
+    m.linie(x1, y1, x2, y2, lineColor);
     // Dickere Linie für bessere Sichtbarkeit
-    tft.drawLine(x1, y1-1, x2, y2-1, lineColor);
-    tft.drawLine(x1, y1+1, x2, y2+1, lineColor);
-    
+    m.linie(x1, y1-1, x2, y2-1, lineColor);
+    m.linie(x1, y1+1, x2, y2+1, lineColor);
+
     // Punkte an den Enden mit Farbverlauf
     for (int r = 4; r >= 0; r--) {
       uint16_t pointColor = r == 0 ? TFT_TEXT : lineColor;
-      tft.fillCircle(x1, y1, r, pointColor);
-      tft.fillCircle(x2, y2, r, pointColor);
+      m.kreisFlaeche(x1, y1, r, pointColor);
+      m.kreisFlaeche(x2, y2, r, pointColor);
     }
-    
+
     // Y-Achsen-Beschriftung mit Werten
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x + 2, y1 - 3);
-    tft.print(mittelwert_niedrig, 1);
-    tft.setCursor(x + 2, y2 - 3);
-    tft.print(mittelwert_hoch, 1);
-    
+    m.zahl(x + 2, y1 - 3, TFT_LIGHT_TEXT, mittelwert_niedrig, 1, "", 0);
+    m.zahl(x + 2, y2 - 3, TFT_LIGHT_TEXT, mittelwert_hoch, 1, "", 0);
+
     // Y-Achsen-Titel
-    tft.setCursor(x + 2, y + 30);
-    tft.print("uW");
-  }
-  
-  // Faktoren in der unteren Reihe (letzte 2)
-  for (int i = 0; i < 2; i++) {
-    int faktorIndex = i + 3;
-    int x = startX + i * factorWidth + factorWidth/2;
-    int y = startY + factorHeight + 20;
-    
-    // Rahmen mit abgerundeten Ecken
-    tft.drawRoundRect(x, y, factorWidth, factorHeight, 3, TFT_GRID);
-    
-    // Farbigen Hintergrund für den Faktornamen
-    tft.fillRoundRect(x+5, y+5, factorWidth-10, 20, 3, TFT_TITLE_BG);
-    
-    // Faktorname
-    tft.setTextColor(TFT_HIGHLIGHT);
-    tft.setCursor(x + factorWidth/2 - 20, y + 12);
-    tft.print(faktorNamen[faktorIndex]);
-    
-    // Y-Achse
-    tft.drawFastVLine(x + 20, y + 25, factorHeight - 35, TFT_GRID);
-    
-    // X-Achse
-    tft.drawFastHLine(x + 20, y + factorHeight - 15, factorWidth - 40, TFT_GRID);
-    
-    // X-Achsen-Positionen
-    int x1 = x + 35;
-    int x2 = x + factorWidth - 35;
-    
-    // Vertikale Linien für -1 und +1 Level
-    tft.drawFastVLine(x1, y + factorHeight - 20, 10, TFT_GRID);
-    tft.drawFastVLine(x2, y + factorHeight - 20, 10, TFT_GRID);
-    
-    // X-Achse Beschriftung
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x1 - 5, y + factorHeight - 10);
-    tft.print("-1");
-    tft.setCursor(x2 - 5, y + factorHeight - 10);
-    tft.print("+1");
-    
-    // KORRIGIERT: Berechne echte Mittelwerte
-    float mittelwert_niedrig = 0;
-    float mittelwert_hoch = 0;
-    int anzahl_niedrig = 0;
-    int anzahl_hoch = 0;
-    
-    if (alleNullWerte) {
-      float testEffekte[5] = {0.5, -0.3, 0.2, -0.7, 0.4};
-      mittelwert_niedrig = gesamtmittelwert - testEffekte[faktorIndex] / 2.0;
-      mittelwert_hoch = gesamtmittelwert + testEffekte[faktorIndex] / 2.0;
-    } else {
-      for (int j = 0; j < 8; j++) {
-        if (teilfaktoriellPlan[j][faktorIndex] == -1) {
-          mittelwert_niedrig += teilfaktoriellMittelwerte[j];
-          anzahl_niedrig++;
-        } else if (teilfaktoriellPlan[j][faktorIndex] == 1) {
-          mittelwert_hoch += teilfaktoriellMittelwerte[j];
-          anzahl_hoch++;
-        }
-      }
-      
-      if (anzahl_niedrig > 0) mittelwert_niedrig /= anzahl_niedrig;
-      if (anzahl_hoch > 0) mittelwert_hoch /= anzahl_hoch;
-      
-      // Fallback falls keine Daten vorhanden
-      if (anzahl_niedrig == 0) {
-        mittelwert_niedrig = gesamtmittelwert * 0.9;
-      }
-      if (anzahl_hoch == 0) {
-        mittelwert_hoch = gesamtmittelwert * 1.1;
-      }
-    }
-    
-    // Y-Positionen basierend auf tatsächlichen Werten - VERBESSERTE Float-Berechnung
-    float y_range = maxResponse - minResponse;
-    // Sicherstellen, dass y_range nicht zu klein ist
-    if (y_range < 0.5) y_range = 0.5;
-    
-    // Korrigierte Berechnung der Skalierung mit mehr Platz am Rand
-    float y_scale = (float)(factorHeight - 60) / y_range;
-    
-    // Korrigierte Y-Positionen mit Begrenzung, damit sie im sichtbaren Bereich bleiben
-    int y1 = y + factorHeight - 25 - (int)((mittelwert_niedrig - minResponse) * y_scale);
-    int y2 = y + factorHeight - 25 - (int)((mittelwert_hoch - minResponse) * y_scale);
-    
-    // Sicherstellen, dass die Punkte innerhalb des Diagramms bleiben
-    y1 = constrain(y1, y + 30, y + factorHeight - 20);
-    y2 = constrain(y2, y + 30, y + factorHeight - 20);
-    
-    // Effekt-Linie zeichnen
-    float effekt = mittelwert_hoch - mittelwert_niedrig;
-    uint16_t lineColor = (effekt > 0) ? TFT_SUCCESS : TFT_WARNING;
-    
-    tft.drawLine(x1, y1, x2, y2, lineColor);
-    tft.drawLine(x1, y1-1, x2, y2-1, lineColor);
-    tft.drawLine(x1, y1+1, x2, y2+1, lineColor);
-    
-    // Punkte an den Enden
-    for (int r = 4; r >= 0; r--) {
-      uint16_t pointColor = r == 0 ? TFT_TEXT : lineColor;
-      tft.fillCircle(x1, y1, r, pointColor);
-      tft.fillCircle(x2, y2, r, pointColor);
-    }
-    
-    // Y-Werte anzeigen
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x + 2, y1 - 3);
-    tft.print(mittelwert_niedrig, 1);
-    tft.setCursor(x + 2, y2 - 3);
-    tft.print(mittelwert_hoch, 1);
-    
-    tft.setCursor(x + 2, y + 30);
-    tft.print("uW");
+    m.text(x + 2, y + 30, TFT_LIGHT_TEXT, "uW", 0);
   }
-  
+
   // Wenn Testdaten verwendet werden, Hinweis anzeigen
   if (alleNullWerte) {
-    tft.fillRoundRect(startX+50, startY+2*factorHeight+30, 300, 20, 5, TFT_TITLE_BG);
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(startX+55, startY + 2*factorHeight + 35);
-    tft.print("Beispieldaten bei -1/+1 Level");
+    m.rundFlaeche(startX+50, startY+2*factorHeight+30, 300, 20, 5, TFT_TITLE_BG);
+    m.text(startX+55, startY + 2*factorHeight + 35, TFT_LIGHT_TEXT, "Beispieldaten bei -1/+1 Level", 0);
   }
 }
 
@@ -304,24 +208,34 @@ void WindTurbineExperiment::zeigeHaupteffekteDiagramm() {
  * FEHLER BEHOBEN: Doppelte Deklaration von y_range entfernt
  */
 void WindTurbineExperiment::zeigeInteraktionsDiagramm() {
+  if (diagrammModell.beginneAufnahme(DIAGRAMM_INTERAKTION, 0, 0, diagrammDatenstand())) {
+    baueInteraktionsDiagramm();
+    diagrammModell.beendeAufnahme();
+  }
+  diagrammModell.zeichne(DIAGRAMM_INTERAKTION);
+}
+
+/**
+ * Berechnet das Interaktions-Diagramm der beiden stärksten Faktoren und nimmt es auf
+ */
+void WindTurbineExperiment::baueInteraktionsDiagramm() {
+  WindTurbineDiagrammModell& m = diagrammModell;
+
   int startX = 60;
   int startY = 90;
   int plotWidth = 350;
   int plotHeight = 180;
-  
+
   // Diagramm-Rahmen
-  tft.drawRoundRect(startX-10, startY-30, plotWidth+20, plotHeight+40, 5, TFT_OUTLINE);
-  
+  m.rundRechteck(startX-10, startY-30, plotWidth+20, plotHeight+40, 5, TFT_OUTLINE);
+
   // Titel
-  tft.fillRoundRect(startX + plotWidth/2 - 80, startY - 25, 160, 20, 5, TFT_TITLE_BG);
-  tft.setTextSize(1);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setCursor(startX + plotWidth/2 - 50, startY - 20);
-  tft.println("Interaction Plot");
-  
+  m.rundFlaeche(startX + plotWidth/2 - 80, startY - 25, 160, 20, 5, TFT_TITLE_BG);
+  m.text(startX + plotWidth/2 - 50, startY - 20, TFT_HIGHLIGHT, "Interaction Plot");
+
   // Rahmen zeichnen
-  tft.drawRect(startX, startY, plotWidth, plotHeight, TFT_GRID);
-  
+  m.rechteck(startX, startY, plotWidth, plotHeight, TFT_GRID);
+
   // Prüfen, ob echte Effekte vorhanden sind
   bool alleNullWerte = true;
   for (int i = 0; i < 5; i++) {
@@ -330,15 +244,15 @@ void WindTurbineExperiment::zeigeInteraktionsDiagramm() {
       break;
     }
   }
-  
+
   // Wähle die beiden stärksten Faktoren
   int faktor1 = 0;
   int faktor2 = 1;
-  
+
   if (!alleNullWerte) {
     float maxEffekt1 = 0;
     float maxEffekt2 = 0;
-    
+
     for (int i = 0; i < 5; i++) {
       float absEffekt = abs(effekte[i]);
       if (absEffekt > maxEffekt1) {
@@ -352,12 +266,11 @@ void WindTurbineExperiment::zeigeInteraktionsDiagramm() {
       }
     }
   }
-  
+
   // KORRIGIERT: Robuste Datensammlung mit Validierung
   float y_werte[4] = {0, 0, 0, 0}; // F1-/F2-, F1+/F2-, F1-/F2+, F1+/F2+
   bool datenVorhanden[4] = {false, false, false, false};
-  int anzahlWerte[4] = {0, 0, 0, 0};
-  
+
   if (alleNullWerte) {
     // Testdaten mit bekannter Interaktion
     y_werte[0] = 2.8; // F1-, F2-
@@ -366,53 +279,15 @@ void WindTurbineExperiment::zeigeInteraktionsDiagramm() {
     y_werte[3] = 4.2; // F1+, F2+
     for (int i = 0; i < 4; i++) datenVorhanden[i] = true;
   } else {
-    // Echte Daten sammeln
-    for (int i = 0; i < 8; i++) {
-      int index = -1;
-      
-      if (teilfaktoriellPlan[i][faktor1] == -1 && teilfaktoriellPlan[i][faktor2] == -1) {
-        index = 0;
-      } else if (teilfaktoriellPlan[i][faktor1] == 1 && teilfaktoriellPlan[i][faktor2] == -1) {
-        index = 1;
-      } else if (teilfaktoriellPlan[i][faktor1] == -1 && teilfaktoriellPlan[i][faktor2] == 1) {
-        index = 2;
-      } else if (teilfaktoriellPlan[i][faktor1] == 1 && teilfaktoriellPlan[i][faktor2] == 1) {
-        index = 3;
-      }
-      
-      if (index >= 0) {
-        y_werte[index] += teilfaktoriellMittelwerte[i];
-        anzahlWerte[index]++;
-        datenVorhanden[index] = true;
-      }
-    }
-    
-    // Mittelwerte berechnen
+    // Zellen aus Gesamtmittelwert, beiden Haupteffekten und ihrer Wechselwirkung
+    // (im 2^(5-2)-Plan ist jede Kombination mit zwei Versuchen besetzt)
+    aktualisiereAuswertung();
     for (int i = 0; i < 4; i++) {
-      if (anzahlWerte[i] > 0) {
-        y_werte[i] /= anzahlWerte[i];
-      }
-    }
-    
-    // KORRIGIERT: Interpolation für fehlende Punkte
-    for (int i = 0; i < 4; i++) {
-      if (!datenVorhanden[i]) {
-        // Einfache Interpolation basierend auf Haupteffekten
-        float gesamtmittelwert = 0;
-        for (int j = 0; j < 8; j++) {
-          gesamtmittelwert += teilfaktoriellMittelwerte[j];
-        }
-        gesamtmittelwert /= 8.0;
-        
-        // Schätze basierend auf Haupteffekten
-        float effekt1_beitrag = (i & 1) ? effekte[faktor1] / 2 : -effekte[faktor1] / 2;
-        float effekt2_beitrag = (i & 2) ? effekte[faktor2] / 2 : -effekte[faktor2] / 2;
-        
-        y_werte[i] = gesamtmittelwert + effekt1_beitrag + effekt2_beitrag;
-      }
+      y_werte[i] = teilAnalyse.zellenMittel(faktor1, (i & 1) ? 1 : -1, faktor2, (i & 2) ? 1 : -1);
+      datenVorhanden[i] = true;
     }
   }
-  
+
   // Y-Skala bestimmen mit verbesserter Berechnung
   float y_min = y_werte[0];
   float y_max = y_werte[0];
@@ -420,165 +295,141 @@ void WindTurbineExperiment::zeigeInteraktionsDiagramm() {
     if (y_werte[i] < y_min) y_min = y_werte[i];
     if (y_werte[i] > y_max) y_max = y_werte[i];
   }
-  
+
   // Sicherstellen, dass der Bereich ausreichend groß ist
   float y_range = y_max - y_min;
   if (y_range < 0.5) y_range = 0.5;
-  
+
   // Mehr Platz am Rand für bessere Sichtbarkeit
   y_min -= y_range * 0.15;
   y_max += y_range * 0.15;
-  
+
   // WICHTIG: y_range hier aktualisieren nach der Erweiterung
   y_range = y_max - y_min;
-  
+
   // Achsen zeichnen
-  tft.drawFastHLine(startX, startY + plotHeight - 30, plotWidth, TFT_TEXT);
-  tft.drawFastVLine(startX, startY, plotHeight - 30, TFT_TEXT);
-  
+  m.hLinie(startX, startY + plotHeight - 30, plotWidth, TFT_TEXT);
+  m.vLinie(startX, startY, plotHeight - 30, TFT_TEXT);
+
   // X-Achsen-Positionen
   int x1 = startX + plotWidth/4;
   int x2 = startX + 3*plotWidth/4;
-  
+
   // X-Achsen-Ticks
-  tft.drawFastVLine(x1, startY + plotHeight - 35, 10, TFT_TEXT);
-  tft.drawFastVLine(x2, startY + plotHeight - 35, 10, TFT_TEXT);
-  
+  m.vLinie(x1, startY + plotHeight - 35, 10, TFT_TEXT);
+  m.vLinie(x2, startY + plotHeight - 35, 10, TFT_TEXT);
+
   // X-Achsen-Beschriftung
-  tft.fillRoundRect(startX + plotWidth/2 - 50, startY + plotHeight - 15, 100, 20, 5, TFT_TITLE_BG);
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(startX + plotWidth/2 - 30, startY + plotHeight - 10);
-  tft.print(faktorNamen[faktor1]);
-  
-  tft.fillRect(x1-10, startY + plotHeight - 25, 20, 15, 0x1082);
-  tft.setTextColor(TFT_LIGHT_TEXT);
-  tft.setCursor(x1-5, startY + plotHeight - 22);
-  tft.print("-1");
-  
-  tft.fillRect(x2-10, startY + plotHeight - 25, 20, 15, 0x1082);
-  tft.setCursor(x2-5, startY + plotHeight - 22);
-  tft.print("+1");
-  
+  m.rundFlaeche(startX + plotWidth/2 - 50, startY + plotHeight - 15, 100, 20, 5, TFT_TITLE_BG);
+  m.text(startX + plotWidth/2 - 30, startY + plotHeight - 10, TFT_TEXT, faktorNamen[faktor1]);
+
+  m.flaeche(x1-10, startY + plotHeight - 25, 20, 15, 0x1082);
+  m.text(x1-5, startY + plotHeight - 22, TFT_LIGHT_TEXT, "-1");
+
+  m.flaeche(x2-10, startY + plotHeight - 25, 20, 15, 0x1082);
+  m.text(x2-5, startY + plotHeight - 22, TFT_LIGHT_TEXT, "+1");
+
   // Y-Achsen-Beschriftung
-  tft.fillRect(startX - 25, startY + plotHeight/2 - 30, 20, 60, TFT_TITLE_BG);
-  tft.setCursor(startX - 20, startY + plotHeight/2 + 10);
-  tft.setTextColor(TFT_TEXT);
-  tft.print("L");
-  tft.setCursor(startX - 20, startY + plotHeight/2);
-  tft.print("e");
-  tft.setCursor(startX - 20, startY + plotHeight/2 - 10);
-  tft.print("i");
-  tft.setCursor(startX - 20, startY + plotHeight/2 - 20);
-  tft.print("s");
-  
+  m.flaeche(startX - 25, startY + plotHeight/2 - 30, 20, 60, TFT_TITLE_BG);
+  m.text(startX - 20, startY + plotHeight/2 + 10, TFT_TEXT, "L");
+  m.text(startX - 20, startY + plotHeight/2, TFT_TEXT, "e");
+  m.text(startX - 20, startY + plotHeight/2 - 10, TFT_TEXT, "i");
+  m.text(startX - 20, startY + plotHeight/2 - 20, TFT_TEXT, "s");
+
   // Y-Skala
-  tft.fillRect(startX - 30, startY + 5, 25, 20, 0x1082);
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(startX - 28, startY + 10);
-  tft.print(y_max, 1);
-  
-  tft.fillRect(startX - 30, startY + plotHeight - 40, 25, 20, 0x1082);
-  tft.setCursor(startX - 28, startY + plotHeight - 35);
-  tft.print(y_min, 1);
-  
+  m.flaeche(startX - 30, startY + 5, 25, 20, 0x1082);
+  m.zahl(startX - 28, startY + 10, TFT_TEXT, y_max, 1);
+
+  m.flaeche(startX - 30, startY + plotHeight - 40, 25, 20, 0x1082);
+  m.zahl(startX - 28, startY + plotHeight - 35, TFT_TEXT, y_min, 1);
+
   // Legende
-  tft.fillRoundRect(startX + plotWidth - 90, startY + 5, 80, 65, 5, TFT_OUTLINE);
-  tft.fillRect(startX + plotWidth - 89, startY + 6, 78, 18, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HIGHLIGHT);
-  tft.setCursor(startX + plotWidth - 85, startY + 10);
-  tft.print(faktorNamen[faktor2]);
-  
+  m.rundFlaeche(startX + plotWidth - 90, startY + 5, 80, 65, 5, TFT_OUTLINE);
+  m.flaeche(startX + plotWidth - 89, startY + 6, 78, 18, TFT_TITLE_BG);
+  m.text(startX + plotWidth - 85, startY + 10, TFT_HIGHLIGHT, faktorNamen[faktor2]);
+
   // Linie für Faktor2 = -1
-  tft.setTextColor(TFT_TEXT);
-  tft.drawFastHLine(startX + plotWidth - 80, startY + 35, 20, TFT_TEXT);
+  m.hLinie(startX + plotWidth - 80, startY + 35, 20, TFT_TEXT);
   for (int r = 3; r >= 0; r--) {
-    tft.fillCircle(startX + plotWidth - 70, startY + 35, r, r == 0 ? TFT_TEXT : TFT_TEXT);
+    m.kreisFlaeche(startX + plotWidth - 70, startY + 35, r, TFT_TEXT);
   }
-  tft.setCursor(startX + plotWidth - 45, startY + 32);
-  tft.print("-1");
-  
+  m.text(startX + plotWidth - 45, startY + 32, TFT_TEXT, "-1");
+
   // Linie für Faktor2 = +1
-  tft.drawFastHLine(startX + plotWidth - 80, startY + 55, 20, TFT_CHART_ACCENT);
+  m.hLinie(startX + plotWidth - 80, startY + 55, 20, TFT_CHART_ACCENT);
   for (int r = 3; r >= 0; r--) {
-    tft.fillCircle(startX + plotWidth - 70, startY + 55, r, r == 0 ? TFT_TEXT : TFT_CHART_ACCENT);
+    m.kreisFlaeche(startX + plotWidth - 70, startY + 55, r, r == 0 ? TFT_TEXT : TFT_CHART_ACCENT);
   }
-  tft.setCursor(startX + plotWidth - 45, startY + 52);
-  tft.print("+1");
-  
+  m.text(startX + plotWidth - 45, startY + 52, TFT_TEXT, "+1");
+
   // KORRIGIERT: Linien und Punkte zeichnen (verwende bereits berechnete y_range)
   // Linie für Faktor 2 = -1 (Float-Berechnung mit verbesserter Skalierung)
   float y_scale = (float)(plotHeight - 50) / y_range;
-  
+
   // Berechnung der Y-Positionen mit Begrenzung
   int y1_faktor2_minus = startY + plotHeight - 40 - (int)((y_werte[0] - y_min) * y_scale);
   int y2_faktor2_minus = startY + plotHeight - 40 - (int)((y_werte[1] - y_min) * y_scale);
-  
+
   // Sicherstellen, dass die Punkte innerhalb des Diagramms bleiben
   y1_faktor2_minus = constrain(y1_faktor2_minus, startY + 10, startY + plotHeight - 40);
   y2_faktor2_minus = constrain(y2_faktor2_minus, startY + 10, startY + plotHeight - 40);
-  
+
   // Hauptlinie
-  tft.drawLine(x1, y1_faktor2_minus, x2, y2_faktor2_minus, TFT_TEXT);
-  tft.drawLine(x1, y1_faktor2_minus-1, x2, y2_faktor2_minus-1, TFT_TEXT);
-  tft.drawLine(x1, y1_faktor2_minus+1, x2, y2_faktor2_minus+1, TFT_TEXT);
-  
+  m.linie(x1, y1_faktor2_minus, x2, y2_faktor2_minus, TFT_TEXT);
+  m.linie(x1, y1_faktor2_minus-1, x2, y2_faktor2_minus-1, TFT_TEXT);
+  m.linie(x1, y1_faktor2_minus+1, x2, y2_faktor2_minus+1, TFT_TEXT);
+
   // Punkte
   for (int r = 4; r >= 0; r--) {
     uint16_t color = r == 0 ? TFT_TEXT : (r == 4 ? 0x3186 : TFT_TEXT);
-    tft.fillCircle(x1, y1_faktor2_minus, r, color);
-    tft.fillCircle(x2, y2_faktor2_minus, r, color);
+    m.kreisFlaeche(x1, y1_faktor2_minus, r, color);
+    m.kreisFlaeche(x2, y2_faktor2_minus, r, color);
   }
-  
+
   // Kennzeichnung interpolierter Punkte
   if (!alleNullWerte) {
     if (!datenVorhanden[0]) {
-      tft.drawCircle(x1, y1_faktor2_minus, 6, TFT_WARNING);
+      m.kreis(x1, y1_faktor2_minus, 6, TFT_WARNING);
     }
     if (!datenVorhanden[1]) {
-      tft.drawCircle(x2, y2_faktor2_minus, 6, TFT_WARNING);
+      m.kreis(x2, y2_faktor2_minus, 6, TFT_WARNING);
     }
   }
-  
+
   // Linie für Faktor 2 = +1 (Float-Berechnung mit verbesserter Skalierung)
   int y1_faktor2_plus = startY + plotHeight - 40 - (int)((y_werte[2] - y_min) * y_scale);
   int y2_faktor2_plus = startY + plotHeight - 40 - (int)((y_werte[3] - y_min) * y_scale);
-  
+
   // Sicherstellen, dass die Punkte innerhalb des Diagramms bleiben
   y1_faktor2_plus = constrain(y1_faktor2_plus, startY + 10, startY + plotHeight - 40);
   y2_faktor2_plus = constrain(y2_faktor2_plus, startY + 10, startY + plotHeight - 40);
-  
-  tft.drawLine(x1, y1_faktor2_plus, x2, y2_faktor2_plus, TFT_CHART_ACCENT);
-  tft.drawLine(x1, y1_faktor2_plus-1, x2, y2_faktor2_plus-1, TFT_CHART_ACCENT);
-  tft.drawLine(x1, y1_faktor2_plus+1, x2, y2_faktor2_plus+1, TFT_CHART_ACCENT);
-  
+
+  m.linie(x1, y1_faktor2_plus, x2, y2_faktor2_plus, TFT_CHART_ACCENT);
+  m.linie(x1, y1_faktor2_plus-1, x2, y2_faktor2_plus-1, TFT_CHART_ACCENT);
+  m.linie(x1, y1_faktor2_plus+1, x2, y2_faktor2_plus+1, TFT_CHART_ACCENT);
+
   for (int r = 4; r >= 0; r--) {
     uint16_t color = r == 0 ? TFT_TEXT : (r == 4 ? 0xFB86 : TFT_CHART_ACCENT);
-    tft.fillCircle(x1, y1_faktor2_plus, r, color);
-    tft.fillCircle(x2, y2_faktor2_plus, r, color);
+    m.kreisFlaeche(x1, y1_faktor2_plus, r, color);
+    m.kreisFlaeche(x2, y2_faktor2_plus, r, color);
   }
-  
+
   if (!alleNullWerte) {
     if (!datenVorhanden[2]) {
-      tft.drawCircle(x1, y1_faktor2_plus, 6, TFT_WARNING);
+      m.kreis(x1, y1_faktor2_plus, 6, TFT_WARNING);
     }
     if (!datenVorhanden[3]) {
-      tft.drawCircle(x2, y2_faktor2_plus, 6, TFT_WARNING);
+      m.kreis(x2, y2_faktor2_plus, 6, TFT_WARNING);
     }
   }
-  
+
   // Werte anzeigen
-  tft.setTextColor(TFT_TEXT);
-  tft.setCursor(x1-15, y1_faktor2_minus-15);
-  tft.print(y_werte[0], 1);
-  tft.setCursor(x2-15, y2_faktor2_minus-15);
-  tft.print(y_werte[1], 1);
-  
-  tft.setTextColor(TFT_CHART_ACCENT);
-  tft.setCursor(x1-15, y1_faktor2_plus+10);
-  tft.print(y_werte[2], 1);
-  tft.setCursor(x2-15, y2_faktor2_plus+10);
-  tft.print(y_werte[3], 1);
-  
+  m.zahl(x1-15, y1_faktor2_minus-15, TFT_TEXT, y_werte[0], 1);
+  m.zahl(x2-15, y2_faktor2_minus-15, TFT_TEXT, y_werte[1], 1);
+
+  m.zahl(x1-15, y1_faktor2_plus+10, TFT_CHART_ACCENT, y_werte[2], 1);
+  m.zahl(x2-15, y2_faktor2_plus+10, TFT_CHART_ACCENT, y_werte[3], 1);
+
   // Warnung bei interpolierten Daten
   if (!alleNullWerte) {
     bool hatInterpolierte = false;
@@ -588,50 +439,86 @@ void WindTurbineExperiment::zeigeInteraktionsDiagramm() {
         break;
       }
     }
-    
+
     if (hatInterpolierte) {
-      tft.fillRoundRect(startX, startY + plotHeight, 300, 20, 5, TFT_WARNING);
-      tft.setTextColor(TFT_TEXT);
-      tft.setCursor(startX+5, startY + plotHeight + 5);
-      tft.print("⚠ Gepunktete Punkte = Interpoliert (unvollständige Daten)");
+      m.rundFlaeche(startX, startY + plotHeight, 300, 20, 5, TFT_WARNING);
+      m.text(startX+5, startY + plotHeight + 5, TFT_TEXT, "⚠ Gepunktete Punkte = Interpoliert (unvollständige Daten)");
     }
   } else {
-    tft.fillRoundRect(startX, startY + plotHeight, 250, 20, 5, TFT_TITLE_BG);
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(startX+5, startY + plotHeight + 5);
-    tft.print("Beispieldaten für Interaktionsplot");
+    m.rundFlaeche(startX, startY + plotHeight, 250, 20, 5, TFT_TITLE_BG);
+    m.text(startX+5, startY + plotHeight + 5, TFT_LIGHT_TEXT, "Beispieldaten für Interaktionsplot");
   }
 }
 
+/**
+ * Fehlerbalken (Konfidenzintervall) mit Endstrichen, auf [oben, unten] begrenzt
+ */
+static void fehlerbalken(WindTurbineDiagrammModell& m, int x, int yHoch, int yTief, int oben, int unten) {
+  yHoch = constrain(yHoch, oben, unten);
+  yTief = constrain(yTief, oben, unten);
+  if (yTief - yHoch < 2) return;
+  m.vLinie(x, yHoch, yTief - yHoch + 1, TFT_TEXT);
+  m.hLinie(x - 3, yHoch, 7, TFT_TEXT);
+  m.hLinie(x - 3, yTief, 7, TFT_TEXT);
+}
+
+// Farbverlauf der Diagrammhintergründe (dunkelblau, nach unten heller)
+static uint16_t diagrammVerlauf(int16_t zeile, void* kontext) {
+  return ((TFT_eSPI*)kontext)->color565(4, 10 + zeile/10, 20 + zeile/5);
+}
+
+/**
+ * Zeichnet den Hintergrund mit Farbverlauf für die 220x140-Diagramme
+ * Über DMA kachelweise, sonst zeilenweise wie bisher
+ */
+void WindTurbineExperiment::zeichneDiagrammHintergrund(int x, int y, int breite, int hoehe) {
+  if (dmaRenderer.istBereit() && !compositor.istReparaturAktiv()) {
+    dmaRenderer.fuelleZeilenweise(x, y, breite, hoehe, diagrammVerlauf, &tft);
+  } else {
+    for (int i = 0; i < hoehe; i++) {
+      tft.drawFastHLine(x, y + i, breite, diagrammVerlauf(i, &tft));
+    }
+  }
+}
+
+
 /**
  * Zeigt ein Pareto-Diagramm mit konsistenter Skalierung an
  * MATHEMATISCH KORREKT: Balken und Kurve verwenden beide Prozent-Basis (0-100%)
  */
 void WindTurbineExperiment::zeigeParetoEffekteDiagramm(int x, int y) {
-  int diagrammHoehe = 140;
-  int diagrammBreite = 220;
-  
   // Hintergrund
-  for (int i = 0; i < diagrammHoehe; i++) {
-    uint16_t color = tft.color565(4, 10 + i/10, 20 + i/5);
-    tft.drawFastHLine(x-diagrammBreite, y-diagrammHoehe+i, diagrammBreite, color);
+  zeichneDiagrammHintergrund(x-220, y-140, 220, 140);
+
+  if (diagrammModell.beginneAufnahme(DIAGRAMM_PARETO, x, y, diagrammDatenstand())) {
+    baueParetoEffekteDiagramm(x, y);
+    diagrammModell.beendeAufnahme();
   }
-  
+  diagrammModell.zeichne(DIAGRAMM_PARETO);
+}
+
+/**
+ * Sortiert die Effekte, berechnet Anteile und Kumulation und nimmt das Pareto-Diagramm auf
+ */
+void WindTurbineExperiment::baueParetoEffekteDiagramm(int x, int y) {
+  WindTurbineDiagrammModell& m = diagrammModell;
+  char puffer[8];
+
+  int diagrammHoehe = 140;
+  int diagrammBreite = 220;
+
   // Rahmen
-  tft.drawRoundRect(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
-  
+  m.rundRechteck(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
+
   // Achsen
-  tft.drawFastVLine(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
-  tft.drawFastHLine(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
-  tft.drawFastVLine(x, y-diagrammHoehe, diagrammHoehe, TFT_LIGHT_TEXT); // Rechte Y-Achse
-  
+  m.vLinie(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
+  m.hLinie(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
+  m.vLinie(x, y-diagrammHoehe, diagrammHoehe, TFT_LIGHT_TEXT); // Rechte Y-Achse
+
   // Titel
-  tft.fillRoundRect(x-diagrammBreite/2-60, y-diagrammHoehe-20, 120, 20, 5, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HEADER);
-  tft.setTextSize(1);
-  tft.setCursor(x-diagrammBreite/2-40, y-diagrammHoehe-15);
-  tft.print("Pareto-Diagramm");
-  
+  m.rundFlaeche(x-diagrammBreite/2-60, y-diagrammHoehe-20, 120, 20, 5, TFT_TITLE_BG);
+  m.text(x-diagrammBreite/2-40, y-diagrammHoehe-15, TFT_HEADER, "Pareto-Diagramm");
+
   // Prüfe Daten
   bool alleNullWerte = true;
   for (int i = 0; i < 5; i++) {
@@ -640,18 +527,18 @@ void WindTurbineExperiment::zeigeParetoEffekteDiagramm(int x, int y) {
       break;
     }
   }
-  
+
   // Sortierte Effekte
   int sortierteFaktoren[5];
   float sortierteEffekte[5];
-  
+
   for (int i = 0; i < 5; i++) {
     sortierteFaktoren[i] = i;
-    sortierteEffekte[i] = alleNullWerte ? 
-                        (i == 0 ? 0.9 : (i == 1 ? 0.8 : (i == 2 ? 0.6 : (i == 3 ? 0.4 : 0.3)))) : 
+    sortierteEffekte[i] = alleNullWerte ?
+                        (i == 0 ? 0.9 : (i == 1 ? 0.8 : (i == 2 ? 0.6 : (i == 3 ? 0.4 : 0.3)))) :
                         abs(effekte[i]);
   }
-  
+
   // Sortieren
   for (int i = 0; i < 4; i++) {
     for (int j = 0; j < 4 - i; j++) {
@@ -659,134 +546,223 @@ void WindTurbineExperiment::zeigeParetoEffekteDiagramm(int x, int y) {
         float tempEffekt = sortierteEffekte[j];
         sortierteEffekte[j] = sortierteEffekte[j + 1];
         sortierteEffekte[j + 1] = tempEffekt;
-        
+
         int tempIndex = sortierteFaktoren[j];
         sortierteFaktoren[j] = sortierteFaktoren[j + 1];
         sortierteFaktoren[j + 1] = tempIndex;
       }
     }
   }
-  
+
   // MATHEMATISCH KORREKT: Gesamtsumme für Prozentberechnung
   float summe = 0;
   for (int i = 0; i < 5; i++) {
     summe += sortierteEffekte[i];
   }
-  
+
   // MATHEMATISCH KORREKT: Prozentanteile berechnen (beide Skalen verwenden Prozente)
   float prozentanteile[5];
   float kumulierterProzent[5];
   float laufendeSumme = 0;
-  
+
   for (int i = 0; i < 5; i++) {
     prozentanteile[i] = (summe > 0) ? (sortierteEffekte[i] / summe) * 100.0 : 0;
     laufendeSumme += prozentanteile[i];
     kumulierterProzent[i] = laufendeSumme;
   }
-  
+
   // Y-Achsen-Beschriftung (beide 0-100%)
-  tft.fillRoundRect(x-diagrammBreite-50, y-diagrammHoehe/2-10, 45, 20, 3, TFT_TITLE_BG);
-  tft.setTextColor(TFT_LIGHT_TEXT);
-  tft.setCursor(x-diagrammBreite-45, y-diagrammHoehe/2-5);
-  tft.print("Prozent");
-  
-  // Skala links (Einzeleffekte in %)
-  for (int i = 0; i <= 4; i++) {
-    int y_pos = y - (i * (diagrammHoehe-20)) / 4 - 10;
-    tft.fillRoundRect(x-diagrammBreite-25, y_pos-8, 20, 16, 2, TFT_TITLE_BG);
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x-diagrammBreite-22, y_pos-3);
-    tft.print(i * 25);
-    tft.print("%");
-  }
-  
-  // Skala rechts (Kumuliert 0-100%)
-  for (int i = 0; i <= 4; i++) {
-    int y_pos = y - (i * (diagrammHoehe-20)) / 4 - 10;
-    tft.fillRoundRect(x+5, y_pos-8, 20, 16, 2, TFT_TITLE_BG);
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x+8, y_pos-3);
-    tft.print(i * 25);
-    tft.print("%");
+  m.rundFlaeche(x-diagrammBreite-50, y-diagrammHoehe/2-10, 45, 20, 3, TFT_TITLE_BG);
+  m.text(x-diagrammBreite-45, y-diagrammHoehe/2-5, TFT_LIGHT_TEXT, "Prozent");
+
+  // Skala links (Einzeleffekte in %) und rechts (Kumuliert 0-100%)
+  for (int seite = 0; seite < 2; seite++) {
+    for (int i = 0; i <= 4; i++) {
+      int y_pos = y - (i * (diagrammHoehe-20)) / 4 - 10;
+      snprintf(puffer, sizeof(puffer), "%d%%", i * 25);
+      if (seite == 0) {
+        m.rundFlaeche(x-diagrammBreite-25, y_pos-8, 20, 16, 2, TFT_TITLE_BG);
+        m.text(x-diagrammBreite-22, y_pos-3, TFT_LIGHT_TEXT, puffer);
+      } else {
+        m.rundFlaeche(x+5, y_pos-8, 20, 16, 2, TFT_TITLE_BG);
+        m.text(x+8, y_pos-3, TFT_LIGHT_TEXT, puffer);
+      }
+    }
   }
-  
+
   // Referenzlinien
   for (int i = 1; i <= 4; i++) {
     int y_line = y - (i * (diagrammHoehe-20)) / 4 - 10;
-    for (int x_dash = x-diagrammBreite+5; x_dash < x; x_dash += 10) {
-      tft.drawFastHLine(x_dash, y_line, 5, 0x39E7);
-    }
+    m.strichLinie(x-diagrammBreite+5, y_line, x, 0x39E7);
   }
-  
+
   // Balkenbreite
   int balkenBreite = (diagrammBreite - 30) / 5;
-  
+
   // MATHEMATISCH KORREKT: Balken und Kurve zeichnen (beide in Prozent)
   for (int i = 0; i < 5; i++) {
     int balkenX = x - diagrammBreite + 20 + i * balkenBreite;
-    
+
     // MATHEMATISCH KORREKT: Balkenhöhe basierend auf Prozentanteil (nicht absoluter Wert)
     int balkenHoehe = (prozentanteile[i] / 100.0) * (diagrammHoehe - 20);
     if (balkenHoehe < 2 && prozentanteile[i] > 0) balkenHoehe = 2;
-    
+
     // Balken zeichnen
-    for (int h = 0; h < balkenHoehe; h++) {
-      uint16_t currentColor = tft.color565(0, 100 - h/3, 150 + h/2);
-      tft.drawFastHLine(balkenX, y - balkenHoehe - 10 + h, balkenBreite - 8, currentColor);
-    }
-    
-    tft.drawRect(balkenX, y - balkenHoehe - 10, balkenBreite - 8, balkenHoehe, TFT_HIGHLIGHT);
-    
+    m.verlauf(balkenX, y - balkenHoehe - 10, balkenBreite - 8, balkenHoehe, VERLAUF_PARETO);
+    m.rechteck(balkenX, y - balkenHoehe - 10, balkenBreite - 8, balkenHoehe, TFT_HIGHLIGHT);
+
     // Prozentanteil über dem Balken
-    tft.setTextColor(TFT_TEXT);
-    tft.setCursor(balkenX, y - balkenHoehe - 25);
-    tft.print(prozentanteile[i], 1);
-    tft.print("%");
-    
+    m.zahl(balkenX, y - balkenHoehe - 25, TFT_TEXT, prozentanteile[i], 1, "%");
+
     // Faktorbezeichnung
-    tft.fillRoundRect(balkenX, y + 5, balkenBreite - 8, 15, 3, TFT_TITLE_BG);
-    tft.setTextColor(TFT_TEXT);
-    tft.setCursor(balkenX + (balkenBreite-8)/2 - 3, y + 8);
-    tft.print(faktorNamen[sortierteFaktoren[i]][0]);
-    
+    char kuerzel[2] = {faktorNamen[sortierteFaktoren[i]][0], '\0'};
+    m.rundFlaeche(balkenX, y + 5, balkenBreite - 8, 15, 3, TFT_TITLE_BG);
+    m.text(balkenX + (balkenBreite-8)/2 - 3, y + 8, TFT_TEXT, kuerzel);
+
     // MATHEMATISCH KORREKT: Pareto-Kurve (kumulierte Prozente) mit verbesserter Positionierung
     int paretoY = y - (kumulierterProzent[i] / 100.0) * (diagrammHoehe - 20) - 10;
     // Sicherstellen, dass die Punkte innerhalb des Diagramms bleiben
     paretoY = constrain(paretoY, y - diagrammHoehe + 10, y - 10);
-    
+
     int punktX = balkenX + (balkenBreite - 8) / 2;
-    
+
     // Linie zur nächsten (falls vorhanden) mit verbesserter Positionierung
     if (i > 0) {
       int vorherX = x - diagrammBreite + 20 + (i-1) * balkenBreite + (balkenBreite - 8) / 2;
       int vorherY = y - (kumulierterProzent[i-1] / 100.0) * (diagrammHoehe - 20) - 10;
-      
+
       // Sicherstellen, dass der vorherige Punkt innerhalb des Diagramms bleibt
       vorherY = constrain(vorherY, y - diagrammHoehe + 10, y - 10);
-      
-      tft.drawLine(vorherX, vorherY, punktX, paretoY, TFT_WARNING);
-      tft.drawLine(vorherX, vorherY-1, punktX, paretoY-1, 0xFD40);
+
+      m.linie(vorherX, vorherY, punktX, paretoY, TFT_WARNING);
+      m.linie(vorherX, vorherY-1, punktX, paretoY-1, 0xFD40);
     }
-    
+
     // Pareto-Punkt
     for (int r = 3; r >= 0; r--) {
       uint16_t color = r == 0 ? TFT_TEXT : (r == 3 ? 0xFD40 : TFT_WARNING);
-      tft.fillCircle(punktX, paretoY, r, color);
+      m.kreisFlaeche(punktX, paretoY, r, color);
     }
-    
+
     // Kumulierter Prozentwert
-    tft.setTextColor(TFT_WARNING);
-    tft.setCursor(punktX + 8, paretoY - 5);
-    tft.print((int)kumulierterProzent[i]);
-    tft.print("%");
+    snprintf(puffer, sizeof(puffer), "%d%%", (int)kumulierterProzent[i]);
+    m.text(punktX + 8, paretoY - 5, TFT_WARNING, puffer);
   }
-  
+
   // Hinweis auf korrekte Skalierung
   if (alleNullWerte) {
-    tft.fillRoundRect(x-diagrammBreite+20, y+25, 180, 15, 3, TFT_SUCCESS);
-    tft.setTextColor(TFT_TEXT);
-    tft.setCursor(x-diagrammBreite+25, y+28);
-    tft.print("Prozent-Skalierung für Balken und Kurve");
+    m.rundFlaeche(x-diagrammBreite+20, y+25, 180, 15, 3, TFT_SUCCESS);
+    m.text(x-diagrammBreite+25, y+28, TFT_TEXT, "Prozent-Skalierung für Balken und Kurve");
+  }
+}
+
+/**
+ * Zeigt das Halbnormal-Diagramm aller Kontraste des Teilplans mit Lenths Fehlergrenzen an
+ */
+void WindTurbineExperiment::zeigeHalbnormalDiagramm(int x, int y) {
+  // Hintergrund
+  zeichneDiagrammHintergrund(x-220, y-140, 220, 140);
+
+  if (diagrammModell.beginneAufnahme(DIAGRAMM_HALBNORMAL, x, y, diagrammDatenstand())) {
+    baueHalbnormalDiagramm(x, y);
+    diagrammModell.beendeAufnahme();
+  }
+  diagrammModell.zeichne(DIAGRAMM_HALBNORMAL);
+}
+
+/**
+ * Gestrichelte senkrechte Grenzlinie mit Beschriftung oben (links oder rechts der Linie)
+ */
+static void grenzLinie(WindTurbineDiagrammModell& m, int x, int yOben, int yUnten, uint16_t farbe, const char* name, bool links) {
+  for (int y = yOben; y < yUnten; y += 8) {
+    m.vLinie(x, y, min(4, yUnten - y), farbe);
+  }
+  m.text(links ? x - 6 * strlen(name) - 2 : x + 3, yOben - 10, farbe, name);
+}
+
+/**
+ * Beträge gegen Halbnormal-Quantile, Gerade durch den Ursprung mit Steigung PSE,
+ * ME und SME als senkrechte Grenzen
+ */
+void WindTurbineExperiment::baueHalbnormalDiagramm(int x, int y) {
+  WindTurbineDiagrammModell& m = diagrammModell;
+
+  int diagrammHoehe = 140;
+  int diagrammBreite = 220;
+
+  // Rahmen und Achsen
+  m.rundRechteck(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
+  m.vLinie(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
+  m.hLinie(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
+
+  // Titel
+  m.rundFlaeche(x-diagrammBreite/2-60, y-diagrammHoehe-20, 120, 20, 5, TFT_TITLE_BG);
+  m.text(x-diagrammBreite/2-51, y-diagrammHoehe-15, TFT_HEADER, "Halbnormal-Diagramm");
+
+  aktualisiereAuswertung();
+  if (!teilLenth.istGueltig()) {
+    m.rundFlaeche(x-diagrammBreite+40, y-diagrammHoehe/2-8, 140, 15, 3, TFT_TITLE_BG);
+    // Ohne Streuung zwischen den Kontrasten (exakt lineare Daten) ist PSE = 0
+    m.text(x-diagrammBreite+45, y-diagrammHoehe/2-5, TFT_LIGHT_TEXT,
+           teilAnalyse.istGueltig() ? "PSE = 0 (keine Streuung)" : "Keine Effektdaten");
+    return;
+  }
+
+  int anzahl = teilLenth.anzahlEffekte();
+  int links = x - diagrammBreite + 10;
+  int rechts = x - 10;
+  int oben = y - diagrammHoehe + 20;
+  int unten = y - 10;
+
+  // Skalen: größter Betrag bzw. SME, größtes Quantil
+  float maxBetrag = max((float)fabs(teilLenth.effekt(anzahl - 1)), teilLenth.sme()) * 1.1;
+  float maxQuantil = teilLenth.quantil(anzahl - 1) * 1.1;
+  if (maxBetrag <= 0) maxBetrag = 1;
+
+  // Y-Achse: Quantile 0, 1, 2 ...
+  m.rundFlaeche(x-diagrammBreite-50, y-diagrammHoehe, 45, 20, 3, TFT_TITLE_BG);
+  m.text(x-diagrammBreite-45, y-diagrammHoehe+5, TFT_LIGHT_TEXT, "Quantil");
+  for (int q = 0; q <= (int)maxQuantil; q++) {
+    int yPos = unten - q / maxQuantil * (unten - oben);
+    if (q > 0) m.strichLinie(links, yPos, x, 0x39E7);
+    m.zahl(x-diagrammBreite-12, yPos-3, TFT_LIGHT_TEXT, q, 0);
+  }
+
+  // X-Achse: |Effekt| in uW
+  for (int i = 0; i <= 2; i++) {
+    int xPos = links + i * (rechts - links) / 2;
+    m.zahl(xPos - 6, y + 5, TFT_LIGHT_TEXT, maxBetrag * i / 2, 2);
+  }
+  m.text(x - 78, y + 17, TFT_LIGHT_TEXT, "|Effekt| (uW)");
+
+  // Gerade der inaktiven Effekte: |c| = PSE * q (am Rand abgeschnitten)
+  float endQuantil = maxQuantil;
+  if (teilLenth.pse() * endQuantil > maxBetrag) endQuantil = maxBetrag / teilLenth.pse();
+  int endeX = links + teilLenth.pse() * endQuantil / maxBetrag * (rechts - links);
+  int endeY = unten - endQuantil / maxQuantil * (unten - oben);
+  m.linie(links, unten, endeX, endeY, TFT_GRID);
+
+  // Fehlergrenzen
+  int meX = links + teilLenth.me() / maxBetrag * (rechts - links);
+  int smeX = links + teilLenth.sme() / maxBetrag * (rechts - links);
+  grenzLinie(m, meX, oben, unten, TFT_CHART_ACCENT, "ME", true);
+  grenzLinie(m, smeX, oben, unten, TFT_WARNING, "SME", false);
+
+  // Punkte, auffällige Effekte mit Aliasnamen
+  for (int rang = 0; rang < anzahl; rang++) {
+    int px = links + fabs(teilLenth.effekt(rang)) / maxBetrag * (rechts - links);
+    int py = unten - teilLenth.quantil(rang) / maxQuantil * (unten - oben);
+    uint16_t farbe = teilLenth.istAktiv(rang) ? TFT_WARNING :
+                     (teilLenth.istAuffaellig(rang) ? TFT_CHART_ACCENT : TFT_HIGHLIGHT);
+    m.kreisFlaeche(px, py, 3, farbe);
+    m.kreis(px, py, 3, TFT_TEXT);
+
+    // Die drei größten Beträge immer beschriften
+    if (teilLenth.istAuffaellig(rang) || rang >= anzahl - 3) {
+      char name[8];
+      teilAlias.formatiereKette(teilLenth.wort(rang), name, sizeof(name), 1);
+      m.text(px - 6 * strlen(name) - 5, py - 3, TFT_TEXT, name);
+    }
   }
 }
 
@@ -795,44 +771,49 @@ void WindTurbineExperiment::zeigeParetoEffekteDiagramm(int x, int y) {
  * MATHEMATISCH KORREKT: Bereits korrekt implementiert
  */
 void WindTurbineExperiment::zeigeEffekteDiagramm(int x, int y) {
+  // Hintergrund mit leichtem Farbverlauf
+  zeichneDiagrammHintergrund(x-220, y-140, 220, 140);
+
+  if (diagrammModell.beginneAufnahme(DIAGRAMM_EFFEKTE, x, y, diagrammDatenstand())) {
+    baueEffekteDiagramm(x, y);
+    diagrammModell.beendeAufnahme();
+  }
+  diagrammModell.zeichne(DIAGRAMM_EFFEKTE);
+}
+
+/**
+ * Skaliert die Effekte auf die Diagrammhöhe und nimmt das Balkendiagramm auf
+ */
+void WindTurbineExperiment::baueEffekteDiagramm(int x, int y) {
+  WindTurbineDiagrammModell& m = diagrammModell;
+  char puffer[8];
+
   // Diagrammbereich mit abgerundeten Ecken
   int diagrammHoehe = 140;
   int diagrammBreite = 220;
-  
-  // Hintergrund mit leichtem Farbverlauf
-  for (int i = 0; i < diagrammHoehe; i++) {
-    uint16_t color = tft.color565(4, 10 + i/10, 20 + i/5);
-    tft.drawFastHLine(x-diagrammBreite, y-diagrammHoehe+i, diagrammBreite, color);
-  }
-  
+
   // Rahmen zeichnen
-  tft.drawRoundRect(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
-  
+  m.rundRechteck(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
+
   // Y-Achse zeichnen
-  tft.drawFastVLine(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
-  
+  m.vLinie(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
+
   // X-Achse zeichnen
-  tft.drawFastHLine(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
-  
+  m.hLinie(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
+
   // Horizontale Nulllinie
-  tft.drawFastHLine(x-diagrammBreite, y-diagrammHoehe/2, diagrammBreite, TFT_GRID);
-  tft.fillRoundRect(x-diagrammBreite-25, y-diagrammHoehe/2-10, 20, 20, 3, TFT_TITLE_BG);
-  tft.setTextColor(TFT_LIGHT_TEXT);
-  tft.setTextSize(1);
-  tft.setCursor(x-diagrammBreite-20, y-diagrammHoehe/2-5);
-  tft.print("0");
-  
+  m.hLinie(x-diagrammBreite, y-diagrammHoehe/2, diagrammBreite, TFT_GRID);
+  m.rundFlaeche(x-diagrammBreite-25, y-diagrammHoehe/2-10, 20, 20, 3, TFT_TITLE_BG);
+  m.text(x-diagrammBreite-20, y-diagrammHoehe/2-5, TFT_LIGHT_TEXT, "0");
+
   // Diagrammtitel
-  tft.fillRoundRect(x-diagrammBreite/2-60, y-diagrammHoehe-20, 120, 20, 5, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HEADER);
-  tft.setTextSize(1);
-  tft.setCursor(x-diagrammBreite/2-40, y-diagrammHoehe-15);
-  tft.print("Effektstaerken");
-  
+  m.rundFlaeche(x-diagrammBreite/2-60, y-diagrammHoehe-20, 120, 20, 5, TFT_TITLE_BG);
+  m.text(x-diagrammBreite/2-40, y-diagrammHoehe-15, TFT_HEADER, "Effektstaerken");
+
   // Finde maximalen Effekt
   float maxEffekt = 0;
   bool alleNullWerte = true;
-  
+
   for (int i = 0; i < 5; i++) {
     if (abs(effekte[i]) > maxEffekt) {
       maxEffekt = abs(effekte[i]);
@@ -841,93 +822,80 @@ void WindTurbineExperiment::zeigeEffekteDiagramm(int x, int y) {
       alleNullWerte = false;
     }
   }
-  
+
+  int balkenBreite = (diagrammBreite - 30) / 5;
+
   if (alleNullWerte) {
     float testEffekte[5] = {0.5, -0.3, 0.2, -0.7, 0.4};
     maxEffekt = 0.7;
-    
-    int balkenBreite = (diagrammBreite - 30) / 5;
+
     float skalierung = (diagrammHoehe/2) / (maxEffekt * 1.2);
-    
+
     for (int i = 0; i < 5; i++) {
       int balkenX = x - diagrammBreite + 20 + i * balkenBreite;
       int balkenHoehe = abs(testEffekte[i]) * skalierung;
       int balkenY = testEffekte[i] > 0 ? y - diagrammHoehe/2 - balkenHoehe : y - diagrammHoehe/2;
-      
+
       if (testEffekte[i] > 0) {
-        for (int h = 0; h < balkenHoehe; h++) {
-          uint16_t color = tft.color565(0, 120 - h, 0);
-          tft.drawFastHLine(balkenX, balkenY + h, balkenBreite-8, color);
-        }
-        tft.drawRect(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_SUCCESS);
+        m.verlauf(balkenX, balkenY, balkenBreite-8, balkenHoehe, VERLAUF_GRUEN_STARK);
+        m.rechteck(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_SUCCESS);
       } else {
-        for (int h = 0; h < balkenHoehe; h++) {
-          uint16_t color = tft.color565(120 - h, 0, 0);
-          tft.drawFastHLine(balkenX, balkenY + h, balkenBreite-8, color);
-        }
-        tft.drawRect(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_WARNING);
+        m.verlauf(balkenX, balkenY, balkenBreite-8, balkenHoehe, VERLAUF_ROT_STARK);
+        m.rechteck(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_WARNING);
       }
-      
-      tft.setTextColor(TFT_TEXT);
-      tft.setCursor(balkenX, testEffekte[i] > 0 ? balkenY - 15 : balkenY + balkenHoehe + 5);
-      tft.print(testEffekte[i], 1);
+
+      m.zahl(balkenX, testEffekte[i] > 0 ? balkenY - 15 : balkenY + balkenHoehe + 5, TFT_TEXT, testEffekte[i], 1);
     }
-    
-    tft.fillRoundRect(x-diagrammBreite+40, y-15, 140, 15, 3, TFT_TITLE_BG);
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x-diagrammBreite+45, y-12);
-    tft.print("Beispieldaten");
+
+    m.rundFlaeche(x-diagrammBreite+40, y-15, 140, 15, 3, TFT_TITLE_BG);
+    m.text(x-diagrammBreite+45, y-12, TFT_LIGHT_TEXT, "Beispieldaten");
   } else {
     // Reale Daten mit verbesserter Skalierung
     // Sicherstellen, dass die Skalierung nicht zu groß wird
     float skalierung = (diagrammHoehe/2 - 15) / (maxEffekt > 0 ? maxEffekt * 1.2 : 1);
-    int balkenBreite = (diagrammBreite - 30) / 5;
-    
+    aktualisiereAuswertung();
+    float halbbreite = teilAnalyse.konfidenzHalbbreite();
+
     for (int i = 0; i < 5; i++) {
       int balkenX = x - diagrammBreite + 20 + i * balkenBreite;
       int balkenHoehe = abs(effekte[i]) * skalierung;
       if (balkenHoehe < 2 && effekte[i] != 0) balkenHoehe = 2;
       int balkenY = effekte[i] > 0 ? y - diagrammHoehe/2 - balkenHoehe : y - diagrammHoehe/2;
-      
+
       if (effekte[i] > 0) {
-        for (int h = 0; h < balkenHoehe; h++) {
-          uint16_t color = tft.color565(0, 120 - h/2, 0);
-          tft.drawFastHLine(balkenX, balkenY + h, balkenBreite-8, color);
-        }
-        tft.drawRect(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_SUCCESS);
+        m.verlauf(balkenX, balkenY, balkenBreite-8, balkenHoehe, VERLAUF_GRUEN);
+        m.rechteck(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_SUCCESS);
       } else if (effekte[i] < 0) {
-        for (int h = 0; h < balkenHoehe; h++) {
-          uint16_t color = tft.color565(120 - h/2, 0, 0);
-          tft.drawFastHLine(balkenX, balkenY + h, balkenBreite-8, color);
-        }
-        tft.drawRect(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_WARNING);
+        m.verlauf(balkenX, balkenY, balkenBreite-8, balkenHoehe, VERLAUF_ROT);
+        m.rechteck(balkenX, balkenY, balkenBreite-8, balkenHoehe, TFT_WARNING);
       }
-      
+
       if (effekte[i] != 0) {
-        tft.setTextColor(TFT_TEXT);
-        tft.setCursor(balkenX, effekte[i] > 0 ? balkenY - 15 : balkenY + balkenHoehe + 5);
-        tft.print(effekte[i], 1);
+        m.zahl(balkenX, effekte[i] > 0 ? balkenY - 15 : balkenY + balkenHoehe + 5, TFT_TEXT, effekte[i], 1);
+      }
+
+      // Konfidenzintervall des Effekts
+      if (halbbreite > 0) {
+        int nullY = y - diagrammHoehe/2;
+        fehlerbalken(m, balkenX + (balkenBreite-8)/2,
+                     nullY - (effekte[i] + halbbreite) * skalierung, nullY - (effekte[i] - halbbreite) * skalierung,
+                     y - diagrammHoehe + 2, y - 2);
       }
     }
   }
-  
+
   // Faktorbezeichnungen
-  tft.setTextColor(TFT_TEXT);
-  int balkenBreite = (diagrammBreite - 30) / 5;
   for (int i = 0; i < 5; i++) {
     int balkenX = x - diagrammBreite + 20 + i * balkenBreite;
-    tft.fillRoundRect(balkenX, y+5, balkenBreite-8, 15, 3, TFT_TITLE_BG);
-    tft.setCursor(balkenX + (balkenBreite-8)/2 - 3, y+8);
-    tft.print(i+1);
+    m.rundFlaeche(balkenX, y+5, balkenBreite-8, 15, 3, TFT_TITLE_BG);
+    snprintf(puffer, sizeof(puffer), "%d", i+1);
+    m.text(balkenX + (balkenBreite-8)/2 - 3, y+8, TFT_TEXT, puffer);
   }
-  
+
   // Legende
-  tft.fillRoundRect(x-diagrammBreite+30, y+25, 160, 30, 5, TFT_OUTLINE);
-  tft.setTextColor(TFT_LIGHT_TEXT);
-  tft.setCursor(x-diagrammBreite+35, y+30);
-  tft.print("1=St. 2=Gr. 3=Ab.");
-  tft.setCursor(x-diagrammBreite+35, y+45);
-  tft.print("4=Lu. 5=Bl.");
+  m.rundFlaeche(x-diagrammBreite+30, y+25, 160, 30, 5, TFT_OUTLINE);
+  m.text(x-diagrammBreite+35, y+30, TFT_LIGHT_TEXT, "1=St. 2=Gr. 3=Ab.");
+  m.text(x-diagrammBreite+35, y+45, TFT_LIGHT_TEXT, "4=Lu. 5=Bl.");
 }
 
 /**
@@ -935,26 +903,34 @@ void WindTurbineExperiment::zeigeEffekteDiagramm(int x, int y) {
  * MATHEMATISCH KORREKT: Bereits korrekt implementiert
  */
 void WindTurbineExperiment::zeigeVollfaktoriellDiagramm(int x, int y) {
-  int diagrammHoehe = 140;
-  int diagrammBreite = 220;
-  
   // Hintergrund
-  for (int i = 0; i < diagrammHoehe; i++) {
-    uint16_t color = tft.color565(4, 10 + i/10, 20 + i/5);
-    tft.drawFastHLine(x-diagrammBreite, y-diagrammHoehe+i, diagrammBreite, color);
+  zeichneDiagrammHintergrund(x-220, y-140, 220, 140);
+
+  if (diagrammModell.beginneAufnahme(DIAGRAMM_VOLLFAKTORIELL, x, y, diagrammDatenstand())) {
+    baueVollfaktoriellDiagramm(x, y);
+    diagrammModell.beendeAufnahme();
   }
-  
-  tft.drawRoundRect(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
-  tft.drawFastVLine(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
-  tft.drawFastHLine(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
-  
+  diagrammModell.zeichne(DIAGRAMM_VOLLFAKTORIELL);
+}
+
+/**
+ * Skaliert die vollfaktoriellen Mittelwerte und nimmt das Balkendiagramm auf
+ */
+void WindTurbineExperiment::baueVollfaktoriellDiagramm(int x, int y) {
+  WindTurbineDiagrammModell& m = diagrammModell;
+  char puffer[8];
+
+  int diagrammHoehe = 140;
+  int diagrammBreite = 220;
+
+  m.rundRechteck(x-diagrammBreite, y-diagrammHoehe, diagrammBreite, diagrammHoehe, 5, TFT_OUTLINE);
+  m.vLinie(x-diagrammBreite, y-diagrammHoehe, diagrammHoehe, TFT_GRID);
+  m.hLinie(x-diagrammBreite, y, diagrammBreite, TFT_GRID);
+
   // Titel
-  tft.fillRoundRect(x-diagrammBreite/2-70, y-diagrammHoehe-20, 140, 20, 5, TFT_TITLE_BG);
-  tft.setTextColor(TFT_HEADER);
-  tft.setTextSize(1);
-  tft.setCursor(x-diagrammBreite/2-60, y-diagrammHoehe-15);
-  tft.print("Vollfaktorieller Vergleich");
-  
+  m.rundFlaeche(x-diagrammBreite/2-70, y-diagrammHoehe-20, 140, 20, 5, TFT_TITLE_BG);
+  m.text(x-diagrammBreite/2-60, y-diagrammHoehe-15, TFT_HEADER, "Vollfaktorieller Vergleich");
+
   bool alleNullWerte = true;
   for (int i = 0; i < 8; i++) {
     if (vollfaktoriellMittelwerte[i] != 0) {
@@ -962,47 +938,39 @@ void WindTurbineExperiment::zeigeVollfaktoriellDiagramm(int x, int y) {
       break;
     }
   }
-  
+
+  int balkenBreite = (diagrammBreite - 20) / 8;
+
   if (alleNullWerte) {
     float testWerte[8] = {0.8, 1.2, 0.7, 1.5, 0.9, 1.4, 1.1, 1.8};
     float minWert = 0.7;
     float maxWert = 1.8;
-    
+
     float werteBereich = maxWert - minWert;
     float skalierung = (diagrammHoehe - 30) / werteBereich;
-    int balkenBreite = (diagrammBreite - 20) / 8;
-    
+
     for (int i = 0; i < 8; i++) {
       int balkenX = x - diagrammBreite + 10 + i * balkenBreite;
       int balkenHoehe = (testWerte[i] - minWert) * skalierung;
       if (balkenHoehe < 2) balkenHoehe = 2;
-      
-      for (int h = 0; h < balkenHoehe; h++) {
-        uint16_t currentColor = tft.color565(0, 80 + h/3, 120 + h/2);
-        tft.drawFastHLine(balkenX, y-h-15, balkenBreite-2, currentColor);
-      }
-      
-      tft.drawRect(balkenX, y-balkenHoehe-15, balkenBreite-2, balkenHoehe, TFT_HIGHLIGHT);
-      
-      tft.setTextColor(TFT_TEXT);
-      tft.setCursor(balkenX, y-balkenHoehe-30);
-      tft.print(testWerte[i], 1);
+
+      m.verlauf(balkenX, y-balkenHoehe-14, balkenBreite-2, balkenHoehe, VERLAUF_VOLLFAKTORIELL);
+      m.rechteck(balkenX, y-balkenHoehe-15, balkenBreite-2, balkenHoehe, TFT_HIGHLIGHT);
+      m.zahl(balkenX, y-balkenHoehe-30, TFT_TEXT, testWerte[i], 1);
     }
-    
-    tft.fillRoundRect(x-diagrammBreite+40, y-diagrammHoehe+5, 140, 15, 3, TFT_TITLE_BG);
-    tft.setTextColor(TFT_LIGHT_TEXT);
-    tft.setCursor(x-diagrammBreite+45, y-diagrammHoehe+8);
-    tft.print("Beispieldaten");
+
+    m.rundFlaeche(x-diagrammBreite+40, y-diagrammHoehe+5, 140, 15, 3, TFT_TITLE_BG);
+    m.text(x-diagrammBreite+45, y-diagrammHoehe+8, TFT_LIGHT_TEXT, "Beispieldaten");
   } else {
     // Reale Daten
     float minWert = vollfaktoriellMittelwerte[0];
     float maxWert = vollfaktoriellMittelwerte[0];
-    
+
     for (int i = 1; i < 8; i++) {
       if (vollfaktoriellMittelwerte[i] < minWert) minWert = vollfaktoriellMittelwerte[i];
       if (vollfaktoriellMittelwerte[i] > maxWert) maxWert = vollfaktoriellMittelwerte[i];
     }
-    
+
     if (minWert == maxWert) {
       if (minWert == 0) {
         maxWert = 1.0;
@@ -1011,40 +979,40 @@ void WindTurbineExperiment::zeigeVollfaktoriellDiagramm(int x, int y) {
         maxWert = maxWert * 1.2;
       }
     }
-    
+
     float werteBereich = maxWert - minWert;
     // Verbesserte Skalierung mit mehr Platz am oberen Rand
     float skalierung = (diagrammHoehe - 40) / (werteBereich > 0 ? werteBereich : 1);
-    int balkenBreite = (diagrammBreite - 20) / 8;
-    
+    aktualisiereAuswertung();
+
     for (int i = 0; i < 8; i++) {
       int balkenX = x - diagrammBreite + 10 + i * balkenBreite;
       int balkenHoehe = (vollfaktoriellMittelwerte[i] - minWert) * skalierung;
       if (balkenHoehe < 2 && vollfaktoriellMittelwerte[i] > 0) balkenHoehe = 2;
-      
+
       // Sicherstellen, dass die Balken nicht zu hoch werden und im Diagramm bleiben
       balkenHoehe = constrain(balkenHoehe, 0, diagrammHoehe - 25);
-      
-      for (int h = 0; h < balkenHoehe; h++) {
-        uint16_t currentColor = tft.color565(0, 80 + h/3, 120 + h/2);
-        tft.drawFastHLine(balkenX, y-h-15, balkenBreite-2, currentColor);
+
+      // Verlauf von unten (y-15) nach oben
+      m.verlauf(balkenX, y-balkenHoehe-14, balkenBreite-2, balkenHoehe, VERLAUF_VOLLFAKTORIELL);
+      m.rechteck(balkenX, y-balkenHoehe-15, balkenBreite-2, balkenHoehe, TFT_HIGHLIGHT);
+      m.zahl(balkenX, y-balkenHoehe-30, TFT_TEXT, vollfaktoriellMittelwerte[i], 1);
+
+      // Konfidenzintervall des Versuchsmittelwerts
+      float halbbreite = vollAnalyse.versuchsHalbbreite(i);
+      if (halbbreite > 0) {
+        int mitteY = y - 15 - (vollfaktoriellMittelwerte[i] - minWert) * skalierung;
+        fehlerbalken(m, balkenX + (balkenBreite-2)/2, mitteY - halbbreite * skalierung, mitteY + halbbreite * skalierung,
+                     y - diagrammHoehe + 2, y - 2);
       }
-      
-      tft.drawRect(balkenX, y-balkenHoehe-15, balkenBreite-2, balkenHoehe, TFT_HIGHLIGHT);
-      
-      tft.setTextColor(TFT_TEXT);
-      tft.setCursor(balkenX, y-balkenHoehe-30);
-      tft.print(vollfaktoriellMittelwerte[i], 1);
     }
   }
-  
+
   // Versuchsnummern
-  tft.setTextColor(TFT_TEXT);
-  int balkenBreite = (diagrammBreite - 20) / 8;
   for (int i = 0; i < 8; i++) {
     int balkenX = x - diagrammBreite + 10 + i * balkenBreite;
-    tft.fillRoundRect(balkenX, y+5, balkenBreite-2, 15, 3, TFT_TITLE_BG);
-    tft.setCursor(balkenX + (balkenBreite-2)/2 - 3, y+8);
-    tft.print(i+1);
+    m.rundFlaeche(balkenX, y+5, balkenBreite-2, 15, 3, TFT_TITLE_BG);
+    snprintf(puffer, sizeof(puffer), "%d", i+1);
+    m.text(balkenX + (balkenBreite-2)/2 - 3, y+8, TFT_TEXT, puffer);
   }
 }
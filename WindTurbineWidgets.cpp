@@ -0,0 +1,351 @@
+/**
+ * WindTurbineWidgets.cpp
+ * Widget-Schicht mit Vergleich der Eigenschaften
+ */
+
+#include "WindTurbineWidgets.h"
+
+WindTurbineWidgetBaum::WindTurbineWidgetBaum() :
+  tft(nullptr),
+  schrift(nullptr),
+  anzahl(0)
+{
+}
+
+void WindTurbineWidgetBaum::begin(TFT_eSPI* display, WindTurbineSchrift* schriften) {
+  tft = display;
+  schrift = schriften;
+}
+
+void WindTurbineWidgetBaum::leeren() {
+  anzahl = 0;
+}
+
+/**
+ * Legt ein Widget mit Standardeigenschaften an
+ * @param eltern Kennung des Elternelements oder -1 für den Bildschirm
+ * @return Kennung des Widgets oder -1
+ */
+int WindTurbineWidgetBaum::fuegeHinzu(WidgetTyp typ, int16_t x, int16_t y, int16_t w, int16_t h, int eltern) {
+  if (anzahl >= WIDGET_MAX_ANZAHL) {
+    Serial.println("Widgets: Maximale Anzahl erreicht");
+    return -1;
+  }
+  if (eltern >= anzahl) {
+    eltern = -1;
+  }
+
+  Widget& widget = widgets[anzahl];
+  widget.typ = typ;
+  widget.eltern = eltern;
+  widget.gezeichnet = false;
+  widget.zeichner = nullptr;
+  widget.kontext = nullptr;
+
+  WidgetEigenschaften& e = widget.soll;
+  memset(&e, 0, sizeof(e));
+  e.x = x;
+  e.y = y;
+  e.w = w;
+  e.h = h;
+  e.vordergrund = TFT_TEXT;
+  e.hintergrund = (eltern >= 0) ? widgets[eltern].soll.hintergrund : TFT_BACKGROUND;
+  e.akzent = TFT_HIGHLIGHT;
+  e.textGroesse = 1;
+  e.sichtbar = true;
+
+  // Typabhängige Vorgaben wie bei den bisherigen Zeichenfunktionen
+  if (typ == WIDGET_TITELBALKEN) {
+    e.vordergrund = TFT_HEADER;
+    e.hintergrund = TFT_TITLE_BG;
+    e.radius = 5;
+  } else if (typ == WIDGET_STATUSLEISTE) {
+    e.hintergrund = TFT_STATUS_BAR;
+  } else if (typ == WIDGET_BALKEN) {
+    e.vordergrund = TFT_SUCCESS;
+    e.akzent = TFT_GRID;
+  }
+
+  widget.ist = e;
+  return anzahl++;
+}
+
+bool WindTurbineWidgetBaum::gueltig(int id) {
+  return id >= 0 && id < anzahl;
+}
+
+void WindTurbineWidgetBaum::setzeText(int id, const char* text) {
+  if (!gueltig(id)) return;
+  strncpy(widgets[id].soll.text, text, WIDGET_MAX_TEXT - 1);
+  widgets[id].soll.text[WIDGET_MAX_TEXT - 1] = '\0';
+}
+
+void WindTurbineWidgetBaum::setzeFarben(int id, uint16_t vordergrund, uint16_t hintergrund) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.vordergrund = vordergrund;
+  widgets[id].soll.hintergrund = hintergrund;
+}
+
+void WindTurbineWidgetBaum::setzeAkzent(int id, uint16_t akzent) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.akzent = akzent;
+}
+
+void WindTurbineWidgetBaum::setzeTextGroesse(int id, uint8_t groesse) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.textGroesse = groesse;
+}
+
+void WindTurbineWidgetBaum::setzeRadius(int id, uint8_t radius) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.radius = radius;
+}
+
+void WindTurbineWidgetBaum::setzeSichtbar(int id, bool sichtbar) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.sichtbar = sichtbar;
+}
+
+void WindTurbineWidgetBaum::setzeAusgewaehlt(int id, bool ausgewaehlt) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.ausgewaehlt = ausgewaehlt;
+}
+
+void WindTurbineWidgetBaum::setzeWert(int id, float wert) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.wert = constrain(wert, 0.0f, 1.0f);
+}
+
+/**
+ * Legt die Position (relativ zum Widget) und Farbe einer Tabellenspalte fest
+ */
+void WindTurbineWidgetBaum::setzeSpalte(int id, int spalte, int16_t x, uint16_t farbe) {
+  if (!gueltig(id) || spalte < 0 || spalte >= WIDGET_MAX_SPALTEN) return;
+  widgets[id].soll.spaltenX[spalte] = x;
+  widgets[id].soll.spaltenFarbe[spalte] = farbe;
+}
+
+void WindTurbineWidgetBaum::setzeDiagramm(int id, DiagrammZeichner zeichner, void* kontext) {
+  if (!gueltig(id)) return;
+  widgets[id].zeichner = zeichner;
+  widgets[id].kontext = kontext;
+}
+
+/**
+ * Diagrammdaten haben sich geändert - Diagramm beim nächsten zeichne() neu zeichnen
+ */
+void WindTurbineWidgetBaum::erhoeheVersion(int id) {
+  if (!gueltig(id)) return;
+  widgets[id].soll.version++;
+}
+
+void WindTurbineWidgetBaum::invalidiereAlle() {
+  for (int i = 0; i < anzahl; i++) {
+    widgets[i].gezeichnet = false;
+  }
+}
+
+int WindTurbineWidgetBaum::anzahlWidgets() {
+  return anzahl;
+}
+
+/**
+ * Zeichnet alle Widgets, deren Eigenschaften sich seit dem letzten Zeichnen geändert haben
+ * Kinder liegen in der Liste immer hinter ihren Eltern und werden mitgezogen.
+ * @return Anzahl der gezeichneten Widgets
+ */
+int WindTurbineWidgetBaum::zeichne() {
+  if (tft == nullptr) return 0;
+
+  int gezeichnet = 0;
+
+  for (int i = 0; i < anzahl; i++) {
+    Widget& widget = widgets[i];
+
+    // Elternelement wurde in diesem Durchlauf neu gezeichnet
+    if (widget.eltern >= 0 && !widgets[widget.eltern].gezeichnet) {
+      widget.gezeichnet = false;
+    }
+
+    if (widget.gezeichnet && !unterscheidenSich(widget.soll, widget.ist)) {
+      continue;
+    }
+
+    // Alte Fläche löschen, wenn das Widget verschoben oder ausgeblendet wurde
+    const WidgetEigenschaften& alt = widget.ist;
+    if (widget.gezeichnet && alt.sichtbar &&
+        (!widget.soll.sichtbar || alt.x != widget.soll.x || alt.y != widget.soll.y ||
+         alt.w != widget.soll.w || alt.h != widget.soll.h)) {
+      tft->fillRect(alt.x, alt.y, alt.w, alt.h, elternHintergrund(i));
+    }
+
+    if (widget.soll.sichtbar) {
+      zeichneWidget(widget);
+      gezeichnet++;
+    }
+
+    widget.ist = widget.soll;
+    // Für die Kinder in diesem Durchlauf als "neu gezeichnet" kennzeichnen
+    widget.gezeichnet = false;
+  }
+
+  // Zustand für den nächsten Vergleich festhalten
+  for (int i = 0; i < anzahl; i++) {
+    widgets[i].gezeichnet = true;
+  }
+
+  return gezeichnet;
+}
+
+bool WindTurbineWidgetBaum::unterscheidenSich(const WidgetEigenschaften& a, const WidgetEigenschaften& b) {
+  if (a.x != b.x || a.y != b.y || a.w != b.w || a.h != b.h) return true;
+  if (a.vordergrund != b.vordergrund || a.hintergrund != b.hintergrund || a.akzent != b.akzent) return true;
+  if (a.textGroesse != b.textGroesse || a.radius != b.radius) return true;
+  if (a.sichtbar != b.sichtbar || a.ausgewaehlt != b.ausgewaehlt) return true;
+  if (a.wert != b.wert || a.version != b.version) return true;
+  if (strcmp(a.text, b.text) != 0) return true;
+  for (int s = 0; s < WIDGET_MAX_SPALTEN; s++) {
+    if (a.spaltenX[s] != b.spaltenX[s] || a.spaltenFarbe[s] != b.spaltenFarbe[s]) return true;
+  }
+  return false;
+}
+
+uint16_t WindTurbineWidgetBaum::elternHintergrund(int id) {
+  int eltern = widgets[id].eltern;
+  return (eltern >= 0) ? widgets[eltern].soll.hintergrund : TFT_BACKGROUND;
+}
+
+void WindTurbineWidgetBaum::zeichneWidget(Widget& widget) {
+  const WidgetEigenschaften& e = widget.soll;
+
+  switch (widget.typ) {
+    case WIDGET_TITELBALKEN: {
+      tft->fillRoundRect(e.x, e.y, e.w, e.h, e.radius, e.hintergrund);
+      // Kleinere Textgröße für längere Titel, rechts davon liegt die Motor-Status-Box
+      uint8_t groesse = (textBreite(e.text, 2) > TITEL_MAX_BREITE) ? 1 : 2;
+      char gekuerzt[WIDGET_MAX_TEXT];
+      strncpy(gekuerzt, e.text, WIDGET_MAX_TEXT - 1);
+      gekuerzt[WIDGET_MAX_TEXT - 1] = '\0';
+      kuerze(gekuerzt, TITEL_MAX_BREITE, groesse);
+      schreibe(gekuerzt, e.x + 15, e.y + (groesse == 1 ? 10 : 8), groesse, e.vordergrund, e.hintergrund);
+      break;
+    }
+
+    case WIDGET_STATUSLEISTE: {
+      tft->fillRect(e.x, e.y, e.w, e.h, e.hintergrund);
+      // Zurück-Button am rechten Rand
+      tft->fillRoundRect(e.x + e.w - 60, e.y + 2, 55, e.h - 4, 3, TFT_SUBTITLE);
+      schreibe("D=Zur.", e.x + e.w - 55, e.y + e.h - 12, 1, TFT_TEXT, TFT_SUBTITLE);
+
+      // Text auf den Platz links vom Button kürzen
+      int maxBreite = e.w - 70;
+      char gekuerzt[WIDGET_MAX_TEXT];
+      strncpy(gekuerzt, e.text, WIDGET_MAX_TEXT - 1);
+      gekuerzt[WIDGET_MAX_TEXT - 1] = '\0';
+      kuerze(gekuerzt, maxBreite, 1);
+      schreibe(gekuerzt, e.x + 10, e.y + e.h - 15, 1, e.vordergrund, e.hintergrund);
+      break;
+    }
+
+    case WIDGET_BOX:
+      if (e.radius > 0) {
+        tft->fillRoundRect(e.x, e.y, e.w, e.h, e.radius, e.hintergrund);
+        if (e.ausgewaehlt) tft->drawRoundRect(e.x, e.y, e.w, e.h, e.radius, e.akzent);
+      } else {
+        tft->fillRect(e.x, e.y, e.w, e.h, e.hintergrund);
+        if (e.ausgewaehlt) tft->drawRect(e.x, e.y, e.w, e.h, e.akzent);
+      }
+      zeichneText(e, e.text, e.x + 10, e.vordergrund, e.hintergrund);
+      break;
+
+    case WIDGET_TEXT:
+      tft->fillRect(e.x, e.y, e.w, e.h, e.hintergrund);
+      zeichneText(e, e.text, e.x, e.vordergrund, e.hintergrund);
+      break;
+
+    case WIDGET_TABELLENZEILE:
+      tft->fillRect(e.x, e.y, e.w, e.h, e.ausgewaehlt ? e.akzent : e.hintergrund);
+      zeichneSpalten(e, e.ausgewaehlt ? e.akzent : e.hintergrund);
+      break;
+
+    case WIDGET_BALKEN:
+      tft->fillRect(e.x, e.y, e.w, e.h, e.hintergrund);
+      tft->drawRect(e.x, e.y, e.w, e.h, e.akzent);
+      tft->fillRect(e.x + 2, e.y + 2, (int16_t)((e.w - 4) * e.wert), e.h - 4, e.vordergrund);
+      break;
+
+    case WIDGET_DIAGRAMM:
+      tft->fillRect(e.x, e.y, e.w, e.h, e.hintergrund);
+      if (widget.zeichner != nullptr) {
+        widget.zeichner(*tft, e.x, e.y, e.w, e.h, widget.kontext);
+      }
+      break;
+  }
+}
+
+/**
+ * Einzeiliger Text, vertikal im Widget zentriert
+ */
+void WindTurbineWidgetBaum::zeichneText(const WidgetEigenschaften& e, const char* text, int16_t x, uint16_t farbe, uint16_t hintergrund) {
+  if (text[0] == '\0') return;
+  schreibe(text, x, e.y + (e.h - 8 * e.textGroesse) / 2, e.textGroesse, farbe, hintergrund);
+}
+
+/**
+ * Zeichnet die durch '|' getrennten Spalten einer Tabellenzeile
+ */
+void WindTurbineWidgetBaum::zeichneSpalten(const WidgetEigenschaften& e, uint16_t hintergrund) {
+  char zelle[WIDGET_MAX_TEXT];
+  const char* start = e.text;
+
+  for (int s = 0; s < WIDGET_MAX_SPALTEN && start != nullptr; s++) {
+    const char* ende = strchr(start, '|');
+    size_t laenge = (ende != nullptr) ? (size_t)(ende - start) : strlen(start);
+    if (laenge >= sizeof(zelle)) laenge = sizeof(zelle) - 1;
+    memcpy(zelle, start, laenge);
+    zelle[laenge] = '\0';
+
+    uint16_t farbe = e.spaltenFarbe[s] != 0 ? e.spaltenFarbe[s] : e.vordergrund;
+    zeichneText(e, zelle, e.x + e.spaltenX[s], farbe, hintergrund);
+
+    start = (ende != nullptr) ? ende + 1 : nullptr;
+  }
+}
+
+/**
+ * Text mit dem Schriftatlas der Textgröße, sonst mit der GLCD-Schrift
+ * y ist die Oberkante der GLCD-Zeile, die Atlaszeile wird auf deren Mitte ausgerichtet.
+ * Der Hintergrund muss einfarbig sein, die Glyphen werden damit vorgemischt.
+ */
+void WindTurbineWidgetBaum::schreibe(const char* text, int16_t x, int16_t y, uint8_t groesse, uint16_t farbe, uint16_t hintergrund,
+                                     TFT_eSPI* ziel) {
+  if (ziel == nullptr) ziel = tft;
+  if (schrift != nullptr && schrift->verfuegbar(groesse)) {
+    int16_t oben = y + (8 * groesse - schrift->zeilenHoehe(groesse)) / 2;
+    schrift->zeichneText(text, x, oben, groesse, farbe, hintergrund, ziel);
+    return;
+  }
+  ziel->setTextSize(groesse);
+  ziel->setTextColor(farbe);
+  ziel->setCursor(x, y);
+  ziel->print(text);
+}
+
+int16_t WindTurbineWidgetBaum::textBreite(const char* text, uint8_t groesse) {
+  if (schrift != nullptr) return schrift->textBreite(text, groesse);
+  return strlen(text) * 6 * groesse;
+}
+
+/**
+ * Kürzt einen Text (Puffer mit WIDGET_MAX_TEXT Bytes) mit "..." auf maxBreite
+ */
+void WindTurbineWidgetBaum::kuerze(char* text, int maxBreite, uint8_t groesse) {
+  if (textBreite(text, groesse) <= maxBreite || maxBreite < 4 * 6 * groesse) return;
+  int laenge = min((int)strlen(text), WIDGET_MAX_TEXT - 4) + 1;
+  do {
+    laenge--;
+    // Nicht innerhalb eines UTF-8-Zeichens abschneiden
+    while (laenge > 0 && (text[laenge] & 0xC0) == 0x80) laenge--;
+    strcpy(text + laenge, "...");
+  } while (laenge > 0 && textBreite(text, groesse) > maxBreite);
+}
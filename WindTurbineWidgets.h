@@ -0,0 +1,133 @@
+/**
+ * WindTurbineWidgets.h
+ * Kleine Widget-Schicht (retained mode) für die Bildschirme
+ *
+ * Ein Bildschirm legt seine Widgets einmal an (Titelbalken, Statusleiste,
+ * Box, Text, Tabellenzeile, Balken, Diagramm). Danach werden nur noch
+ * Eigenschaften gesetzt. zeichne() vergleicht die Soll-Eigenschaften mit den
+ * zuletzt gezeichneten und zeichnet nur Widgets, bei denen sich etwas geändert hat.
+ * Wird ein Widget neu gezeichnet, werden auch seine Kinder neu gezeichnet,
+ * da der Hintergrund des Elternelements sie überdeckt.
+ *
+ * Texte werden mit dem Schriftatlas der Textgröße gezeichnet, falls einer
+ * geladen ist, sonst mit der GLCD-Schrift.
+ *
+ * Aus Widgets aufgebaut sind der teil- und vollfaktorielle Versuchsplan, beide
+ * Auswertungen und die Liste der gespeicherten Versuche (Auswahl per Drehknopf).
+ * Die Messbildschirme legen nur die Faktoreinstellungen des Versuchs als Widgets
+ * über den zwischengespeicherten Hintergrund.
+ * Noch direkt gezeichnet werden Diagramme, ZZP- und Faltungsbildschirme,
+ * Regression, Zusammenfassung, Eingabedialoge und die Live-Sprites;
+ * zeichneTitelbalken() leert dabei die Widget-Liste.
+ */
+
+#ifndef WIND_TURBINE_WIDGETS_H
+#define WIND_TURBINE_WIDGETS_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineSchrift.h"
+
+// Widget-Typen
+enum WidgetTyp {
+  WIDGET_TITELBALKEN,
+  WIDGET_STATUSLEISTE,
+  WIDGET_BOX,
+  WIDGET_TEXT,
+  WIDGET_TABELLENZEILE, // Spalten im Text durch '|' getrennt
+  WIDGET_BALKEN,        // Füllgrad über wert (0.0 - 1.0)
+  WIDGET_DIAGRAMM       // Zeichnen über Callback, neu bei geänderter Version
+};
+
+// Zeichnet den Inhalt eines Diagramm-Widgets in den angegebenen Bereich
+typedef void (*DiagrammZeichner)(TFT_eSPI& tft, int16_t x, int16_t y, int16_t w, int16_t h, void* kontext);
+
+// Eigenschaften eines Widgets (Grundlage für den Vergleich)
+struct WidgetEigenschaften {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  uint16_t vordergrund;
+  uint16_t hintergrund;
+  uint16_t akzent;          // Auswahl-Hintergrund, Balken- und Rahmenfarbe
+  uint8_t textGroesse;
+  uint8_t radius;
+  bool sichtbar;
+  bool ausgewaehlt;
+  float wert;
+  uint16_t version;         // Diagramme: vom Bildschirm bei neuen Daten erhöht
+  char text[WIDGET_MAX_TEXT];
+  int16_t spaltenX[WIDGET_MAX_SPALTEN];      // relativ zu x
+  uint16_t spaltenFarbe[WIDGET_MAX_SPALTEN]; // 0 = Vordergrundfarbe
+};
+
+class WindTurbineWidgetBaum {
+public:
+  // Konstruktor
+  WindTurbineWidgetBaum();
+
+  void begin(TFT_eSPI* display, WindTurbineSchrift* schriften = nullptr);
+
+  // Neuer Bildschirm: alle Widgets entfernen
+  void leeren();
+
+  // Widget anlegen, liefert die Kennung oder -1 wenn die Liste voll ist
+  // Elternelemente müssen vor ihren Kindern angelegt werden
+  int fuegeHinzu(WidgetTyp typ, int16_t x, int16_t y, int16_t w, int16_t h, int eltern = -1);
+
+  // Eigenschaften setzen (wirksam beim nächsten zeichne())
+  void setzeText(int id, const char* text);
+  void setzeFarben(int id, uint16_t vordergrund, uint16_t hintergrund);
+  void setzeAkzent(int id, uint16_t akzent);
+  void setzeTextGroesse(int id, uint8_t groesse);
+  void setzeRadius(int id, uint8_t radius);
+  void setzeSichtbar(int id, bool sichtbar);
+  void setzeAusgewaehlt(int id, bool ausgewaehlt);
+  void setzeWert(int id, float wert);
+  void setzeSpalte(int id, int spalte, int16_t x, uint16_t farbe = 0);
+  void setzeDiagramm(int id, DiagrammZeichner zeichner, void* kontext);
+  void erhoeheVersion(int id);
+
+  // Geänderte Widgets zeichnen, liefert die Anzahl gezeichneter Widgets
+  int zeichne();
+
+  // Alle Widgets beim nächsten zeichne() neu zeichnen
+  void invalidiereAlle();
+
+  int anzahlWidgets();
+
+  // Text mit dem Schriftatlas der Textgröße, sonst GLCD (auch für Bildschirme ohne Widgets)
+  // @param ziel Display oder Sprite, nullptr = Display
+  void schreibe(const char* text, int16_t x, int16_t y, uint8_t groesse, uint16_t farbe, uint16_t hintergrund,
+                TFT_eSPI* ziel = nullptr);
+  // Text (Puffer mit WIDGET_MAX_TEXT Bytes) mit "..." auf maxBreite kürzen
+  void kuerze(char* text, int maxBreite, uint8_t groesse);
+
+private:
+  struct Widget {
+    WidgetTyp typ;
+    int eltern;
+    WidgetEigenschaften soll;
+    WidgetEigenschaften ist;
+    bool gezeichnet;
+    DiagrammZeichner zeichner;
+    void* kontext;
+  };
+
+  TFT_eSPI* tft;
+  WindTurbineSchrift* schrift;
+  Widget widgets[WIDGET_MAX_ANZAHL];
+  int anzahl;
+
+  bool gueltig(int id);
+  bool unterscheidenSich(const WidgetEigenschaften& a, const WidgetEigenschaften& b);
+  uint16_t elternHintergrund(int id);
+  void zeichneWidget(Widget& widget);
+  void zeichneText(const WidgetEigenschaften& e, const char* text, int16_t x, uint16_t farbe, uint16_t hintergrund);
+  void zeichneSpalten(const WidgetEigenschaften& e, uint16_t hintergrund);
+  int16_t textBreite(const char* text, uint8_t groesse);
+};
+
+#endif // WIND_TURBINE_WIDGETS_H
@@ -0,0 +1,385 @@
+/**
+ * WindTurbineWirkungsflaeche.cpp
+ * Ergänzungsversuche, quadratisches Modell, stationärer Punkt und Optimum
+ */
+
+#include "WindTurbineWirkungsflaeche.h"
+#include "WindTurbineModellSuche.h"
+
+// Eigenwert kleiner als dieser Anteil des größten: Grat statt Punkt
+#define ZZP_GRAT_GRENZE 1e-3
+// Jacobi-Verfahren
+#define ZZP_JACOBI_RUNDEN 50
+
+/**
+ * Eigenwerte und -vektoren einer symmetrischen Matrix (zyklisches Jacobi-Verfahren)
+ * Danach stehen die Eigenwerte auf der Diagonalen von a, die Eigenvektoren in den Spalten von v.
+ */
+static void jacobiEigen(double a[ZZP_MAX_FAKTOREN][ZZP_MAX_FAKTOREN], int n, double v[ZZP_MAX_FAKTOREN][ZZP_MAX_FAKTOREN]) {
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) v[i][j] = (i == j) ? 1.0 : 0.0;
+  }
+
+  for (int runde = 0; runde < ZZP_JACOBI_RUNDEN; runde++) {
+    double neben = 0;
+    for (int p = 0; p < n; p++) {
+      for (int q = p + 1; q < n; q++) neben += a[p][q] * a[p][q];
+    }
+    if (neben < 1e-24) break;
+
+    for (int p = 0; p < n; p++) {
+      for (int q = p + 1; q < n; q++) {
+        if (a[p][q] == 0) continue;
+
+        // Drehung, die a[p][q] zu 0 macht
+        double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+        double t = (theta >= 0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+        double c = 1.0 / sqrt(t * t + 1.0);
+        double s = t * c;
+
+        for (int k = 0; k < n; k++) {
+          double akp = a[k][p];
+          double akq = a[k][q];
+          a[k][p] = c * akp - s * akq;
+          a[k][q] = s * akp + c * akq;
+        }
+        for (int k = 0; k < n; k++) {
+          double apk = a[p][k];
+          double aqk = a[q][k];
+          a[p][k] = c * apk - s * aqk;
+          a[q][k] = s * apk + c * aqk;
+        }
+        for (int k = 0; k < n; k++) {
+          double vkp = v[k][p];
+          double vkq = v[k][q];
+          v[k][p] = c * vkp - s * vkq;
+          v[k][q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+}
+
+WindTurbineWirkungsflaeche::WindTurbineWirkungsflaeche() :
+  faktoren(0),
+  ergaenzung(0),
+  art(STATIONAER_KEIN),
+  imBereich(false),
+  eigenwerte(0),
+  optimalWert(0),
+  optimalStationaer(false)
+{
+  for (int f = 0; f < ZZP_MAX_FAKTOREN; f++) {
+    stetig[f] = false;
+    termLinear[f] = -1;
+    termQuadrat[f] = -1;
+    stationaer[f] = 0;
+    lambda[f] = 0;
+    optimalStufen[f] = 0;
+    for (int g = 0; g < ZZP_MAX_FAKTOREN; g++) termWechselwirkung[f][g] = -1;
+  }
+  for (int v = 0; v < ZZP_MAX_ERGAENZUNG; v++) {
+    for (int f = 0; f < ZZP_MAX_FAKTOREN; f++) ergaenzungStufen[v][f] = 0;
+  }
+}
+
+/**
+ * Sternpunkte je stetigem Faktor, danach die Zentrumspunkte; legt die Modellterme fest
+ */
+int WindTurbineWirkungsflaeche::erzeugeErgaenzung(const bool* stetig, const int* ersatzStufe, int faktoren) {
+  ergaenzung = 0;
+  if (faktoren < 1 || faktoren > ZZP_MAX_FAKTOREN) {
+    Serial.println("Wirkungsflaeche: ungueltige Anzahl Faktoren");
+    return 0;
+  }
+  this->faktoren = faktoren;
+
+  int stetige = 0;
+  for (int f = 0; f < faktoren; f++) {
+    this->stetig[f] = stetig[f];
+    if (stetig[f]) stetige++;
+  }
+
+  // Modell: Konstante, Haupteffekte, Wechselwirkungen, Quadrate der stetigen Faktoren
+  regression.leeren();
+  for (int f = 0; f < ZZP_MAX_FAKTOREN; f++) {
+    termLinear[f] = -1;
+    termQuadrat[f] = -1;
+    for (int g = 0; g < ZZP_MAX_FAKTOREN; g++) termWechselwirkung[f][g] = -1;
+  }
+  for (int f = 0; f < faktoren; f++) {
+    termLinear[f] = regression.fuegeTermHinzu(1 << f);
+  }
+  for (int a = 0; a < faktoren; a++) {
+    for (int b = a + 1; b < faktoren; b++) {
+      termWechselwirkung[a][b] = regression.fuegeTermHinzu((1 << a) | (1 << b));
+      termWechselwirkung[b][a] = termWechselwirkung[a][b];
+    }
+  }
+  for (int f = 0; f < faktoren; f++) {
+    if (stetig[f]) termQuadrat[f] = regression.fuegeTermHinzu(1 << f, true);
+  }
+  art = STATIONAER_KEIN;
+  eigenwerte = 0;
+
+  if (stetige == 0) {
+    Serial.println("Wirkungsflaeche: keine stetigen Faktoren, keine Ergaenzung");
+    return 0;
+  }
+
+  // Sternpunkte: ein Faktor auf -alpha bzw. +alpha, stetige Faktoren sonst in der Mitte
+  for (int f = 0; f < faktoren; f++) {
+    if (!stetig[f]) continue;
+    for (int seite = -1; seite <= 1; seite += 2) {
+      for (int g = 0; g < faktoren; g++) {
+        ergaenzungStufen[ergaenzung][g] = (g == f) ? seite * ZZP_ALPHA : (stetig[g] ? 0 : ersatzStufe[g]);
+      }
+      ergaenzung++;
+    }
+  }
+
+  // Zentrumspunkte
+  for (int z = 0; z < ZZP_ZENTRUMSPUNKTE; z++) {
+    for (int g = 0; g < faktoren; g++) {
+      ergaenzungStufen[ergaenzung][g] = stetig[g] ? 0 : ersatzStufe[g];
+    }
+    ergaenzung++;
+  }
+
+  return ergaenzung;
+}
+
+int WindTurbineWirkungsflaeche::anzahlFaktoren() const {
+  return faktoren;
+}
+
+int WindTurbineWirkungsflaeche::anzahlErgaenzung() const {
+  return ergaenzung;
+}
+
+bool WindTurbineWirkungsflaeche::istStetig(int faktor) const {
+  return faktor >= 0 && faktor < faktoren && stetig[faktor];
+}
+
+float WindTurbineWirkungsflaeche::stufe(int versuch, int faktor) const {
+  if (versuch < 0 || versuch >= ergaenzung || faktor < 0 || faktor >= faktoren) return 0;
+  return ergaenzungStufen[versuch][faktor];
+}
+
+bool WindTurbineWirkungsflaeche::istZentrumspunkt(int versuch) const {
+  return versuch >= ergaenzung - ZZP_ZENTRUMSPUNKTE && versuch < ergaenzung;
+}
+
+bool WindTurbineWirkungsflaeche::passeAn(const float* stufen, const float* werte, int anzahl) {
+  if (faktoren < 1) return false;
+  if (!regression.passeAn(stufen, faktoren, werte, anzahl)) return false;
+  bestimmeOptimum();
+  return true;
+}
+
+bool WindTurbineWirkungsflaeche::istAngepasst() const {
+  return regression.istAngepasst();
+}
+
+const WindTurbineRegression& WindTurbineWirkungsflaeche::modell() const {
+  return regression;
+}
+
+float WindTurbineWirkungsflaeche::koeffizient(int term) const {
+  return term >= 0 ? regression.koeffizient(term) : 0;
+}
+
+float WindTurbineWirkungsflaeche::konstante() const {
+  return regression.koeffizient(0);
+}
+
+float WindTurbineWirkungsflaeche::linear(int faktor) const {
+  return (faktor >= 0 && faktor < faktoren) ? koeffizient(termLinear[faktor]) : 0;
+}
+
+float WindTurbineWirkungsflaeche::wechselwirkung(int a, int b) const {
+  if (a < 0 || a >= faktoren || b < 0 || b >= faktoren) return 0;
+  return koeffizient(termWechselwirkung[a][b]);
+}
+
+float WindTurbineWirkungsflaeche::quadratisch(int faktor) const {
+  return (faktor >= 0 && faktor < faktoren) ? koeffizient(termQuadrat[faktor]) : 0;
+}
+
+float WindTurbineWirkungsflaeche::vorhersage(const float* stufen) const {
+  return regression.vorhersage(stufen);
+}
+
+/**
+ * Stationärer Punkt der stetigen Faktoren bei festen Stufen der übrigen
+ * @param diskret Stufen aller Faktoren (nur die nicht stetigen werden gelesen)
+ * @param punkt Stufen aller Faktoren am stationären Punkt
+ * @param eigen Eigenwerte von B (einer je stetigem Faktor)
+ */
+StationaerArt WindTurbineWirkungsflaeche::analysiereStationaer(const float* diskret, float* punkt, float* eigen) const {
+  int index[ZZP_MAX_FAKTOREN];
+  int c = 0;
+  for (int f = 0; f < faktoren; f++) {
+    punkt[f] = stetig[f] ? 0 : diskret[f];
+    if (stetig[f]) index[c++] = f;
+  }
+  if (c == 0) return STATIONAER_KEIN;
+
+  // B und g für die stetigen Faktoren
+  double b[ZZP_MAX_FAKTOREN][ZZP_MAX_FAKTOREN];
+  double g[ZZP_MAX_FAKTOREN];
+  for (int i = 0; i < c; i++) {
+    int fi = index[i];
+    g[i] = linear(fi);
+    for (int f = 0; f < faktoren; f++) {
+      if (!stetig[f]) g[i] += wechselwirkung(fi, f) * diskret[f];
+    }
+    for (int j = 0; j < c; j++) {
+      b[i][j] = (i == j) ? quadratisch(fi) : wechselwirkung(fi, index[j]) / 2.0;
+    }
+  }
+
+  double v[ZZP_MAX_FAKTOREN][ZZP_MAX_FAKTOREN];
+  jacobiEigen(b, c, v);
+
+  double groesster = 0;
+  for (int i = 0; i < c; i++) {
+    eigen[i] = b[i][i];
+    groesster = max(groesster, fabs(b[i][i]));
+  }
+
+  int positiv = 0;
+  int negativ = 0;
+  for (int i = 0; i < c; i++) {
+    if (groesster <= 0 || fabs(b[i][i]) <= ZZP_GRAT_GRENZE * groesster) return STATIONAER_GRAT;
+    if (b[i][i] > 0) positiv++;
+    else negativ++;
+  }
+
+  // xs = -1/2 V Λ^-1 V' g
+  double z[ZZP_MAX_FAKTOREN];
+  for (int i = 0; i < c; i++) {
+    double summe = 0;
+    for (int k = 0; k < c; k++) summe += v[k][i] * g[k];
+    z[i] = summe / b[i][i];
+  }
+  for (int k = 0; k < c; k++) {
+    double summe = 0;
+    for (int i = 0; i < c; i++) summe += v[k][i] * z[i];
+    punkt[index[k]] = -0.5 * summe;
+  }
+
+  if (negativ == c) return STATIONAER_MAXIMUM;
+  if (positiv == c) return STATIONAER_MINIMUM;
+  return STATIONAER_SATTEL;
+}
+
+/**
+ * Größter Modellwert im Würfel [-1, 1] über die stetigen Faktoren (sucheModellMaximum)
+ * @param punkt Stufen aller Faktoren; nicht stetige bleiben, stetige werden ersetzt
+ */
+float WindTurbineWirkungsflaeche::sucheImBereich(float* punkt) const {
+  SuchArt suchArt[ZZP_MAX_FAKTOREN];
+  for (int f = 0; f < faktoren; f++) suchArt[f] = stetig[f] ? SUCHE_STETIG : SUCHE_FEST;
+  float wert = vorhersage(punkt);
+  sucheModellMaximum(regression, nullptr, faktoren, suchArt, faktoren, punkt, wert);
+  return wert;
+}
+
+/**
+ * Optimum über alle Stufenkombinationen der nicht stetigen Faktoren
+ * Für jede Kombination der stationäre Punkt, falls er ein Maximum im Bereich ist,
+ * sonst die Suche im Bereich. Der stationäre Punkt der besten Kombination wird gemerkt.
+ */
+void WindTurbineWirkungsflaeche::bestimmeOptimum() {
+  int diskret[ZZP_MAX_FAKTOREN];
+  int d = 0;
+  int c = 0;
+  for (int f = 0; f < faktoren; f++) {
+    if (stetig[f]) c++;
+    else diskret[d++] = f;
+  }
+
+  bool erster = true;
+  for (int kombination = 0; kombination < (1 << d); kombination++) {
+    float punkt[ZZP_MAX_FAKTOREN];
+    for (int f = 0; f < faktoren; f++) punkt[f] = 0;
+    for (int k = 0; k < d; k++) {
+      punkt[diskret[k]] = ((kombination >> k) & 1) ? 1 : -1;
+    }
+
+    float stationaerPunkt[ZZP_MAX_FAKTOREN];
+    float eigen[ZZP_MAX_FAKTOREN];
+    StationaerArt stationaerArt = analysiereStationaer(punkt, stationaerPunkt, eigen);
+
+    bool drin = stationaerArt != STATIONAER_KEIN && stationaerArt != STATIONAER_GRAT;
+    for (int f = 0; f < faktoren && drin; f++) {
+      drin = fabs(stationaerPunkt[f]) <= 1.0001;
+    }
+
+    float wert;
+    bool amStationaeren = stationaerArt == STATIONAER_MAXIMUM && drin;
+    if (amStationaeren) {
+      for (int f = 0; f < faktoren; f++) punkt[f] = stationaerPunkt[f];
+      wert = vorhersage(punkt);
+    } else {
+      wert = sucheImBereich(punkt);
+    }
+
+    if (erster || wert > optimalWert) {
+      erster = false;
+      optimalWert = wert;
+      optimalStationaer = amStationaeren;
+      art = stationaerArt;
+      imBereich = drin;
+      eigenwerte = (stationaerArt == STATIONAER_KEIN) ? 0 : c;
+      for (int f = 0; f < faktoren; f++) {
+        optimalStufen[f] = punkt[f];
+        stationaer[f] = stationaerPunkt[f];
+      }
+      for (int i = 0; i < c; i++) lambda[i] = eigen[i];
+    }
+  }
+}
+
+StationaerArt WindTurbineWirkungsflaeche::stationaereArt() const {
+  return istAngepasst() ? art : STATIONAER_KEIN;
+}
+
+float WindTurbineWirkungsflaeche::stationaereStufe(int faktor) const {
+  return (faktor >= 0 && faktor < faktoren) ? stationaer[faktor] : 0;
+}
+
+bool WindTurbineWirkungsflaeche::stationaerImBereich() const {
+  return istAngepasst() && imBereich;
+}
+
+int WindTurbineWirkungsflaeche::anzahlEigenwerte() const {
+  return istAngepasst() ? eigenwerte : 0;
+}
+
+float WindTurbineWirkungsflaeche::eigenwert(int index) const {
+  return (index >= 0 && index < eigenwerte) ? lambda[index] : 0;
+}
+
+float WindTurbineWirkungsflaeche::optimum() const {
+  return istAngepasst() ? optimalWert : 0;
+}
+
+float WindTurbineWirkungsflaeche::optimaleStufe(int faktor) const {
+  return (faktor >= 0 && faktor < faktoren) ? optimalStufen[faktor] : 0;
+}
+
+bool WindTurbineWirkungsflaeche::optimumAmStationaerenPunkt() const {
+  return istAngepasst() && optimalStationaer;
+}
+
+const char* WindTurbineWirkungsflaeche::artText(StationaerArt art) {
+  switch (art) {
+    case STATIONAER_MAXIMUM: return "Maximum";
+    case STATIONAER_MINIMUM: return "Minimum";
+    case STATIONAER_SATTEL: return "Sattelpunkt";
+    case STATIONAER_GRAT: return "Grat";
+    default: return "-";
+  }
+}
@@ -0,0 +1,115 @@
+/**
+ * WindTurbineWirkungsflaeche.h
+ * Zentraler zusammengesetzter Plan und quadratisches Wirkungsflächenmodell
+ *
+ * Der 2^k-Würfel des vollfaktoriellen Versuchs wird um Sternpunkte (ein Faktor
+ * auf ±ZZP_ALPHA, alle anderen in der Mitte) und wiederholte Zentrumspunkte
+ * ergänzt. Mit ZZP_ALPHA = 1 liegen die Sternpunkte auf den Würfelflächen
+ * (flächenzentrierter Plan), weil die Faktoren der Anlage nicht über ihre
+ * Grenzstufen hinaus eingestellt werden können. Faktoren ohne Zwischenstufen
+ * (z.B. Blattanzahl) erhalten keine Sternpunkte und bleiben in der Ergänzung
+ * auf einer festen Stufe.
+ *
+ * Angepasst wird y = b0 + Σ bi xi + Σ bij xi xj + Σ bii xi² (quadratische Terme
+ * nur für stetige Faktoren) mit WindTurbineRegression. Für die stetigen Faktoren
+ * ergibt sich der stationäre Punkt aus B xs = -g/2 (B: bii auf der Diagonalen,
+ * bij/2 daneben; g: lineare Koeffizienten samt Wechselwirkungen mit den nicht
+ * stetigen Faktoren). Die Eigenwerte von B (Jacobi-Verfahren) entscheiden über
+ * Maximum, Minimum, Sattel oder Grat.
+ *
+ * Liegt kein Maximum im Versuchsbereich [-1, 1]^k, wird das Modell mit
+ * sucheModellMaximum() (WindTurbineModellSuche.h) auf dem Raster durchsucht und
+ * der beste Rasterpunkt koordinatenweise verfeinert.
+ * Nicht stetige Faktoren werden dabei auf beiden Stufen ausgewertet.
+ */
+
+#ifndef WIND_TURBINE_WIRKUNGSFLAECHE_H
+#define WIND_TURBINE_WIRKUNGSFLAECHE_H
+
+#include <Arduino.h>
+#include "WindTurbineConstants.h"
+#include "WindTurbineRegression.h"
+
+// Art des stationären Punkts
+enum StationaerArt {
+  STATIONAER_KEIN,     // Keine stetigen Faktoren oder Modell nicht angepasst
+  STATIONAER_MAXIMUM,
+  STATIONAER_MINIMUM,
+  STATIONAER_SATTEL,
+  STATIONAER_GRAT      // Eigenwert nahe 0: kein eindeutiger Punkt
+};
+
+class WindTurbineWirkungsflaeche {
+public:
+  // Konstruktor
+  WindTurbineWirkungsflaeche();
+
+  // Stern- und Zentrumspunkte zum 2^k-Würfel erzeugen
+  // @param stetig je Faktor: Zwischenstufen einstellbar
+  // @param ersatzStufe Stufe der nicht stetigen Faktoren in der Ergänzung (-1 / 1)
+  // @return Anzahl der Ergänzungsversuche
+  int erzeugeErgaenzung(const bool* stetig, const int* ersatzStufe, int faktoren);
+
+  int anzahlFaktoren() const;
+  int anzahlErgaenzung() const;
+  bool istStetig(int faktor) const;
+  // Kodierte Stufe eines Ergänzungsversuchs
+  float stufe(int versuch, int faktor) const;
+  bool istZentrumspunkt(int versuch) const;
+
+  // Quadratisches Modell anpassen
+  // @param stufen kodierte Stufen [Beobachtung * anzahlFaktoren() + Faktor]
+  bool passeAn(const float* stufen, const float* werte, int anzahl);
+
+  bool istAngepasst() const;
+  const WindTurbineRegression& modell() const;
+
+  // Koeffizienten in kodierten Einheiten (0 wenn nicht im Modell oder vermengt)
+  float konstante() const;
+  float linear(int faktor) const;
+  float wechselwirkung(int a, int b) const;
+  float quadratisch(int faktor) const;
+
+  // Stationärer Punkt der stetigen Faktoren (nicht stetige auf ihrer optimalen Stufe)
+  StationaerArt stationaereArt() const;
+  float stationaereStufe(int faktor) const;
+  bool stationaerImBereich() const;
+  int anzahlEigenwerte() const;
+  float eigenwert(int index) const;
+
+  // Bester Modellwert im Versuchsbereich und seine Stufen
+  float optimum() const;
+  float optimaleStufe(int faktor) const;
+  bool optimumAmStationaerenPunkt() const;
+
+  float vorhersage(const float* stufen) const;
+
+  static const char* artText(StationaerArt art);
+
+private:
+  int faktoren;
+  bool stetig[ZZP_MAX_FAKTOREN];
+  int ergaenzung;
+  float ergaenzungStufen[ZZP_MAX_ERGAENZUNG][ZZP_MAX_FAKTOREN];
+
+  WindTurbineRegression regression;
+  int termLinear[ZZP_MAX_FAKTOREN];
+  int termQuadrat[ZZP_MAX_FAKTOREN];
+  int termWechselwirkung[ZZP_MAX_FAKTOREN][ZZP_MAX_FAKTOREN];
+
+  StationaerArt art;
+  float stationaer[ZZP_MAX_FAKTOREN];
+  bool imBereich;
+  int eigenwerte;
+  float lambda[ZZP_MAX_FAKTOREN];
+  float optimalStufen[ZZP_MAX_FAKTOREN];
+  float optimalWert;
+  bool optimalStationaer;
+
+  float koeffizient(int term) const;
+  StationaerArt analysiereStationaer(const float* diskret, float* punkt, float* eigen) const;
+  float sucheImBereich(float* punkt) const;
+  void bestimmeOptimum();
+};
+
+#endif // WIND_TURBINE_WIRKUNGSFLAECHE_H
@@ -0,0 +1,380 @@
+/**
+ * WindTurbineWirkungsflaecheUI.cpp
+ * Plan-, Mess- und Auswertungsbildschirm des zentralen zusammengesetzten Plans
+ *
+ * Gemessen werden nur die Stern- und Zentrumspunkte; der Würfel kommt aus dem
+ * vollfaktoriellen Versuch. Der Messbildschirm benutzt Hintergrund und
+ * Live-Bereiche des vollfaktoriellen Versuchs.
+ */
+
+#include "WindTurbineExperiment.h"
+
+// Faktornamen für enge Spalten
+static const char* kurzeFaktorNamen[] = {"Steigung", "Groesse", "Abstand", "Luftst.", "Blattanz."};
+
+/**
+ * Stufe als Text: Beschriftung der Stufen -1 / 0 / 1, sonst Realwert (z.B. "52 cm")
+ */
+static void formatiereStufe(int faktor, float kodiert, char* puffer, int groesse) {
+  if (kodiert == -1) {
+    snprintf(puffer, groesse, "%s", faktorEinheitenNiedrig[faktor]);
+  } else if (kodiert == 1) {
+    snprintf(puffer, groesse, "%s", faktorEinheitenHoch[faktor]);
+  } else if (kodiert == 0 && faktorStetig[faktor]) {
+    snprintf(puffer, groesse, "%s", faktorEinheitenMitte[faktor]);
+  } else {
+    snprintf(puffer, groesse, faktorFormat[faktor], faktorMitte[faktor] + faktorHalbeSpanne[faktor] * kodiert);
+  }
+}
+
+/**
+ * Stufensymbol (-, 0, +) mit Beschriftung
+ */
+void WindTurbineExperiment::zeichneZzpStufe(int x, int y, int faktor, float kodiert) {
+  if (kodiert < 0) {
+    tft.fillRoundRect(x, y-6, 12, 12, 3, 0x1082);
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.setCursor(x+3, y-3);
+    tft.print("-");
+  } else if (kodiert > 0) {
+    tft.fillRoundRect(x, y-6, 12, 12, 3, 0x04FF);
+    tft.setTextColor(TFT_HIGHLIGHT);
+    tft.setCursor(x+3, y-3);
+    tft.print("+");
+  } else {
+    tft.fillRoundRect(x, y-6, 12, 12, 3, TFT_TITLE_BG);
+    tft.setTextColor(TFT_SUCCESS);
+    tft.setCursor(x+3, y-3);
+    tft.print("0");
+  }
+
+  char text[20];
+  formatiereStufe(faktor, kodiert, text, sizeof(text));
+  tft.setTextColor(TFT_TEXT);
+  tft.setCursor(x+15, y-3);
+  tft.print(text);
+}
+
+/**
+ * Zeigt die Ergänzungsversuche (Stern- und Zentrumspunkte) zum vollfaktoriellen Würfel
+ */
+void WindTurbineExperiment::zeigeZzpPlan() {
+  int anzahl = wirkungsflaeche.anzahlErgaenzung();
+
+  tft.fillScreen(TFT_BACKGROUND);
+  zeichneTitelbalken("Zentral zusammengesetzter Plan");
+
+  // Aufbau des Plans
+  tft.fillRoundRect(20, 48, 440, 60, 5, TFT_OUTLINE);
+  tft.fillRect(21, 49, 438, 18, TFT_TITLE_BG);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 55);
+  tft.print("Wuerfel + Ergaenzung (flaechenzentriert, alpha = ");
+  tft.print(ZZP_ALPHA, 1);
+  tft.print("):");
+
+  tft.setTextColor(TFT_TEXT);
+  tft.setCursor(40, 72);
+  tft.print("8 Wuerfelpunkte (vollfaktoriell), ");
+  tft.print(max(anzahl - ZZP_ZENTRUMSPUNKTE, 0));
+  tft.print(" Sternpunkte, ");
+  tft.print(anzahl > 0 ? ZZP_ZENTRUMSPUNKTE : 0);
+  tft.print(" Zentrumspunkte");
+
+  // Faktoren ohne Zwischenstufen
+  tft.setCursor(40, 88);
+  bool alleStetig = true;
+  for (int k = 0; k < 3; k++) {
+    int faktorIndex = ausgewaehlteVollfaktoren[k];
+    if (faktorStetig[faktorIndex]) continue;
+    if (alleStetig) {
+      tft.setTextColor(TFT_LIGHT_TEXT);
+      tft.print("Nur 2 Stufen, in der Ergaenzung fest: ");
+    } else {
+      tft.print(", ");
+    }
+    alleStetig = false;
+    tft.setTextColor(TFT_TEXT);
+    tft.print(faktorNamen[faktorIndex]);
+    tft.print("=");
+    tft.print(anzahl > 0 && wirkungsflaeche.stufe(0, k) > 0 ? faktorEinheitenHoch[faktorIndex] : faktorEinheitenNiedrig[faktorIndex]);
+  }
+  if (alleStetig) {
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.print("Alle Faktoren stetig: quadratische Terme fuer alle drei");
+  }
+
+  // Tabelle der Ergänzungsversuche
+  tft.fillRoundRect(20, 118, 440, 170, 5, TFT_OUTLINE);
+  tft.fillRect(21, 119, 438, 20, TFT_TITLE_BG);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 125);
+  tft.print("Nr.");
+  tft.setCursor(65, 125);
+  tft.print("Art");
+  for (int j = 0; j < 3; j++) {
+    tft.setCursor(125 + j * 112, 125);
+    tft.print(faktorNamen[ausgewaehlteVollfaktoren[j]]);
+  }
+
+  if (anzahl == 0) {
+    tft.setTextColor(TFT_WARNING);
+    tft.setCursor(40, 160);
+    tft.print("Keiner der ausgewaehlten Faktoren hat Zwischenstufen.");
+    tft.setCursor(40, 176);
+    tft.print("Ein quadratisches Modell ist nicht moeglich.");
+  }
+
+  for (int i = 0; i < anzahl; i++) {
+    int y = 150 + i * 15;
+
+    if (i % 2 == 0) {
+      tft.fillRect(21, y-7, 438, 15, 0x1082);
+    }
+
+    tft.setTextColor(TFT_TEXT);
+    tft.setCursor(33, y-3);
+    tft.print(i + 1);
+    tft.setTextColor(wirkungsflaeche.istZentrumspunkt(i) ? TFT_SUCCESS : TFT_SUBTITLE);
+    tft.setCursor(65, y-3);
+    tft.print(wirkungsflaeche.istZentrumspunkt(i) ? "Zentrum" : "Stern");
+
+    for (int j = 0; j < 3; j++) {
+      zeichneZzpStufe(125 + j * 112, y, ausgewaehlteVollfaktoren[j], wirkungsflaeche.stufe(i, j));
+    }
+  }
+
+  zeichneStatusleiste(anzahl > 0 ? "Druecken Sie den Drehknopf, um mit den Messungen zu beginnen."
+                                 : "Keine Ergaenzung moeglich - D = Zurueck zum Regressionsmodell");
+
+  maxCursorPosition = 0;
+  aktuellerModus = ZZP_PLAN;
+}
+
+/**
+ * Messbildschirm eines Ergänzungsversuchs (5 Messungen wie im vollfaktoriellen Versuch)
+ */
+void WindTurbineExperiment::zeigeZzpMessung() {
+  int anzahl = wirkungsflaeche.anzahlErgaenzung();
+  if (aktuellerVersuch >= anzahl) {
+    // Zurück aus der Auswertung: letzten Versuch zeigen
+    aktuellerVersuch = max(anzahl - 1, 0);
+    aktuelleMessung = 5;
+  }
+  // Die Live-Bereiche lesen die Messreihe über den Modus
+  aktuellerModus = ZZP_MESSUNG;
+
+  zeigeStatischenHintergrund(HINTERGRUND_VOLL_MESSUNG, [this](TFT_eSPI& ziel) {
+    zeichneVollMessungHintergrund(ziel);
+  });
+
+  char titel[50];
+  sprintf(titel, "Wirkungsflaeche: Versuch %d/%d", aktuellerVersuch + 1, anzahl);
+  zeichneTitelbalken(titel);
+
+  // Fortschrittsanzeige
+  tft.fillRoundRect(380, 15, 90, 20, 5, TFT_TITLE_BG);
+  tft.fillRect(382, 17, anzahl > 0 ? (aktuellerVersuch * 86) / anzahl : 0, 16, TFT_HIGHLIGHT);
+
+  // Faktoreinstellungen hinter den Faktornamen
+  tft.setTextSize(1);
+  for (int i = 0; i < 5; i++) {
+    int y = 78 + i * 22;
+    zeichneZzpStufe(95, y, i, zzpStufe(aktuellerVersuch, i));
+
+    bool ausgewaehlt = false;
+    for (int k = 0; k < 3; k++) ausgewaehlt = ausgewaehlt || ausgewaehlteVollfaktoren[k] == i;
+    if (!ausgewaehlt) {
+      tft.setTextColor(TFT_LIGHT_TEXT);
+      tft.setCursor(180, y-3);
+      tft.print("(fix)");
+    }
+  }
+  tft.setTextColor(wirkungsflaeche.istZentrumspunkt(aktuellerVersuch) ? TFT_SUCCESS : TFT_SUBTITLE);
+  tft.setCursor(180, 60);
+  tft.print(wirkungsflaeche.istZentrumspunkt(aktuellerVersuch) ? "Zentrum" : "Stern");
+  tft.setTextColor(TFT_TEXT);
+
+  // Messwerte, Fortschritt, Mittelwert und Live-Leistung (als Sprites)
+  zeichneMesswertTabelle(false);
+  zeichneMessfortschritt(false);
+  zeichneMittelwertAnzeige(false);
+  zeichneLiveLeistung(false, letzteLiveLeistung);
+
+  leistungsDiagramm.zeichneVollstaendig(15, leistungsDiagrammY(false));
+
+  zeichneMessStatusleiste(false);
+
+  maxCursorPosition = 0;
+}
+
+/**
+ * Auswertung der Wirkungsfläche: Koeffizienten des quadratischen Modells,
+ * stationärer Punkt mit Eigenwerten und das vorhergesagte Optimum im Versuchsbereich
+ */
+void WindTurbineExperiment::zeigeZzpAuswertung() {
+  aktualisiereAuswertung();
+  passeWirkungsflaecheAn();
+  const WindTurbineRegression& modell = wirkungsflaeche.modell();
+
+  tft.fillScreen(TFT_BACKGROUND);
+  zeichneTitelbalken("Wirkungsflaeche (quadratisch)");
+
+  // Koeffizienten in kodierten Einheiten
+  tft.fillRoundRect(20, 48, 220, 202, 5, TFT_OUTLINE);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(30, 56);
+  tft.print("Koeffizienten (kodiert):");
+
+  char name[24];
+  for (int t = 0; t < modell.anzahlTerme() && t < 11; t++) {
+    int y = 74 + t * 16;
+
+    // Termname aus der Reihenfolge: Konstante, Faktoren, Wechselwirkungen, Quadrate
+    int lineare = 3;
+    int wechselwirkungen = 3;
+    if (t == 0) {
+      snprintf(name, sizeof(name), "b0");
+    } else if (t <= lineare) {
+      snprintf(name, sizeof(name), "%s", kurzeFaktorNamen[ausgewaehlteVollfaktoren[t - 1]]);
+    } else if (t <= lineare + wechselwirkungen) {
+      const int paare[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+      const int* paar = paare[t - lineare - 1];
+      snprintf(name, sizeof(name), "%c*%c", 'A' + ausgewaehlteVollfaktoren[paar[0]], 'A' + ausgewaehlteVollfaktoren[paar[1]]);
+    } else {
+      // Quadrate nur der stetigen Faktoren
+      int q = t - lineare - wechselwirkungen;
+      for (int k = 0; k < 3; k++) {
+        if (wirkungsflaeche.istStetig(k) && --q == 0) {
+          snprintf(name, sizeof(name), "%s^2", kurzeFaktorNamen[ausgewaehlteVollfaktoren[k]]);
+        }
+      }
+    }
+
+    tft.setTextColor(TFT_TEXT);
+    tft.setCursor(30, y);
+    tft.print(name);
+
+    if (!modell.istGeschaetzt(t)) {
+      tft.setTextColor(TFT_LIGHT_TEXT);
+      tft.setCursor(120, y);
+      tft.print("nicht schaetzbar");
+      continue;
+    }
+
+    float b = modell.koeffizient(t);
+    tft.fillRoundRect(115, y-3, 60, 14, 3, t == 0 ? TFT_TITLE_BG : (b >= 0 ? TFT_SUCCESS : TFT_WARNING));
+    tft.setTextColor(TFT_TEXT);
+    tft.setCursor(120, y);
+    tft.print(b, 2);
+
+    if (modell.standardfehler(t) > 0) {
+      tft.setTextColor(TFT_LIGHT_TEXT);
+      tft.setCursor(180, y);
+      tft.print("+-");
+      tft.print(modell.standardfehler(t), 2);
+    }
+  }
+
+  // Stationärer Punkt
+  StationaerArt art = wirkungsflaeche.stationaereArt();
+  tft.fillRoundRect(250, 48, 210, 98, 5, TFT_OUTLINE);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(260, 56);
+  tft.print("Stationaerer Punkt: ");
+  tft.setTextColor(art == STATIONAER_MAXIMUM ? TFT_SUCCESS : TFT_WARNING);
+  tft.print(WindTurbineWirkungsflaeche::artText(art));
+
+  if (art == STATIONAER_MAXIMUM || art == STATIONAER_MINIMUM || art == STATIONAER_SATTEL) {
+    int zeile = 0;
+    for (int k = 0; k < 3; k++) {
+      if (!wirkungsflaeche.istStetig(k)) continue;
+      int faktorIndex = ausgewaehlteVollfaktoren[k];
+      float x = wirkungsflaeche.stationaereStufe(k);
+      int y = 74 + zeile * 14;
+      tft.setTextColor(TFT_TEXT);
+      tft.setCursor(260, y);
+      tft.print(kurzeFaktorNamen[faktorIndex]);
+      tft.print(": ");
+      tft.setCursor(330, y);
+      tft.setTextColor(fabs(x) <= 1.0001 ? TFT_TEXT : TFT_LIGHT_TEXT);
+      tft.print(x, 2);
+      tft.setCursor(375, y);
+      snprintf(name, sizeof(name), faktorFormat[faktorIndex], faktorMitte[faktorIndex] + faktorHalbeSpanne[faktorIndex] * x);
+      tft.print(name);
+      zeile++;
+    }
+    tft.setTextColor(wirkungsflaeche.stationaerImBereich() ? TFT_SUCCESS : TFT_WARNING);
+    tft.setCursor(260, 116);
+    tft.print(wirkungsflaeche.stationaerImBereich() ? "im Versuchsbereich" : "ausserhalb des Versuchsbereichs");
+  } else {
+    tft.setTextColor(TFT_LIGHT_TEXT);
+    tft.setCursor(260, 74);
+    tft.print(art == STATIONAER_GRAT ? "Eigenwert nahe 0: kein eindeutiger" : "Keine Kruemmung schaetzbar");
+    tft.setCursor(260, 88);
+    tft.print(art == STATIONAER_GRAT ? "Punkt (Grat)" : "(Ergaenzung noch nicht gemessen)");
+  }
+
+  // Eigenwerte der Krümmungsmatrix
+  if (wirkungsflaeche.anzahlEigenwerte() > 0) {
+    tft.setTextColor(TFT_SUBTITLE);
+    tft.setCursor(260, 131);
+    tft.print("Eigenwerte:");
+    for (int i = 0; i < wirkungsflaeche.anzahlEigenwerte(); i++) {
+      tft.print(" ");
+      tft.print(wirkungsflaeche.eigenwert(i), 1);
+    }
+  }
+
+  // Vorhergesagtes Optimum im Versuchsbereich
+  tft.fillRoundRect(250, 152, 210, 98, 5, TFT_SUCCESS);
+  tft.setTextColor(TFT_TEXT);
+  tft.setCursor(260, 160);
+  tft.print(wirkungsflaeche.optimumAmStationaerenPunkt() ? "Optimum (stationaerer Punkt):" : "Optimum (Rand des Bereichs):");
+  for (int k = 0; k < 3; k++) {
+    int faktorIndex = ausgewaehlteVollfaktoren[k];
+    int y = 178 + k * 15;
+    tft.setCursor(260, y);
+    tft.print(kurzeFaktorNamen[faktorIndex]);
+    tft.print(":");
+    formatiereStufe(faktorIndex, wirkungsflaeche.optimaleStufe(k), name, sizeof(name));
+    tft.setCursor(330, y);
+    tft.print(name);
+  }
+  tft.fillRoundRect(258, 225, 194, 18, 3, TFT_TITLE_BG);
+  tft.setTextColor(TFT_HIGHLIGHT);
+  tft.setCursor(265, 230);
+  tft.print("Prognose: ");
+  tft.print(wirkungsflaeche.optimum(), 2);
+  tft.print(" uW");
+
+  // Modellgüte
+  tft.fillRoundRect(20, 256, 440, 38, 5, TFT_OUTLINE);
+  tft.setTextColor(TFT_SUBTITLE);
+  tft.setCursor(30, 263);
+  tft.print("R^2 = ");
+  tft.print(constrain(modell.r2(), 0.0f, 1.0f), 3);
+  tft.print("   korr. = ");
+  tft.print(constrain(modell.r2Korrigiert(), 0.0f, 1.0f), 3);
+  tft.print("   Rest-FG = ");
+  tft.print(modell.freiheitsgrade());
+  tft.setCursor(30, 279);
+  tft.print("Beobachtungen: ");
+  tft.print(modell.anzahlBeobachtungen());
+  tft.print(" (Wuerfel + ");
+  int gemessen = 0;
+  for (int v = 0; v < wirkungsflaeche.anzahlErgaenzung(); v++) {
+    if (zzpMittelwerte[v] != 0) gemessen++;
+  }
+  tft.print(gemessen);
+  tft.print(" von ");
+  tft.print(wirkungsflaeche.anzahlErgaenzung());
+  tft.print(" Ergaenzungsversuchen)");
+
+  zeichneStatusleiste("Druecken Sie den Drehknopf, um die Zusammenfassung anzuzeigen.");
+
+  maxCursorPosition = 0;
+  aktuellerModus = ZZP_AUSWERTUNG;
+}
@@ -0,0 +1,380 @@
+/**
+ * WindTurbineZwischenstand.cpp
+ * Schrittweise aktualisierte Diagramme während der teilfaktoriellen Messungen
+ */
+
+#include "WindTurbineZwischenstand.h"
+
+// Haupteffekte: Zeichenfläche relativ zum Ursprung, eine Spalte pro Faktor
+#define ZS_FLAECHE_X 38
+#define ZS_FLAECHE_Y 24
+#define ZS_FLAECHE_B 180
+#define ZS_FLAECHE_H 160
+#define ZS_SPALTE 36
+#define ZS_RAND 5      // Punkte (Radius 3) bleiben innerhalb der Fläche
+#define ZS_GITTER 4    // Abschnitte der y-Achse
+
+// Pareto: zweite Box, eine Zeile pro Faktor
+#define ZS_PARETO_X 235
+#define ZS_ZEILE_Y 28
+#define ZS_ZEILE_H 36
+#define ZS_BALKEN_X 45
+#define ZS_BALKEN_B 120
+#define ZS_TEXT_X 170
+
+WindTurbineZwischenstand::WindTurbineZwischenstand() :
+  tft(nullptr),
+  ursprungX(0),
+  ursprungY(0),
+  gezeichnet(false)
+{
+  leeren();
+}
+
+void WindTurbineZwischenstand::begin(TFT_eSPI* display) {
+  tft = display;
+}
+
+void WindTurbineZwischenstand::leeren() {
+  for (int v = 0; v < 8; v++) {
+    vorhanden[v] = false;
+  }
+  for (int f = 0; f < 5; f++) {
+    for (int s = 0; s < 2; s++) {
+      summe[f][s] = 0;
+      anzahl[f][s] = 0;
+    }
+  }
+}
+
+/**
+ * Schreibt die Summen der Stufen fort (ein bereits vorhandener Wert wird ersetzt)
+ * @param stufen Stufen des Versuchs (-1 = niedrig, 1 = hoch)
+ */
+void WindTurbineZwischenstand::setzeVersuch(int versuch, const int stufen[5], float mittelwert) {
+  if (versuch < 0 || versuch >= 8) return;
+  entferneVersuch(versuch);
+
+  for (int f = 0; f < 5; f++) {
+    versuchStufen[versuch][f] = stufen[f];
+    if (stufen[f] == 0) continue;
+    int s = (stufen[f] > 0) ? 1 : 0;
+    summe[f][s] += mittelwert;
+    anzahl[f][s]++;
+  }
+  versuchWert[versuch] = mittelwert;
+  vorhanden[versuch] = true;
+}
+
+void WindTurbineZwischenstand::entferneVersuch(int versuch) {
+  if (versuch < 0 || versuch >= 8 || !vorhanden[versuch]) return;
+
+  for (int f = 0; f < 5; f++) {
+    if (versuchStufen[versuch][f] == 0) continue;
+    int s = (versuchStufen[versuch][f] > 0) ? 1 : 0;
+    summe[f][s] -= versuchWert[versuch];
+    anzahl[f][s]--;
+  }
+  vorhanden[versuch] = false;
+}
+
+float WindTurbineZwischenstand::mittelwert(int faktor, int stufe) {
+  return summe[faktor][stufe] / anzahl[faktor][stufe];
+}
+
+bool WindTurbineZwischenstand::effektBekannt(int faktor) {
+  return anzahl[faktor][0] > 0 && anzahl[faktor][1] > 0;
+}
+
+float WindTurbineZwischenstand::effekt(int faktor) {
+  return effektBekannt(faktor) ? mittelwert(faktor, 1) - mittelwert(faktor, 0) : 0;
+}
+
+bool WindTurbineZwischenstand::istGezeichnet() {
+  return gezeichnet;
+}
+
+/**
+ * Zeichnet beide Diagramme komplett (beim Betreten der Ansicht)
+ */
+void WindTurbineZwischenstand::zeichneVollstaendig(int16_t x, int16_t y) {
+  if (tft == nullptr) return;
+  ursprungX = x;
+  ursprungY = y;
+
+  zeichneHaupteffektRahmen();
+  aktualisiereHaupteffekte(true);
+
+  zeichneParetoRahmen();
+  aktualisierePareto(true);
+
+  gezeichnet = true;
+}
+
+int WindTurbineZwischenstand::zeichneAenderungen() {
+  if (tft == nullptr || !gezeichnet) return 0;
+  return aktualisiereHaupteffekte(false) + aktualisierePareto(false);
+}
+
+// ---------------------------------------------------------------------------
+// Haupteffekte
+// ---------------------------------------------------------------------------
+
+/**
+ * Kleinster und größter Stufen-Mittelwert
+ * @return false wenn noch kein Versuch vorliegt
+ */
+bool WindTurbineZwischenstand::berechneAchse(float& minimum, float& maximum) {
+  bool gefunden = false;
+  for (int f = 0; f < 5; f++) {
+    for (int s = 0; s < 2; s++) {
+      if (anzahl[f][s] == 0) continue;
+      float wert = mittelwert(f, s);
+      if (!gefunden || wert < minimum) minimum = wert;
+      if (!gefunden || wert > maximum) maximum = wert;
+      gefunden = true;
+    }
+  }
+  return gefunden;
+}
+
+int16_t WindTurbineZwischenstand::wertZuY(float wert) {
+  int16_t oben = ursprungY + ZS_FLAECHE_Y + ZS_RAND;
+  int16_t hoehe = ZS_FLAECHE_H - 2 * ZS_RAND;
+  float anteil = (wert - achseMin) / (achseMax - achseMin);
+  return oben + hoehe - (int16_t)(constrain(anteil, 0.0f, 1.0f) * hoehe);
+}
+
+int16_t WindTurbineZwischenstand::punktX(int faktor, int stufe) {
+  return ursprungX + ZS_FLAECHE_X + faktor * ZS_SPALTE + (stufe ? 28 : 9);
+}
+
+void WindTurbineZwischenstand::zeichneHaupteffektRahmen() {
+  tft->fillRoundRect(ursprungX, ursprungY, 225, ZWISCHENSTAND_HOEHE, 5, TFT_OUTLINE);
+  tft->setTextSize(1);
+  tft->setTextColor(TFT_HIGHLIGHT);
+  tft->setCursor(ursprungX + 10, ursprungY + 7);
+  tft->print("Haupteffekte (bisher)");
+
+  // Faktorkürzel und Stufen unter der Zeichenfläche
+  char kuerzel[5];
+  int16_t unten = ursprungY + ZS_FLAECHE_Y + ZS_FLAECHE_H;
+  for (int f = 0; f < 5; f++) {
+    strncpy(kuerzel, faktorNamen[f], 4);
+    kuerzel[4] = '\0';
+    tft->setTextColor(TFT_TEXT);
+    tft->setCursor(ursprungX + ZS_FLAECHE_X + f * ZS_SPALTE + 6, unten + 6);
+    tft->print(kuerzel);
+    tft->setTextColor(TFT_LIGHT_TEXT);
+    tft->setCursor(punktX(f, 0) - 2, unten + 18);
+    tft->print("-");
+    tft->setCursor(punktX(f, 1) - 2, unten + 18);
+    tft->print("+");
+  }
+}
+
+/**
+ * Leert die Zeichenfläche und zeichnet Gitter und alle Faktoren
+ */
+void WindTurbineZwischenstand::zeichneHaupteffektFlaeche() {
+  tft->fillRect(ursprungX + ZS_FLAECHE_X, ursprungY + ZS_FLAECHE_Y, ZS_FLAECHE_B, ZS_FLAECHE_H, TFT_BACKGROUND);
+  for (int f = 0; f < 5; f++) {
+    stelleGitterWiederHer(f);
+  }
+  zeichneAchsenBeschriftung();
+}
+
+void WindTurbineZwischenstand::zeichneAchsenBeschriftung() {
+  tft->fillRect(ursprungX + 2, ursprungY + ZS_FLAECHE_Y, ZS_FLAECHE_X - 4, ZS_FLAECHE_H, TFT_OUTLINE);
+  if (achseMax <= achseMin) return;
+
+  int stellen = (achseMax - achseMin >= 2 * ZS_GITTER) ? 0 : 1;
+  tft->setTextSize(1);
+  tft->setTextColor(TFT_LIGHT_TEXT);
+  tft->setCursor(ursprungX + 3, wertZuY(achseMax) - 3);
+  tft->print(achseMax, stellen);
+  tft->setCursor(ursprungX + 3, wertZuY(achseMin) - 4);
+  tft->print(achseMin, stellen);
+}
+
+/**
+ * Gitterlinien im Bereich einer Faktor-Spalte
+ */
+void WindTurbineZwischenstand::stelleGitterWiederHer(int faktor) {
+  int16_t x = ursprungX + ZS_FLAECHE_X + faktor * ZS_SPALTE;
+  int16_t oben = ursprungY + ZS_FLAECHE_Y + ZS_RAND;
+  int16_t hoehe = ZS_FLAECHE_H - 2 * ZS_RAND;
+  for (int g = 0; g <= ZS_GITTER; g++) {
+    tft->drawFastHLine(x, oben + g * hoehe / ZS_GITTER, ZS_SPALTE, TFT_GRID);
+  }
+}
+
+void WindTurbineZwischenstand::zeichneFaktor(int faktor, uint16_t linienFarbe, uint16_t punktFarbe) {
+  int16_t y0 = punktY[faktor][0];
+  int16_t y1 = punktY[faktor][1];
+  if (y0 >= 0 && y1 >= 0) {
+    tft->drawLine(punktX(faktor, 0), y0, punktX(faktor, 1), y1, linienFarbe);
+  }
+  for (int s = 0; s < 2; s++) {
+    if (punktY[faktor][s] >= 0) {
+      tft->fillCircle(punktX(faktor, s), punktY[faktor][s], 3, punktFarbe);
+    }
+  }
+}
+
+/**
+ * Zeichnet geänderte Punkte neu; reicht die y-Achse nicht mehr aus, wird
+ * sie in 1-2-5-Schritten erweitert und die Fläche komplett neu gezeichnet
+ * @param alles true = Achse neu wählen und alles zeichnen
+ * @return Anzahl neu gezeichneter Faktoren
+ */
+int WindTurbineZwischenstand::aktualisiereHaupteffekte(bool alles) {
+  float minimum = 0, maximum = 0;
+  bool daten = berechneAchse(minimum, maximum);
+
+  if (alles) {
+    achseMin = 0;
+    achseMax = 0;
+  }
+  bool neueAchse = alles || (daten && (achseMax <= achseMin || minimum < achseMin || maximum > achseMax));
+  if (neueAchse && daten) {
+    float roh = max(maximum - minimum, 1.0f) / ZS_GITTER;
+    float potenz = pow(10, floor(log10(roh)));
+    float schritt = (roh <= potenz) ? potenz : (roh <= 2 * potenz) ? 2 * potenz : (roh <= 5 * potenz) ? 5 * potenz : 10 * potenz;
+    achseMin = floor(minimum / schritt) * schritt;
+    achseMax = ceil(maximum / schritt) * schritt;
+    if (achseMax <= achseMin) achseMax = achseMin + schritt;
+  }
+  if (neueAchse) {
+    zeichneHaupteffektFlaeche();
+    for (int f = 0; f < 5; f++) {
+      punktY[f][0] = -1;
+      punktY[f][1] = -1;
+    }
+  }
+
+  int neu = 0;
+  for (int f = 0; f < 5; f++) {
+    int16_t y[2];
+    for (int s = 0; s < 2; s++) {
+      y[s] = (anzahl[f][s] > 0) ? wertZuY(mittelwert(f, s)) : -1;
+    }
+    if (y[0] == punktY[f][0] && y[1] == punktY[f][1] && !neueAchse) continue;
+
+    // Alte Linie und Punkte mit der Hintergrundfarbe übermalen, Gitter ergänzen
+    if (!neueAchse) {
+      zeichneFaktor(f, TFT_BACKGROUND, TFT_BACKGROUND);
+      stelleGitterWiederHer(f);
+    }
+
+    punktY[f][0] = y[0];
+    punktY[f][1] = y[1];
+    zeichneFaktor(f, (y[1] < y[0]) ? TFT_SUCCESS : TFT_WARNING, TFT_HIGHLIGHT);
+    neu++;
+  }
+  return neu;
+}
+
+// ---------------------------------------------------------------------------
+// Pareto
+// ---------------------------------------------------------------------------
+
+void WindTurbineZwischenstand::zeichneParetoRahmen() {
+  tft->fillRoundRect(ursprungX + ZS_PARETO_X, ursprungY, 225, ZWISCHENSTAND_HOEHE, 5, TFT_OUTLINE);
+  tft->setTextSize(1);
+  tft->setTextColor(TFT_HIGHLIGHT);
+  tft->setCursor(ursprungX + ZS_PARETO_X + 10, ursprungY + 7);
+  tft->print("Pareto |Effekt| (bisher)");
+}
+
+/**
+ * Sortiert die Faktoren nach Effektbetrag und passt jede Zeile an:
+ * anderer Faktor = Zeile neu, sonst nur Längendifferenz und Zahlenwert
+ * @param alles true = alle Zeilen komplett zeichnen
+ * @return Anzahl geänderter Zeilen
+ */
+int WindTurbineZwischenstand::aktualisierePareto(bool alles) {
+  int reihenfolge[5] = {0, 1, 2, 3, 4};
+  float groesster = 0;
+  for (int f = 0; f < 5; f++) {
+    if (effektBekannt(f) && abs(effekt(f)) > groesster) groesster = abs(effekt(f));
+  }
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4 - i; j++) {
+      int a = reihenfolge[j];
+      int b = reihenfolge[j + 1];
+      float wertA = effektBekannt(a) ? abs(effekt(a)) : -1;
+      float wertB = effektBekannt(b) ? abs(effekt(b)) : -1;
+      if (wertA < wertB) {
+        reihenfolge[j] = b;
+        reihenfolge[j + 1] = a;
+      }
+    }
+  }
+
+  int geaendert = 0;
+  int16_t boxX = ursprungX + ZS_PARETO_X;
+  int16_t balkenX = boxX + ZS_BALKEN_X;
+  int16_t textX = boxX + ZS_TEXT_X;
+
+  for (int r = 0; r < 5; r++) {
+    int f = reihenfolge[r];
+    int16_t zeileY = ursprungY + ZS_ZEILE_Y + r * ZS_ZEILE_H;
+
+    int16_t laenge = 0;
+    uint16_t farbe = TFT_GRID;
+    char text[10];
+    if (effektBekannt(f)) {
+      float e = effekt(f);
+      laenge = (groesster > 0) ? (int16_t)(abs(e) / groesster * ZS_BALKEN_B + 0.5f) : 0;
+      farbe = (e >= 0) ? TFT_SUCCESS : TFT_WARNING;
+      snprintf(text, sizeof(text), "%+.1f", e);
+    } else {
+      strcpy(text, "--");
+    }
+
+    if (alles || zeileFaktor[r] != f) {
+      tft->fillRect(boxX + 4, zeileY, 217, ZS_ZEILE_H - 8, TFT_OUTLINE);
+      char kuerzel[5];
+      strncpy(kuerzel, faktorNamen[f], 4);
+      kuerzel[4] = '\0';
+      tft->setTextSize(1);
+      tft->setTextColor(TFT_TEXT);
+      tft->setCursor(boxX + 10, zeileY + 10);
+      tft->print(kuerzel);
+      if (laenge > 0) tft->fillRect(balkenX, zeileY + 4, laenge, 20, farbe);
+      tft->setCursor(textX, zeileY + 10);
+      tft->print(text);
+      geaendert++;
+    } else {
+      bool anders = false;
+      int16_t alt = zeileLaenge[r];
+      if (farbe != zeileFarbe[r]) {
+        tft->fillRect(balkenX, zeileY + 4, max(alt, laenge), 20, TFT_OUTLINE);
+        if (laenge > 0) tft->fillRect(balkenX, zeileY + 4, laenge, 20, farbe);
+        anders = true;
+      } else if (laenge > alt) {
+        tft->fillRect(balkenX + alt, zeileY + 4, laenge - alt, 20, farbe);
+        anders = true;
+      } else if (laenge < alt) {
+        tft->fillRect(balkenX + laenge, zeileY + 4, alt - laenge, 20, TFT_OUTLINE);
+        anders = true;
+      }
+      if (strcmp(text, zeileText[r]) != 0) {
+        tft->fillRect(textX, zeileY + 4, 50, 20, TFT_OUTLINE);
+        tft->setTextSize(1);
+        tft->setTextColor(TFT_TEXT);
+        tft->setCursor(textX, zeileY + 10);
+        tft->print(text);
+        anders = true;
+      }
+      if (anders) geaendert++;
+    }
+
+    zeileFaktor[r] = f;
+    zeileLaenge[r] = laenge;
+    zeileFarbe[r] = farbe;
+    strcpy(zeileText[r], text);
+  }
+  return geaendert;
+}
@@ -0,0 +1,89 @@
+/**
+ * WindTurbineZwischenstand.h
+ * Haupteffekte und Pareto-Diagramm während der teilfaktoriellen Messungen
+ *
+ * Nach jedem abgeschlossenen Versuch werden nur die Summen der Stufen
+ * fortgeschrieben (5 Faktoren, je eine Stufe). Gezeichnet wird danach nur,
+ * was sich dadurch ändert: im Haupteffekt-Diagramm pro Faktor der Punkt der
+ * Stufe des Versuchs samt Verbindungslinie, im Pareto-Diagramm die Differenz
+ * der Balkenlänge und der Zahlenwert. Nur wenn die y-Achse der Haupteffekte
+ * erweitert werden muss, wird deren Zeichenfläche komplett neu gezeichnet.
+ */
+
+#ifndef WIND_TURBINE_ZWISCHENSTAND_H
+#define WIND_TURBINE_ZWISCHENSTAND_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "WindTurbineConstants.h"
+
+// Gesamtfläche beider Diagramme (je 225 Pixel breit)
+#define ZWISCHENSTAND_BREITE 460
+#define ZWISCHENSTAND_HOEHE 220
+
+class WindTurbineZwischenstand {
+public:
+  // Konstruktor
+  WindTurbineZwischenstand();
+
+  void begin(TFT_eSPI* display);
+
+  // Alle Versuche entfernen
+  void leeren();
+
+  // Mittelwert eines abgeschlossenen Versuchs übernehmen oder ersetzen
+  void setzeVersuch(int versuch, const int stufen[5], float mittelwert);
+  void entferneVersuch(int versuch);
+
+  // Effekt hoch - niedrig, bekannt sobald beide Stufen gemessen wurden
+  bool effektBekannt(int faktor);
+  float effekt(int faktor);
+
+  // Rahmen, Achsen und alle Punkte/Balken zeichnen
+  void zeichneVollstaendig(int16_t x, int16_t y);
+
+  // Nur geänderte Punkte, Linien und Balken zeichnen
+  // @return Anzahl neu gezeichneter Elemente
+  int zeichneAenderungen();
+
+  bool istGezeichnet();
+
+private:
+  TFT_eSPI* tft;
+  int16_t ursprungX;
+  int16_t ursprungY;
+  bool gezeichnet;
+
+  // Versuchsdaten und laufende Summen je Faktor und Stufe (0 = niedrig, 1 = hoch)
+  bool vorhanden[8];
+  int8_t versuchStufen[8][5];
+  float versuchWert[8];
+  float summe[5][2];
+  uint8_t anzahl[5][2];
+
+  // Gezeichneter Zustand der Haupteffekte
+  int16_t punktY[5][2];   // -1 = kein Punkt
+  float achseMin;
+  float achseMax;
+
+  // Gezeichneter Zustand des Pareto-Diagramms pro Zeile
+  int8_t zeileFaktor[5];  // -1 = leer
+  int16_t zeileLaenge[5];
+  uint16_t zeileFarbe[5];
+  char zeileText[5][10];
+
+  float mittelwert(int faktor, int stufe);
+  bool berechneAchse(float& minimum, float& maximum);
+  int16_t wertZuY(float wert);
+  int16_t punktX(int faktor, int stufe);
+  void zeichneHaupteffektRahmen();
+  void zeichneHaupteffektFlaeche();
+  void zeichneAchsenBeschriftung();
+  void zeichneFaktor(int faktor, uint16_t linienFarbe, uint16_t punktFarbe);
+  void stelleGitterWiederHer(int faktor);
+  int aktualisiereHaupteffekte(bool alles);
+  void zeichneParetoRahmen();
+  int aktualisierePareto(bool alles);
+};
+
+#endif // WIND_TURBINE_ZWISCHENSTAND_H
@@ -26,6 +26,34 @@
  * - WindTurbineDataManager.h: Datenverwaltung Header
  * - WindTurbineDataManager.cpp: Datenverwaltung Implementierung
  * - WindTurbineDataUI.cpp: UI für Datenverwaltung und Export
+ * - WindTurbineCompositor.h/.cpp: Overlays und Neuzeichnen beschädigter Bereiche
+ * - WindTurbineLiveUI.cpp: Live-Werte der Messbildschirme (Sprites)
+ * - WindTurbineDmaRenderer.h/.cpp: Kachelweises Zeichnen per DMA mit Doppelpuffer
+ * - WindTurbineWidgets.h/.cpp: Widget-Schicht mit Vergleich der Eigenschaften
+ * - WindTurbineHintergrundCache.h/.cpp: RLE-Zwischenspeicher für statische Hintergründe
+ * - WindTurbineStreifenDiagramm.h/.cpp: Laufendes Leistungsdiagramm der Messbildschirme
+ * - WindTurbineDiagrammModell.h/.cpp: Zwischengespeicherte Geometrie der Auswertungsdiagramme
+ * - WindTurbineSpiKalibrierung.h/.cpp: SPI-Takt des Displays beim Start kalibrieren (NVS)
+ * - WindTurbineSchrift.h/.cpp: Kantengeglättete Schriftatlanten mit Glyphen-Cache
+ * - WindTurbineZwischenstand.h/.cpp: Haupteffekte und Pareto während der teilfaktoriellen Messungen
+ * - WindTurbineBildPlaner.h/.cpp: Zusammenfassen von Zeichenaufträgen mit begrenzter Bildrate
+ * - WindTurbineSpiegel.h/.cpp: Schattenbild des Displays für die Spiegelung im Browser
+ * - WindTurbinePngStrom.h/.cpp: PNG-Kodierung Zeile für Zeile (Screenshot)
+ * - WindTurbineVersuchsplan.h: Teilfaktorielle Versuchspläne 2^(k-p) zur Übersetzungszeit
+ * - WindTurbineEffektAnalyse.h/.cpp: Alle Effekte eines Plans in einem Durchlauf (Yates)
+ * - WindTurbineRegression.h/.cpp: Lineares Modell nach kleinsten Quadraten (Cholesky, ohne Heap)
+ * - WindTurbineAnova.h/.cpp: Varianzanalyse mit F-Tests und p-Werten aus den Wiederholungen
+ * - WindTurbineKonfidenz.h/.cpp: Laufende Statistik und Konfidenzintervalle (t-Tabelle)
+ * - WindTurbineLenth.h/.cpp: Effektprüfung ohne Wiederholungen (Lenth) und Halbnormal-Diagramm
+ * - WindTurbineAliasStruktur.h/.cpp: Definierende Relation, Auflösung und Aliasketten
+ * - WindTurbineWirkungsflaeche.h/.cpp: Zentraler zusammengesetzter Plan, quadratisches Modell, stationärer Punkt
+ * - WindTurbineWirkungsflaecheUI.cpp: Plan-, Mess- und Auswertungsbildschirm der Wirkungsfläche
+ * - WindTurbineFaltung.h/.cpp: Faltung des Teilplans (Spiegelung oder ein Faktor), kombinierter Plan mit Block
+ * - WindTurbineFaltungUI.cpp: Plan-, Mess- und Auswertungsbildschirm der Faltung
+ * - WindTurbineOptimierung.h/.cpp: Optimum über dem Modell (alle Ecken, stetige Suche, Verbote), Prognoseintervall
+ * - WindTurbineRenderZaehler.h/.cpp: Zählung von Zeichenaufrufen und SPI-Bytes
+ * - WindTurbineBenchmark.cpp: Render-Benchmark aller Bildschirme
+ * - host/: Host-Build für Linux (TFT_eSPI-Bildspeicher, PNG-Ausgabe, Zählung der Zeichenaufrufe)
  */
 
  #include "WindTurbineExperiment.h"
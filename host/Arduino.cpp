@@ -0,0 +1,296 @@
+/**
+ * host/Arduino.cpp
+ * Arduino-Kern für den Host-Build
+ */
+
+#include "Arduino.h"
+#include <chrono>
+#include <cstdarg>
+#include <cctype>
+
+HardwareSerial Serial;
+
+// Durch delay() übersprungene Zeit
+static unsigned long long uhrVersatzUs = 0;
+
+static unsigned long long laufzeitUs() {
+  static const auto start = std::chrono::steady_clock::now();
+  auto jetzt = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(jetzt - start).count() + uhrVersatzUs;
+}
+
+unsigned long millis() {
+  return (unsigned long)(laufzeitUs() / 1000);
+}
+
+unsigned long micros() {
+  // Wie auf dem ESP32: 32 Bit, läuft nach gut 71 Minuten über
+  return (uint32_t)laufzeitUs();
+}
+
+void delay(unsigned long ms) {
+  uhrVersatzUs += (unsigned long long)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+  uhrVersatzUs += us;
+}
+
+void yield() {
+}
+
+void pinMode(uint8_t, uint8_t) {
+}
+
+void digitalWrite(uint8_t, uint8_t) {
+}
+
+int digitalRead(uint8_t) {
+  // Eingänge mit Pull-up: nicht gedrückt
+  return HIGH;
+}
+
+int analogRead(uint8_t) {
+  // Motor-Testpin: ~2700 bei angeschlossenem Motor
+  return 2700;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long max) {
+  return (max <= 0) ? 0 : rand() % max;
+}
+
+long random(long min, long max) {
+  return (max <= min) ? min : min + random(max - min);
+}
+
+void randomSeed(unsigned long seed) {
+  srand(seed);
+}
+
+bool psramFound() {
+  return false;
+}
+
+void* ps_malloc(size_t groesse) {
+  return malloc(groesse);
+}
+
+void* ps_realloc(void* zeiger, size_t groesse) {
+  return realloc(zeiger, groesse);
+}
+
+// ---------------------------------------------------------------------------
+// String
+
+static std::string zahlZuText(unsigned long long wert, int basis, bool negativ) {
+  if (basis < 2) basis = 10;
+  char puffer[72];
+  char* p = &puffer[sizeof(puffer) - 1];
+  *p = '\0';
+  do {
+    int ziffer = wert % basis;
+    *--p = (ziffer < 10) ? '0' + ziffer : 'A' + ziffer - 10;
+    wert /= basis;
+  } while (wert > 0);
+  if (negativ) *--p = '-';
+  return std::string(p);
+}
+
+static std::string gleitkommaZuText(double wert, int stellen) {
+  char puffer[64];
+  snprintf(puffer, sizeof(puffer), "%.*f", stellen, wert);
+  return std::string(puffer);
+}
+
+String::String(int wert, int basis) :
+  s(basis == DEC ? zahlZuText(wert < 0 ? -(long long)wert : wert, basis, wert < 0) : zahlZuText((unsigned int)wert, basis, false)) {}
+String::String(unsigned int wert, int basis) : s(zahlZuText(wert, basis, false)) {}
+String::String(long wert, int basis) :
+  s(basis == DEC ? zahlZuText(wert < 0 ? -(long long)wert : wert, basis, wert < 0) : zahlZuText((unsigned long)wert, basis, false)) {}
+String::String(unsigned long wert, int basis) : s(zahlZuText(wert, basis, false)) {}
+String::String(float wert, int stellen) : s(gleitkommaZuText(wert, stellen)) {}
+String::String(double wert, int stellen) : s(gleitkommaZuText(wert, stellen)) {}
+
+int String::indexOf(char c, unsigned int von) const {
+  size_t p = s.find(c, von);
+  return (p == std::string::npos) ? -1 : (int)p;
+}
+
+int String::indexOf(const String& text, unsigned int von) const {
+  size_t p = s.find(text.s, von);
+  return (p == std::string::npos) ? -1 : (int)p;
+}
+
+int String::lastIndexOf(char c) const {
+  size_t p = s.rfind(c);
+  return (p == std::string::npos) ? -1 : (int)p;
+}
+
+String String::substring(unsigned int von) const {
+  return (von >= s.size()) ? String() : String(s.substr(von));
+}
+
+String String::substring(unsigned int von, unsigned int bis) const {
+  if (von > bis) std::swap(von, bis);
+  if (von >= s.size()) return String();
+  return String(s.substr(von, bis - von));
+}
+
+bool String::startsWith(const String& text) const {
+  return s.compare(0, text.s.size(), text.s) == 0;
+}
+
+bool String::endsWith(const String& text) const {
+  return s.size() >= text.s.size() && s.compare(s.size() - text.s.size(), text.s.size(), text.s) == 0;
+}
+
+void String::replace(const String& alt, const String& neu) {
+  if (alt.s.empty()) return;
+  size_t p = 0;
+  while ((p = s.find(alt.s, p)) != std::string::npos) {
+    s.replace(p, alt.s.size(), neu.s);
+    p += neu.s.size();
+  }
+}
+
+void String::trim() {
+  size_t anfang = s.find_first_not_of(" \t\r\n");
+  size_t ende = s.find_last_not_of(" \t\r\n");
+  s = (anfang == std::string::npos) ? std::string() : s.substr(anfang, ende - anfang + 1);
+}
+
+void String::toLowerCase() {
+  for (char& c : s) c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (char& c : s) c = toupper((unsigned char)c);
+}
+
+void String::remove(unsigned int index, unsigned int anzahl) {
+  if (index < s.size()) s.erase(index, anzahl);
+}
+
+void String::toCharArray(char* puffer, unsigned int groesse) const {
+  if (groesse == 0) return;
+  size_t n = std::min((size_t)groesse - 1, s.size());
+  memcpy(puffer, s.c_str(), n);
+  puffer[n] = '\0';
+}
+
+String operator+(const String& lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, const char* rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const char* lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, char rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, int rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, unsigned int rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, long rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, unsigned long rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, float rhs) { String r(lhs); r += rhs; return r; }
+String operator+(const String& lhs, double rhs) { String r(lhs); r += rhs; return r; }
+
+// ---------------------------------------------------------------------------
+// Print
+
+size_t Print::write(const uint8_t* puffer, size_t groesse) {
+  size_t n = 0;
+  while (groesse--) {
+    n += write(*puffer++);
+  }
+  return n;
+}
+
+size_t Print::print(const String& text) {
+  return write((const uint8_t*)text.c_str(), text.length());
+}
+
+size_t Print::print(const char* text) {
+  return write(text);
+}
+
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+size_t Print::print(int wert, int basis) {
+  return print((long)wert, basis);
+}
+
+size_t Print::print(unsigned int wert, int basis) {
+  return printZahl(wert, basis);
+}
+
+size_t Print::print(long wert, int basis) {
+  return print((long long)wert, basis);
+}
+
+size_t Print::print(unsigned long wert, int basis) {
+  return printZahl(wert, basis);
+}
+
+size_t Print::print(long long wert, int basis) {
+  if (basis == DEC && wert < 0) {
+    return print('-') + printZahl(-(unsigned long long)wert, basis);
+  }
+  return printZahl((unsigned long long)wert, basis);
+}
+
+size_t Print::print(unsigned long long wert, int basis) {
+  return printZahl(wert, basis);
+}
+
+size_t Print::print(double wert, int stellen) {
+  return printFloat(wert, stellen);
+}
+
+size_t Print::print(const Printable& objekt) {
+  return objekt.printTo(*this);
+}
+
+size_t Print::println() {
+  return write("\r\n");
+}
+
+size_t Print::printf(const char* format, ...) {
+  char puffer[256];
+  va_list argumente;
+  va_start(argumente, format);
+  int laenge = vsnprintf(puffer, sizeof(puffer), format, argumente);
+  va_end(argumente);
+  if (laenge < 0) return 0;
+  return write((const uint8_t*)puffer, std::min((size_t)laenge, sizeof(puffer) - 1));
+}
+
+size_t Print::printZahl(unsigned long long wert, int basis) {
+  std::string text = zahlZuText(wert, basis, false);
+  return write((const uint8_t*)text.c_str(), text.size());
+}
+
+size_t Print::printFloat(double wert, int stellen) {
+  // Wie der Arduino-Kern: nan, inf und ovf statt Ziffern
+  if (std::isnan(wert)) return write("nan");
+  if (std::isinf(wert)) return write("inf");
+  if (wert > 4294967040.0 || wert < -4294967040.0) return write("ovf");
+
+  std::string text = gleitkommaZuText(wert, stellen);
+  return write((const uint8_t*)text.c_str(), text.size());
+}
+
+// ---------------------------------------------------------------------------
+// Serial
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (c != '\r') fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* puffer, size_t groesse) {
+  for (size_t i = 0; i < groesse; i++) {
+    write(puffer[i]);
+  }
+  return groesse;
+}
@@ -0,0 +1,201 @@
+/**
+ * host/Arduino.h
+ * Arduino-Kern für den Host-Build (Linux)
+ *
+ * Enthält nur, was die Bildschirm-Module des Sketches verwenden: String,
+ * Print/Serial (auf stdout), Zeitfunktionen und Speicherfunktionen.
+ * delay() wartet nicht wirklich, sondern verschiebt nur die Uhr von
+ * millis()/micros(), damit Bildschirme mit Wartezeiten sofort durchlaufen.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define IRAM_ATTR
+#define PROGMEM
+#define F(x) x
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+class String {
+public:
+  String() {}
+  String(const char* text) : s(text ? text : "") {}
+  String(const std::string& text) : s(text) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(int wert, int basis = DEC);
+  explicit String(unsigned int wert, int basis = DEC);
+  explicit String(long wert, int basis = DEC);
+  explicit String(unsigned long wert, int basis = DEC);
+  explicit String(float wert, int stellen = 2);
+  explicit String(double wert, int stellen = 2);
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+
+  String& operator+=(const String& rhs) { s += rhs.s; return *this; }
+  String& operator+=(const char* rhs) { s += rhs; return *this; }
+  String& operator+=(char rhs) { s += rhs; return *this; }
+  String& operator+=(int rhs) { return *this += String(rhs); }
+  String& operator+=(unsigned int rhs) { return *this += String(rhs); }
+  String& operator+=(long rhs) { return *this += String(rhs); }
+  String& operator+=(unsigned long rhs) { return *this += String(rhs); }
+  String& operator+=(float rhs) { return *this += String(rhs); }
+  String& operator+=(double rhs) { return *this += String(rhs); }
+
+  bool operator==(const String& rhs) const { return s == rhs.s; }
+  bool operator==(const char* rhs) const { return s == rhs; }
+  bool operator!=(const String& rhs) const { return s != rhs.s; }
+  bool operator!=(const char* rhs) const { return s != rhs; }
+  bool operator<(const String& rhs) const { return s < rhs.s; }
+  char operator[](unsigned int i) const { return s[i]; }
+  char& operator[](unsigned int i) { return s[i]; }
+
+  char charAt(unsigned int i) const { return s[i]; }
+  int indexOf(char c, unsigned int von = 0) const;
+  int indexOf(const String& text, unsigned int von = 0) const;
+  int lastIndexOf(char c) const;
+  String substring(unsigned int von) const;
+  String substring(unsigned int von, unsigned int bis) const;
+  bool startsWith(const String& text) const;
+  bool endsWith(const String& text) const;
+  bool equals(const String& rhs) const { return s == rhs.s; }
+  void replace(const String& alt, const String& neu);
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  void reserve(unsigned int groesse) { s.reserve(groesse); }
+  void remove(unsigned int index, unsigned int anzahl = 1);
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  void toCharArray(char* puffer, unsigned int groesse) const;
+
+private:
+  std::string s;
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+String operator+(const String& lhs, int rhs);
+String operator+(const String& lhs, unsigned int rhs);
+String operator+(const String& lhs, long rhs);
+String operator+(const String& lhs, unsigned long rhs);
+String operator+(const String& lhs, float rhs);
+String operator+(const String& lhs, double rhs);
+
+class Print;
+
+class Printable {
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+// Ausgabe wie im Arduino-Kern, abgeleitete Klassen implementieren write()
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* puffer, size_t groesse);
+  size_t write(const char* text) { return text ? write((const uint8_t*)text, strlen(text)) : 0; }
+
+  size_t print(const String& text);
+  size_t print(const char* text);
+  size_t print(char c);
+  size_t print(int wert, int basis = DEC);
+  size_t print(unsigned int wert, int basis = DEC);
+  size_t print(long wert, int basis = DEC);
+  size_t print(unsigned long wert, int basis = DEC);
+  size_t print(long long wert, int basis = DEC);
+  size_t print(unsigned long long wert, int basis = DEC);
+  size_t print(double wert, int stellen = 2);
+  size_t print(const Printable& objekt);
+
+  size_t println();
+  template<typename T> size_t println(const T& wert) { size_t n = print(wert); return n + println(); }
+  template<typename T> size_t println(const T& wert, int format) { size_t n = print(wert, format); return n + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+  size_t printZahl(unsigned long long wert, int basis);
+  size_t printFloat(double wert, int stellen);
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  void setTimeout(unsigned long) {}
+};
+
+// Serial schreibt auf stdout
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  void flush() { fflush(stdout); }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* puffer, size_t groesse) override;
+  using Print::write;
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// Zeit
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// Pins (Eingänge liefern Ruhepegel: Taster nicht gedrückt, Motor angeschlossen)
+void pinMode(uint8_t pin, uint8_t modus);
+void digitalWrite(uint8_t pin, uint8_t wert);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// Speicher (kein PSRAM auf dem Host)
+bool psramFound();
+void* ps_malloc(size_t groesse);
+void* ps_realloc(void* zeiger, size_t groesse);
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,11 @@
+/**
+ * host/ArduinoJson.h
+ * Nur damit WindTurbineDataManager.h übersetzt - der Host-Build ersetzt
+ * die Datenverwaltung (host/HostDatenverwaltung.cpp) und exportiert nichts.
+ */
+
+#ifndef HOST_ARDUINOJSON_H
+#define HOST_ARDUINOJSON_H
+
+#include <Arduino.h>
+#endif // HOST_ARDUINOJSON_H
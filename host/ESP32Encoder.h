@@ -0,0 +1,23 @@
+/**
+ * host/ESP32Encoder.h
+ * Drehregler für den Host-Build
+ */
+
+#ifndef HOST_ESP32_ENCODER_H
+#define HOST_ESP32_ENCODER_H
+
+#include <Arduino.h>
+
+class ESP32Encoder {
+public:
+  void attachHalfQuad(int, int) {}
+  void attachFullQuad(int, int) {}
+  void setCount(int64_t wert) { zaehler = wert; }
+  int64_t getCount() { return zaehler; }
+  void clearCount() { zaehler = 0; }
+
+private:
+  int64_t zaehler = 0;
+};
+
+#endif // HOST_ESP32_ENCODER_H
@@ -0,0 +1,11 @@
+/**
+ * host/ESPmDNS.h
+ * Nur damit WindTurbineDataManager.h übersetzt - der Host-Build ersetzt
+ * die Datenverwaltung (host/HostDatenverwaltung.cpp) und exportiert nichts.
+ */
+
+#ifndef HOST_ESPMDNS_H
+#define HOST_ESPMDNS_H
+
+#include <Arduino.h>
+#endif // HOST_ESPMDNS_H
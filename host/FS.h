@@ -0,0 +1,57 @@
+/**
+ * host/FS.h
+ * Dateisystem für den Host-Build: Dateien liegen in einem lokalen Verzeichnis
+ */
+
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File : public Stream {
+public:
+  File(FILE* datei = nullptr, const String& name = String());
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* puffer, size_t groesse) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  size_t read(uint8_t* puffer, size_t groesse);
+  size_t size();
+  const char* name();
+  void close();
+  operator bool() const { return datei != nullptr; }
+
+private:
+  FILE* datei;
+  String dateiName;
+};
+
+class FS {
+public:
+  FS(const char* verzeichnis) : basis(verzeichnis) {}
+  File open(const String& pfad, const char* modus = FILE_READ);
+  File open(const char* pfad, const char* modus = FILE_READ);
+  bool exists(const String& pfad);
+  bool exists(const char* pfad);
+  bool remove(const String& pfad);
+  bool remove(const char* pfad);
+
+protected:
+  String basis;
+  String hostPfad(const char* pfad);
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // HOST_FS_H
@@ -0,0 +1,187 @@
+/**
+ * host/HostDatenverwaltung.cpp
+ * Datenverwaltung für den Host-Build
+ *
+ * Ersetzt WindTurbineDataManager.cpp: Versuche werden nur im Speicher
+ * gehalten, damit die Listen- und Detailbildschirme Inhalte zeigen.
+ * WiFi-Export gibt es auf dem Host nicht.
+ */
+
+#include "WindTurbineDataManager.h"
+
+struct HostVersuch {
+  ExperimentMetadata metadaten;
+  float teilMessungen[8][5];
+  float teilMittelwerte[8];
+  float teilStandardabweichungen[8];
+  float vollMessungen[8][5];
+  float vollMittelwerte[8];
+  float vollStandardabweichungen[8];
+  float zzpMessungen[ZZP_MAX_ERGAENZUNG][5];
+  float zzpMittelwerte[ZZP_MAX_ERGAENZUNG];
+  float zzpStandardabweichungen[ZZP_MAX_ERGAENZUNG];
+  float effekte[5];
+  int vollfaktoren[3];
+};
+
+static HostVersuch hostVersuche[MAX_SAVED_EXPERIMENTS];
+static int hostAnzahl = 0;
+static int hostLaufnummer = 0;
+
+static int findeVersuch(const char* filename) {
+  for (int i = 0; i < hostAnzahl; i++) {
+    if (strcmp(hostVersuche[i].metadaten.filename, filename) == 0) return i;
+  }
+  return -1;
+}
+
+WindTurbineDataManager::WindTurbineDataManager() :
+  server(nullptr),
+  wifiExportActive(false),
+  accessPointAktiv(false),
+  spiegelungAktiv(false),
+  spiegelNeu(false)
+{
+}
+
+WindTurbineDataManager::~WindTurbineDataManager() {
+}
+
+bool WindTurbineDataManager::begin() {
+  return SPIFFS.begin(true);
+}
+
+bool WindTurbineDataManager::saveExperiment(const char* description, float teilfaktoriellMessungen[][5],
+                                            float teilfaktoriellMittelwerte[], float teilfaktoriellStandardabweichungen[],
+                                            float vollfaktoriellMessungen[][5], float vollfaktoriellMittelwerte[],
+                                            float vollfaktoriellStandardabweichungen[], float effekte[],
+                                            int ausgewaehlteVollfaktoren[],
+                                            float zzpMessungen[][5], float zzpMittelwerte[], float zzpStandardabweichungen[],
+                                            const WindTurbineWirkungsflaeche&) {
+  if (hostAnzahl >= MAX_SAVED_EXPERIMENTS) return false;
+
+  HostVersuch& v = hostVersuche[hostAnzahl];
+  snprintf(v.metadaten.filename, sizeof(v.metadaten.filename), "exp_host_%d.json", ++hostLaufnummer);
+  snprintf(v.metadaten.description, sizeof(v.metadaten.description), "%s", description);
+  snprintf(v.metadaten.timestamp, sizeof(v.metadaten.timestamp), "%lu", millis() / 1000);
+  v.metadaten.isValid = true;
+  v.metadaten.maxPower = 0;
+  for (int i = 0; i < 8; i++) {
+    v.metadaten.maxPower = max(v.metadaten.maxPower, max(teilfaktoriellMittelwerte[i], vollfaktoriellMittelwerte[i]));
+  }
+
+  memcpy(v.teilMessungen, teilfaktoriellMessungen, sizeof(v.teilMessungen));
+  memcpy(v.teilMittelwerte, teilfaktoriellMittelwerte, sizeof(v.teilMittelwerte));
+  memcpy(v.teilStandardabweichungen, teilfaktoriellStandardabweichungen, sizeof(v.teilStandardabweichungen));
+  memcpy(v.vollMessungen, vollfaktoriellMessungen, sizeof(v.vollMessungen));
+  memcpy(v.vollMittelwerte, vollfaktoriellMittelwerte, sizeof(v.vollMittelwerte));
+  memcpy(v.vollStandardabweichungen, vollfaktoriellStandardabweichungen, sizeof(v.vollStandardabweichungen));
+  memcpy(v.zzpMessungen, zzpMessungen, sizeof(v.zzpMessungen));
+  memcpy(v.zzpMittelwerte, zzpMittelwerte, sizeof(v.zzpMittelwerte));
+  memcpy(v.zzpStandardabweichungen, zzpStandardabweichungen, sizeof(v.zzpStandardabweichungen));
+  memcpy(v.effekte, effekte, sizeof(v.effekte));
+  memcpy(v.vollfaktoren, ausgewaehlteVollfaktoren, sizeof(v.vollfaktoren));
+
+  hostAnzahl++;
+  return true;
+}
+
+bool WindTurbineDataManager::loadExperiment(const char* filename, float teilfaktoriellMessungen[][5],
+                                            float teilfaktoriellMittelwerte[], float teilfaktoriellStandardabweichungen[],
+                                            float vollfaktoriellMessungen[][5], float vollfaktoriellMittelwerte[],
+                                            float vollfaktoriellStandardabweichungen[], float effekte[],
+                                            int ausgewaehlteVollfaktoren[],
+                                            float zzpMessungen[][5], float zzpMittelwerte[],
+                                            float zzpStandardabweichungen[]) {
+  int index = findeVersuch(filename);
+  if (index < 0) return false;
+
+  HostVersuch& v = hostVersuche[index];
+  memcpy(teilfaktoriellMessungen, v.teilMessungen, sizeof(v.teilMessungen));
+  memcpy(teilfaktoriellMittelwerte, v.teilMittelwerte, sizeof(v.teilMittelwerte));
+  memcpy(teilfaktoriellStandardabweichungen, v.teilStandardabweichungen, sizeof(v.teilStandardabweichungen));
+  memcpy(vollfaktoriellMessungen, v.vollMessungen, sizeof(v.vollMessungen));
+  memcpy(vollfaktoriellMittelwerte, v.vollMittelwerte, sizeof(v.vollMittelwerte));
+  memcpy(vollfaktoriellStandardabweichungen, v.vollStandardabweichungen, sizeof(v.vollStandardabweichungen));
+  if (zzpMessungen != nullptr && zzpMittelwerte != nullptr && zzpStandardabweichungen != nullptr) {
+    memcpy(zzpMessungen, v.zzpMessungen, sizeof(v.zzpMessungen));
+    memcpy(zzpMittelwerte, v.zzpMittelwerte, sizeof(v.zzpMittelwerte));
+    memcpy(zzpStandardabweichungen, v.zzpStandardabweichungen, sizeof(v.zzpStandardabweichungen));
+  }
+  memcpy(effekte, v.effekte, sizeof(v.effekte));
+  memcpy(ausgewaehlteVollfaktoren, v.vollfaktoren, sizeof(v.vollfaktoren));
+  return true;
+}
+
+int WindTurbineDataManager::listExperiments(ExperimentMetadata* metadata, int maxCount) {
+  int anzahl = min(hostAnzahl, maxCount);
+  for (int i = 0; i < anzahl; i++) {
+    metadata[i] = hostVersuche[i].metadaten;
+  }
+  return anzahl;
+}
+
+bool WindTurbineDataManager::deleteExperiment(const char* filename) {
+  int index = findeVersuch(filename);
+  if (index < 0) return false;
+
+  for (int i = index; i < hostAnzahl - 1; i++) {
+    hostVersuche[i] = hostVersuche[i + 1];
+  }
+  hostAnzahl--;
+  return true;
+}
+
+bool WindTurbineDataManager::deleteAllExperiments() {
+  hostAnzahl = 0;
+  return true;
+}
+
+bool WindTurbineDataManager::startWiFiExport(const char*) {
+  Serial.println("Host: WiFi-Export nicht verfuegbar");
+  return false;
+}
+
+void WindTurbineDataManager::stopWiFiExport() {
+  wifiExportActive = false;
+}
+
+void WindTurbineDataManager::handleWiFiExport() {
+}
+
+bool WindTurbineDataManager::startSpiegelung() {
+  Serial.println("Host: Spiegelung nicht verfuegbar");
+  return false;
+}
+
+void WindTurbineDataManager::stopSpiegelung() {
+  spiegelungAktiv = false;
+}
+
+bool WindTurbineDataManager::isSpiegelungAktiv() {
+  return false;
+}
+
+bool WindTurbineDataManager::istSpiegelVerbunden() {
+  return false;
+}
+
+bool WindTurbineDataManager::pruefeNeueSpiegelVerbindung() {
+  return false;
+}
+
+bool WindTurbineDataManager::sendeSpiegelDaten(const uint8_t*, size_t) {
+  return false;
+}
+
+String WindTurbineDataManager::getExportURL() {
+  return "";
+}
+
+String WindTurbineDataManager::getCurrentSSID() {
+  return currentSSID;
+}
+
+String WindTurbineDataManager::getCurrentIP() {
+  return "0.0.0.0";
+}
@@ -0,0 +1,81 @@
+/**
+ * host/HostMain.cpp
+ * Host-Programm: zeichnet alle Bildschirme unter Linux in einen Bildspeicher
+ *
+ * Anstelle der Hardware-Bibliotheken werden die Ersatzdateien aus host/
+ * verwendet, die Datenverwaltung wird durch host/HostDatenverwaltung.cpp
+ * ersetzt. Übersetzen mit host/Makefile: make -C host
+ *
+ * Aufruf: host/windrad_host [Ausgabeverzeichnis]   (Standard: bilder)
+ * - <Verzeichnis>/<Bildschirm>.png: Bild nach dem warmen Durchlauf, die PNGs
+ *   sind bei gleichem Stand byteweise gleich (Vergleich mit Referenzbildern
+ *   z.B. über cmp)
+ * - <Verzeichnis>/operationen.csv: Zeichenaufrufe des warmen Durchlaufs
+ * - spiffs/render_benchmark.csv: Tabelle des Render-Benchmarks
+ *
+ * Zum Profilieren eignen sich die üblichen Werkzeuge, z.B.
+ * perf record host/windrad_host oder valgrind --tool=callgrind host/windrad_host.
+ */
+
+#include "WindTurbineExperiment.h"
+#include <sys/stat.h>
+
+struct HostAusgabe {
+  const char* verzeichnis;
+  TFT_eSPI* display;
+  FILE* operationen;
+  int fehler;
+};
+
+static void bildschirmGezeichnet(const char* name, bool warm, void* kontext) {
+  HostAusgabe* ausgabe = (HostAusgabe*)kontext;
+
+  // Nur der warme Durchlauf wird ausgewertet
+  if (warm) {
+    char pfad[256];
+    snprintf(pfad, sizeof(pfad), "%s/%s.png", ausgabe->verzeichnis, name);
+    if (!ausgabe->display->speicherePNG(pfad)) {
+      fprintf(stderr, "Host: %s konnte nicht geschrieben werden\n", pfad);
+      ausgabe->fehler++;
+    }
+
+    if (ausgabe->operationen != nullptr) {
+      char praefix[64];
+      snprintf(praefix, sizeof(praefix), "%s;", name);
+      TFT_eSPI::gibOperationenAus(ausgabe->operationen, praefix);
+    }
+  }
+
+  TFT_eSPI::setzeOperationenZurueck();
+}
+
+int main(int argc, char** argv) {
+  const char* verzeichnis = (argc > 1) ? argv[1] : "bilder";
+  mkdir(verzeichnis, 0755);
+
+  static WindTurbineExperiment experiment;
+  experiment.setup();
+
+  char pfad[256];
+  snprintf(pfad, sizeof(pfad), "%s/operationen.csv", verzeichnis);
+
+  HostAusgabe ausgabe;
+  ausgabe.verzeichnis = verzeichnis;
+  ausgabe.display = TFT_eSPI::hostDisplay();
+  ausgabe.operationen = fopen(pfad, "w");
+  ausgabe.fehler = 0;
+
+  if (ausgabe.operationen != nullptr) {
+    fprintf(ausgabe.operationen, "Bildschirm;Funktion;Anzahl\n");
+  }
+
+  TFT_eSPI::setzeOperationenZurueck();
+  experiment.fuehreRenderBenchmarkDurch(bildschirmGezeichnet, &ausgabe);
+
+  if (ausgabe.operationen != nullptr) {
+    fclose(ausgabe.operationen);
+  }
+
+  printf("Host: Bilder in %s/, Zeichenaufrufe in %s\n", verzeichnis, pfad);
+  return (ausgabe.fehler == 0) ? 0 : 1;
+}
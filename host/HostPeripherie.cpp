@@ -0,0 +1,102 @@
+/**
+ * host/HostPeripherie.cpp
+ * Globale Objekte und Dateisystem des Host-Builds
+ */
+
+#include <Wire.h>
+#include <SPIFFS.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+TwoWire Wire;
+SPIFFSFS SPIFFS;
+
+namespace fs {
+
+File::File(FILE* d, const String& name) :
+  datei(d),
+  dateiName(name)
+{
+}
+
+size_t File::write(uint8_t c) {
+  return (datei != nullptr && fputc(c, datei) != EOF) ? 1 : 0;
+}
+
+size_t File::write(const uint8_t* puffer, size_t groesse) {
+  return (datei != nullptr) ? fwrite(puffer, 1, groesse, datei) : 0;
+}
+
+int File::available() {
+  if (datei == nullptr) return 0;
+  long position = ftell(datei);
+  fseek(datei, 0, SEEK_END);
+  long ende = ftell(datei);
+  fseek(datei, position, SEEK_SET);
+  return (int)(ende - position);
+}
+
+int File::read() {
+  return (datei != nullptr) ? fgetc(datei) : -1;
+}
+
+size_t File::read(uint8_t* puffer, size_t groesse) {
+  return (datei != nullptr) ? fread(puffer, 1, groesse, datei) : 0;
+}
+
+size_t File::size() {
+  if (datei == nullptr) return 0;
+  long position = ftell(datei);
+  fseek(datei, 0, SEEK_END);
+  long ende = ftell(datei);
+  fseek(datei, position, SEEK_SET);
+  return (size_t)ende;
+}
+
+const char* File::name() {
+  return dateiName.c_str();
+}
+
+void File::close() {
+  if (datei != nullptr) {
+    fclose(datei);
+    datei = nullptr;
+  }
+}
+
+String FS::hostPfad(const char* pfad) {
+  return basis + ((pfad[0] == '/') ? "" : "/") + pfad;
+}
+
+File FS::open(const String& pfad, const char* modus) {
+  return open(pfad.c_str(), modus);
+}
+
+File FS::open(const char* pfad, const char* modus) {
+  FILE* datei = fopen(hostPfad(pfad).c_str(), modus);
+  return File(datei, pfad);
+}
+
+bool FS::exists(const String& pfad) {
+  return exists(pfad.c_str());
+}
+
+bool FS::exists(const char* pfad) {
+  return access(hostPfad(pfad).c_str(), F_OK) == 0;
+}
+
+bool FS::remove(const String& pfad) {
+  return remove(pfad.c_str());
+}
+
+bool FS::remove(const char* pfad) {
+  return ::remove(hostPfad(pfad).c_str()) == 0;
+}
+
+} // namespace fs
+
+bool SPIFFSFS::begin(bool) {
+  mkdir(basis.c_str(), 0755);
+  struct stat info;
+  return stat(basis.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
@@ -0,0 +1,121 @@
+/**
+ * host/HostPng.cpp
+ * PNG-Ausgabe ohne zlib: die Bilddaten werden in gespeicherten
+ * Deflate-Blöcken abgelegt, dafür genügen CRC-32 und Adler-32.
+ */
+
+#include "HostPng.h"
+#include <cstdio>
+#include <vector>
+
+static uint32_t crcTabelle[256];
+
+static void initialisiereCrc() {
+  static bool fertig = false;
+  if (fertig) return;
+  for (uint32_t n = 0; n < 256; n++) {
+    uint32_t c = n;
+    for (int k = 0; k < 8; k++) {
+      c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    }
+    crcTabelle[n] = c;
+  }
+  fertig = true;
+}
+
+static uint32_t crc32(const uint8_t* daten, size_t laenge, uint32_t crc = 0xFFFFFFFFu) {
+  for (size_t i = 0; i < laenge; i++) {
+    crc = crcTabelle[(crc ^ daten[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static void haengeAn32(std::vector<uint8_t>& ziel, uint32_t wert) {
+  ziel.push_back(wert >> 24);
+  ziel.push_back(wert >> 16);
+  ziel.push_back(wert >> 8);
+  ziel.push_back(wert);
+}
+
+static bool schreibeChunk(FILE* datei, const char* typ, const std::vector<uint8_t>& daten) {
+  std::vector<uint8_t> kopf;
+  haengeAn32(kopf, daten.size());
+  kopf.insert(kopf.end(), typ, typ + 4);
+
+  uint32_t crc = crc32((const uint8_t*)typ, 4);
+  crc = crc32(daten.data(), daten.size(), crc) ^ 0xFFFFFFFFu;
+
+  std::vector<uint8_t> ende;
+  haengeAn32(ende, crc);
+
+  return fwrite(kopf.data(), 1, kopf.size(), datei) == kopf.size() &&
+         fwrite(daten.data(), 1, daten.size(), datei) == daten.size() &&
+         fwrite(ende.data(), 1, ende.size(), datei) == ende.size();
+}
+
+bool schreibePNG(const char* pfad, const uint16_t* pixel, int32_t breite, int32_t hoehe, bool getauscht) {
+  if (pixel == nullptr || breite <= 0 || hoehe <= 0) return false;
+  initialisiereCrc();
+
+  // Rohdaten: pro Zeile Filterbyte 0 und RGB888
+  std::vector<uint8_t> roh;
+  roh.reserve((size_t)hoehe * (1 + breite * 3));
+  for (int32_t y = 0; y < hoehe; y++) {
+    roh.push_back(0);
+    for (int32_t x = 0; x < breite; x++) {
+      uint16_t farbe = pixel[y * breite + x];
+      if (getauscht) farbe = (farbe >> 8) | (farbe << 8);
+      uint8_t r = (farbe >> 11) & 0x1F;
+      uint8_t g = (farbe >> 5) & 0x3F;
+      uint8_t b = farbe & 0x1F;
+      roh.push_back((r << 3) | (r >> 2));
+      roh.push_back((g << 2) | (g >> 4));
+      roh.push_back((b << 3) | (b >> 2));
+    }
+  }
+
+  // zlib-Strom aus gespeicherten Blöcken (max. 65535 Bytes je Block)
+  std::vector<uint8_t> zlib;
+  zlib.push_back(0x78);
+  zlib.push_back(0x01);
+  size_t position = 0;
+  do {
+    size_t laenge = roh.size() - position;
+    if (laenge > 65535) laenge = 65535;
+    bool letzter = (position + laenge == roh.size());
+    zlib.push_back(letzter ? 1 : 0);
+    zlib.push_back(laenge & 0xFF);
+    zlib.push_back(laenge >> 8);
+    zlib.push_back(~laenge & 0xFF);
+    zlib.push_back((~laenge >> 8) & 0xFF);
+    zlib.insert(zlib.end(), roh.begin() + position, roh.begin() + position + laenge);
+    position += laenge;
+  } while (position < roh.size());
+
+  uint32_t a = 1, b = 0;
+  for (uint8_t wert : roh) {
+    a = (a + wert) % 65521;
+    b = (b + a) % 65521;
+  }
+  haengeAn32(zlib, (b << 16) | a);
+
+  std::vector<uint8_t> ihdr;
+  haengeAn32(ihdr, breite);
+  haengeAn32(ihdr, hoehe);
+  ihdr.push_back(8);  // Bit pro Kanal
+  ihdr.push_back(2);  // RGB
+  ihdr.push_back(0);
+  ihdr.push_back(0);
+  ihdr.push_back(0);
+
+  FILE* datei = fopen(pfad, "wb");
+  if (datei == nullptr) return false;
+
+  static const uint8_t signatur[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  bool ok = fwrite(signatur, 1, sizeof(signatur), datei) == sizeof(signatur) &&
+            schreibeChunk(datei, "IHDR", ihdr) &&
+            schreibeChunk(datei, "IDAT", zlib) &&
+            schreibeChunk(datei, "IEND", std::vector<uint8_t>());
+
+  return (fclose(datei) == 0) && ok;
+}
@@ -0,0 +1,14 @@
+/**
+ * host/HostPng.h
+ * Schreibt RGB565-Bildspeicher als PNG (unkomprimierte Deflate-Blöcke)
+ */
+
+#ifndef HOST_PNG_H
+#define HOST_PNG_H
+
+#include <cstdint>
+
+// @param getauscht true wenn die Pixel byte-getauscht vorliegen (Sprite-Speicher)
+bool schreibePNG(const char* pfad, const uint16_t* pixel, int32_t breite, int32_t hoehe, bool getauscht);
+
+#endif // HOST_PNG_H
@@ -0,0 +1,26 @@
+/**
+ * host/INA226.h
+ * Leistungssensor für den Host-Build (liefert feste Messwerte)
+ */
+
+#ifndef HOST_INA226_H
+#define HOST_INA226_H
+
+#include <Arduino.h>
+
+class INA226 {
+public:
+  INA226(uint8_t) {}
+  bool begin() { return true; }
+  int setMaxCurrentShunt(float, float, bool = true) { return 0; }
+  void setAverage(uint8_t) {}
+  void setBusVoltageConversionTime(uint8_t) {}
+  void setShuntVoltageConversionTime(uint8_t) {}
+
+  // Akku bei 3,9 V, Generator mit 0,1 mV / 40 µA
+  float getBusVoltage() { return 3.9; }
+  float getCurrent_mA() { return 0.04; }
+  float getShuntVoltage_mV() { return 0.1; }
+};
+
+#endif // HOST_INA226_H
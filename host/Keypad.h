@@ -0,0 +1,21 @@
+/**
+ * host/Keypad.h
+ * Nummernblock für den Host-Build (keine Taste gedrückt)
+ */
+
+#ifndef HOST_KEYPAD_H
+#define HOST_KEYPAD_H
+
+#include <Arduino.h>
+
+#define NO_KEY '\0'
+#define makeKeymap(x) ((char*)x)
+
+class Keypad {
+public:
+  Keypad(char*, byte*, byte*, byte, byte) {}
+  char getKey() { return NO_KEY; }
+  void setDebounceTime(unsigned int) {}
+};
+
+#endif // HOST_KEYPAD_H
@@ -0,0 +1,45 @@
+/**
+ * host/Preferences.h
+ * NVS-Schlüsselspeicher für den Host-Build (nur im Speicher, geht beim Beenden verloren)
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+
+class Preferences {
+public:
+  bool begin(const char* name, bool = false) {
+    bereich = name;
+    return true;
+  }
+
+  void end() {}
+
+  uint32_t getUInt(const char* key, uint32_t standard = 0) {
+    std::map<std::string, uint32_t>::iterator it = werte().find(bereich + "/" + key);
+    return (it != werte().end()) ? it->second : standard;
+  }
+
+  size_t putUInt(const char* key, uint32_t wert) {
+    werte()[bereich + "/" + key] = wert;
+    return sizeof(wert);
+  }
+
+  bool remove(const char* key) {
+    return werte().erase(bereich + "/" + key) > 0;
+  }
+
+private:
+  std::string bereich;
+
+  static std::map<std::string, uint32_t>& werte() {
+    static std::map<std::string, uint32_t> speicher;
+    return speicher;
+  }
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,11 @@
+/**
+ * host/SPI.h
+ * SPI für den Host-Build (das Display schreibt direkt in den Bildspeicher)
+ */
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#endif // HOST_SPI_H
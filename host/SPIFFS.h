@@ -0,0 +1,22 @@
+/**
+ * host/SPIFFS.h
+ * SPIFFS für den Host-Build (Verzeichnis "spiffs" im Arbeitsverzeichnis)
+ */
+
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include <FS.h>
+
+class SPIFFSFS : public fs::FS {
+public:
+  SPIFFSFS() : fs::FS("spiffs") {}
+  bool begin(bool formatieren = false);
+  size_t totalBytes() { return 1441792; }
+  size_t usedBytes() { return 0; }
+  void end() {}
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // HOST_SPIFFS_H
@@ -0,0 +1,896 @@
+/**
+ * host/TFT_eSPI.cpp
+ * TFT_eSPI für den Host-Build: RGB565-Bildspeicher, Zählung und PNG-Ausgabe
+ */
+
+#include "TFT_eSPI.h"
+#include "HostPng.h"
+#include <map>
+#include <string>
+#include <vector>
+
+// GLCD-Schrift 5x7 (Zeichen 0x20 bis 0x7E), spaltenweise, Bit 0 = oberste Zeile
+static const uint8_t glcdSchrift[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x5F, 0x00, 0x00,  // '!'
+  0x00, 0x07, 0x00, 0x07, 0x00,  // '"'
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  // '#'
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,  // '$'
+  0x23, 0x13, 0x08, 0x64, 0x62,  // '%'
+  0x36, 0x49, 0x56, 0x20, 0x50,  // '&'
+  0x00, 0x08, 0x07, 0x03, 0x00,  // '''
+  0x00, 0x1C, 0x22, 0x41, 0x00,  // '('
+  0x00, 0x41, 0x22, 0x1C, 0x00,  // ')'
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // '*'
+  0x08, 0x08, 0x3E, 0x08, 0x08,  // '+'
+  0x00, 0x80, 0x70, 0x30, 0x00,  // ','
+  0x08, 0x08, 0x08, 0x08, 0x08,  // '-'
+  0x00, 0x00, 0x60, 0x60, 0x00,  // '.'
+  0x20, 0x10, 0x08, 0x04, 0x02,  // '/'
+  0x3E, 0x51, 0x49, 0x45, 0x3E,  // '0'
+  0x00, 0x42, 0x7F, 0x40, 0x00,  // '1'
+  0x72, 0x49, 0x49, 0x49, 0x46,  // '2'
+  0x21, 0x41, 0x49, 0x4D, 0x33,  // '3'
+  0x18, 0x14, 0x12, 0x7F, 0x10,  // '4'
+  0x27, 0x45, 0x45, 0x45, 0x39,  // '5'
+  0x3C, 0x4A, 0x49, 0x49, 0x31,  // '6'
+  0x41, 0x21, 0x11, 0x09, 0x07,  // '7'
+  0x36, 0x49, 0x49, 0x49, 0x36,  // '8'
+  0x46, 0x49, 0x49, 0x29, 0x1E,  // '9'
+  0x00, 0x00, 0x14, 0x00, 0x00,  // ':'
+  0x00, 0x40, 0x34, 0x00, 0x00,  // ';'
+  0x00, 0x08, 0x14, 0x22, 0x41,  // '<'
+  0x14, 0x14, 0x14, 0x14, 0x14,  // '='
+  0x00, 0x41, 0x22, 0x14, 0x08,  // '>'
+  0x02, 0x01, 0x59, 0x09, 0x06,  // '?'
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,  // '@'
+  0x7C, 0x12, 0x11, 0x12, 0x7C,  // 'A'
+  0x7F, 0x49, 0x49, 0x49, 0x36,  // 'B'
+  0x3E, 0x41, 0x41, 0x41, 0x22,  // 'C'
+  0x7F, 0x41, 0x41, 0x41, 0x3E,  // 'D'
+  0x7F, 0x49, 0x49, 0x49, 0x41,  // 'E'
+  0x7F, 0x09, 0x09, 0x09, 0x01,  // 'F'
+  0x3E, 0x41, 0x41, 0x51, 0x73,  // 'G'
+  0x7F, 0x08, 0x08, 0x08, 0x7F,  // 'H'
+  0x00, 0x41, 0x7F, 0x41, 0x00,  // 'I'
+  0x20, 0x40, 0x41, 0x3F, 0x01,  // 'J'
+  0x7F, 0x08, 0x14, 0x22, 0x41,  // 'K'
+  0x7F, 0x40, 0x40, 0x40, 0x40,  // 'L'
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,  // 'M'
+  0x7F, 0x04, 0x08, 0x10, 0x7F,  // 'N'
+  0x3E, 0x41, 0x41, 0x41, 0x3E,  // 'O'
+  0x7F, 0x09, 0x09, 0x09, 0x06,  // 'P'
+  0x3E, 0x41, 0x51, 0x21, 0x5E,  // 'Q'
+  0x7F, 0x09, 0x19, 0x29, 0x46,  // 'R'
+  0x26, 0x49, 0x49, 0x49, 0x32,  // 'S'
+  0x03, 0x01, 0x7F, 0x01, 0x03,  // 'T'
+  0x3F, 0x40, 0x40, 0x40, 0x3F,  // 'U'
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  // 'V'
+  0x3F, 0x40, 0x38, 0x40, 0x3F,  // 'W'
+  0x63, 0x14, 0x08, 0x14, 0x63,  // 'X'
+  0x03, 0x04, 0x78, 0x04, 0x03,  // 'Y'
+  0x61, 0x59, 0x49, 0x4D, 0x43,  // 'Z'
+  0x00, 0x7F, 0x41, 0x41, 0x41,  // '['
+  0x02, 0x04, 0x08, 0x10, 0x20,  // '\'
+  0x00, 0x41, 0x41, 0x41, 0x7F,  // ']'
+  0x04, 0x02, 0x01, 0x02, 0x04,  // '^'
+  0x40, 0x40, 0x40, 0x40, 0x40,  // '_'
+  0x00, 0x03, 0x07, 0x08, 0x00,  // '`'
+  0x20, 0x54, 0x54, 0x78, 0x40,  // 'a'
+  0x7F, 0x28, 0x44, 0x44, 0x38,  // 'b'
+  0x38, 0x44, 0x44, 0x44, 0x28,  // 'c'
+  0x38, 0x44, 0x44, 0x28, 0x7F,  // 'd'
+  0x38, 0x54, 0x54, 0x54, 0x18,  // 'e'
+  0x00, 0x08, 0x7E, 0x09, 0x02,  // 'f'
+  0x18, 0xA4, 0xA4, 0x9C, 0x78,  // 'g'
+  0x7F, 0x08, 0x04, 0x04, 0x78,  // 'h'
+  0x00, 0x44, 0x7D, 0x40, 0x00,  // 'i'
+  0x20, 0x40, 0x40, 0x3D, 0x00,  // 'j'
+  0x7F, 0x10, 0x28, 0x44, 0x00,  // 'k'
+  0x00, 0x41, 0x7F, 0x40, 0x00,  // 'l'
+  0x7C, 0x04, 0x78, 0x04, 0x78,  // 'm'
+  0x7C, 0x08, 0x04, 0x04, 0x78,  // 'n'
+  0x38, 0x44, 0x44, 0x44, 0x38,  // 'o'
+  0xFC, 0x18, 0x24, 0x24, 0x18,  // 'p'
+  0x18, 0x24, 0x24, 0x18, 0xFC,  // 'q'
+  0x7C, 0x08, 0x04, 0x04, 0x08,  // 'r'
+  0x48, 0x54, 0x54, 0x54, 0x24,  // 's'
+  0x04, 0x04, 0x3F, 0x44, 0x24,  // 't'
+  0x3C, 0x40, 0x40, 0x20, 0x7C,  // 'u'
+  0x1C, 0x20, 0x40, 0x20, 0x1C,  // 'v'
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  // 'w'
+  0x44, 0x28, 0x10, 0x28, 0x44,  // 'x'
+  0x4C, 0x90, 0x90, 0x90, 0x7C,  // 'y'
+  0x44, 0x64, 0x54, 0x4C, 0x44,  // 'z'
+  0x00, 0x08, 0x36, 0x41, 0x00,  // '{'
+  0x00, 0x00, 0x77, 0x00, 0x00,  // '|'
+  0x00, 0x41, 0x36, 0x08, 0x00,  // '}'
+  0x02, 0x01, 0x02, 0x04, 0x02   // '~'
+};
+
+// Ersatzzeichen (Rahmen) für alles außerhalb von 0x20 bis 0x7E
+static const uint8_t ersatzZeichen[5] = {0x7F, 0x41, 0x41, 0x41, 0x7F};
+
+static inline uint16_t tausche(uint16_t farbe) {
+  return (farbe >> 8) | (farbe << 8);
+}
+
+// ---------------------------------------------------------------------------
+// Zählung
+
+static TFT_eSPI* aktivesDisplay = nullptr;
+static std::map<std::string, unsigned long long> operationsZaehler;
+static unsigned long long pixelZaehler = 0;
+
+// Zählt eine Zeichenfunktion für die Dauer ihres Aufrufs
+class HostZaehlung {
+public:
+  HostZaehlung(TFT_eSPI* display, const char* name) : tft(display) { tft->zaehle(name); }
+  ~HostZaehlung() { tft->beendeZaehlung(); }
+private:
+  TFT_eSPI* tft;
+};
+
+#define ZAEHLE(name) HostZaehlung zaehlung(this, name)
+
+void TFT_eSPI::zaehle(const char* name) {
+  if (zaehlTiefe++ == 0) {
+    operationsZaehler[istSprite ? std::string("sprite.") + name : std::string(name)]++;
+  }
+}
+
+void TFT_eSPI::beendeZaehlung() {
+  zaehlTiefe--;
+}
+
+void TFT_eSPI::setzeOperationenZurueck() {
+  operationsZaehler.clear();
+  pixelZaehler = 0;
+}
+
+unsigned long long TFT_eSPI::operationen(const char* name) {
+  auto eintrag = operationsZaehler.find(name);
+  return (eintrag == operationsZaehler.end()) ? 0 : eintrag->second;
+}
+
+unsigned long long TFT_eSPI::geschriebenePixel() {
+  return pixelZaehler;
+}
+
+void TFT_eSPI::gibOperationenAus(FILE* ziel, const char* praefix) {
+  for (const auto& eintrag : operationsZaehler) {
+    fprintf(ziel, "%s%s;%llu\n", praefix, eintrag.first.c_str(), eintrag.second);
+  }
+  fprintf(ziel, "%sPixel;%llu\n", praefix, pixelZaehler);
+}
+
+// ---------------------------------------------------------------------------
+// Display
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) :
+  puffer(nullptr),
+  pufferBreite(w),
+  pufferHoehe(h),
+  pixelGetauscht(false),
+  istSprite(false),
+  zaehlTiefe(0),
+  panelBreite(w),
+  panelHoehe(h),
+  rotation(0),
+  cursorX(0),
+  cursorY(0),
+  textFarbe(0xFFFF),
+  textHintergrund(0xFFFF),
+  textGroesse(1),
+  umbruchX(true),
+  umbruchY(false),
+  utf8Rest(0),
+  utf8Zeichen(0),
+  fensterX(0),
+  fensterY(0),
+  fensterB(0),
+  fensterH(0),
+  fensterPos(0),
+  tauscheBytes(false)
+{
+  resetViewport();
+}
+
+TFT_eSPI::~TFT_eSPI() {
+  if (aktivesDisplay == this) aktivesDisplay = nullptr;
+  free(puffer);
+}
+
+void TFT_eSPI::init(uint8_t) {
+  if (puffer == nullptr) {
+    puffer = (uint16_t*)calloc((size_t)panelBreite * panelHoehe, sizeof(uint16_t));
+  }
+  aktivesDisplay = this;
+  setRotation(0);
+}
+
+void TFT_eSPI::begin(uint8_t tc) {
+  init(tc);
+}
+
+/**
+ * Der Bildspeicher wird in der aktuellen Drehung geführt
+ * (der Sketch dreht nur einmal direkt nach init())
+ */
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r & 3;
+  if (rotation & 1) {
+    pufferBreite = panelHoehe;
+    pufferHoehe = panelBreite;
+  } else {
+    pufferBreite = panelBreite;
+    pufferHoehe = panelHoehe;
+  }
+  resetViewport();
+}
+
+uint8_t TFT_eSPI::getRotation() {
+  return rotation;
+}
+
+int16_t TFT_eSPI::width() {
+  return vpDatum ? xBreite : pufferBreite;
+}
+
+int16_t TFT_eSPI::height() {
+  return vpDatum ? yHoehe : pufferHoehe;
+}
+
+// Wie TFT_eSPI::setViewport(): Ursprung darf außerhalb liegen, geclippt wird auf den Speicher
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool datum) {
+  vpDatum = datum;
+  vpAusserhalb = false;
+  xDatum = x;
+  yDatum = y;
+  xBreite = w;
+  yHoehe = h;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > pufferBreite) w = pufferBreite - x;
+  if (y + h > pufferHoehe) h = pufferHoehe - y;
+
+  if (w < 1 || h < 1) {
+    xDatum = 0;
+    yDatum = 0;
+    xBreite = pufferBreite;
+    yHoehe = pufferHoehe;
+    vpX = vpY = vpW = vpH = 0;
+    vpAusserhalb = true;
+    return;
+  }
+
+  if (!datum) {
+    xDatum = 0;
+    yDatum = 0;
+    xBreite = pufferBreite;
+    yHoehe = pufferHoehe;
+  }
+
+  vpX = x;
+  vpY = y;
+  vpW = x + w;
+  vpH = y + h;
+}
+
+void TFT_eSPI::resetViewport() {
+  vpDatum = false;
+  vpAusserhalb = false;
+  xDatum = 0;
+  yDatum = 0;
+  xBreite = pufferBreite;
+  yHoehe = pufferHoehe;
+  vpX = 0;
+  vpY = 0;
+  vpW = pufferBreite;
+  vpH = pufferHoehe;
+}
+
+/**
+ * Verschiebt ein Rechteck um den Viewport-Ursprung und schneidet es zu
+ * @param dx, dy abgeschnittene Spalten/Zeilen links bzw. oben
+ * @return false wenn nichts sichtbar bleibt
+ */
+bool TFT_eSPI::schneide(int32_t& x, int32_t& y, int32_t& w, int32_t& h, int32_t& dx, int32_t& dy) {
+  if (puffer == nullptr || vpAusserhalb) return false;
+
+  x += xDatum;
+  y += yDatum;
+  dx = 0;
+  dy = 0;
+
+  if (x < vpX) { dx = vpX - x; w -= dx; x = vpX; }
+  if (y < vpY) { dy = vpY - y; h -= dy; y = vpY; }
+  if (x + w > vpW) w = vpW - x;
+  if (y + h > vpH) h = vpH - y;
+
+  return w > 0 && h > 0;
+}
+
+void TFT_eSPI::setzePixel(int32_t x, int32_t y, uint16_t farbe) {
+  int32_t w = 1, h = 1, dx, dy;
+  if (!schneide(x, y, w, h, dx, dy)) return;
+
+  puffer[y * pufferBreite + x] = pixelGetauscht ? tausche(farbe) : farbe;
+  if (!istSprite) pixelZaehler++;
+}
+
+void TFT_eSPI::fuelleBereich(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t farbe) {
+  int32_t dx, dy;
+  if (!schneide(x, y, w, h, dx, dy)) return;
+
+  uint16_t wert = pixelGetauscht ? tausche(farbe) : farbe;
+  for (int32_t j = 0; j < h; j++) {
+    uint16_t* zeile = puffer + (y + j) * pufferBreite + x;
+    for (int32_t i = 0; i < w; i++) {
+      zeile[i] = wert;
+    }
+  }
+  if (!istSprite) pixelZaehler += (unsigned long long)w * h;
+}
+
+/**
+ * Überträgt ein Bild (Zeilen zu w Pixeln) mit Viewport und Clipping
+ * @param getauscht true wenn die Quelldaten byte-getauscht vorliegen
+ */
+void TFT_eSPI::uebertrageBild(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* daten, bool getauscht, bool mitTransparenz, uint16_t transparent) {
+  if (daten == nullptr) return;
+
+  int32_t quellBreite = w;
+  int32_t dx, dy;
+  if (!schneide(x, y, w, h, dx, dy)) return;
+
+  for (int32_t j = 0; j < h; j++) {
+    const uint16_t* quelle = daten + (j + dy) * quellBreite + dx;
+    uint16_t* zeile = puffer + (y + j) * pufferBreite + x;
+    for (int32_t i = 0; i < w; i++) {
+      uint16_t farbe = getauscht ? tausche(quelle[i]) : quelle[i];
+      if (mitTransparenz && farbe == transparent) continue;
+      zeile[i] = pixelGetauscht ? tausche(farbe) : farbe;
+      if (!istSprite) pixelZaehler++;
+    }
+  }
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  ZAEHLE("fillScreen");
+  fillRect(0, 0, pufferBreite, pufferHoehe, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  ZAEHLE("drawPixel");
+  setzePixel(x, y, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  ZAEHLE("drawFastHLine");
+  fuelleBereich(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  ZAEHLE("drawFastVLine");
+  fuelleBereich(x, y, 1, h, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  ZAEHLE("fillRect");
+  fuelleBereich(x, y, w, h, color);
+}
+
+// Bresenham, die Endpunkte werden mitgezeichnet
+void TFT_eSPI::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+  ZAEHLE("drawLine");
+
+  int32_t dx = abs(xe - xs);
+  int32_t dy = -abs(ye - ys);
+  int32_t sx = (xs < xe) ? 1 : -1;
+  int32_t sy = (ys < ye) ? 1 : -1;
+  int32_t fehler = dx + dy;
+
+  while (true) {
+    setzePixel(xs, ys, color);
+    if (xs == xe && ys == ye) break;
+    int32_t e2 = 2 * fehler;
+    if (e2 >= dy) { fehler += dy; xs += sx; }
+    if (e2 <= dx) { fehler += dx; ys += sy; }
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  ZAEHLE("drawRect");
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color) {
+  int32_t f = 1 - r;
+  int32_t ddF_x = 1;
+  int32_t ddF_y = -2 * r;
+  int32_t x = 0;
+
+  while (x < r) {
+    if (f >= 0) {
+      r--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (cornername & 0x4) {
+      drawPixel(x0 + x, y0 + r, color);
+      drawPixel(x0 + r, y0 + x, color);
+    }
+    if (cornername & 0x2) {
+      drawPixel(x0 + x, y0 - r, color);
+      drawPixel(x0 + r, y0 - x, color);
+    }
+    if (cornername & 0x8) {
+      drawPixel(x0 - r, y0 + x, color);
+      drawPixel(x0 - x, y0 + r, color);
+    }
+    if (cornername & 0x1) {
+      drawPixel(x0 - r, y0 - x, color);
+      drawPixel(x0 - x, y0 - r, color);
+    }
+  }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color) {
+  int32_t f = 1 - r;
+  int32_t ddF_x = 1;
+  int32_t ddF_y = -r - r;
+  int32_t y = 0;
+
+  delta++;
+
+  while (y < r) {
+    if (f >= 0) {
+      if (cornername & 0x1) drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
+      if (cornername & 0x2) drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+      r--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+
+    y++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    if (cornername & 0x1) drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
+    if (cornername & 0x2) drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+  }
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  ZAEHLE("drawCircle");
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+  drawCircleHelper(x0, y0, r, 0xF, color);
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  ZAEHLE("fillCircle");
+  drawFastHLine(x0 - r, y0, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  ZAEHLE("drawRoundRect");
+  r = min(r, min(w, h) / 2);
+
+  drawFastHLine(x + r, y, w - r - r, color);
+  drawFastHLine(x + r, y + h - 1, w - r - r, color);
+  drawFastVLine(x, y + r, h - r - r, color);
+  drawFastVLine(x + w - 1, y + r, h - r - r, color);
+
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  ZAEHLE("fillRoundRect");
+  r = min(r, min(w, h) / 2);
+
+  fillRect(x, y + r, w, h - r - r, color);
+  fillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+void TFT_eSPI::drawTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color) {
+  ZAEHLE("drawTriangle");
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x3, y3, color);
+  drawLine(x3, y3, x1, y1, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color) {
+  ZAEHLE("fillTriangle");
+
+  // Nach y sortieren (y1 <= y2 <= y3)
+  if (y1 > y2) { std::swap(y1, y2); std::swap(x1, x2); }
+  if (y2 > y3) { std::swap(y3, y2); std::swap(x3, x2); }
+  if (y1 > y2) { std::swap(y1, y2); std::swap(x1, x2); }
+
+  if (y1 == y3) {
+    int32_t a = min(x1, min(x2, x3));
+    int32_t b = max(x1, max(x2, x3));
+    drawFastHLine(a, y1, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t dx13 = x3 - x1, dy13 = y3 - y1;
+  int32_t dx23 = x3 - x2, dy23 = y3 - y2;
+  int32_t sa = 0, sb = 0;
+  int32_t letzte = (y2 == y3) ? y2 : y2 - 1;
+  int32_t y;
+
+  // Obere Hälfte
+  for (y = y1; y <= letzte; y++) {
+    int32_t a = x1 + sa / dy12;
+    int32_t b = x1 + sb / dy13;
+    sa += dx12;
+    sb += dx13;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+
+  // Untere Hälfte
+  sa = dx23 * (y - y2);
+  sb = dx13 * (y - y1);
+  for (; y <= y3; y++) {
+    int32_t a = x2 + sa / dy23;
+    int32_t b = x1 + sb / dy13;
+    sa += dx23;
+    sb += dx13;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+uint16_t TFT_eSPI::color565(uint8_t red, uint8_t green, uint8_t blue) {
+  return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+}
+
+// ---------------------------------------------------------------------------
+// Text
+
+void TFT_eSPI::setTextColor(uint16_t color) {
+  textFarbe = color;
+  textHintergrund = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool) {
+  textFarbe = fgcolor;
+  textHintergrund = bgcolor;
+}
+
+void TFT_eSPI::setTextSize(uint8_t size) {
+  textGroesse = (size > 0) ? size : 1;
+}
+
+void TFT_eSPI::setTextWrap(bool wrapX, bool wrapY) {
+  umbruchX = wrapX;
+  umbruchY = wrapY;
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y) {
+  cursorX = x;
+  cursorY = y;
+}
+
+int16_t TFT_eSPI::getCursorX() {
+  return cursorX;
+}
+
+int16_t TFT_eSPI::getCursorY() {
+  return cursorY;
+}
+
+int16_t TFT_eSPI::textWidth(const char* text) {
+  int16_t zeichen = 0;
+  for (const char* p = text; *p; p++) {
+    // UTF-8-Folgebytes zählen nicht
+    if (((uint8_t)*p & 0xC0) != 0x80) zeichen++;
+  }
+  return zeichen * 6 * textGroesse;
+}
+
+/**
+ * Zeichnet ein Zeichen der GLCD-Schrift (6x8 inkl. Abstand)
+ * Ist bg gleich color, bleibt der Hintergrund transparent.
+ */
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+  ZAEHLE("drawChar");
+
+  const uint8_t* spalten = (c >= 0x20 && c <= 0x7E) ? &glcdSchrift[(c - 0x20) * 5] : ersatzZeichen;
+  bool fuellen = (bg != color);
+
+  for (int8_t i = 0; i < 6; i++) {
+    uint8_t linie = (i < 5) ? spalten[i] : 0;
+    for (int8_t j = 0; j < 8; j++, linie >>= 1) {
+      if (linie & 1) {
+        fuelleBereich(x + i * size, y + j * size, size, size, color);
+      } else if (fuellen) {
+        fuelleBereich(x + i * size, y + j * size, size, size, bg);
+      }
+    }
+  }
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+  ZAEHLE("write");
+
+  // UTF-8 dekodieren
+  uint16_t zeichen = c;
+  if (utf8Rest > 0) {
+    if ((c & 0xC0) == 0x80) {
+      utf8Zeichen = (utf8Zeichen << 6) | (c & 0x3F);
+      if (--utf8Rest > 0) return 1;
+      zeichen = utf8Zeichen;
+    } else {
+      utf8Rest = 0;
+    }
+  } else if (c >= 0xC0) {
+    utf8Rest = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : 1;
+    utf8Zeichen = c & (0x3F >> utf8Rest);
+    return 1;
+  }
+
+  if (zeichen == '\r') return 1;
+
+  if (zeichen == '\n') {
+    cursorX = 0;
+    cursorY += 8 * textGroesse;
+    return 1;
+  }
+
+  if (umbruchX && cursorX + 6 * textGroesse > width()) {
+    cursorX = 0;
+    cursorY += 8 * textGroesse;
+  }
+  if (umbruchY && cursorY >= height()) {
+    cursorY = 0;
+  }
+
+  drawChar(cursorX, cursorY, zeichen, textFarbe, textHintergrund, textGroesse);
+  cursorX += 6 * textGroesse;
+  return 1;
+}
+
+// ---------------------------------------------------------------------------
+// Block-Übertragungen
+
+void TFT_eSPI::startWrite() {
+}
+
+void TFT_eSPI::endWrite() {
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  ZAEHLE("setAddrWindow");
+  fensterX = x;
+  fensterY = y;
+  fensterB = w;
+  fensterH = h;
+  fensterPos = 0;
+}
+
+// Schreibt fortlaufend in das Adressfenster (ohne Viewport, wie auf dem Gerät)
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len) {
+  ZAEHLE("pushBlock");
+  if (puffer == nullptr || fensterB <= 0) return;
+
+  uint16_t wert = pixelGetauscht ? tausche(color) : color;
+  uint32_t ende = (uint32_t)fensterB * fensterH;
+  while (len-- > 0 && fensterPos < ende) {
+    int32_t x = fensterX + fensterPos % fensterB;
+    int32_t y = fensterY + fensterPos / fensterB;
+    if (x >= 0 && y >= 0 && x < pufferBreite && y < pufferHoehe) {
+      puffer[y * pufferBreite + x] = wert;
+      if (!istSprite) pixelZaehler++;
+    }
+    fensterPos++;
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  ZAEHLE("pushImage");
+  uebertrageBild(x, y, w, h, data, !tauscheBytes, false, 0);
+}
+
+// Gegenstück zu readRect(): Daten immer byte-getauscht
+void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  ZAEHLE("pushRect");
+  uebertrageBild(x, y, w, h, data, true, false, 0);
+}
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  ZAEHLE("readRect");
+  if (puffer == nullptr) return;
+
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      int32_t px = x + i + xDatum;
+      int32_t py = y + j + yDatum;
+      uint16_t farbe = 0;
+      if (px >= 0 && py >= 0 && px < pufferBreite && py < pufferHoehe) {
+        farbe = puffer[py * pufferBreite + px];
+        if (pixelGetauscht) farbe = tausche(farbe);
+      }
+      *data++ = tausche(farbe);
+    }
+  }
+}
+
+void TFT_eSPI::setSwapBytes(bool swap) {
+  tauscheBytes = swap;
+}
+
+bool TFT_eSPI::getSwapBytes() {
+  return tauscheBytes;
+}
+
+bool TFT_eSPI::initDMA(bool) {
+  return true;
+}
+
+void TFT_eSPI::deInitDMA() {
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t*) {
+  ZAEHLE("pushImageDMA");
+  uebertrageBild(x, y, w, h, data, !tauscheBytes, false, 0);
+}
+
+bool TFT_eSPI::dmaBusy() {
+  return false;
+}
+
+void TFT_eSPI::dmaWait() {
+}
+
+// ---------------------------------------------------------------------------
+// Host-Erweiterungen
+
+TFT_eSPI* TFT_eSPI::hostDisplay() {
+  return aktivesDisplay;
+}
+
+const uint16_t* TFT_eSPI::bildspeicher() {
+  return puffer;
+}
+
+bool TFT_eSPI::speicherePNG(const char* pfad) {
+  if (puffer == nullptr) return false;
+  return schreibePNG(pfad, puffer, pufferBreite, pufferHoehe, pixelGetauscht);
+}
+
+// ---------------------------------------------------------------------------
+// Sprite
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) :
+  TFT_eSPI(0, 0),
+  ziel(tft),
+  farbtiefe(16),
+  scrollX(0),
+  scrollY(0),
+  scrollB(0),
+  scrollH(0),
+  scrollFarbe(TFT_BLACK)
+{
+  istSprite = true;
+  pixelGetauscht = true;
+}
+
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t) {
+  if (puffer != nullptr) return puffer;
+  if (w < 1 || h < 1) return nullptr;
+
+  puffer = (uint16_t*)calloc((size_t)w * h, sizeof(uint16_t));
+  if (puffer == nullptr) return nullptr;
+
+  panelBreite = w;
+  panelHoehe = h;
+  pufferBreite = w;
+  pufferHoehe = h;
+  resetViewport();
+  setScrollRect(0, 0, w, h, TFT_BLACK);
+  return puffer;
+}
+
+void TFT_eSprite::deleteSprite() {
+  free(puffer);
+  puffer = nullptr;
+}
+
+bool TFT_eSprite::created() {
+  return puffer != nullptr;
+}
+
+// Der Host arbeitet immer mit 16 Bit
+void TFT_eSprite::setColorDepth(int8_t b) {
+  farbtiefe = b;
+  if (b != 16) {
+    Serial.println("TFT_eSprite (Host): nur 16 Bit Farbtiefe, verwende 16 Bit");
+  }
+}
+
+int8_t TFT_eSprite::getColorDepth() {
+  return farbtiefe;
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+  ZAEHLE("fillSprite");
+  fuelleBereich(vpX - xDatum, vpY - yDatum, vpW - vpX, vpH - vpY, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  ZAEHLE("pushSprite");
+  if (puffer == nullptr || ziel == nullptr) return;
+  ziel->uebertrageBild(x, y, pufferBreite, pufferHoehe, puffer, true, false, 0);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  ZAEHLE("pushSprite");
+  if (puffer == nullptr || ziel == nullptr) return;
+  ziel->uebertrageBild(x, y, pufferBreite, pufferHoehe, puffer, true, true, transparent);
+}
+
+void TFT_eSprite::setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > pufferBreite) w = pufferBreite - x;
+  if (y + h > pufferHoehe) h = pufferHoehe - y;
+
+  scrollX = x;
+  scrollY = y;
+  scrollB = max(w, (int32_t)0);
+  scrollH = max(h, (int32_t)0);
+  scrollFarbe = color;
+}
+
+/**
+ * Verschiebt den Inhalt des Scroll-Bereichs, frei werdende Pixel
+ * erhalten die Farbe aus setScrollRect() (dx < 0 schiebt nach links)
+ */
+void TFT_eSprite::scroll(int16_t dx, int16_t dy) {
+  ZAEHLE("scroll");
+  if (puffer == nullptr || scrollB == 0 || scrollH == 0) return;
+
+  std::vector<uint16_t> kopie((size_t)scrollB * scrollH);
+  for (int32_t j = 0; j < scrollH; j++) {
+    memcpy(&kopie[j * scrollB], puffer + (scrollY + j) * pufferBreite + scrollX, scrollB * sizeof(uint16_t));
+  }
+
+  uint16_t leer = tausche(scrollFarbe);
+  for (int32_t j = 0; j < scrollH; j++) {
+    uint16_t* zeile = puffer + (scrollY + j) * pufferBreite + scrollX;
+    int32_t quellZeile = j - dy;
+    for (int32_t i = 0; i < scrollB; i++) {
+      int32_t quellSpalte = i - dx;
+      bool innen = quellZeile >= 0 && quellZeile < scrollH && quellSpalte >= 0 && quellSpalte < scrollB;
+      zeile[i] = innen ? kopie[quellZeile * scrollB + quellSpalte] : leer;
+    }
+  }
+}
+
+void* TFT_eSprite::getPointer() {
+  return puffer;
+}
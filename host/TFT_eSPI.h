@@ -0,0 +1,202 @@
+/**
+ * host/TFT_eSPI.h
+ * TFT_eSPI für den Host-Build: zeichnet in einen RGB565-Bildspeicher
+ *
+ * Bildet die Teilmenge von TFT_eSPI nach, die der Sketch verwendet
+ * (Grundformen, GLCD-Schrift mit Cursor, Viewport, Sprites, Block- und
+ * DMA-Übertragungen). Die Algorithmen folgen der Bibliothek, die Pixel
+ * können daher in Einzelfällen leicht abweichen.
+ *
+ * Zusätzlich zur Bibliothek:
+ * - speicherePNG() schreibt den Bildspeicher als PNG
+ * - Jeder Aufruf einer Zeichenfunktion wird unter ihrem Namen gezählt
+ *   (Sprites mit Präfix "sprite."), verschachtelte Aufrufe nur einmal.
+ *
+ * Wie auf dem Gerät halten Sprites ihre Pixel byte-getauscht, Block-
+ * Übertragungen (pushImage, pushRect, pushImageDMA) erwarten byte-getauschte
+ * Daten, solange setSwapBytes(true) nicht gesetzt ist.
+ */
+
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+#include <Arduino.h>
+
+// Panel im Hochformat wie in User_Setup.h (ST7796 480x320)
+#define TFT_WIDTH  320
+#define TFT_HEIGHT 480
+
+// Standardfarben der Bibliothek (RGB565)
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_TRANSPARENT 0x0120
+
+class TFT_eSprite;
+
+class TFT_eSPI : public Print {
+  friend class TFT_eSprite;
+  friend class HostZaehlung;
+
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0);
+  void setRotation(uint8_t r);
+  uint8_t getRotation();
+
+  // Grundformen
+  void fillScreen(uint32_t color);
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+  virtual void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color);
+  virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void drawTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color);
+  void fillTriangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t color);
+
+  virtual int16_t width();
+  virtual int16_t height();
+
+  // Text (GLCD-Schrift 6x8)
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+  void setTextSize(uint8_t size);
+  void setTextWrap(bool wrapX, bool wrapY = false);
+  void setCursor(int16_t x, int16_t y);
+  int16_t getCursorX();
+  int16_t getCursorY();
+  int16_t textWidth(const char* text);
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  // Viewport
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+
+  // Block-Übertragungen
+  void startWrite();
+  void endWrite();
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void pushBlock(uint16_t color, uint32_t len);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+  void pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+  void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+  void setSwapBytes(bool swap);
+  bool getSwapBytes();
+
+  // DMA (auf dem Host synchron)
+  bool initDMA(bool ctrl_cs = false);
+  void deInitDMA();
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+  bool dmaBusy();
+  void dmaWait();
+
+  uint16_t color565(uint8_t red, uint8_t green, uint8_t blue);
+
+  // Host: Bildspeicher (RGB565 in Zeilen zu width() Pixeln)
+  const uint16_t* bildspeicher();
+  bool speicherePNG(const char* pfad);
+  static TFT_eSPI* hostDisplay();   // Zuletzt mit init() gestartetes Display
+
+  // Host: Zählung der Zeichenaufrufe
+  static void setzeOperationenZurueck();
+  static unsigned long long operationen(const char* name);
+  static unsigned long long geschriebenePixel();
+  static void gibOperationenAus(FILE* ziel, const char* praefix);
+
+protected:
+  uint16_t* puffer;
+  int32_t pufferBreite;   // Breite des Speichers in der aktuellen Drehung
+  int32_t pufferHoehe;
+  bool pixelGetauscht;    // true bei Sprites (byte-getauschtes RGB565)
+  bool istSprite;
+
+  // Verschachtelungstiefe für die Zählung
+  uint8_t zaehlTiefe;
+
+  void zaehle(const char* name);
+  void beendeZaehlung();
+
+  // Pixel in Bildschirmkoordinaten nach Viewport und Clipping schreiben
+  void setzePixel(int32_t x, int32_t y, uint16_t farbe);
+  void fuelleBereich(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t farbe);
+  void uebertrageBild(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* daten, bool getauscht, bool mitTransparenz, uint16_t transparent);
+  bool schneide(int32_t& x, int32_t& y, int32_t& w, int32_t& h, int32_t& dx, int32_t& dy);
+
+  void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color);
+  void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+
+  int16_t panelBreite;
+  int16_t panelHoehe;
+  uint8_t rotation;
+
+  // Viewport wie in der Bibliothek
+  int32_t vpX, vpY, vpW, vpH;
+  int32_t xDatum, yDatum, xBreite, yHoehe;
+  bool vpDatum;
+  bool vpAusserhalb;
+
+  // Text
+  int32_t cursorX, cursorY;
+  uint32_t textFarbe, textHintergrund;
+  uint8_t textGroesse;
+  bool umbruchX, umbruchY;
+  uint8_t utf8Rest;
+  uint16_t utf8Zeichen;
+
+  // Adressfenster für pushBlock
+  int32_t fensterX, fensterY, fensterB, fensterH;
+  uint32_t fensterPos;
+
+  bool tauscheBytes;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite();
+
+  void* createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+  void deleteSprite();
+  bool created();
+  void setColorDepth(int8_t b);
+  int8_t getColorDepth();
+
+  void fillSprite(uint32_t color);
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+  void setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color = TFT_BLACK);
+  void scroll(int16_t dx, int16_t dy = 0);
+  void* getPointer();
+
+private:
+  TFT_eSPI* ziel;
+  int8_t farbtiefe;
+  int32_t scrollX, scrollY, scrollB, scrollH;
+  uint16_t scrollFarbe;
+};
+
+#endif // HOST_TFT_ESPI_H
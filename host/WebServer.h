@@ -0,0 +1,14 @@
+/**
+ * host/WebServer.h
+ * Nur damit WindTurbineDataManager.h übersetzt - der Host-Build ersetzt
+ * die Datenverwaltung (host/HostDatenverwaltung.cpp) und exportiert nichts.
+ */
+
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+
+class WebServer;
+
+#endif // HOST_WEBSERVER_H
@@ -0,0 +1,16 @@
+/**
+ * host/WiFi.h
+ * Nur damit WindTurbineDataManager.h übersetzt - der Host-Build ersetzt
+ * die Datenverwaltung (host/HostDatenverwaltung.cpp) und exportiert nichts.
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+// Nur als Member der Datenverwaltung (Spiegelung)
+class WiFiClient {
+};
+
+#endif // HOST_WIFI_H
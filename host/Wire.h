@@ -0,0 +1,18 @@
+/**
+ * host/Wire.h
+ * I2C für den Host-Build (ohne Funktion)
+ */
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  void begin(int = -1, int = -1) {}
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
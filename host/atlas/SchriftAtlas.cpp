@@ -0,0 +1,137 @@
+/**
+ * host/atlas/SchriftAtlas.cpp
+ * Erzeugt einen Schriftatlas (.wsa, siehe WindTurbineSchrift.h) aus einer
+ * TrueType-Schrift mit FreeType
+ *
+ * Aufruf: schrift_atlas <schrift.ttf> <Pixelgröße> <ziel.wsa>
+ * Enthalten sind ASCII (0x20-0x7E) und Latin-1 (0xA0-0xFF: Umlaute, °, µ, ², ±).
+ * Die Datei wird so geschrieben, wie WindTurbineSchrift::speichereWsa() sie
+ * auf dem ESP32 ablegt (little endian, Glyphen-Tabelle mit 12 Bytes je Eintrag,
+ * 4 Bit Deckung pro Pixel, jede Glyphe beginnt auf ganzem Byte).
+ */
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+struct Glyphe {
+  uint16_t code;
+  uint8_t breite;
+  uint8_t hoehe;
+  uint8_t vorschub;
+  int8_t dx;
+  int8_t oben;     // Erst nach der Zeilenhöhe bekannt
+  uint8_t reserve;
+  uint32_t offset;
+  int top;         // Abstand Grundlinie bis Oberkante (FreeType bitmap_top)
+};
+
+static void schreibeU16(FILE* datei, uint16_t wert) {
+  fputc(wert & 0xFF, datei);
+  fputc(wert >> 8, datei);
+}
+
+static void schreibeU32(FILE* datei, uint32_t wert) {
+  for (int i = 0; i < 4; i++) fputc((wert >> (8 * i)) & 0xFF, datei);
+}
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    fprintf(stderr, "Aufruf: %s <schrift.ttf> <Pixelgroesse> <ziel.wsa>\n", argv[0]);
+    return 2;
+  }
+  int pixel = atoi(argv[2]);
+  if (pixel < 6 || pixel > 48) {
+    fprintf(stderr, "Pixelgroesse 6..48 erwartet\n");
+    return 2;
+  }
+
+  FT_Library bibliothek;
+  FT_Face schrift;
+  if (FT_Init_FreeType(&bibliothek) != 0 || FT_New_Face(bibliothek, argv[1], 0, &schrift) != 0) {
+    fprintf(stderr, "Schrift %s nicht lesbar\n", argv[1]);
+    return 1;
+  }
+  FT_Set_Pixel_Sizes(schrift, 0, pixel);
+
+  // Wie ladeVlw(): größte Ober- und Unterlänge aus Schrift und Glyphen
+  int oberlaenge = (schrift->size->metrics.ascender + 63) >> 6;
+  int unterlaenge = (-schrift->size->metrics.descender + 63) >> 6;
+  int leerVorschub = 0;
+
+  std::vector<Glyphe> glyphen;
+  std::vector<uint8_t> deckung;
+  for (uint32_t code = 0x20; code <= 0xFF; code++) {
+    if (code > 0x7E && code < 0xA0) continue;
+    FT_UInt index = FT_Get_Char_Index(schrift, code);
+    if (index == 0 || FT_Load_Glyph(schrift, index, FT_LOAD_RENDER | FT_LOAD_TARGET_LIGHT) != 0) continue;
+
+    FT_GlyphSlot slot = schrift->glyph;
+    const FT_Bitmap& bild = slot->bitmap;
+    if (bild.width > 255 || bild.rows > 255) continue;
+
+    Glyphe g = {};
+    g.code = code;
+    g.breite = bild.width;
+    g.hoehe = bild.rows;
+    g.vorschub = (slot->advance.x + 32) >> 6;
+    g.dx = slot->bitmap_left;
+    g.top = slot->bitmap_top;
+    g.offset = deckung.size();
+    if (code == ' ') leerVorschub = g.vorschub;
+
+    if (g.top > oberlaenge) oberlaenge = g.top;
+    if (g.hoehe - g.top > unterlaenge) unterlaenge = g.hoehe - g.top;
+
+    // 8 Bit Deckung auf 4 Bit, niedriges Halbbyte zuerst
+    deckung.resize(deckung.size() + (g.breite * g.hoehe + 1) / 2, 0);
+    uint8_t* ziel = deckung.data() + g.offset;
+    int n = 0;
+    for (int y = 0; y < g.hoehe; y++) {
+      for (int x = 0; x < g.breite; x++, n++) {
+        uint8_t wert = (bild.buffer[y * bild.pitch + x] + 8) / 17;
+        if (n & 1) ziel[n >> 1] |= wert << 4;
+        else ziel[n >> 1] = wert;
+      }
+    }
+    glyphen.push_back(g);
+  }
+
+  int zeilenHoehe = oberlaenge + unterlaenge;
+  if (glyphen.empty() || zeilenHoehe > 255) {
+    fprintf(stderr, "Keine verwendbaren Glyphen\n");
+    return 1;
+  }
+  if (leerVorschub == 0) leerVorschub = zeilenHoehe / 3;
+
+  FILE* datei = fopen(argv[3], "wb");
+  if (datei == nullptr) {
+    fprintf(stderr, "%s kann nicht geschrieben werden\n", argv[3]);
+    return 1;
+  }
+  fwrite("WSA1", 1, 4, datei);
+  fputc(zeilenHoehe, datei);
+  fputc(leerVorschub, datei);
+  schreibeU16(datei, glyphen.size());
+  schreibeU32(datei, deckung.size());
+  for (const Glyphe& g : glyphen) {
+    schreibeU16(datei, g.code);
+    fputc(g.breite, datei);
+    fputc(g.hoehe, datei);
+    fputc(g.vorschub, datei);
+    fputc((uint8_t)g.dx, datei);
+    fputc((uint8_t)(int8_t)(oberlaenge - g.top), datei);
+    fputc(0, datei);
+    schreibeU32(datei, g.offset);
+  }
+  fwrite(deckung.data(), 1, deckung.size(), datei);
+  bool ok = fclose(datei) == 0;
+
+  printf("%s: %zu Glyphen, %d px Zeilenhoehe, %zu Bytes Deckung\n", argv[3], glyphen.size(), zeilenHoehe, deckung.size());
+  FT_Done_Face(schrift);
+  FT_Done_FreeType(bibliothek);
+  return ok ? 0 : 1;
+}
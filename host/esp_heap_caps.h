@@ -0,0 +1,19 @@
+/**
+ * host/esp_heap_caps.h
+ * Speicher mit Fähigkeiten (DMA, PSRAM) - auf dem Host normaler Heap
+ */
+
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <Arduino.h>
+
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_8BIT     (1 << 2)
+
+inline void* heap_caps_malloc(size_t groesse, uint32_t) { return malloc(groesse); }
+inline void heap_caps_free(void* zeiger) { free(zeiger); }
+
+#endif // HOST_ESP_HEAP_CAPS_H
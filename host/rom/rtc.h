@@ -0,0 +1,15 @@
+/**
+ * host/rom/rtc.h
+ * Reset-Gründe des ESP32-ROM für den Host-Build
+ */
+
+#ifndef HOST_ROM_RTC_H
+#define HOST_ROM_RTC_H
+
+#include <Arduino.h>
+
+#define POWERON_RESET 1
+
+inline int rtc_get_reset_reason(int) { return POWERON_RESET; }
+
+#endif // HOST_ROM_RTC_H